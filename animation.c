@@ -359,6 +359,7 @@ typedef struct
 
   short body;
   short shield;
+  short flash; // ticks left drawn in the hit flash colors
 } player;
 
 typedef struct
@@ -375,7 +376,26 @@ const short active_frames[] = {-1, 5, -1, -1}; // active frames for each attack
 short clouds_x = 320;
 
 #define NUM_PLAYERS 2
-player players[2] = {{640 / 4, GROUND_LEVEL, false, 0, 0, 0, 200, E, C2, 0, 3}, {640 * 3 / 4, GROUND_LEVEL, true, 0, 0, 0, 200, A, C1, 0, 3}};
+#define NUM_STATES 14 // entries in each Anim, indexed by player state
+#define HIT_FLASH_TICKS 3 // ticks a fighter flashes after taking a hit
+#define STAGE_LIST LIST_OFF // LIST_DEFER or LIST_CHASE: game_step draws through the display list
+player players[2] = {{640 / 4, GROUND_LEVEL, false, 0, 0, 0, 200, E, C2, 0, 3, 0}, {640 * 3 / 4, GROUND_LEVEL, true, 0, 0, 0, 200, A, C1, 0, 3, 0}};
+
+// Stage art drawn over the fighters, which never moves
+typedef struct
+{
+  const Bitmap *bm;
+  short x;
+  short y;
+  bool flip;
+} prop;
+const prop props[] = {{&P1, 264, 228, false}, {&P2, 372, 228, false}, {&stars2, 320, 480, false}, {&moon, 320, 480, false}, {&roof_decoration, 324, 480, false}, {&roof_decoration, 316, 480, true}};
+#define NUM_PROPS (sizeof(props) / sizeof(props[0]))
+
+// Save-under slot holding what is under each fighter as drawn, and the
+// rectangle saved; -1 when the fighter couldn't be saved under
+short under[NUM_PLAYERS] = {-1, -1};
+short under_rect[NUM_PLAYERS][4];
 
 void resetGame()
 {
@@ -389,6 +409,7 @@ void resetGame()
   players[0].hp = 200;
   players[0].body = 0;
   players[0].shield = 3;
+  players[0].flash = 0;
 
   players[1].x = 640 * 3 / 4;
   players[1].y = GROUND_LEVEL;
@@ -399,10 +420,14 @@ void resetGame()
   players[1].hp = 200;
   players[1].body = 0;
   players[1].shield = 3;
+  players[1].flash = 0;
 }
 
 
 
+// Each player's health bar and shields, {x0, y0, x1, y1}
+const short hud_box[NUM_PLAYERS][4] = {{12, 20, 228, 48}, {412, 20, 628, 48}};
+
 // Draw health bars for both players
 void drawHealthBars(char color)
 {
@@ -438,114 +463,370 @@ void drawShields(char color)
   }
 }
 
-void eraseShields(bool p1)
+// Draws the sprite three screen widths apart so whatever scrolls off one
+// edge comes back in at the other; the clip drops the off-screen copies
+void drawLooped(const Bitmap *bm, short x, short y, char color)
 {
-  if (p1)
-    for (short i = 0, x = 20; i < 3; i++, x += 52)
-    {
-      fillRect(x, 40, 40, 8, WHITE);
-    }
-  else
-    for (short i = 0, x = 476; i < 3; i++, x += 52)
-    {
-      fillRect(x, 40, 40, 8, WHITE);
-    }
+  drawBitmap(bm, x - 640, y, 0, color);
+  drawBitmap(bm, x, y, 0, color);
+  drawBitmap(bm, x + 640, y, 0, color);
 }
 
-void eraseHP(bool p1)
+void drawSprite(const Bitmap *bm, bool flip, short x, short y, char color)
 {
-  if (p1)
+  drawBitmap(bm, x, y, flip, color);
+}
+
+// Every color of a fighter that was just hit becomes red
+static const unsigned char hit_flash[16] = {RED, RED, RED, RED, RED, RED, RED, RED,
+                                            RED, RED, RED, RED, RED, RED, RED, RED};
+
+void drawFrame(player *p, char color)
+{
+  const Frame *head = &p->head_anim[p->state].f[p->frame];
+  const Frame *body = &p->body_anim[p->state].f[p->frame];
+  if (p->flash && color != WHITE)
   {
-    fillRect(20, 20, 200, 16, WHITE);
-    if (players[0].hp < 0)
-      players[0].hp = 0;
+    drawBitmapRemap(head->bm, p->x, p->y, p->flip, color, hit_flash);
+    drawBitmapRemap(body->bm, p->x, p->y, p->flip, color, hit_flash);
+    return;
   }
-  else
+  drawBitmapCode(head->bm, head->code, p->x, p->y, p->flip, color);
+  drawBitmapCode(body->bm, body->code, p->x, p->y, p->flip, color);
+}
+
+// A frame zoomed about its anchor, scale being 1 at int2fix15(1)
+void drawSpriteScaled(const Frame *f, short x, short y, bool flip, fix15 scale, char color)
+{
+  drawBitmapScaled(f->bm, x, y, flip, color, scale);
+}
+
+// Keep every frame of the fighters picked for this round in the SRAM
+// bitmap cache, so drawing them never waits on flash
+void pinFighters()
+{
+  unpinBitmaps();
+  for (int i = 0; i < NUM_PLAYERS; i++)
+    for (int s = 0; s < NUM_STATES; s++)
+      for (int f = 0; f < players[i].head_anim[s].len; f++)
+      {
+        pinBitmap(players[i].head_anim[s].f[f].bm);
+        pinBitmap(players[i].body_anim[s].f[f].bm);
+      }
+}
+
+// Grow the screen rectangle r = {x0, y0, x1, y1} (x1, y1 exclusive) to
+// cover the rectangle s
+void addRect(short r[4], const short s[4])
+{
+  if (s[0] < r[0]) r[0] = s[0];
+  if (s[1] < r[1]) r[1] = s[1];
+  if (s[2] > r[2]) r[2] = s[2];
+  if (s[3] > r[3]) r[3] = s[3];
+}
+
+// Grow r to cover a bitmap drawn at (x, y)
+void addBitmapRect(short r[4], const Bitmap *bm, short x, short y, bool flip)
+{
+  short s[4];
+  s[0] = x - (flip ? bm->fx : bm->ax);
+  s[1] = y - bm->ay;
+  s[2] = s[0] + bm->w * bm->cell;
+  s[3] = s[1] + bm->h * bm->cell;
+  addRect(r, s);
+}
+
+// Grow r to cover a player's current frame, head and body
+void addFrameRect(short r[4], const player *p)
+{
+  short s[4];
+  frameRect(&p->head_anim[p->state].f[p->frame], p->x, p->y, p->flip, s);
+  addRect(r, s);
+  frameRect(&p->body_anim[p->state].f[p->frame], p->x, p->y, p->flip, s);
+  addRect(r, s);
+}
+
+bool rectsOverlap(const short a[4], const short b[4])
+{
+  return a[0] < b[2] && b[0] < a[2] && a[1] < b[3] && b[1] < a[3];
+}
+
+// Step player p's picture to its next frame: clear the blocks that go
+// away, fill the ones that come in. d is what frameDelta() gave for p;
+// when that was NULL the frame has to be redrawn whole, and nothing is
+// drawn here
+void drawDelta(const player *p, const FrameDelta *d)
+{
+  if (d == NULL)
+    return;
+  const DeltaRun *r = d->runs;
+  for (short i = 0; i < d->clear + d->set; i++, r++)
   {
-    fillRect(620 - 200, 20, 200, 16, WHITE);
-    if (players[0].hp < 0)
-      players[0].hp = 0;
+    short x = p->flip ? p->x + 4 * (r->cx - r->n + 1) : p->x - 4 * r->cx;
+    fillRect(x, p->y - 4 * r->cy, 4 * r->n, 4, i < d->clear ? WHITE : BLACK);
   }
 }
 
-void drawLooped(const short arr[][2], short arr_len, short x, short y, char color)
+// Does r overlap a bitmap drawn at (x, y)?
+bool overBitmap(const short r[4], const Bitmap *bm, short x, short y, bool flip)
+{
+  short s[4] = {SCREEN_WIDTH, SCREEN_HEIGHT, 0, 0};
+  addBitmapRect(s, bm, x, y, flip);
+  return rectsOverlap(r, s);
+}
+
+// Does r overlap a bitmap drawn by drawLooped?
+bool overLooped(const short r[4], const Bitmap *bm, short x, short y)
 {
-  for (short i = 0; i < arr_len; i++)
+  return overBitmap(r, bm, x - 640, y, false) || overBitmap(r, bm, x, y, false) ||
+         overBitmap(r, bm, x + 640, y, false);
+}
+
+// The delta that takes player i from how it was drawn last tick (before[i])
+// to how it is now, or NULL if it has to be redrawn whole. A delta is only
+// used when nothing but the frame changed (and the fighter isn't flashing -
+// deltas are drawn in black), the new frame still lies inside what was
+// saved under it, nothing there is dirty or being put back for the other
+// player, and it is clear of everything but white backdrop - the rooftop,
+// the other player, the HUD, the P1/P2 markers, the clouds and the props -
+// which its cleared blocks, filled white, would wipe.
+const FrameDelta *frameDelta(int i, const player before[])
+{
+  static const DeltaRun no_runs[1];
+  static const FrameDelta unchanged = {no_runs, 0, 0};
+  const player *was = &before[i], *p = &players[i];
+  if (under[i] < 0 || p->flash || was->flash || p->x != was->x || p->y != was->y || p->flip != was->flip ||
+      p->state != was->state || p->head_anim != was->head_anim || p->body_anim != was->body_anim)
+    return NULL;
+
+  const FrameDelta *d = NULL;
+  if (p->frame == was->frame)
+    d = &unchanged;
+  else if (p->frame == (was->frame + 1) % p->head_anim[p->state].len)
   {
-    if (x - arr[i][0] + 4 > 640)
-      fillRect(x - arr[i][0] - 640, y - arr[i][1], 4, 4, color);
-    else
-      fillRect(x - arr[i][0], y - arr[i][1], 4, 4, color);
+    for (unsigned k = 0; k < sizeof(anim_deltas) / sizeof(anim_deltas[0]); k++)
+      if (anim_deltas[k].head == p->head_anim && anim_deltas[k].body == p->body_anim &&
+          anim_deltas[k].states[p->state] != NULL)
+        d = &anim_deltas[k].states[p->state][was->frame];
   }
+  if (d == NULL || d->runs == NULL)
+    return NULL;
+
+  short r[4] = {SCREEN_WIDTH, SCREEN_HEIGHT, 0, 0};
+  short other[4] = {SCREEN_WIDTH, SCREEN_HEIGHT, 0, 0};
+  addFrameRect(r, p);
+  if (r[0] < under_rect[i][0] || r[1] < under_rect[i][1] || r[2] > under_rect[i][2] || r[3] > under_rect[i][3])
+    return NULL;
+  memcpy(r, under_rect[i], sizeof(r));
+  addFrameRect(other, &players[!i]);
+  if (under[!i] >= 0)
+    addRect(other, under_rect[!i]);
+  if (isDirty(r[0], r[1], r[2] - r[0], r[3] - r[1]) || rectsOverlap(r, other) ||
+      overBitmap(r, &rooftop, 322, 480, false) || overBitmap(r, &rooftop, 318, 480, true) ||
+      overBitmap(r, &P1, players[0].x, players[0].y, false) ||
+      overBitmap(r, &P2, players[1].x, players[1].y, false) ||
+      rectsOverlap(r, hud_box[0]) || rectsOverlap(r, hud_box[1]) || overLooped(r, &clouds3, clouds_x, 480))
+    return NULL;
+  for (unsigned k = 0; k < NUM_PROPS; k++)
+    if (overBitmap(r, props[k].bm, props[k].x, props[k].y, props[k].flip))
+      return NULL;
+  return d;
 }
 
-void drawSprite(const short arr[][2], short arr_len, bool flip, short x, short y, char color)
+// The layers of the fight screen, drawn as far as the clip rectangle
+void drawBackdrop()
 {
-  if (!flip)
-    for (short i = 0; i < arr_len; i++)
-      fillRect(x - arr[i][0], y - arr[i][1], 4, 4, color);
-  else
-    for (short i = 0; i < arr_len; i++)
-      fillRect(x + arr[i][0], y - arr[i][1], 4, 4, color);
+  fillRect(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, WHITE);
+  drawSprite(&rooftop, false, 322, 480, BLACK);
+  drawSprite(&rooftop, true, 318, 480, BLACK);
 }
 
-void drawFrame(player *p, char color)
+void drawProps()
+{
+  for (unsigned k = 0; k < NUM_PROPS; k++)
+    drawSprite(props[k].bm, props[k].flip, props[k].x, props[k].y, BLACK);
+}
+
+void drawMarkers()
+{
+  drawSprite(&P1, false, players[0].x, players[0].y, BLACK);
+  drawSprite(&P2, false, players[1].x, players[1].y, BLACK);
+}
+
+void drawClouds()
+{
+  drawLooped(&clouds3, clouds_x, 480, BLACK);
+  drawLooped(&clouds3_inside, clouds_x, 480, WHITE);
+}
+
+void drawHUD()
 {
-  drawSprite(p->head_anim[p->state].f[p->frame].p, p->head_anim[p->state].f[p->frame].len, p->flip, p->x, p->y, color);
-  drawSprite(p->body_anim[p->state].f[p->frame].p, p->body_anim[p->state].f[p->frame].len, p->flip, p->x, p->y, color);
+  drawHealthBars(BLACK);
+  drawShields(BLACK);
+}
+
+// Layers of the fight screen apart from the fighters, back to front. The
+// still ones are drawn once a fight and packed into stage_background,
+// which stands in for them after that if unpacking it is the quicker; the
+// others are drawn over it wherever the screen is dirty. Each counts the
+// time spent drawing it.
+typedef struct
+{
+  const char *name;
+  void (*draw)(void);
+  bool still; // never changes during a fight
+  bool over;  // drawn over the fighters
+  unsigned int draws;
+  unsigned int us;
+} layer;
+layer layers[] = {{"backdrop", drawBackdrop, true, false}, {"props", drawProps, true, true},
+                  {"markers", drawMarkers, false, true}, {"clouds", drawClouds, false, true},
+                  {"hud", drawHUD, false, true}};
+#define NUM_LAYERS (sizeof(layers) / sizeof(layers[0]))
+
+// The still layers packed, or data NULL if they didn't fit or are quicker
+// to draw
+#define STAGE_BACKGROUND_BYTES 4096
+unsigned char stage_background_data[STAGE_BACKGROUND_BYTES];
+PackedImage stage_background;
+unsigned int background_draws, background_us;
+unsigned int still_us, unpack_us; // the whole screen of still layers, drawn and unpacked
+unsigned int steps, step_us;       // game_step calls this fight and the time in them
+
+void drawLayer(int k)
+{
+  uint32_t t = time_us_32();
+  layers[k].draw();
+  layers[k].us += time_us_32() - t;
+  layers[k].draws++;
+}
+
+// Draw what is over the fighters on the fight screen
+void drawOverlays()
+{
+  for (unsigned k = 0; k < NUM_LAYERS; k++)
+    if (layers[k].over)
+      drawLayer(k);
+}
+
+// Draw the fight screen as it is now without the fighters, as far as the
+// clip rectangle - which is how the dirty rectangles get redrawn: one copy
+// of the packed still layers, then the rest.
+// Fighters are not erased from here but from their save-under copies,
+// which are a plain copy back where the packed image is a decode per
+// rectangle. And when resetStage found the packed copy slower than just
+// drawing the still layers, there is none and the layers are drawn
+void drawStage()
+{
+  if (stage_background.data != NULL)
+  {
+    uint32_t t = time_us_32();
+    drawPackedImage(&stage_background, 0, 0);
+    background_us += time_us_32() - t;
+    background_draws++;
+  }
+  for (unsigned k = 0; k < NUM_LAYERS; k++)
+    if (!layers[k].still || stage_background.data == NULL)
+      drawLayer(k);
 }
 
+// Print what each layer cost over the fight - only the recording, with
+// the display list on - then the time a tick and the bitmap cache lookups
+void reportLayers()
+{
+  printf("still layers %u us, packed %u bytes, unpacked %u us%s\n", still_us, stage_background.size, unpack_us,
+         stage_background.data != NULL ? "" : " - not used");
+  printf("%-9s %-6s %u draws %u us\n", "packed", "", background_draws, background_us);
+  for (unsigned k = 0; k < NUM_LAYERS; k++)
+    printf("%-9s %-6s %u draws %u us\n", layers[k].name, layers[k].still ? "still" : "", layers[k].draws, layers[k].us);
+  printf("%u ticks, %u us a tick, bitmap cache %u hits %u misses\n", steps, steps ? step_us / steps : 0,
+         bitmap_cache_hits, bitmap_cache_misses);
+  if (STAGE_LIST != LIST_OFF)
+    printf("display list %u commands, %u fills merged, %u flushes\n", list_commands, list_merged, list_flushes);
+}
+
+// Draw player i over a copy of what is under it, kept in under[i] to erase
+// it with, then what goes over the fighters again where it covers it
+void drawFighter(int i)
+{
+  short r[4] = {SCREEN_WIDTH, SCREEN_HEIGHT, 0, 0};
+  addFrameRect(r, &players[i]);
+  under[i] = saveUnder(r[0], r[1], r[2] - r[0], r[3] - r[1]);
+  memcpy(under_rect[i], r, sizeof(r));
+  drawFrame(&players[i], BLACK);
+  setClipRect(r[0], r[1], r[2] - r[0], r[3] - r[1]);
+  drawOverlays();
+  resetClip();
+}
+
+// Start the fight screen over: draw the still layers and pack them into
+// stage_background, and have the next game_step draw all of it. The
+// packed copy is only kept if unpacking it beats drawing the layers
+void resetStage()
+{
+  for (int i = 0; i < NUM_PLAYERS; i++)
+  {
+    dropUnder(under[i]);
+    under[i] = -1;
+  }
+  for (unsigned k = 0; k < NUM_LAYERS; k++)
+    layers[k].draws = layers[k].us = 0;
+  background_draws = background_us = 0;
+  list_commands = list_merged = list_flushes = 0;
+  steps = step_us = 0;
+  bitmap_cache_hits = bitmap_cache_misses = 0;
+
+  resetClip();
+  uint32_t t = time_us_32();
+  for (unsigned k = 0; k < NUM_LAYERS; k++)
+    if (layers[k].still)
+      layers[k].draw();
+  still_us = time_us_32() - t;
+  stage_background.size = 0;
+  stage_background.data = NULL;
+  unpack_us = 0;
+  if (packRect(&stage_background, 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, stage_background_data, STAGE_BACKGROUND_BYTES) >= 0)
+  {
+    t = time_us_32();
+    drawPackedImage(&stage_background, 0, 0);
+    unpack_us = time_us_32() - t;
+    if (unpack_us >= still_us)
+      stage_background.data = NULL;
+  }
+  markDirty(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+}
+
+// Title screen halves by [player][head: A, E][result: none, lost, won][body: C1, C2]
+const PackedImage *const title_halves[2][2][3][2] = {
+  {{{&title_A_full_c1_l, &title_A_full_c2_l}, {&title_A_lose_c1_l, &title_A_lose_c2_l}, {&title_A_win_c1_l, &title_A_win_c2_l}},
+   {{&title_E_full_c1_l, &title_E_full_c2_l}, {&title_E_lose_c1_l, &title_E_lose_c2_l}, {&title_E_win_c1_l, &title_E_win_c2_l}}},
+  {{{&title_A_full_c1_r, &title_A_full_c2_r}, {&title_A_lose_c1_r, &title_A_lose_c2_r}, {&title_A_win_c1_r, &title_A_win_c2_r}},
+   {{&title_E_full_c1_r, &title_E_full_c2_r}, {&title_E_lose_c1_r, &title_E_lose_c2_r}, {&title_E_win_c1_r, &title_E_win_c2_r}}}};
+
 void drawTitleScreen(bool ready)
 {
-  fillRect(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, BLACK); // set background to black
-  short outline_off = 68;
-  for(short i=0;i<2;i++)
+  // Each half is one packed image of that player's titles and outlines,
+  // the winner's last as it reaches over the middle
+  for(short k=0;k<2;k++)
   {
-    if(players[i].head_anim==A)
-    {
-      if(winner<0)
-        drawSprite(title_A_full, 2871, i==1, SCREEN_MIDLINE_X, SCREEN_HEIGHT+8, WHITE);
-      else if(winner!=i)
-        drawSprite(title_A_lose, 1969, i==1, SCREEN_MIDLINE_X, SCREEN_HEIGHT+8, WHITE);
-      else
-        drawSprite(title_A_win, 2807, i==1, SCREEN_MIDLINE_X, SCREEN_HEIGHT+8, WHITE);
-      drawSprite(title_A, 74, i==1, SCREEN_MIDLINE_X, SCREEN_HEIGHT, WHITE);
-      drawSprite(A_Idle_0, 119, i==1,i==0?outline_off:SCREEN_WIDTH-outline_off, SCREEN_HEIGHT, BLACK);
-    }
-    else
-    {
-      if(winner<0)
-        drawSprite(title_E_full, 2070, i==1, SCREEN_MIDLINE_X, SCREEN_HEIGHT+8, WHITE);
-      else if(winner!=i)
-        drawSprite(title_E_lose, 1597, i==1, SCREEN_MIDLINE_X, SCREEN_HEIGHT+8, WHITE);
-      else
-        drawSprite(title_E_win, 3156, i==1, SCREEN_MIDLINE_X, SCREEN_HEIGHT+8, WHITE);
-      drawSprite(title_E, 70, i==1, SCREEN_MIDLINE_X, SCREEN_HEIGHT, WHITE);
-      drawSprite(E_Idle_0, 72, i==1, i==0?outline_off:SCREEN_WIDTH-outline_off, SCREEN_HEIGHT, BLACK);
-    }
-    if(players[i].body_anim==C1)
-    {
-      drawSprite(title_c1, 446, i==1, SCREEN_MIDLINE_X, SCREEN_HEIGHT, WHITE);
-      drawSprite(C1_Idle_0, 141, i==1, i==0?outline_off:SCREEN_WIDTH-outline_off, SCREEN_HEIGHT, BLACK);
-    }
-    else
-    {
-      drawSprite(title_c2, 407, i==1, SCREEN_MIDLINE_X, SCREEN_HEIGHT, WHITE);
-      drawSprite(C2_Idle_0, 147, i==1, i==0 ? outline_off:SCREEN_WIDTH-outline_off, SCREEN_HEIGHT, BLACK);
-    }
-      
+    short i = winner==0 ? 1-k : k;
+    short head = players[i].head_anim==A ? 0 : 1;
+    short result = winner<0 ? 0 : (winner!=i ? 1 : 2);
+    short body = players[i].body_anim==C1 ? 0 : 1;
+    const PackedImage *half = title_halves[i][head][result][body];
+    drawPackedImage(half, i==0 ? 0 : SCREEN_WIDTH-half->w, 0);
   }
   if(ready)
   {
-    drawSprite(title_ready, 1236, false, SCREEN_MIDLINE_X, SCREEN_HEIGHT, WHITE);
-    drawSprite(title_ready_in, 428, false, SCREEN_MIDLINE_X, SCREEN_HEIGHT, BLACK);
-    drawSprite(key_in,140, false, SCREEN_MIDLINE_X, SCREEN_HEIGHT, BLACK);
-    drawSprite(key_in,140, true, SCREEN_MIDLINE_X-4, SCREEN_HEIGHT, BLACK);
+    drawSprite(&title_ready, false, SCREEN_MIDLINE_X, SCREEN_HEIGHT, WHITE);
+    drawSprite(&title_ready_in, false, SCREEN_MIDLINE_X, SCREEN_HEIGHT, BLACK);
+    drawSprite(&key_in, false, SCREEN_MIDLINE_X, SCREEN_HEIGHT, BLACK);
+    drawSprite(&key_in, true, SCREEN_MIDLINE_X-4, SCREEN_HEIGHT, BLACK);
   }
   else
   {
-    drawSprite(title, 1235, false, SCREEN_MIDLINE_X, SCREEN_HEIGHT, WHITE);
-    drawSprite(title_vs, 93, false, SCREEN_MIDLINE_X, SCREEN_HEIGHT, WHITE);
+    drawSprite(&title, false, SCREEN_MIDLINE_X, SCREEN_HEIGHT, WHITE);
+    drawSprite(&title_vs, false, SCREEN_MIDLINE_X, SCREEN_HEIGHT, WHITE);
   }
 }
 
@@ -554,11 +835,11 @@ void drawPauseScreen()
   // drawTitleScreen(true);
   // drawHealthBars(WHITE);
   // drawShields(WHITE);
-  drawSprite(paused, 437, false,SCREEN_MIDLINE_X,SCREEN_HEIGHT,BLACK);
-  drawSprite(key_out, 48, false,SCREEN_MIDLINE_X,SCREEN_HEIGHT,BLACK);
-  drawSprite(key_out, 48, true,SCREEN_MIDLINE_X,SCREEN_HEIGHT,BLACK);
-  drawSprite(key_in, 140, false,SCREEN_MIDLINE_X,SCREEN_HEIGHT,WHITE);
-  drawSprite(key_in, 140, true,SCREEN_MIDLINE_X,SCREEN_HEIGHT,WHITE);
+  drawSprite(&paused, false,SCREEN_MIDLINE_X,SCREEN_HEIGHT,BLACK);
+  drawSprite(&key_out, false,SCREEN_MIDLINE_X,SCREEN_HEIGHT,BLACK);
+  drawSprite(&key_out, true,SCREEN_MIDLINE_X,SCREEN_HEIGHT,BLACK);
+  drawSprite(&key_in, false,SCREEN_MIDLINE_X,SCREEN_HEIGHT,WHITE);
+  drawSprite(&key_in, true,SCREEN_MIDLINE_X,SCREEN_HEIGHT,WHITE);
 }
 
 bool isOverlapping(short h1, short h2, short attacker)
@@ -807,9 +1088,12 @@ void handle_input(short i)
 
 void game_step()
 {
+  player before[NUM_PLAYERS] = {players[0], players[1]}; // as drawn last tick
+  short clouds_before = clouds_x;
+  for (int i = 0; i < NUM_PLAYERS; i++)
+    if (players[i].flash > 0)
+      players[i].flash--;
 
-  drawHealthBars(BLACK);
-  drawShields(BLACK);
   // drawRect(80, 0 ,640-160, 480, BLACK);
 
   players[0].body = players[0].state == 11 ? -1 : players[0].state == 8 || players[0].state == 9 ? 5
@@ -817,17 +1101,10 @@ void game_step()
   players[1].body = players[1].state == 11 ? -1 : players[1].state == 8 || players[1].state == 9 ? 5
                                                                                                  : 0; // none if dead, crouch body if crouch OR crouch attack, stand body otherwise
 
-  drawSprite(P1, 13, false, players[0].x, players[0].y, WHITE); // erase previous frame UI
-  drawSprite(P2, 15, false, players[1].x, players[1].y, WHITE); // erase previous frame UI
-  // drawLooped(clouds, 479, clouds_x, 480, WHITE); //erase previous clouds
-  drawLooped(clouds3, 403, clouds_x, 480, WHITE); // erase previous clouds
   clouds_x++;
   if (clouds_x >= 960)
     clouds_x = 320;
 
-  drawFrame(&players[0], WHITE); // player 0, erase previous frame
-  drawFrame(&players[1], WHITE); // player 1, erase previous frame
-
   for (int i = 0; i < NUM_PLAYERS; i++)
   {
     switch (players[i].state)
@@ -894,7 +1171,6 @@ void game_step()
             players[!i].shield--;
             if (players[i].shield < 3)
               players[i].shield++;
-            eraseShields(!i == 0);
             players[!i].state = 13; // stand guard
             players[!i].frame = 0;
           }
@@ -905,7 +1181,7 @@ void game_step()
             players[!i].frame = 0;
             players[!i].state = 4; // hurt state
             players[!i].hp -= 20;  // hurt state
-            eraseHP(!i == 0);
+            players[!i].flash = HIT_FLASH_TICKS;
           }
         }
         else{
@@ -940,7 +1216,6 @@ void game_step()
             players[!i].shield--;
             if (players[i].shield < 3)
               players[i].shield++;
-            eraseShields(!i == 0);
             players[!i].state = 12; // crouch guard
             players[!i].frame = 0;
           }
@@ -951,7 +1226,7 @@ void game_step()
             players[!i].frame = 0;
             players[!i].state = 4; // hurt state
             players[!i].hp -= 10;  // hurt state
-            eraseHP(!i == 0);
+            players[!i].flash = HIT_FLASH_TICKS;
           }
         }
         else{
@@ -978,7 +1253,7 @@ void game_step()
           players[!i].frame = 0;
           players[!i].state = 4; // hurt state
           players[!i].hp -= 20;  // hurt state
-          eraseHP(!i == 0);
+          players[!i].flash = HIT_FLASH_TICKS;
         }
         else{
           dma_start_channel_mask(1u << whooshctrl_chan) ;
@@ -1064,7 +1339,6 @@ void game_step()
             players[!i].shield--;
             if (players[i].shield < 3)
               players[i].shield++;
-            eraseShields(!i == 0);
             players[!i].state = 6; // fall state
             players[!i].frame = 0; // fall state
             players[i].state = 5;  // jump state
@@ -1077,7 +1351,7 @@ void game_step()
             players[!i].frame = 0;
             players[!i].state = 4; // hurt state
             players[!i].hp -= 20;  // hurt state
-            eraseHP(!i == 0);
+            players[!i].flash = HIT_FLASH_TICKS;
           }
         }
       }
@@ -1119,20 +1393,57 @@ void game_step()
       players[i].flip = players[i].x > players[!i].x;
   }
 
-  drawFrame(&players[0], BLACK); // player i, draw current frame
-  drawFrame(&players[1], BLACK); // player i, draw current frame
+  // Mark what looks different from last tick dirty, by going through the
+  // drawing of how it was and how it is without drawing
+  trackDirty(DIRTY_ONLY);
+  for (int i = 0; i < NUM_PLAYERS; i++)
+    if (players[i].hp != before[i].hp || players[i].shield != before[i].shield)
+      fillRect(hud_box[i][0], hud_box[i][1], hud_box[i][2] - hud_box[i][0], hud_box[i][3] - hud_box[i][1], BLACK);
+  for (int i = 0; i < NUM_PLAYERS; i++)
+    if (players[i].x != before[i].x || players[i].y != before[i].y)
+    {
+      drawSprite(i == 0 ? &P1 : &P2, false, before[i].x, before[i].y, BLACK);
+      drawSprite(i == 0 ? &P1 : &P2, false, players[i].x, players[i].y, BLACK);
+    }
+  drawLooped(&clouds3, clouds_before, 480, BLACK);
+  drawLooped(&clouds3, clouds_x, 480, BLACK);
 
-  drawSprite(P1, 13, false, players[0].x, players[0].y, BLACK);
-  drawSprite(P2, 15, false, players[1].x, players[1].y, BLACK);
-  drawSprite(P1, 13, false, 264, 228, BLACK);
-  drawSprite(P2, 15, false, 372, 228, BLACK);
+  // A fighter that couldn't be saved under is erased by redrawing the
+  // stage there
+  for (int i = 0; i < NUM_PLAYERS; i++)
+    if (under[i] < 0)
+      drawFrame(&before[i], BLACK);
+  trackDirty(DIRTY_OFF);
+  deferDraws(STAGE_LIST);
+
+  // Fighters that only stepped a frame, clear of all that, draw just the
+  // blocks that changed. The rest are taken off the screen by putting back
+  // what was under them, the last drawn first, and drawn again at the end.
+  const FrameDelta *delta[NUM_PLAYERS];
+  for (int i = 0; i < NUM_PLAYERS; i++)
+    delta[i] = frameDelta(i, before);
+  for (int i = NUM_PLAYERS - 1; i >= 0; i--)
+    if (delta[i] == NULL)
+    {
+      restoreUnder(under[i]);
+      under[i] = -1;
+    }
+  for (int i = 0; i < NUM_PLAYERS; i++)
+    drawDelta(&players[i], delta[i]);
 
-  drawSprite(stars2, 15, false, 320, 480, BLACK);
-  drawSprite(moon, 171, false, 320, 480, BLACK);
-  drawLooped(clouds3, 403, clouds_x, 480, BLACK);
-  drawLooped(clouds3_inside, 515, clouds_x, 480, WHITE);
-  drawSprite(roof_decoration, 39, false, 324, 480, BLACK);
-  drawSprite(roof_decoration, 39, true, 316, 480, BLACK);
+  // Redraw the dirty rectangles, then the fighters over them
+  short rects[DIRTY_RECTS][4];
+  short n = takeDirtyRects(rects);
+  for (short k = 0; k < n; k++)
+  {
+    setClipRect(rects[k][0], rects[k][1], rects[k][2] - rects[k][0], rects[k][3] - rects[k][1]);
+    drawStage();
+  }
+  resetClip();
+  for (int i = 0; i < NUM_PLAYERS; i++)
+    if (delta[i] == NULL)
+      drawFighter(i);
+  deferDraws(LIST_OFF);
 }
 // Animation on core 0
 static PT_THREAD(protothread_anim(struct pt *pt))
@@ -1210,16 +1521,16 @@ static PT_THREAD(protothread_core1(struct pt *pt))
     {
       short p1_offset = 72;
       if(p1_key_prev>=0)
-        drawSprite(key_sprites[p1_key_prev].p, key_sprites[p1_key_prev].len, false, SCREEN_MIDLINE_X-p1_offset, SCREEN_HEIGHT, BLACK);
+        drawSprite(key_sprites[p1_key_prev].bm, false, SCREEN_MIDLINE_X-p1_offset, SCREEN_HEIGHT, BLACK);
       if(p2_key_prev>=0)
-        drawSprite(key_sprites[p2_key_prev].p, key_sprites[p2_key_prev].len, false, SCREEN_MIDLINE_X, SCREEN_HEIGHT, BLACK);
+        drawSprite(key_sprites[p2_key_prev].bm, false, SCREEN_MIDLINE_X, SCREEN_HEIGHT, BLACK);
         
       short p1_key = getKey(true);
       short p2_key = getKey(false);
 
       if(p1_key>=0)
       {
-        drawSprite(key_sprites[p1_key].p, key_sprites[p1_key].len, false, SCREEN_MIDLINE_X-p1_offset, SCREEN_HEIGHT, WHITE);
+        drawSprite(key_sprites[p1_key].bm, false, SCREEN_MIDLINE_X-p1_offset, SCREEN_HEIGHT, WHITE);
         if (p1_key!=p1_key_prev)
         {
           trigger_effect(button_freq,1);
@@ -1254,7 +1565,7 @@ static PT_THREAD(protothread_core1(struct pt *pt))
         
       if(p2_key>=0)
       {
-        drawSprite(key_sprites[p2_key].p, key_sprites[p2_key].len, false, SCREEN_MIDLINE_X, SCREEN_HEIGHT, WHITE);
+        drawSprite(key_sprites[p2_key].bm, false, SCREEN_MIDLINE_X, SCREEN_HEIGHT, WHITE);
         if(p2_key!=p2_key_prev)
         {
           trigger_effect(button_freq,1);
@@ -1294,9 +1605,8 @@ static PT_THREAD(protothread_core1(struct pt *pt))
       if(p1_key>0 && p1_key<7 && p1_key==p2_key) //start game when two players are pressing the same key in range [1,6]
       {
         ui_state = 2;
-        fillRect(0, 0, 640, 480, WHITE);
-        drawSprite(rooftop, 741, false, 322, 480, BLACK);
-        drawSprite(rooftop, 741, true, 318, 480, BLACK);
+        pinFighters();
+        resetStage();
         dma_start_channel_mask(1u << fightctrl_chan) ;
        // dma_start_channel_mask(1u << shieldctrl_chan) ;
         // trigger_effect(placeholder_freq,16);
@@ -1309,11 +1619,17 @@ static PT_THREAD(protothread_core1(struct pt *pt))
       break;
     }
     case 2:
+    {
+      uint32_t t = time_us_32();
       game_step(); // game step
+      step_us += time_us_32() - t;
+      steps++;
       break;
+    }
 
     case 3: //win state
       winner = players[0].hp<=0?1:0;
+      reportLayers();
       drawTitleScreen(true);
       resetGame();
       ui_state = -2; //go back to ready screen (will show winner there)
@@ -1323,17 +1639,17 @@ static PT_THREAD(protothread_core1(struct pt *pt))
       drawPauseScreen();
       short p1_offset = 68;
       if(p1_key_prev>=0)
-        drawSprite(key_sprites[p1_key_prev].p, key_sprites[p1_key_prev].len, false, SCREEN_MIDLINE_X-p1_offset, SCREEN_HEIGHT, WHITE);
+        drawSprite(key_sprites[p1_key_prev].bm, false, SCREEN_MIDLINE_X-p1_offset, SCREEN_HEIGHT, WHITE);
       if(p2_key_prev>=0)
-        drawSprite(key_sprites[p2_key_prev].p, key_sprites[p2_key_prev].len, false, SCREEN_MIDLINE_X, SCREEN_HEIGHT, WHITE);
+        drawSprite(key_sprites[p2_key_prev].bm, false, SCREEN_MIDLINE_X, SCREEN_HEIGHT, WHITE);
         
       short p1_key = getKey(true);
       short p2_key = getKey(false);
 
       if(p1_key>=0)
-        drawSprite(key_sprites[p1_key].p, key_sprites[p1_key].len, false, SCREEN_MIDLINE_X-p1_offset, SCREEN_HEIGHT, BLACK);
+        drawSprite(key_sprites[p1_key].bm, false, SCREEN_MIDLINE_X-p1_offset, SCREEN_HEIGHT, BLACK);
       if(p2_key>=0)
-        drawSprite(key_sprites[p2_key].p, key_sprites[p2_key].len, false, SCREEN_MIDLINE_X, SCREEN_HEIGHT, BLACK);
+        drawSprite(key_sprites[p2_key].bm, false, SCREEN_MIDLINE_X, SCREEN_HEIGHT, BLACK);
 
       p1_key_prev = p1_key;
       p2_key_prev = p2_key;
@@ -1342,9 +1658,8 @@ static PT_THREAD(protothread_core1(struct pt *pt))
       if(p1_key>0 && p1_key<7 && p1_key==p2_key) //start game when two players are pressing the same key in range [1,6]
       {
         ui_state = 2;
-        fillRect(0, 0, 640, 480, WHITE);
-        drawSprite(rooftop, 741, false, 322, 480, BLACK);
-        drawSprite(rooftop, 741, true, 318, 480, BLACK);
+        pinFighters();
+        resetStage();
         dma_start_channel_mask(1u << fightctrl_chan) ;
         // trigger_effect(placeholder_freq,16);
 
@@ -0,0 +1,169 @@
+/**
+ * Host benchmark for fillTriangle / fillConvexPoly
+ *
+ * Checks the scanline rasterizer against a brute-force test of every pixel
+ * (same fill rule: vertices on pixel corners, left edges in, right and
+ * bottom edges out), then times triangles and polygons of a few sizes and
+ * reports spans (rows written) and pixels per microsecond.
+ *
+ * BUILD/RUN (from the project directory, on the development machine)
+ *  cc -O2 -I. -Ibench/sdk_stub -o bench_poly bench/bench_poly.c vga16_graphics.c -lm
+ *  ./bench_poly
+ *
+ * The numbers are desktop numbers - use them to compare sizes and changes,
+ * not as RP2040 timings.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+#include <time.h>
+#include "vga16_graphics.h"
+
+extern unsigned char vga_data_array[] ;
+#define TXCOUNT 153600
+
+static unsigned char reference[TXCOUNT] ;
+
+// Current clip rectangle (vga16_graphics.c)
+extern short clip_x0, clip_y0, clip_x1, clip_y1 ;
+
+static double now_us(void) {
+    struct timespec t ;
+    clock_gettime(CLOCK_MONOTONIC, &t) ;
+    return t.tv_sec * 1e6 + t.tv_nsec / 1e3 ;
+}
+
+static void ref_pixel(int x, int y, char color) {
+    int pixel = (640 * y) + x ;
+    if (pixel & 1) reference[pixel>>1] = (reference[pixel>>1] & 0x0F) | (color << 4) ;
+    else reference[pixel>>1] = (reference[pixel>>1] & 0xF0) | color ;
+}
+
+// Brute force: on row y every edge that spans it (ya <= y < yb) gives a
+// crossing, and the pixels from the leftmost crossing (inclusive) to the
+// rightmost (exclusive) are in. Compared exactly with cross-multiplication.
+static void ref_poly(const short pts[][2], int n, char color) {
+    for (int y = 0; y < 480; y++) {
+        for (int x = 0; x < 640; x++) {
+            int edges = 0, ok_l = 0, ok_r = 0 ;
+            for (int i = 0; i < n; i++) {
+                int xa = pts[i][0], ya = pts[i][1] ;
+                int xb = pts[(i + 1) % n][0], yb = pts[(i + 1) % n][1] ;
+                if (ya > yb) {
+                    int t = xa ; xa = xb ; xb = t ;
+                    t = ya ; ya = yb ; yb = t ;
+                }
+                if (y < ya || y >= yb) continue ;
+                edges++ ;
+                // sign of (x - crossing) * dy
+                long long d = (long long)(x - xa) * (yb - ya) - (long long)(y - ya) * (xb - xa) ;
+                if (d >= 0) ok_l++ ;   // at or right of this crossing
+                if (d < 0) ok_r++ ;    // strictly left of this crossing
+            }
+            if (edges == 2 && ok_l >= 1 && ok_r >= 1) ref_pixel(x, y, color) ;
+        }
+    }
+}
+
+static void random_convex(short pts[][2], int n, int cx, int cy, int r) {
+    // Points on a circle at sorted angles are always convex
+    double a[16] ;
+    for (int i = 0; i < n; i++) a[i] = (rand() / (double)RAND_MAX) * 6.2831853 ;
+    for (int i = 1; i < n; i++) {
+        for (int j = i; j > 0 && a[j] < a[j - 1]; j--) {
+            double t = a[j] ; a[j] = a[j - 1] ; a[j - 1] = t ;
+        }
+    }
+    for (int i = 0; i < n; i++) {
+        pts[i][0] = cx + (short)(r * cos(a[i])) ;
+        pts[i][1] = cy + (short)(r * sin(a[i])) ;
+    }
+}
+
+// Spans written by the last run()
+static long count_spans ;
+
+// Fill reps convex n-gons of radius r, returns the elapsed microseconds
+static double run(int n, int r, int reps) {
+    short pts[16][2] ;
+    count_spans = 0 ;
+    srand(1) ;
+    // Pre-build the shapes so only the fill is timed
+    short (*all)[16][2] = malloc(sizeof(*all) * 256) ;
+    for (int i = 0; i < 256; i++) {
+        random_convex(all[i], n, r + rand() % (640 - 2 * r), r + rand() % (480 - 2 * r), r) ;
+    }
+    double t0 = now_us() ;
+    for (int i = 0; i < reps; i++) {
+        fillConvexPoly((const short (*)[2])all[i & 255], n, i & 15) ;
+    }
+    double dt = now_us() - t0 ;
+    // Count what was drawn (outside the timed loop)
+    for (int i = 0; i < 256; i++) {
+        memcpy(pts, all[i], sizeof(pts)) ;
+        int ymin = 480, ymax = 0 ;
+        for (int k = 0; k < n; k++) {
+            if (pts[k][1] < ymin) ymin = pts[k][1] ;
+            if (pts[k][1] > ymax) ymax = pts[k][1] ;
+        }
+        count_spans += ymax - ymin ;
+    }
+    count_spans = count_spans * reps / 256 ;
+    free(all) ;
+    return dt ;
+}
+
+int main() {
+    // Random triangles and convex polygons, partly off screen, must match
+    // the brute-force rule exactly
+    int same = 1 ;
+    srand(7) ;
+    for (int i = 0; i < 300 && same; i++) {
+        short pts[8][2] ;
+        int n = 3 + (i % 6) ;
+        random_convex(pts, n, rand() % 800 - 80, rand() % 640 - 80, 2 + rand() % 200) ;
+        if (i & 1) setClipRect(rand() % 400, rand() % 300, rand() % 400, rand() % 300) ;
+        else resetClip() ;
+        memset(vga_data_array, 0, TXCOUNT) ;
+        memset(reference, 0, TXCOUNT) ;
+        if (n == 3) fillTriangle(pts[0][0], pts[0][1], pts[1][0], pts[1][1], pts[2][0], pts[2][1], 9) ;
+        else fillConvexPoly((const short (*)[2])pts, n, 9) ;
+        // Brute force over the whole screen, then cut it down to the clip
+        ref_poly((const short (*)[2])pts, n, 9) ;
+        for (int y = 0; y < 480; y++) {
+            for (int x = 0; x < 640; x++) {
+                if (x < clip_x0 || x >= clip_x1 || y < clip_y0 || y >= clip_y1) ref_pixel(x, y, 0) ;
+            }
+        }
+        same = memcmp(reference, vga_data_array, TXCOUNT) == 0 ;
+    }
+    resetClip() ;
+
+    // A rectangle given as corners fills exactly what fillRect does
+    static const short box[4][2] = {{100, 50}, {173, 50}, {173, 91}, {100, 91}} ;
+    memset(vga_data_array, 0, TXCOUNT) ;
+    fillRect(100, 50, 73, 41, 5) ;
+    memcpy(reference, vga_data_array, TXCOUNT) ;
+    memset(vga_data_array, 0, TXCOUNT) ;
+    fillConvexPoly(box, 4, 5) ;
+    same = same && (memcmp(reference, vga_data_array, TXCOUNT) == 0) ;
+
+    printf("output matches brute force: %s\n\n", same ? "yes" : "NO") ;
+
+    static const struct { int n, r, reps ; const char *what ; } cases[] = {
+        {3,   6, 400000, "triangle r=6 (spark)"},
+        {3,  40, 100000, "triangle r=40 (slash)"},
+        {3, 200,  10000, "triangle r=200"},
+        {4,  40, 100000, "quad r=40 (speed line)"},
+        {8,  40, 100000, "octagon r=40"},
+        {8, 200,  10000, "octagon r=200 (stage)"},
+    } ;
+    printf("%-26s %12s %12s\n", "case", "spans/us", "polys/us") ;
+    for (unsigned i = 0; i < sizeof(cases)/sizeof(cases[0]); i++) {
+        double dt = run(cases[i].n, cases[i].r, cases[i].reps) ;
+        printf("%-26s %12.1f %12.2f\n", cases[i].what, count_spans / dt, cases[i].reps / dt) ;
+    }
+    return !same ;
+}
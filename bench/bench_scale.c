@@ -0,0 +1,169 @@
+/**
+ * Host benchmark for scaled sprites (drawBitmapScaled)
+ *
+ * Checks drawBitmapScaled against drawBitmap at 1:1 for every fighter
+ * bitmap, both flips, clipped and not; then at other scales against a
+ * pixel-by-pixel nearest-neighbor zoom of the 1:1 drawing. Then times a
+ * fighter frame zoomed by a range of factors, both flips.
+ *
+ * BUILD/RUN (from the project directory, on the development machine)
+ *  python3 tools/spritegen.py assets/sprites.txt bench/sprite_data.h
+ *  cc -O2 -I. -Ibench -Ibench/sdk_stub -o bench_scale bench/bench_scale.c vga16_graphics.c
+ *  ./bench_scale
+ *
+ * The numbers are desktop numbers - use them to compare scale factors,
+ * not as RP2040 timings.
+ */
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include "vga16_graphics.h"
+#include "sprites.h"
+
+extern unsigned char vga_data_array[] ;
+#define TXCOUNT 153600
+#define W 640
+#define H 480
+
+static unsigned char reference[TXCOUNT] ;
+static unsigned char unscaled[TXCOUNT] ;
+
+static double now_us(void) {
+    struct timespec t ;
+    clock_gettime(CLOCK_MONOTONIC, &t) ;
+    return t.tv_sec * 1e6 + t.tv_nsec / 1e3 ;
+}
+
+static int pixel(const unsigned char *screen, int x, int y) {
+    unsigned char b = screen[(y * W + x) >> 1] ;
+    return (x & 1) ? (b >> 4) : (b & 15) ;
+}
+
+static void setPixel(unsigned char *screen, int x, int y, int c) {
+    unsigned char *b = &screen[(y * W + x) >> 1] ;
+    *b = (x & 1) ? (*b & 0x0F) | (c << 4) : (*b & 0xF0) | c ;
+}
+
+static int floordiv(long a, long b) {
+    return (a >= 0) ? a / b : -((-a + b - 1) / b) ;
+}
+
+// Every distinct bitmap of the fighters
+static const Bitmap *bitmaps[512] ;
+static int nbitmaps ;
+
+static void collect(const Anim *anim) {
+    for (int s = 0; s < 14; s++) {
+        for (int f = 0; f < anim[s].len; f++) {
+            const Bitmap *bm = anim[s].f[f].bm ;
+            int seen = 0 ;
+            for (int i = 0; i < nbitmaps; i++) seen |= bitmaps[i] == bm ;
+            if (!seen && nbitmaps < 512) bitmaps[nbitmaps++] = bm ;
+        }
+    }
+}
+
+// A 4-bit bitmap with a stripe of every color, key 0
+static unsigned char stripes_data[8 * 16] ;
+static const Bitmap stripes = {16, 16, 12, 20, 15, BITMAP_4BPP, 2, 0, 8, sizeof(stripes_data), stripes_data} ;
+
+// Does drawBitmapScaled at (x, y) match the 1:1 drawing at (320, 240)
+// zoomed pixel by pixel, inside and outside the clip rectangle?
+static int check(const Bitmap *bm, char flip, int32_t scale, short x, short y, char color) {
+    resetClip() ;
+    memset(vga_data_array, 0xFF, TXCOUNT) ;
+    drawBitmap(bm, 320, 240, flip, color) ;
+    memcpy(unscaled, vga_data_array, TXCOUNT) ;
+
+    short cx = 40, cy = 30, cw = 560, ch = 420 ;
+    memset(reference, 0xFF, TXCOUNT) ;
+    for (int j = cy; j < cy + ch; j++) {
+        int v = floordiv(((long)(j - y) << 15) + 16384, scale) ;
+        if ((v < -240) || (v >= 240)) continue ;
+        for (int i = cx; i < cx + cw; i++) {
+            int u = floordiv(((long)(i - x) << 15) + 16384, scale) ;
+            if ((u < -320) || (u >= 320)) continue ;
+            setPixel(reference, i, j, pixel(unscaled, 320 + u, 240 + v)) ;
+        }
+    }
+
+    memset(vga_data_array, 0xFF, TXCOUNT) ;
+    setClipRect(cx, cy, cw, ch) ;
+    drawBitmapScaled(bm, x, y, flip, color, scale) ;
+    resetClip() ;
+    return memcmp(reference, vga_data_array, TXCOUNT) != 0 ;
+}
+
+int main() {
+    collect(A) ;
+    collect(E) ;
+    collect(C1) ;
+    collect(C2) ;
+    for (int i = 0; i < (int)sizeof(stripes_data); i++) stripes_data[i] = (i * 0x13) ^ (i >> 3) ;
+    bitmaps[nbitmaps++] = &stripes ;
+
+    // 1:1 is drawBitmap, wherever it lands
+    int bad = 0, checks = 0 ;
+    static const short spots[][2] = {{320, 400}, {20, 420}, {630, 300}, {300, 60}, {333, 479}} ;
+    for (int i = 0; i < nbitmaps; i++) {
+        for (int flip = 0; flip < 2; flip++) {
+            for (int s = 0; s < 5; s++) {
+                setClipRect(10, 10, 620, 460) ;
+                memset(vga_data_array, 0xFF, TXCOUNT) ;
+                drawBitmap(bitmaps[i], spots[s][0], spots[s][1], flip, i & 15) ;
+                memcpy(reference, vga_data_array, TXCOUNT) ;
+                memset(vga_data_array, 0xFF, TXCOUNT) ;
+                drawBitmapScaled(bitmaps[i], spots[s][0], spots[s][1], flip, i & 15, 32768) ;
+                bad += memcmp(reference, vga_data_array, TXCOUNT) != 0 ;
+                checks++ ;
+            }
+        }
+    }
+    resetClip() ;
+    printf("1:1 matches drawBitmap: %d of %d\n", checks - bad, checks) ;
+
+    // Other scales match the zoomed 1:1 drawing
+    static const int32_t scales[] = {9000, 16384, 23456, 32768, 40000, 49152, 65536, 77777, 98304, 131072} ;
+    int zbad = 0, zchecks = 0 ;
+    for (int i = 0; i < nbitmaps; i += 7) {
+        for (int k = 0; k < 10; k++) {
+            for (int flip = 0; flip < 2; flip++) {
+                zbad += check(bitmaps[i], flip, scales[k], 300 + (k * 5), 380 - (k * 9), i & 15) ;
+                zchecks++ ;
+            }
+        }
+    }
+    zbad += check(&stripes, 1, 98304, 41, 31, 0) ;
+    zbad += check(&stripes, 0, 23456, 600, 440, 0) ;
+    zchecks += 2 ;
+    printf("zoom matches nearest neighbor: %d of %d\n\n", zchecks - zbad, zchecks) ;
+
+    // Time an idle frame (head and body) zoomed, anchored near the bottom
+    // middle the way a fighter stands
+    const Frame *head = &A[0].f[0], *body = &C1[0].f[0] ;
+    static const int32_t timed[] = {16384, 32768, 49152, 65536, 98304, 131072} ;
+    int reps = 20000 ;
+    double t0 = now_us() ;
+    for (int i = 0; i < reps; i++) {
+        drawBitmap(head->bm, 320, 440, i & 1, i & 15) ;
+        drawBitmap(body->bm, 320, 440, i & 1, i & 15) ;
+    }
+    double base = (now_us() - t0) / reps ;
+    printf("%-14s %12s %12s %12s\n", "scale", "us/frame", "flipped", "vs 1:1") ;
+    printf("%-14s %12.3f %12s %12s\n", "drawBitmap", base, "", "") ;
+    for (int k = 0; k < 6; k++) {
+        double t[2] ;
+        for (int flip = 0; flip < 2; flip++) {
+            t0 = now_us() ;
+            for (int i = 0; i < reps; i++) {
+                drawBitmapScaled(head->bm, 320, 440, flip, i & 15, timed[k]) ;
+                drawBitmapScaled(body->bm, 320, 440, flip, i & 15, timed[k]) ;
+            }
+            t[flip] = (now_us() - t0) / reps ;
+        }
+        printf("%-14.2f %12.3f %12.3f %11.2fx\n", timed[k] / 32768.0, t[0], t[1], (t[0] + t[1]) / (2 * base)) ;
+    }
+    return bad || zbad ;
+}
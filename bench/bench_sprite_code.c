@@ -0,0 +1,114 @@
+/**
+ * Host benchmark for compiled sprites (drawBitmapCode)
+ *
+ * Draws every fighter frame that has compiled code both ways - through its
+ * BitmapCode and through the generic drawBitmap blitter - at both flips and
+ * both pixel parities, checks that the screens match, and times each path
+ * facing each way (the fighters turn whenever they cross sides, so both
+ * should be the same speed). Then sets the flash the compiled code takes
+ * against the bitmap data.
+ *
+ * BUILD/RUN (from the project directory, on the development machine)
+ *  python3 tools/spritegen.py assets/sprites.txt bench/sprite_data.h
+ *  cc -O2 -I. -Ibench -Ibench/sdk_stub -o bench_sprite_code bench/bench_sprite_code.c vga16_graphics.c
+ *  ./bench_sprite_code
+ *
+ * The numbers are desktop numbers - use them to compare the two paths,
+ * not as RP2040 timings. The code size is the generator's estimate for
+ * Thumb code; on the RP2040 the code also runs from flash through the XIP
+ * cache, which the desktop doesn't model.
+ */
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include "vga16_graphics.h"
+#include "sprites.h"
+
+#ifndef SPRITE_CODE_BYTES
+#error "no compiled sprites - add some with \"code\" in assets/sprites.txt"
+#endif
+
+extern unsigned char vga_data_array[] ;
+#define TXCOUNT 153600
+
+static unsigned char reference[TXCOUNT] ;
+
+static double now_us(void) {
+    struct timespec t ;
+    clock_gettime(CLOCK_MONOTONIC, &t) ;
+    return t.tv_sec * 1e6 + t.tv_nsec / 1e3 ;
+}
+
+// Every distinct compiled frame of the fighters
+static const Frame *frames[64] ;
+static int nframes ;
+
+static void collect(const Anim *anim) {
+    for (int s = 0; s < 14; s++) {
+        for (int f = 0; f < anim[s].len; f++) {
+            const Frame *fr = &anim[s].f[f] ;
+            int seen = 0 ;
+            for (int i = 0; i < nframes; i++) seen |= frames[i]->bm == fr->bm ;
+            if (fr->code && !seen && nframes < 64) frames[nframes++] = fr ;
+        }
+    }
+}
+
+// Draw every frame at a spread of positions (both parities). flip < 0
+// alternates between facing right and left.
+static long draw_all(bool compiled, int reps, int flips) {
+    long cells = 0 ;
+    for (int i = 0; i < reps; i++) {
+        const Frame *fr = frames[i % nframes] ;
+        short x = 200 + (i * 7) % 240, y = 300 + (i * 3) % 60 ;
+        char flip = (flips < 0) ? (i / nframes) & 1 : flips ;
+        if (compiled) drawBitmapCode(fr->bm, fr->code, x, y, flip, i & 15) ;
+        else drawBitmap(fr->bm, x, y, flip, i & 15) ;
+        cells += fr->bm->w * fr->bm->h ;
+    }
+    return cells ;
+}
+
+int main() {
+    collect(A) ;
+    collect(E) ;
+    collect(C1) ;
+    collect(C2) ;
+    if (nframes == 0) {
+        printf("no compiled fighter frames\n") ;
+        return 1 ;
+    }
+
+    // Same draws both ways must leave the same screen
+    memset(vga_data_array, 0xFF, TXCOUNT) ;
+    draw_all(false, 4000, -1) ;
+    memcpy(reference, vga_data_array, TXCOUNT) ;
+    memset(vga_data_array, 0xFF, TXCOUNT) ;
+    draw_all(true, 4000, -1) ;
+    int same = memcmp(reference, vga_data_array, TXCOUNT) == 0 ;
+    printf("output matches: %s\n\n", same ? "yes" : "NO") ;
+
+    int reps = 100000 ;
+    double generic[2], code[2] ;
+    for (int flip = 0; flip < 2; flip++) {
+        double t0 = now_us() ;
+        draw_all(false, reps, flip) ;
+        generic[flip] = (now_us() - t0) / reps ;
+        t0 = now_us() ;
+        draw_all(true, reps, flip) ;
+        code[flip] = (now_us() - t0) / reps ;
+    }
+
+    long data = 0 ;
+    for (int i = 0; i < nframes; i++) data += frames[i]->bm->size ;
+
+    printf("%d compiled frames\n", nframes) ;
+    printf("%-18s %12s %12s %12s\n", "", "us/frame", "flipped", "flash bytes") ;
+    printf("%-18s %12.3f %12.3f %12ld\n", "drawBitmap", generic[0], generic[1], data) ;
+    printf("%-18s %12.3f %12.3f %12d\n", "drawBitmapCode", code[0], code[1], SPRITE_CODE_BYTES) ;
+    printf("speedup %.1fx for %.0fx the flash\n", (generic[0] + generic[1]) / (code[0] + code[1]),
+           (double)SPRITE_CODE_BYTES / data) ;
+    return !same ;
+}
@@ -0,0 +1,135 @@
+/**
+ * Host simulator for the fight screen (game_step)
+ *
+ * Runs game_step from animation.c on the development machine and checks
+ * every tick against a full redraw: white, the rooftop, both fighters and
+ * everything over them. First a fight of random input - both players
+ * pressing keys, quiet stretches where they stand idle, a new fight every
+ * 500 ticks or on a knockout. Then an idle fighter stood across a grid of
+ * spots, over the rooftop, the HUD and the clouds.
+ *
+ * Prints the ticks that didn't match (there should be none), the time a
+ * tick, how many fighters were saved under a tick, and how much of the
+ * screen the dirty rectangles covered, over all and on idle ticks.
+ *
+ * BUILD/RUN (from the project directory, on the development machine)
+ *  python3 tools/spritegen.py assets/sprites.txt bench/sprite_data.h
+ *  sh bench/stage_game.sh animation.c > bench/stage_game.h
+ *  cc -O2 -I. -Ibench -Ibench/sdk_stub -o bench_stage bench/bench_stage.c vga16_graphics.c
+ *  ./bench_stage [seed] [ticks]
+ *
+ * Give stage_game.sh LIST_DEFER or LIST_CHASE to run game_step through
+ * the display list, and build with -DREPORT for reportLayers' per-layer
+ * costs at the end. The numbers are desktop numbers - use them to compare
+ * one build with another, not as RP2040 timings.
+ */
+
+#include "stage_game.h"
+#include <time.h>
+
+extern unsigned char vga_data_array[] ;
+#define TXCOUNT 153600
+
+static unsigned char shown[TXCOUNT] ;
+
+static double now_us(void) {
+    struct timespec t ;
+    clock_gettime(CLOCK_MONOTONIC, &t) ;
+    return t.tv_sec * 1e6 + t.tv_nsec / 1e3 ;
+}
+
+// The fight screen drawn from nothing
+static void reference(void) {
+    resetClip() ;
+    fillRect(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, WHITE) ;
+    drawSprite(&rooftop, false, 322, 480, BLACK) ;
+    drawSprite(&rooftop, true, 318, 480, BLACK) ;
+    for (int i = 0; i < NUM_PLAYERS; i++) drawFrame(&players[i], BLACK) ;
+    drawOverlays() ;
+}
+
+// Does the screen game_step left match the reference? The screen is put
+// back either way
+static bool matches(int tick) {
+    memcpy(shown, vga_data_array, TXCOUNT) ;
+    reference() ;
+    int q = 0 ;
+    while ((q < TXCOUNT) && (shown[q] == vga_data_array[q])) q++ ;
+    memcpy(vga_data_array, shown, TXCOUNT) ;
+    if (q == TXCOUNT) return true ;
+    if (tick >= 0) printf("tick %d: first mismatch at %d,%d\n", tick, (q % 320) * 2, q / 320) ;
+    return false ;
+}
+
+int main(int argc, char **argv) {
+    int seed = (argc > 1) ? atoi(argv[1]) : 1 ;
+    int ticks = (argc > 2) ? atoi(argv[2]) : 6000 ;
+    static const short keys[] = {4, 6, 4, 6, 4, 6, 1, 2, 3, 5, 7, 8, 9, 0} ;
+    srand(seed) ;
+
+    // A fight of random input
+    int bad = 0, saved = 0, idle = 0 ;
+    double us = 0, dirty = 0, idle_dirty = 0 ;
+    pinFighters() ;
+    memset(vga_data_array, 0x33, TXCOUNT) ;
+    for (int t = 0; t < ticks; t++) {
+        if ((t % 500) == 0) {
+            resetGame() ;
+            players[0].head_anim = ((t / 500) & 1) ? A : E ;
+            players[1].body_anim = ((t / 1000) & 1) ? C1 : C2 ;
+            resetStage() ;
+        }
+        for (int p = 0; p < NUM_PLAYERS; p++) {
+            if ((rand() % 6) == 0) sim_keys[p] = ((rand() % 100) < 20) ? -1 : keys[rand() % 14] ;
+        }
+        bool quiet = (t % 300) < 100 ;
+        if (quiet) sim_keys[0] = sim_keys[1] = -1 ;
+
+        double t0 = now_us() ;
+        game_step() ;
+        double dt = now_us() - t0 ;
+        us += dt ;
+        step_us += dt ;
+        steps++ ;
+        saved += (under[0] >= 0) + (under[1] >= 0) ;
+        dirty += dirty_pixels ;
+        if (quiet && ((t % 300) > 20) && (players[0].state == 0) && (players[1].state == 0)) {
+            idle++ ;
+            idle_dirty += dirty_pixels ;
+        }
+        if ((players[0].hp <= 0) || (players[1].hp <= 0)) {
+            resetGame() ;
+            resetStage() ;
+        }
+        if (!matches(bad < 5 ? t : -1)) bad++ ;
+    }
+#ifdef REPORT
+    reportLayers() ;
+#endif
+    printf("fight: %d of %d ticks wrong, %.2f us a tick, %.2f fighters saved under a tick\n",
+           bad, ticks, us / ticks, saved / (double)ticks) ;
+    printf("dirty %.1f%% of the screen a tick, %.1f%% over %d idle ticks\n",
+           dirty * 100 / (SCREEN_WIDTH * SCREEN_HEIGHT) / ticks,
+           idle ? idle_dirty * 100 / (SCREEN_WIDTH * SCREEN_HEIGHT) / idle : 0, idle) ;
+
+    // An idle fighter across the screen, the other out of the way
+    int roof_bad = 0, roof_ticks = 0 ;
+    sim_keys[0] = sim_keys[1] = -1 ;
+    for (int y = 60; y <= 480; y += 40) {
+        for (int x = 40; x <= 600; x += 80) {
+            resetGame() ;
+            players[0].x = x ;
+            players[0].y = y ;
+            players[1].x = (x < 320) ? 600 : 40 ;
+            resetStage() ;
+            memset(vga_data_array, 0x33, TXCOUNT) ;
+            for (int t = 0; t < 30; t++) {
+                game_step() ;
+                if (!matches(-1)) roof_bad++ ;
+                roof_ticks++ ;
+            }
+        }
+    }
+    printf("standing: %d of %d ticks wrong\n", roof_bad, roof_ticks) ;
+    return (bad || roof_bad) ? 1 : 0 ;
+}
@@ -0,0 +1,157 @@
+/**
+ * Host microbenchmark for the word-wide kernels in vga16_swar.h
+ *
+ * Each kernel is run over random spans of a 640x480 frame and compared with
+ * the same job done the way drawPixel does it: one nibble at a time with
+ * TOPMASK/BOTTOMMASK. Both must leave identical frames.
+ *
+ * BUILD/RUN (from the project directory, on the development machine)
+ *  cc -O2 -I. -o bench_swar bench/bench_swar.c
+ *  ./bench_swar
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "vga16_swar.h"
+
+#define TXCOUNT 153600
+#define SPANS 4096
+
+static uint32_t frame_a[TXCOUNT / 4], frame_b[TXCOUNT / 4] ;
+static unsigned char mask_bits[640 / 8 + 1] ;
+static uint32_t sprite_px[640 / 8 + 1] ;
+
+static struct { short x0, x1, y ; unsigned char c ; } spans[SPANS] ;
+
+// ==== nibble-at-a-time versions (the current drawPixel way) ====
+static inline int get_px(unsigned char *fb, int x, int y) {
+    unsigned char b = fb[(320 * y) + (x >> 1)] ;
+    return (x & 1) ? (b >> 4) : (b & 0x0F) ;
+}
+
+static inline void put_px(unsigned char *fb, int x, int y, int c) {
+    int pixel = (640 * y) + x ;
+    if (pixel & 1) fb[pixel>>1] = (fb[pixel>>1] & 0b00001111) | (c << 4) ;
+    else fb[pixel>>1] = (fb[pixel>>1] & 0b11110000) | c ;
+}
+
+static void nib_fill(unsigned char *fb, int x0, int x1, int y, int c) {
+    for (int x = x0; x < x1; x++) put_px(fb, x, y, c) ;
+}
+
+static void nib_fill_masked(unsigned char *fb, int x0, int x1, int y, int c) {
+    for (int x = x0; x < x1; x++) {
+        if ((mask_bits[x >> 3] >> (x & 7)) & 1) put_px(fb, x, y, c) ;
+    }
+}
+
+static void nib_replace(unsigned char *fb, int x0, int x1, int y, int from, int to) {
+    for (int x = x0; x < x1; x++) {
+        if (get_px(fb, x, y) == from) put_px(fb, x, y, to) ;
+    }
+}
+
+static void nib_blit_key(unsigned char *fb, int x0, int x1, int y, int key) {
+    for (int x = x0; x < x1; x++) {
+        int c = (sprite_px[x >> 3] >> ((x & 7) << 2)) & 15 ;
+        if (c != key) put_px(fb, x, y, c) ;
+    }
+}
+
+static void nib_copy(unsigned char *fb, int x0, int x1, int y, int shift) {
+    for (int x = x0; x < x1; x++) {
+        int s = x + shift ;
+        put_px(fb, x, y, (sprite_px[s >> 3] >> ((s & 7) << 2)) & 15) ;
+    }
+}
+
+static void nib_xor(unsigned char *fb, int x0, int x1, int y, int c) {
+    for (int x = x0; x < x1; x++) put_px(fb, x, y, get_px(fb, x, y) ^ c) ;
+}
+
+// ==== word-wide versions ====
+static uint32_t *row_of(uint32_t *fb, int y) { return fb + (SWAR_ROWWORDS * y) ; }
+
+static double now_us(void) {
+    struct timespec t ;
+    clock_gettime(CLOCK_MONOTONIC, &t) ;
+    return t.tv_sec * 1e6 + t.tv_nsec / 1e3 ;
+}
+
+static void scramble(uint32_t *fb) {
+    srand(1) ;
+    for (int i = 0; i < TXCOUNT / 4; i++) fb[i] = ((uint32_t)rand() << 16) ^ rand() ;
+}
+
+static long total_pixels(void) {
+    long n = 0 ;
+    for (int i = 0; i < SPANS; i++) n += spans[i].x1 - spans[i].x0 ;
+    return n ;
+}
+
+int main() {
+    srand(7) ;
+    for (int i = 0; i < SPANS; i++) {
+        int a = rand() % 640, b = rand() % 640 ;
+        if (a > b) { int t = a ; a = b ; b = t ; }
+        spans[i].x0 = a ; spans[i].x1 = b + 1 ; spans[i].y = rand() % 480 ; spans[i].c = rand() & 15 ;
+    }
+    for (unsigned i = 0; i < sizeof(mask_bits); i++) mask_bits[i] = rand() ;
+    for (unsigned i = 0; i < sizeof(sprite_px)/4; i++) sprite_px[i] = ((uint32_t)rand() << 16) ^ rand() ;
+
+    const char *names[7] = {"solid fill", "masked fill", "color replace", "key composite",
+                            "copy aligned", "copy shifted", "xor fill"} ;
+    long px = total_pixels() ;
+    int reps = 50, ok = 1 ;
+
+    printf("%-16s %14s %14s %8s %6s\n", "kernel", "nibble px/us", "word px/us", "speedup", "match") ;
+    for (int k = 0; k < 7; k++) {
+        double t0, t_nib, t_word ;
+        unsigned char *fa = (unsigned char *)frame_a ;
+
+        scramble(frame_a) ;
+        t0 = now_us() ;
+        for (int r = 0; r < reps; r++) {
+            for (int i = 0; i < SPANS; i++) {
+                int x0 = spans[i].x0, x1 = spans[i].x1, y = spans[i].y, c = spans[i].c ;
+                switch (k) {
+                case 0: nib_fill(fa, x0, x1, y, c) ; break ;
+                case 1: nib_fill_masked(fa, x0, x1, y, c) ; break ;
+                case 2: nib_replace(fa, x0, x1, y, c, 15 - c) ; break ;
+                case 3: nib_blit_key(fa, x0, x1, y, c) ; break ;
+                case 4: nib_copy(fa, x0, x1, y, 0) ; break ;
+                case 5: nib_copy(fa, x0, x1, y, 3) ; break ;
+                case 6: nib_xor(fa, x0, x1, y, c) ; break ;
+                }
+            }
+        }
+        t_nib = now_us() - t0 ;
+
+        scramble(frame_b) ;
+        t0 = now_us() ;
+        for (int r = 0; r < reps; r++) {
+            for (int i = 0; i < SPANS; i++) {
+                int x0 = spans[i].x0, x1 = spans[i].x1, y = spans[i].y, c = spans[i].c ;
+                uint32_t *row = row_of(frame_b, y) ;
+                switch (k) {
+                case 0: swar_fill(row, x0, x1, swar_color(c)) ; break ;
+                case 1: swar_fill_masked(row, x0, x1 - x0, mask_bits, x0, sizeof(mask_bits), swar_color(c)) ; break ;
+                case 2: swar_replace(row, x0, x1, c, 15 - c) ; break ;
+                case 3: swar_blit_key(row, x0, x1 - x0, sprite_px, x0, sizeof(sprite_px)/4, c) ; break ;
+                case 4: swar_copy(row, x0, x1 - x0, sprite_px, x0, sizeof(sprite_px)/4) ; break ;
+                case 5: swar_copy(row, x0, x1 - x0, sprite_px, x0 + 3, sizeof(sprite_px)/4) ; break ;
+                case 6: swar_fill_rop(row, x0, x1, 0xFFFFFFFFu, swar_color(c)) ; break ;
+                }
+            }
+        }
+        t_word = now_us() - t0 ;
+
+        int same = memcmp(frame_a, frame_b, TXCOUNT) == 0 ;
+        ok &= same ;
+        printf("%-16s %14.1f %14.1f %7.1fx %6s\n", names[k],
+               px * reps / t_nib, px * reps / t_word, t_nib / t_word, same ? "yes" : "NO") ;
+    }
+    return !ok ;
+}
@@ -0,0 +1,28 @@
+#ifndef _HOST_HARDWARE_DMA_H
+#define _HOST_HARDWARE_DMA_H
+
+#include "pico/stdlib.h"
+
+typedef struct { volatile uint32_t read_addr ; } dma_channel_hw_t ;
+typedef struct { dma_channel_hw_t ch[12] ; } dma_hw_t ;
+typedef struct { uint32_t ctrl ; } dma_channel_config ;
+
+static dma_hw_t host_dma ;
+#define dma_hw (&host_dma)
+
+#define DMA_SIZE_8 0
+#define DMA_SIZE_32 2
+#define DREQ_PIO0_TX2 2
+
+static inline int dma_claim_unused_channel(bool required) { static int n ; return n++ ; }
+static inline dma_channel_config dma_channel_get_default_config(uint ch) { dma_channel_config c = {0} ; return c ; }
+static inline void channel_config_set_transfer_data_size(dma_channel_config *c, uint size) {}
+static inline void channel_config_set_read_increment(dma_channel_config *c, bool incr) {}
+static inline void channel_config_set_write_increment(dma_channel_config *c, bool incr) {}
+static inline void channel_config_set_dreq(dma_channel_config *c, uint dreq) {}
+static inline void channel_config_set_chain_to(dma_channel_config *c, uint ch) {}
+static inline void dma_channel_configure(uint ch, const dma_channel_config *c, volatile void *write_addr,
+                                         const volatile void *read_addr, uint count, bool trigger) {}
+static inline void dma_start_channel_mask(uint32_t mask) {}
+
+#endif
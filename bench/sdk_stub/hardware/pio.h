@@ -0,0 +1,18 @@
+#ifndef _HOST_HARDWARE_PIO_H
+#define _HOST_HARDWARE_PIO_H
+
+#include "pico/stdlib.h"
+
+typedef struct { volatile uint32_t txf[4] ; } pio_hw_t ;
+typedef pio_hw_t *PIO ;
+typedef struct { int unused ; } pio_program_t ;
+
+static pio_hw_t host_pio0 ;
+#define pio0 (&host_pio0)
+
+static inline uint pio_add_program(PIO pio, const pio_program_t *p) { return 0 ; }
+static inline void pio_sm_put_blocking(PIO pio, uint sm, uint32_t data) {}
+static inline void pio_enable_sm_mask_in_sync(PIO pio, uint32_t mask) {}
+static inline uint8_t pio_sm_get_pc(PIO pio, uint sm) { return 0 ; }
+
+#endif
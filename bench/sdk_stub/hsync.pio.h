@@ -0,0 +1,3 @@
+#include "hardware/pio.h"
+static const pio_program_t hsync_program ;
+static inline void hsync_program_init(PIO pio, uint sm, uint offset, uint pin) {}
@@ -0,0 +1,19 @@
+// Host stand-in for the Pico SDK so the drawing code in vga16_graphics.c can
+// be compiled and timed on a desktop machine. Only what initVGA() and the
+// beam wait touch is declared; none of it does anything but time_us_32.
+#ifndef _HOST_PICO_STDLIB_H
+#define _HOST_PICO_STDLIB_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+
+typedef unsigned int uint ;
+
+static inline uint32_t time_us_32(void) {
+    struct timespec t ;
+    clock_gettime(CLOCK_MONOTONIC, &t) ;
+    return (uint32_t)((t.tv_sec * 1000000ull) + (t.tv_nsec / 1000)) ;
+}
+
+#endif
@@ -0,0 +1,3 @@
+#include "hardware/pio.h"
+static const pio_program_t rgb_program ;
+static inline void rgb_program_init(PIO pio, uint sm, uint offset, uint pin) {}
@@ -0,0 +1,42 @@
+#!/bin/sh
+# Cut the fight screen code out of animation.c so bench_stage.c can run it
+# on the development machine: the player and stage code, input handling and
+# game_step, with the SDK calls, audio and keypad stubbed out.
+#
+#  sh bench/stage_game.sh animation.c [LIST_OFF|LIST_DEFER|LIST_CHASE] > bench/stage_game.h
+#
+# The second argument replaces STAGE_LIST (LIST_CHASE doesn't wait on the
+# host, there is no beam). Sections are found by the lines that start them,
+# so it keeps working as animation.c changes around them.
+src=${1:-animation.c}
+mode=$2
+first=$(grep -n '^typedef struct' "$src" | head -1 | cut -d: -f1)
+keys=$(grep -n '^short getKey' "$src" | cut -d: -f1)
+input=$(grep -n '^void handle_input_floating' "$src" | cut -d: -f1)
+core0=$(grep -n '^// Animation on core 0' "$src" | cut -d: -f1)
+if [ -z "$first" ] || [ -z "$keys" ] || [ -z "$input" ] || [ -z "$core0" ]; then
+  echo "stage_game.sh: $src doesn't have the expected sections" >&2
+  exit 1
+fi
+
+cat <<'X'
+// Generated by bench/stage_game.sh from animation.c - do not edit
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "vga16_graphics.h"
+#include "sprites.h"
+X
+grep -E '^typedef signed int fix15|^#define int2fix15|^#define (SCREEN|GROUND)_' "$src"
+cat <<'X'
+#define dma_start_channel_mask(mask) ((void)0)
+int hitctrl_chan, shieldctrl_chan, whooshctrl_chan ;
+short ui_state, winner = -1 ;
+short sim_keys[2] ;
+short getKey(bool p1) { return sim_keys[p1 ? 0 : 1] ; }
+X
+sed -n "${first},$((keys - 1))p" "$src" |
+  if [ -n "$mode" ]; then sed "s/^#define STAGE_LIST [A-Z_]*/#define STAGE_LIST $mode/" ; else cat ; fi
+sed -n "${input},$((core0 - 1))p" "$src"
@@ -1,7 +1,14 @@
+// code is the compiled version of bm, or NULL (see the manifest's "code").
+// The rest says what the frame covers without looking at its bitmap: drawn
+// at (x, y) its box has its top-left at (x - ax, y - ay), or (x - fx, y - ay)
+// flipped, and is w x h pixels, pixels of them ink.
 typedef struct
 {
-    const short (*p)[2];
-    const short len;
+    const Bitmap *bm;
+    const BitmapCode *code;
+    short ax, fx, ay;
+    short w, h;
+    unsigned short pixels;
 }Frame;
 
 typedef struct
@@ -10,379 +17,43 @@ typedef struct
     const short len;
 }Anim;
 
-//title screen (white part)
-const short title[1235][2] = {{140,124},{136,124},{132,124},{116,120},{112,120},{108,120},{104,120},{100,120},{96,120},{92,120},{88,120},{84,120},{80,120},{76,120},{72,120},{68,120},{64,120},{60,120},{56,120},{52,120},{48,120},{44,120},{40,120},{36,120},{32,120},{28,120},{24,120},{20,120},{16,120},{12,120},{8,120},{4,120},{0,120},{-4,120},{-8,120},{-12,120},{-16,120},{-20,120},{-24,120},{-28,120},{-32,120},{-36,120},{-40,120},{-44,120},{-48,120},{-52,120},{-56,120},{-60,120},{-64,120},{-68,120},{-72,120},{-76,120},{-80,120},{-84,120},{-88,120},{-92,120},{-96,120},{-100,120},{-104,120},{-108,120},{-112,120},{-116,120},{132,116},{128,116},{124,116},{120,116},{116,116},{112,116},{108,116},{104,116},{100,116},{96,116},{92,116},{88,116},{84,116},{80,116},{76,116},{72,116},{68,116},{64,116},{60,116},{56,116},{52,116},{48,116},{44,116},{40,116},{36,116},{32,116},{28,116},{24,116},{20,116},{16,116},{12,116},{8,116},{4,116},{0,116},{-4,116},{-8,116},{-12,116},{-16,116},{-20,116},{-24,116},{-28,116},{-32,116},{-36,116},{-40,116},{-44,116},{-48,116},{-52,116},{-56,116},{-60,116},{-64,116},{-68,116},{-72,116},{-76,116},{-80,116},{-84,116},{-88,116},{-92,116},{-96,116},{-100,116},{-104,116},{-108,116},{-112,116},{-116,116},{-120,116},{-124,116},{-128,116},{-132,116},{-136,116},{136,112},{132,112},{128,112},{124,112},{120,112},{116,112},{112,112},{84,112},{72,112},{48,112},{24,112},{20,112},{16,112},{12,112},{8,112},{-20,112},{-32,112},{-60,112},{-72,112},{-76,112},{-88,112},{-116,112},{-120,112},{-124,112},{120,108},{116,108},{112,108},{84,108},{72,108},{48,108},{24,108},{20,108},{16,108},{12,108},{8,108},{-20,108},{-32,108},{-60,108},{-72,108},{-76,108},{-88,108},{-116,108},{-120,108},{-124,108},{160,104},{156,104},{116,104},{112,104},{100,104},{96,104},{84,104},{72,104},{60,104},{56,104},{52,104},{48,104},{36,104},{24,104},{20,104},{16,104},{12,104},{8,104},{-4,104},{-8,104},{-12,104},{-16,104},{-20,104},{-32,104},{-44,104},{-48,104},{-52,104},{-56,104},{-60,104},{-72,104},{-76,104},{-88,104},{-92,104},{-96,104},{-108,104},{-112,104},{-116,104},{-120,104},{-124,104},{-128,104},{-132,104},{-136,104},{-140,104},{152,100},{148,100},{144,100},{140,100},{136,100},{132,100},{128,100},{124,100},{120,100},{116,100},{112,100},{100,100},{96,100},{84,100},{72,100},{60,100},{56,100},{52,100},{48,100},{36,100},{24,100},{20,100},{16,100},{12,100},{8,100},{-4,100},{-8,100},{-12,100},{-16,100},{-20,100},{-32,100},{-44,100},{-48,100},{-52,100},{-56,100},{-60,100},{-72,100},{-76,100},{-88,100},{-92,100},{-96,100},{-108,100},{-112,100},{-116,100},{-120,100},{-124,100},{116,96},{112,96},{100,96},{96,96},{84,96},{72,96},{60,96},{56,96},{52,96},{48,96},{36,96},{24,96},{20,96},{16,96},{12,96},{8,96},{-16,96},{-20,96},{-32,96},{-44,96},{-48,96},{-52,96},{-56,96},{-60,96},{-72,96},{-76,96},{-88,96},{-92,96},{-96,96},{-108,96},{-112,96},{-116,96},{-120,96},{-124,96},{120,92},{116,92},{112,92},{84,92},{72,92},{60,92},{56,92},{52,92},{48,92},{36,92},{24,92},{8,92},{-16,92},{-20,92},{-32,92},{-44,92},{-60,92},{-88,92},{-92,92},{-96,92},{-108,92},{-112,92},{-116,92},{-120,92},{-124,92},{-128,92},{-132,92},{-136,92},{-140,92},{-144,92},{144,88},{140,88},{136,88},{132,88},{128,88},{124,88},{120,88},{116,88},{112,88},{84,88},{72,88},{60,88},{56,88},{52,88},{48,88},{36,88},{24,88},{8,88},{-4,88},{-8,88},{-12,88},{-16,88},{-20,88},{-32,88},{-44,88},{-60,88},{-88,88},{-92,88},{-96,88},{-108,88},{-112,88},{-116,88},{-136,88},{-140,88},{124,84},{120,84},{116,84},{112,84},{100,84},{96,84},{92,84},{88,84},{84,84},{72,84},{60,84},{56,84},{52,84},{48,84},{36,84},{24,84},{20,84},{16,84},{12,84},{8,84},{-4,84},{-8,84},{-12,84},{-16,84},{-20,84},{-32,84},{-44,84},{-48,84},{-60,84},{-72,84},{-76,84},{-88,84},{-92,84},{-96,84},{-108,84},{-112,84},{-116,84},{136,80},{132,80},{128,80},{124,80},{120,80},{116,80},{112,80},{100,80},{96,80},{92,80},{88,80},{84,80},{72,80},{60,80},{56,80},{52,80},{48,80},{36,80},{24,80},{20,80},{16,80},{12,80},{8,80},{-4,80},{-8,80},{-12,80},{-16,80},{-20,80},{-32,80},{-44,80},{-48,80},{-60,80},{-72,80},{-76,80},{-88,80},{-92,80},{-96,80},{-108,80},{-112,80},{-116,80},{-120,80},{-124,80},{-128,80},{-132,80},{-136,80},{116,76},{112,76},{100,76},{96,76},{92,76},{88,76},{84,76},{72,76},{48,76},{24,76},{20,76},{16,76},{12,76},{8,76},{-4,76},{-8,76},{-12,76},{-16,76},{-20,76},{-32,76},{-60,76},{-72,76},{-76,76},{-88,76},{-92,76},{-96,76},{-108,76},{-112,76},{-116,76},{-120,76},{-124,76},{136,72},{120,72},{116,72},{112,72},{100,72},{96,72},{92,72},{88,72},{84,72},{72,72},{48,72},{24,72},{20,72},{16,72},{12,72},{8,72},{-4,72},{-8,72},{-12,72},{-16,72},{-20,72},{-32,72},{-60,72},{-72,72},{-76,72},{-88,72},{-92,72},{-96,72},{-108,72},{-112,72},{-116,72},{-120,72},{-124,72},{-128,72},{-132,72},{-136,72},{-140,72},{-144,72},{156,68},{152,68},{148,68},{144,68},{140,68},{136,68},{128,68},{124,68},{120,68},{116,68},{112,68},{108,68},{104,68},{100,68},{96,68},{92,68},{88,68},{84,68},{80,68},{76,68},{72,68},{68,68},{64,68},{60,68},{56,68},{52,68},{48,68},{44,68},{40,68},{36,68},{32,68},{28,68},{24,68},{20,68},{16,68},{12,68},{8,68},{4,68},{0,68},{-4,68},{-8,68},{-12,68},{-16,68},{-20,68},{-24,68},{-28,68},{-32,68},{-36,68},{-40,68},{-44,68},{-48,68},{-52,68},{-56,68},{-60,68},{-64,68},{-68,68},{-72,68},{-76,68},{-80,68},{-84,68},{-88,68},{-92,68},{-96,68},{-100,68},{-104,68},{-108,68},{-112,68},{-116,68},{-120,68},{-124,68},{-128,68},{-132,68},{-136,68},{-140,68},{-144,68},{80,64},{76,64},{72,64},{68,64},{64,64},{60,64},{-116,64},{-120,64},{172,56},{168,56},{164,56},{140,56},{128,56},{124,56},{120,56},{116,56},{112,56},{108,56},{104,56},{100,56},{96,56},{92,56},{88,56},{84,56},{80,56},{76,56},{72,56},{68,56},{64,56},{60,56},{56,56},{52,56},{48,56},{44,56},{40,56},{36,56},{32,56},{28,56},{24,56},{20,56},{16,56},{12,56},{8,56},{4,56},{0,56},{-4,56},{-8,56},{-12,56},{-16,56},{-20,56},{-24,56},{-28,56},{-32,56},{-36,56},{-40,56},{-44,56},{-48,56},{-52,56},{-56,56},{-60,56},{-64,56},{-68,56},{-72,56},{-76,56},{-80,56},{-84,56},{-88,56},{-92,56},{-96,56},{-100,56},{-104,56},{-108,56},{-112,56},{-116,56},{-120,56},{-124,56},{-128,56},{-132,56},{-136,56},{-140,56},{-144,56},{-148,56},{-152,56},{-156,56},{-160,56},{-164,56},{-168,56},{-172,56},{-176,56},{-180,56},{-184,56},{-188,56},{-192,56},{-196,56},{172,52},{168,52},{164,52},{160,52},{156,52},{152,52},{148,52},{144,52},{140,52},{136,52},{132,52},{128,52},{124,52},{120,52},{116,52},{112,52},{108,52},{104,52},{100,52},{96,52},{92,52},{88,52},{84,52},{80,52},{76,52},{72,52},{68,52},{64,52},{60,52},{56,52},{52,52},{48,52},{44,52},{40,52},{36,52},{32,52},{28,52},{24,52},{20,52},{16,52},{12,52},{8,52},{4,52},{0,52},{-4,52},{-8,52},{-12,52},{-16,52},{-20,52},{-24,52},{-28,52},{-32,52},{-36,52},{-40,52},{-44,52},{-48,52},{-52,52},{-56,52},{-60,52},{-64,52},{-68,52},{-72,52},{-76,52},{-80,52},{-84,52},{-88,52},{-92,52},{-96,52},{-100,52},{-104,52},{-108,52},{-112,52},{-116,52},{-120,52},{-124,52},{-128,52},{-132,52},{-136,52},{-140,52},{-144,52},{-148,52},{-152,52},{-156,52},{-160,52},{-164,52},{-168,52},{-172,52},{-176,52},{-180,52},{-184,52},{-188,52},{-192,52},{-196,52},{172,48},{168,48},{156,48},{152,48},{144,48},{136,48},{132,48},{128,48},{124,48},{120,48},{116,48},{108,48},{104,48},{96,48},{92,48},{80,48},{76,48},{60,48},{44,48},{28,48},{24,48},{20,48},{16,48},{12,48},{-4,48},{-16,48},{-20,48},{-28,48},{-32,48},{-36,48},{-44,48},{-60,48},{-68,48},{-76,48},{-80,48},{-88,48},{-92,48},{-96,48},{-100,48},{-104,48},{-120,48},{-136,48},{-152,48},{-160,48},{-168,48},{-172,48},{-176,48},{-180,48},{-184,48},{-188,48},{188,44},{184,44},{180,44},{176,44},{172,44},{168,44},{160,44},{152,44},{144,44},{136,44},{132,44},{128,44},{124,44},{120,44},{112,44},{104,44},{96,44},{92,44},{84,44},{76,44},{68,44},{64,44},{60,44},{52,44},{44,44},{40,44},{32,44},{28,44},{24,44},{20,44},{16,44},{12,44},{4,44},{0,44},{-4,44},{-12,44},{-20,44},{-28,44},{-32,44},{-36,44},{-44,44},{-48,44},{-56,44},{-60,44},{-68,44},{-76,44},{-80,44},{-88,44},{-92,44},{-96,44},{-100,44},{-104,44},{-108,44},{-112,44},{-120,44},{-128,44},{-136,44},{-144,44},{-148,44},{-152,44},{-160,44},{-168,44},{-172,44},{-176,44},{-180,44},{192,40},{188,40},{184,40},{180,40},{176,40},{172,40},{168,40},{152,40},{144,40},{136,40},{128,40},{124,40},{120,40},{104,40},{96,40},{92,40},{76,40},{64,40},{60,40},{44,40},{40,40},{32,40},{28,40},{24,40},{20,40},{16,40},{12,40},{0,40},{-4,40},{-12,40},{-20,40},{-28,40},{-36,40},{-44,40},{-48,40},{-56,40},{-60,40},{-68,40},{-80,40},{-88,40},{-92,40},{-96,40},{-100,40},{-104,40},{-108,40},{-116,40},{-120,40},{-128,40},{-136,40},{-148,40},{-152,40},{-160,40},{-168,40},{184,36},{180,36},{176,36},{172,36},{168,36},{160,36},{152,36},{148,36},{140,36},{136,36},{132,36},{128,36},{124,36},{120,36},{112,36},{104,36},{96,36},{92,36},{84,36},{76,36},{68,36},{64,36},{60,36},{52,36},{48,36},{44,36},{40,36},{32,36},{28,36},{24,36},{20,36},{16,36},{12,36},{4,36},{0,36},{-4,36},{-12,36},{-20,36},{-28,36},{-36,36},{-44,36},{-48,36},{-56,36},{-60,36},{-68,36},{-76,36},{-88,36},{-92,36},{-96,36},{-100,36},{-104,36},{-112,36},{-116,36},{-120,36},{-128,36},{-136,36},{-144,36},{-148,36},{-152,36},{-156,36},{-164,36},{-168,36},{-172,36},{-176,36},{-180,36},{192,32},{188,32},{184,32},{180,32},{176,32},{172,32},{168,32},{152,32},{148,32},{140,32},{136,32},{128,32},{124,32},{120,32},{112,32},{104,32},{92,32},{76,32},{60,32},{52,32},{44,32},{40,32},{32,32},{28,32},{20,32},{16,32},{12,32},{-4,32},{-16,32},{-20,32},{-24,32},{-32,32},{-40,32},{-44,32},{-60,32},{-68,32},{-76,32},{-80,32},{-88,32},{-92,32},{-100,32},{-104,32},{-120,32},{-136,32},{-152,32},{-156,32},{-164,32},{-168,32},{-172,32},{-176,32},{-180,32},{192,28},{188,28},{184,28},{180,28},{172,28},{168,28},{164,28},{160,28},{156,28},{152,28},{148,28},{144,28},{140,28},{136,28},{132,28},{128,28},{124,28},{120,28},{116,28},{112,28},{108,28},{104,28},{100,28},{96,28},{92,28},{88,28},{84,28},{80,28},{76,28},{72,28},{68,28},{64,28},{60,28},{56,28},{52,28},{48,28},{44,28},{40,28},{36,28},{32,28},{24,28},{20,28},{16,28},{12,28},{8,28},{4,28},{0,28},{-4,28},{-8,28},{-12,28},{-16,28},{-20,28},{-24,28},{-28,28},{-32,28},{-36,28},{-40,28},{-44,28},{-48,28},{-52,28},{-56,28},{-60,28},{-64,28},{-68,28},{-72,28},{-76,28},{-80,28},{-84,28},{-88,28},{-96,28},{-100,28},{-104,28},{-108,28},{-112,28},{-116,28},{-120,28},{-124,28},{-128,28},{-132,28},{-136,28},{-140,28},{-144,28},{-148,28},{-152,28},{-156,28},{-160,28},{-164,28},{-168,28},{160,24},{156,24},{152,24},{148,24},{144,24},{136,24},{132,24},{128,24},{124,24},{84,24},{80,24},{76,24},{72,24},{68,24},{64,24},{60,24},{56,24},{52,24},{48,24},{44,24},{40,24},{36,24},{32,24},{28,24},{24,24},{20,24},{16,24},{12,24},{8,24},{4,24},{0,24},{-4,24},{-8,24},{-12,24},{-16,24},{-20,24},{-24,24},{-28,24},{-32,24},{-36,24},{-40,24},{-44,24},{-48,24},{-52,24},{-56,24},{-60,24},{-64,24},{-68,24},{-72,24},{-76,24},{-80,24},{-84,24},{-88,24},{-92,24},{-96,24},{-100,24},{-104,24},{-108,24},{-112,24},{-116,24},{-120,24},{-124,24},{-128,24},{-132,24},{-136,24},{-140,24},{-144,24},{-148,24},{-152,24},{-156,24},{-160,24},{-164,24},{80,20},{76,20},{72,20},{68,20},{64,20},{-20,20},{-24,20},{-28,20},{-32,20},{-68,20},{-72,20},{-76,20},{-80,20},{-84,20},{-88,20},{-116,20},{-120,20}};
-const short title_A[74][2] = {{272,164},{268,164},{264,164},{260,164},{256,164},{252,164},{248,164},{244,164},{240,164},{236,164},{276,160},{272,160},{236,160},{232,160},{228,160},{280,156},{276,156},{228,156},{224,156},{280,152},{224,152},{220,152},{280,148},{220,148},{280,144},{220,144},{280,140},{220,140},{280,136},{276,136},{220,136},{276,132},{248,132},{244,132},{220,132},{276,128},{272,128},{252,128},{248,128},{244,128},{240,128},{236,128},{224,128},{220,128},{272,124},{260,124},{252,124},{248,124},{244,124},{240,124},{236,124},{228,124},{224,124},{268,120},{260,120},{256,120},{252,120},{248,120},{244,120},{240,120},{236,120},{228,120},{256,116},{252,116},{248,116},{244,116},{240,116},{236,116},{228,116},{248,112},{244,112},{240,112},{228,112},{236,108}};
-const short title_A_full[2871][2] = {{244,432},{240,432},{236,432},{232,432},{228,432},{224,432},{220,432},{216,432},{212,432},{208,432},{204,432},{200,432},{196,432},{192,432},{188,432},{184,432},{180,432},{176,432},{172,432},{168,432},{252,428},{248,428},{244,428},{240,428},{180,428},{176,428},{172,428},{168,428},{164,428},{160,428},{156,428},{152,428},{148,428},{256,424},{252,424},{236,424},{232,424},{228,424},{224,424},{220,424},{216,424},{212,424},{208,424},{204,424},{200,424},{196,424},{192,424},{188,424},{184,424},{160,424},{156,424},{152,424},{148,424},{144,424},{140,424},{136,424},{132,424},{128,424},{124,424},{276,420},{272,420},{268,420},{264,420},{260,420},{256,420},{244,420},{240,420},{236,420},{232,420},{228,420},{224,420},{220,420},{216,420},{212,420},{208,420},{204,420},{200,420},{196,420},{192,420},{188,420},{184,420},{180,420},{176,420},{172,420},{168,420},{164,420},{144,420},{140,420},{136,420},{132,420},{128,420},{124,420},{120,420},{116,420},{112,420},{284,416},{280,416},{276,416},{252,416},{248,416},{244,416},{240,416},{236,416},{232,416},{228,416},{224,416},{220,416},{216,416},{212,416},{208,416},{204,416},{200,416},{196,416},{192,416},{188,416},{184,416},{180,416},{176,416},{172,416},{168,416},{164,416},{160,416},{156,416},{152,416},{148,416},{132,416},{128,416},{124,416},{120,416},{116,416},{112,416},{108,416},{104,416},{100,416},{96,416},{288,412},{284,412},{272,412},{268,412},{264,412},{260,412},{256,412},{252,412},{248,412},{244,412},{240,412},{236,412},{232,412},{228,412},{224,412},{220,412},{216,412},{212,412},{208,412},{204,412},{200,412},{196,412},{192,412},{188,412},{184,412},{180,412},{176,412},{172,412},{168,412},{164,412},{160,412},{156,412},{152,412},{148,412},{144,412},{140,412},{136,412},{124,412},{120,412},{116,412},{112,412},{108,412},{104,412},{100,412},{296,408},{292,408},{288,408},{280,408},{276,408},{272,408},{268,408},{264,408},{260,408},{256,408},{252,408},{248,408},{244,408},{240,408},{236,408},{232,408},{228,408},{224,408},{220,408},{216,408},{212,408},{208,408},{204,408},{200,408},{196,408},{192,408},{188,408},{184,408},{180,408},{176,408},{172,408},{168,408},{164,408},{160,408},{156,408},{152,408},{148,408},{144,408},{140,408},{136,408},{132,408},{128,408},{116,408},{112,408},{108,408},{104,408},{300,404},{296,404},{284,404},{280,404},{276,404},{272,404},{268,404},{264,404},{260,404},{256,404},{252,404},{248,404},{244,404},{240,404},{236,404},{232,404},{228,404},{224,404},{220,404},{216,404},{212,404},{208,404},{204,404},{200,404},{196,404},{192,404},{188,404},{184,404},{180,404},{176,404},{172,404},{168,404},{164,404},{160,404},{156,404},{152,404},{148,404},{144,404},{140,404},{136,404},{132,404},{128,404},{124,404},{120,404},{112,404},{108,404},{104,404},{100,404},{96,404},{92,404},{88,404},{84,404},{304,400},{300,400},{288,400},{284,400},{280,400},{276,400},{272,400},{268,400},{264,400},{260,400},{256,400},{252,400},{248,400},{244,400},{240,400},{236,400},{232,400},{228,400},{224,400},{220,400},{216,400},{212,400},{208,400},{204,400},{200,400},{196,400},{192,400},{188,400},{184,400},{180,400},{176,400},{172,400},{168,400},{164,400},{160,400},{156,400},{152,400},{148,400},{144,400},{140,400},{136,400},{132,400},{128,400},{124,400},{120,400},{116,400},{112,400},{104,400},{100,400},{96,400},{92,400},{88,400},{84,400},{80,400},{76,400},{72,400},{68,400},{308,396},{304,396},{292,396},{288,396},{284,396},{280,396},{276,396},{272,396},{268,396},{264,396},{260,396},{256,396},{252,396},{248,396},{244,396},{240,396},{236,396},{232,396},{228,396},{224,396},{220,396},{216,396},{212,396},{208,396},{204,396},{200,396},{196,396},{192,396},{188,396},{184,396},{180,396},{176,396},{172,396},{168,396},{164,396},{160,396},{156,396},{152,396},{148,396},{144,396},{140,396},{136,396},{132,396},{128,396},{124,396},{120,396},{116,396},{112,396},{108,396},{96,396},{92,396},{88,396},{84,396},{80,396},{76,396},{312,392},{308,392},{292,392},{288,392},{284,392},{280,392},{276,392},{272,392},{268,392},{264,392},{260,392},{256,392},{252,392},{248,392},{244,392},{240,392},{236,392},{232,392},{228,392},{224,392},{220,392},{216,392},{212,392},{208,392},{204,392},{200,392},{196,392},{192,392},{188,392},{184,392},{180,392},{176,392},{172,392},{168,392},{164,392},{160,392},{156,392},{152,392},{148,392},{144,392},{140,392},{136,392},{132,392},{128,392},{124,392},{120,392},{116,392},{112,392},{108,392},{104,392},{100,392},{92,392},{88,392},{84,392},{80,392},{312,388},{296,388},{292,388},{288,388},{284,388},{280,388},{276,388},{272,388},{268,388},{264,388},{260,388},{256,388},{252,388},{248,388},{244,388},{240,388},{236,388},{232,388},{228,388},{224,388},{220,388},{216,388},{212,388},{208,388},{204,388},{200,388},{196,388},{192,388},{188,388},{184,388},{180,388},{176,388},{172,388},{168,388},{164,388},{160,388},{156,388},{152,388},{148,388},{144,388},{140,388},{136,388},{132,388},{128,388},{124,388},{120,388},{116,388},{112,388},{108,388},{104,388},{100,388},{96,388},{88,388},{84,388},{80,388},{72,388},{68,388},{64,388},{60,388},{56,388},{52,388},{48,388},{44,388},{40,388},{36,388},{316,384},{312,384},{296,384},{292,384},{288,384},{284,384},{280,384},{276,384},{272,384},{268,384},{264,384},{260,384},{256,384},{252,384},{248,384},{244,384},{240,384},{236,384},{232,384},{228,384},{224,384},{220,384},{216,384},{212,384},{208,384},{204,384},{200,384},{196,384},{192,384},{188,384},{184,384},{180,384},{176,384},{172,384},{168,384},{164,384},{160,384},{156,384},{152,384},{148,384},{144,384},{140,384},{136,384},{132,384},{128,384},{124,384},{120,384},{116,384},{112,384},{108,384},{104,384},{100,384},{96,384},{92,384},{84,384},{80,384},{76,384},{72,384},{68,384},{64,384},{60,384},{56,384},{52,384},{48,384},{44,384},{40,384},{36,384},{32,384},{316,380},{300,380},{296,380},{292,380},{288,380},{284,380},{280,380},{276,380},{272,380},{268,380},{264,380},{260,380},{256,380},{252,380},{248,380},{244,380},{240,380},{236,380},{232,380},{228,380},{224,380},{220,380},{216,380},{212,380},{208,380},{204,380},{200,380},{196,380},{192,380},{188,380},{184,380},{180,380},{176,380},{172,380},{168,380},{164,380},{160,380},{156,380},{152,380},{148,380},{144,380},{140,380},{136,380},{132,380},{128,380},{124,380},{120,380},{116,380},{112,380},{108,380},{104,380},{100,380},{96,380},{92,380},{88,380},{80,380},{76,380},{72,380},{68,380},{64,380},{320,376},{316,376},{300,376},{296,376},{292,376},{288,376},{284,376},{280,376},{276,376},{272,376},{268,376},{264,376},{260,376},{256,376},{252,376},{248,376},{244,376},{240,376},{236,376},{232,376},{228,376},{224,376},{220,376},{216,376},{212,376},{208,376},{204,376},{200,376},{196,376},{192,376},{188,376},{184,376},{180,376},{176,376},{172,376},{168,376},{164,376},{160,376},{156,376},{152,376},{148,376},{144,376},{140,376},{136,376},{132,376},{128,376},{124,376},{120,376},{116,376},{112,376},{108,376},{104,376},{100,376},{96,376},{92,376},{88,376},{76,376},{72,376},{68,376},{64,376},{60,376},{56,376},{52,376},{320,372},{316,372},{304,372},{300,372},{296,372},{292,372},{288,372},{284,372},{280,372},{276,372},{272,372},{268,372},{264,372},{260,372},{256,372},{252,372},{248,372},{244,372},{240,372},{236,372},{232,372},{228,372},{224,372},{220,372},{216,372},{212,372},{208,372},{204,372},{200,372},{196,372},{192,372},{188,372},{184,372},{180,372},{176,372},{172,372},{168,372},{164,372},{160,372},{156,372},{152,372},{148,372},{144,372},{140,372},{136,372},{132,372},{128,372},{124,372},{120,372},{116,372},{112,372},{108,372},{104,372},{100,372},{96,372},{92,372},{88,372},{76,372},{72,372},{68,372},{64,372},{60,372},{56,372},{52,372},{320,368},{304,368},{300,368},{296,368},{292,368},{288,368},{284,368},{280,368},{276,368},{272,368},{268,368},{264,368},{260,368},{256,368},{252,368},{248,368},{244,368},{240,368},{236,368},{232,368},{228,368},{224,368},{220,368},{216,368},{212,368},{208,368},{204,368},{200,368},{196,368},{192,368},{188,368},{184,368},{180,368},{176,368},{172,368},{168,368},{164,368},{160,368},{156,368},{152,368},{148,368},{144,368},{140,368},{136,368},{132,368},{128,368},{124,368},{120,368},{116,368},{112,368},{108,368},{104,368},{100,368},{96,368},{92,368},{88,368},{76,368},{72,368},{68,368},{64,368},{36,368},{320,364},{304,364},{300,364},{296,364},{292,364},{288,364},{284,364},{280,364},{276,364},{272,364},{268,364},{264,364},{260,364},{256,364},{252,364},{248,364},{244,364},{240,364},{236,364},{232,364},{228,364},{224,364},{220,364},{216,364},{212,364},{208,364},{204,364},{200,364},{196,364},{192,364},{188,364},{184,364},{180,364},{176,364},{172,364},{168,364},{164,364},{160,364},{156,364},{152,364},{148,364},{144,364},{140,364},{136,364},{132,364},{128,364},{124,364},{120,364},{116,364},{112,364},{108,364},{104,364},{100,364},{96,364},{92,364},{88,364},{84,364},{72,364},{68,364},{64,364},{60,364},{56,364},{52,364},{48,364},{320,360},{304,360},{300,360},{296,360},{292,360},{288,360},{284,360},{280,360},{276,360},{272,360},{268,360},{264,360},{260,360},{256,360},{252,360},{248,360},{244,360},{240,360},{236,360},{232,360},{228,360},{224,360},{220,360},{216,360},{212,360},{208,360},{204,360},{200,360},{196,360},{192,360},{188,360},{184,360},{180,360},{176,360},{172,360},{168,360},{164,360},{160,360},{156,360},{152,360},{148,360},{144,360},{140,360},{136,360},{132,360},{128,360},{124,360},{120,360},{116,360},{112,360},{108,360},{104,360},{100,360},{96,360},{92,360},{88,360},{84,360},{72,360},{68,360},{64,360},{60,360},{56,360},{52,360},{48,360},{44,360},{40,360},{320,356},{304,356},{300,356},{296,356},{292,356},{288,356},{284,356},{280,356},{276,356},{272,356},{268,356},{264,356},{260,356},{256,356},{252,356},{248,356},{244,356},{240,356},{236,356},{232,356},{228,356},{224,356},{220,356},{216,356},{212,356},{208,356},{204,356},{200,356},{196,356},{192,356},{188,356},{184,356},{180,356},{176,356},{172,356},{168,356},{164,356},{160,356},{156,356},{152,356},{148,356},{144,356},{140,356},{136,356},{132,356},{128,356},{124,356},{120,356},{116,356},{112,356},{108,356},{104,356},{100,356},{96,356},{92,356},{88,356},{84,356},{68,356},{64,356},{320,352},{300,352},{296,352},{292,352},{284,352},{280,352},{276,352},{272,352},{268,352},{264,352},{260,352},{256,352},{252,352},{248,352},{244,352},{240,352},{236,352},{232,352},{228,352},{224,352},{220,352},{216,352},{212,352},{208,352},{204,352},{200,352},{196,352},{192,352},{188,352},{184,352},{180,352},{176,352},{172,352},{168,352},{164,352},{160,352},{156,352},{152,352},{148,352},{144,352},{140,352},{136,352},{132,352},{128,352},{124,352},{120,352},{116,352},{112,352},{108,352},{104,352},{100,352},{96,352},{92,352},{88,352},{84,352},{80,352},{68,352},{64,352},{60,352},{56,352},{52,352},{48,352},{44,352},{40,352},{36,352},{32,352},{320,348},{300,348},{296,348},{292,348},{284,348},{280,348},{276,348},{272,348},{268,348},{264,348},{260,348},{256,348},{252,348},{248,348},{244,348},{240,348},{236,348},{232,348},{228,348},{224,348},{220,348},{216,348},{212,348},{208,348},{204,348},{200,348},{196,348},{192,348},{188,348},{184,348},{180,348},{176,348},{172,348},{168,348},{164,348},{160,348},{156,348},{152,348},{148,348},{144,348},{140,348},{136,348},{132,348},{128,348},{124,348},{120,348},{116,348},{112,348},{108,348},{104,348},{100,348},{96,348},{92,348},{88,348},{84,348},{80,348},{64,348},{60,348},{56,348},{320,344},{300,344},{296,344},{292,344},{284,344},{280,344},{276,344},{268,344},{264,344},{260,344},{252,344},{248,344},{244,344},{240,344},{236,344},{232,344},{228,344},{224,344},{220,344},{216,344},{212,344},{208,344},{204,344},{200,344},{196,344},{192,344},{188,344},{184,344},{180,344},{176,344},{172,344},{168,344},{164,344},{160,344},{156,344},{152,344},{148,344},{144,344},{140,344},{136,344},{132,344},{128,344},{124,344},{120,344},{116,344},{112,344},{108,344},{104,344},{100,344},{96,344},{92,344},{88,344},{84,344},{80,344},{64,344},{60,344},{56,344},{52,344},{320,340},{296,340},{292,340},{284,340},{280,340},{276,340},{268,340},{264,340},{260,340},{252,340},{248,340},{244,340},{240,340},{236,340},{232,340},{224,340},{220,340},{216,340},{212,340},{208,340},{204,340},{200,340},{196,340},{192,340},{184,340},{180,340},{176,340},{172,340},{168,340},{164,340},{160,340},{156,340},{152,340},{148,340},{144,340},{140,340},{136,340},{132,340},{128,340},{124,340},{120,340},{116,340},{112,340},{108,340},{104,340},{100,340},{96,340},{92,340},{88,340},{84,340},{80,340},{76,340},{60,340},{56,340},{52,340},{48,340},{44,340},{40,340},{36,340},{320,336},{296,336},{292,336},{288,336},{284,336},{280,336},{276,336},{264,336},{260,336},{248,336},{244,336},{240,336},{236,336},{232,336},{224,336},{220,336},{216,336},{212,336},{208,336},{204,336},{200,336},{196,336},{184,336},{180,336},{176,336},{172,336},{168,336},{164,336},{160,336},{156,336},{152,336},{148,336},{144,336},{140,336},{136,336},{132,336},{128,336},{124,336},{120,336},{116,336},{112,336},{108,336},{104,336},{100,336},{96,336},{92,336},{88,336},{84,336},{80,336},{76,336},{56,336},{52,336},{48,336},{44,336},{40,336},{320,332},{296,332},{292,332},{288,332},{280,332},{276,332},{264,332},{260,332},{244,332},{240,332},{236,332},{232,332},{220,332},{216,332},{212,332},{208,332},{204,332},{200,332},{184,332},{180,332},{176,332},{172,332},{168,332},{156,332},{148,332},{144,332},{140,332},{136,332},{132,332},{128,332},{124,332},{120,332},{116,332},{112,332},{108,332},{104,332},{100,332},{96,332},{92,332},{88,332},{84,332},{80,332},{48,332},{44,332},{40,332},{36,332},{32,332},{28,332},{320,328},{316,328},{296,328},{292,328},{288,328},{280,328},{276,328},{272,328},{264,328},{260,328},{256,328},{240,328},{236,328},{232,328},{220,328},{216,328},{212,328},{208,328},{180,328},{176,328},{172,328},{168,328},{148,328},{144,328},{140,328},{136,328},{132,328},{128,328},{124,328},{120,328},{116,328},{112,328},{108,328},{104,328},{100,328},{96,328},{92,328},{88,328},{80,328},{56,328},{52,328},{48,328},{320,324},{316,324},{292,324},{288,324},{280,324},{276,324},{272,324},{264,324},{260,324},{256,324},{252,324},{236,324},{232,324},{216,324},{212,324},{180,324},{176,324},{148,324},{144,324},{140,324},{136,324},{132,324},{128,324},{120,324},{116,324},{112,324},{108,324},{104,324},{100,324},{96,324},{92,324},{88,324},{60,324},{56,324},{52,324},{48,324},{44,324},{40,324},{36,324},{316,320},{292,320},{280,320},{276,320},{272,320},{268,320},{256,320},{252,320},{232,320},{228,320},{212,320},{180,320},{176,320},{148,320},{136,320},{132,320},{120,320},{116,320},{112,320},{104,320},{100,320},{96,320},{92,320},{88,320},{60,320},{56,320},{52,320},{48,320},{316,316},{292,316},{276,316},{272,316},{268,316},{212,316},{184,316},{180,316},{136,316},{120,316},{116,316},{96,316},{92,316},{88,316},{60,316},{56,316},{52,316},{316,312},{312,312},{276,312},{272,312},{212,312},{184,312},{120,312},{96,312},{92,312},{88,312},{60,312},{56,312},{52,312},{316,308},{312,308},{272,308},{268,308},{92,308},{88,308},{60,308},{56,308},{52,308},{48,308},{44,308},{40,308},{36,308},{312,304},{268,304},{92,304},{88,304},{60,304},{56,304},{52,304},{48,304},{44,304},{312,300},{92,300},{60,300},{56,300},{52,300},{312,296},{92,296},{60,296},{312,292},{308,292},{92,292},{64,292},{60,292},{56,292},{308,288},{176,288},{172,288},{148,288},{144,288},{140,288},{64,288},{60,288},{56,288},{308,284},{184,284},{180,284},{176,284},{172,284},{168,284},{160,284},{156,284},{152,284},{148,284},{144,284},{140,284},{128,284},{68,284},{64,284},{60,284},{56,284},{308,280},{304,280},{184,280},{180,280},{176,280},{172,280},{168,280},{164,280},{160,280},{156,280},{152,280},{148,280},{144,280},{140,280},{132,280},{128,280},{72,280},{68,280},{64,280},{60,280},{56,280},{308,276},{304,276},{188,276},{184,276},{180,276},{176,276},{172,276},{168,276},{164,276},{160,276},{156,276},{152,276},{148,276},{144,276},{136,276},{132,276},{76,276},{72,276},{68,276},{304,272},{188,272},{184,272},{180,272},{176,272},{172,272},{168,272},{164,272},{160,272},{156,272},{120,272},{116,272},{112,272},{84,272},{80,272},{76,272},{72,272},{68,272},{64,272},{304,268},{300,268},{248,268},{244,268},{240,268},{188,268},{184,268},{180,268},{176,268},{172,268},{168,268},{164,268},{116,268},{112,268},{88,268},{84,268},{80,268},{76,268},{72,268},{48,268},{44,268},{300,264},{252,264},{248,264},{244,264},{240,264},{236,264},{192,264},{188,264},{184,264},{180,264},{176,264},{172,264},{168,264},{160,264},{156,264},{152,264},{148,264},{144,264},{140,264},{136,264},{132,264},{112,264},{100,264},{96,264},{88,264},{84,264},{80,264},{76,264},{72,264},{300,260},{252,260},{248,260},{244,260},{240,260},{236,260},{232,260},{192,260},{188,260},{184,260},{180,260},{176,260},{172,260},{168,260},{164,260},{160,260},{156,260},{152,260},{148,260},{144,260},{140,260},{136,260},{132,260},{128,260},{116,260},{112,260},{108,260},{104,260},{100,260},{92,260},{88,260},{84,260},{80,260},{300,256},{296,256},{252,256},{248,256},{244,256},{240,256},{236,256},{232,256},{196,256},{192,256},{188,256},{184,256},{180,256},{176,256},{172,256},{168,256},{164,256},{160,256},{156,256},{152,256},{148,256},{144,256},{132,256},{128,256},{124,256},{120,256},{116,256},{112,256},{88,256},{84,256},{80,256},{296,252},{292,252},{252,252},{248,252},{244,252},{240,252},{236,252},{232,252},{196,252},{192,252},{188,252},{184,252},{180,252},{176,252},{172,252},{168,252},{164,252},{160,252},{128,252},{124,252},{120,252},{116,252},{108,252},{84,252},{80,252},{76,252},{72,252},{308,248},{304,248},{300,248},{296,248},{292,248},{288,248},{252,248},{248,248},{244,248},{240,248},{236,248},{232,248},{224,248},{196,248},{192,248},{188,248},{184,248},{180,248},{176,248},{172,248},{156,248},{152,248},{148,248},{124,248},{120,248},{116,248},{108,248},{96,248},{92,248},{88,248},{84,248},{80,248},{76,248},{320,244},{316,244},{312,244},{252,244},{248,244},{244,244},{240,244},{236,244},{232,244},{228,244},{224,244},{220,244},{196,244},{192,244},{188,244},{184,244},{180,244},{176,244},{172,244},{168,244},{164,244},{152,244},{148,244},{132,244},{128,244},{124,244},{120,244},{116,244},{112,244},{100,244},{96,244},{92,244},{88,244},{84,244},{80,244},{76,244},{72,244},{68,244},{64,244},{288,240},{284,240},{252,240},{248,240},{244,240},{240,240},{236,240},{232,240},{228,240},{224,240},{220,240},{216,240},{204,240},{200,240},{196,240},{192,240},{188,240},{184,240},{180,240},{176,240},{172,240},{168,240},{164,240},{160,240},{156,240},{152,240},{148,240},{144,240},{140,240},{136,240},{132,240},{128,240},{124,240},{120,240},{116,240},{112,240},{104,240},{100,240},{96,240},{92,240},{88,240},{84,240},{80,240},{76,240},{284,236},{248,236},{244,236},{240,236},{236,236},{232,236},{228,236},{224,236},{220,236},{216,236},{208,236},{204,236},{200,236},{196,236},{192,236},{188,236},{184,236},{180,236},{176,236},{172,236},{168,236},{164,236},{160,236},{156,236},{152,236},{148,236},{144,236},{140,236},{136,236},{132,236},{128,236},{124,236},{120,236},{116,236},{112,236},{104,236},{100,236},{96,236},{92,236},{88,236},{84,236},{284,232},{280,232},{248,232},{244,232},{240,232},{236,232},{232,232},{228,232},{224,232},{220,232},{216,232},{212,232},{208,232},{204,232},{200,232},{196,232},{192,232},{188,232},{184,232},{180,232},{176,232},{172,232},{168,232},{164,232},{160,232},{156,232},{152,232},{148,232},{144,232},{140,232},{136,232},{132,232},{128,232},{124,232},{120,232},{116,232},{112,232},{104,232},{100,232},{96,232},{92,232},{88,232},{84,232},{80,232},{76,232},{72,232},{68,232},{64,232},{60,232},{56,232},{52,232},{48,232},{44,232},{40,232},{36,232},{280,228},{244,228},{240,228},{236,228},{232,228},{224,228},{220,228},{216,228},{212,228},{208,228},{204,228},{200,228},{196,228},{192,228},{188,228},{184,228},{180,228},{176,228},{172,228},{168,228},{164,228},{160,228},{156,228},{152,228},{148,228},{144,228},{140,228},{136,228},{132,228},{128,228},{124,228},{120,228},{116,228},{112,228},{108,228},{100,228},{96,228},{92,228},{280,224},{240,224},{236,224},{232,224},{224,224},{220,224},{216,224},{212,224},{208,224},{204,224},{200,224},{196,224},{192,224},{188,224},{184,224},{180,224},{176,224},{172,224},{168,224},{164,224},{160,224},{156,224},{152,224},{148,224},{144,224},{140,224},{136,224},{132,224},{128,224},{124,224},{120,224},{116,224},{112,224},{108,224},{100,224},{96,224},{92,224},{88,224},{276,220},{244,220},{236,220},{232,220},{220,220},{216,220},{212,220},{208,220},{204,220},{200,220},{196,220},{192,220},{188,220},{184,220},{180,220},{176,220},{172,220},{168,220},{164,220},{160,220},{156,220},{152,220},{148,220},{144,220},{140,220},{136,220},{132,220},{128,220},{124,220},{120,220},{116,220},{112,220},{108,220},{104,220},{96,220},{92,220},{88,220},{276,216},{244,216},{240,216},{220,216},{216,216},{212,216},{208,216},{204,216},{200,216},{196,216},{192,216},{188,216},{184,216},{180,216},{176,216},{172,216},{168,216},{164,216},{160,216},{156,216},{152,216},{148,216},{144,216},{140,216},{136,216},{132,216},{128,216},{124,216},{120,216},{116,216},{112,216},{108,216},{104,216},{96,216},{92,216},{88,216},{276,212},{244,212},{240,212},{236,212},{232,212},{220,212},{216,212},{212,212},{208,212},{204,212},{200,212},{196,212},{192,212},{188,212},{184,212},{180,212},{176,212},{172,212},{168,212},{164,212},{160,212},{156,212},{152,212},{148,212},{144,212},{140,212},{136,212},{132,212},{128,212},{124,212},{120,212},{116,212},{112,212},{108,212},{104,212},{96,212},{92,212},{88,212},{72,212},{68,212},{64,212},{276,208},{272,208},{244,208},{240,208},{236,208},{232,208},{228,208},{220,208},{216,208},{212,208},{208,208},{204,208},{200,208},{196,208},{192,208},{188,208},{184,208},{180,208},{176,208},{172,208},{168,208},{164,208},{160,208},{156,208},{152,208},{148,208},{144,208},{140,208},{136,208},{132,208},{128,208},{124,208},{120,208},{108,208},{100,208},{96,208},{92,208},{88,208},{84,208},{80,208},{76,208},{72,208},{68,208},{64,208},{276,204},{272,204},{244,204},{240,204},{236,204},{232,204},{228,204},{216,204},{212,204},{208,204},{204,204},{200,204},{196,204},{192,204},{188,204},{184,204},{180,204},{176,204},{172,204},{168,204},{164,204},{160,204},{156,204},{152,204},{148,204},{144,204},{140,204},{136,204},{132,204},{128,204},{124,204},{120,204},{116,204},{112,204},{104,204},{100,204},{96,204},{92,204},{88,204},{84,204},{276,200},{244,200},{240,200},{236,200},{232,200},{228,200},{224,200},{216,200},{212,200},{208,200},{204,200},{200,200},{196,200},{192,200},{188,200},{184,200},{180,200},{176,200},{172,200},{168,200},{164,200},{160,200},{156,200},{152,200},{148,200},{144,200},{140,200},{136,200},{132,200},{128,200},{124,200},{120,200},{116,200},{108,200},{104,200},{100,200},{96,200},{276,196},{244,196},{240,196},{236,196},{232,196},{228,196},{224,196},{216,196},{212,196},{208,196},{204,196},{200,196},{196,196},{192,196},{188,196},{184,196},{180,196},{176,196},{172,196},{168,196},{164,196},{160,196},{156,196},{152,196},{148,196},{144,196},{140,196},{136,196},{132,196},{128,196},{124,196},{120,196},{116,196},{112,196},{104,196},{100,196},{96,196},{92,196},{280,192},{276,192},{244,192},{240,192},{236,192},{232,192},{228,192},{224,192},{216,192},{212,192},{208,192},{204,192},{200,192},{196,192},{192,192},{188,192},{184,192},{180,192},{176,192},{172,192},{168,192},{164,192},{160,192},{156,192},{152,192},{148,192},{144,192},{140,192},{136,192},{132,192},{128,192},{124,192},{120,192},{116,192},{112,192},{104,192},{100,192},{96,192},{92,192},{280,188},{244,188},{240,188},{236,188},{232,188},{228,188},{224,188},{220,188},{212,188},{208,188},{204,188},{200,188},{196,188},{192,188},{188,188},{184,188},{180,188},{176,188},{172,188},{168,188},{164,188},{160,188},{156,188},{152,188},{148,188},{144,188},{140,188},{136,188},{132,188},{128,188},{124,188},{120,188},{116,188},{108,188},{104,188},{100,188},{96,188},{280,184},{256,184},{244,184},{240,184},{236,184},{232,184},{228,184},{224,184},{220,184},{212,184},{208,184},{204,184},{200,184},{196,184},{192,184},{188,184},{184,184},{180,184},{176,184},{172,184},{168,184},{164,184},{160,184},{156,184},{152,184},{148,184},{144,184},{140,184},{136,184},{112,184},{108,184},{104,184},{100,184},{96,184},{88,184},{280,180},{260,180},{256,180},{252,180},{248,180},{244,180},{240,180},{236,180},{232,180},{228,180},{224,180},{220,180},{216,180},{208,180},{204,180},{200,180},{196,180},{192,180},{188,180},{184,180},{180,180},{176,180},{172,180},{168,180},{164,180},{160,180},{156,180},{152,180},{148,180},{144,180},{140,180},{136,180},{132,180},{128,180},{124,180},{120,180},{116,180},{108,180},{104,180},{100,180},{96,180},{92,180},{280,176},{276,176},{260,176},{256,176},{252,176},{248,176},{244,176},{240,176},{236,176},{232,176},{228,176},{224,176},{220,176},{216,176},{212,176},{204,176},{200,176},{196,176},{192,176},{188,176},{184,176},{180,176},{176,176},{172,176},{168,176},{164,176},{160,176},{156,176},{152,176},{148,176},{144,176},{140,176},{136,176},{132,176},{128,176},{124,176},{120,176},{116,176},{108,176},{104,176},{100,176},{96,176},{92,176},{88,176},{84,176},{276,172},{272,172},{260,172},{256,172},{252,172},{248,172},{244,172},{240,172},{236,172},{232,172},{228,172},{224,172},{220,172},{216,172},{212,172},{208,172},{200,172},{196,172},{192,172},{188,172},{184,172},{180,172},{176,172},{172,172},{168,172},{164,172},{160,172},{156,172},{152,172},{148,172},{144,172},{140,172},{136,172},{132,172},{128,172},{124,172},{120,172},{112,172},{108,172},{104,172},{100,172},{96,172},{92,172},{88,172},{272,168},{268,168},{260,168},{256,168},{252,168},{248,168},{244,168},{240,168},{236,168},{232,168},{228,168},{224,168},{220,168},{216,168},{212,168},{208,168},{204,168},{188,168},{184,168},{180,168},{176,168},{172,168},{168,168},{164,168},{160,168},{156,168},{152,168},{148,168},{144,168},{140,168},{136,168},{132,168},{128,168},{124,168},{116,168},{112,168},{108,168},{104,168},{100,168},{268,164},{264,164},{260,164},{256,164},{252,164},{248,164},{244,164},{240,164},{236,164},{232,164},{228,164},{224,164},{220,164},{216,164},{212,164},{208,164},{204,164},{200,164},{196,164},{192,164},{176,164},{172,164},{168,164},{164,164},{160,164},{156,164},{152,164},{148,164},{144,164},{140,164},{136,164},{132,164},{128,164},{124,164},{116,164},{112,164},{108,164},{260,160},{256,160},{252,160},{248,160},{244,160},{240,160},{236,160},{232,160},{228,160},{224,160},{220,160},{216,160},{212,160},{208,160},{204,160},{200,160},{196,160},{192,160},{188,160},{184,160},{180,160},{160,160},{156,160},{152,160},{148,160},{144,160},{140,160},{136,160},{132,160},{128,160},{124,160},{116,160},{112,160},{108,160},{252,156},{248,156},{244,156},{240,156},{236,156},{232,156},{228,156},{224,156},{220,156},{216,156},{212,156},{208,156},{204,156},{200,156},{196,156},{192,156},{188,156},{184,156},{180,156},{176,156},{172,156},{168,156},{164,156},{148,156},{144,156},{140,156},{136,156},{132,156},{128,156},{120,156},{116,156},{112,156},{108,156},{248,152},{244,152},{240,152},{236,152},{232,152},{228,152},{224,152},{220,152},{216,152},{212,152},{208,152},{204,152},{200,152},{196,152},{192,152},{188,152},{184,152},{180,152},{176,152},{172,152},{168,152},{164,152},{124,152},{120,152},{116,152},{112,152},{108,152},{104,152},{100,152},{240,148},{236,148},{232,148},{228,148},{224,148},{220,148},{216,148},{212,148},{208,148},{204,148},{200,148},{196,148},{192,148},{188,148},{184,148},{180,148},{176,148},{172,148},{168,148},{164,148},{140,148},{136,148},{132,148},{128,148},{124,148},{120,148},{116,148},{112,148},{108,148},{236,144},{232,144},{228,144},{224,144},{220,144},{216,144},{212,144},{208,144},{204,144},{200,144},{196,144},{192,144},{188,144},{184,144},{180,144},{176,144},{172,144},{168,144},{164,144},{144,144},{140,144},{136,144},{132,144},{128,144},{124,144},{120,144},{116,144},{112,144},{108,144},{104,144},{232,140},{228,140},{224,140},{220,140},{216,140},{212,140},{208,140},{204,140},{200,140},{196,140},{192,140},{188,140},{184,140},{180,140},{176,140},{172,140},{168,140},{228,136},{224,136},{220,136},{216,136},{212,136},{208,136},{204,136},{200,136},{196,136},{192,136},{188,136},{184,136},{180,136},{176,136},{224,132},{220,132},{216,132},{212,132},{208,132},{204,132},{200,132},{196,132},{192,132},{188,132},{184,132},{180,132},{220,128},{216,128},{212,128},{208,128},{204,128},{200,128},{196,128},{192,128},{188,128},{184,128},{216,124},{212,124},{208,124},{204,124},{200,124},{196,124},{192,124},{188,124},{212,120},{208,120},{204,120},{200,120},{196,120},{192,120},{208,116},{204,116},{200,116},{196,116},{192,116},{204,112},{200,112},{196,112},{200,108},{196,108}};
-const short title_E[70][2] = {{260,160},{256,160},{252,160},{248,160},{244,160},{240,160},{236,160},{268,156},{264,156},{260,156},{236,156},{232,156},{268,152},{232,152},{228,152},{272,148},{268,148},{228,148},{272,144},{228,144},{272,140},{244,140},{240,140},{236,140},{228,140},{272,136},{248,136},{244,136},{240,136},{236,136},{228,136},{272,132},{260,132},{252,132},{248,132},{244,132},{240,132},{236,132},{228,132},{272,128},{260,128},{252,128},{248,128},{244,128},{240,128},{236,128},{228,128},{272,124},{268,124},{256,124},{252,124},{248,124},{244,124},{240,124},{236,124},{232,124},{228,124},{256,120},{248,120},{244,120},{240,120},{236,120},{228,120},{256,116},{248,116},{240,116},{228,116},{248,112},{240,112},{228,112}};
-const short title_E_full[2070][2] = {{232,412},{228,412},{224,412},{220,412},{216,412},{212,412},{208,412},{204,412},{200,412},{196,412},{192,412},{188,412},{184,412},{180,412},{236,408},{232,408},{228,408},{224,408},{220,408},{216,408},{212,408},{208,408},{204,408},{200,408},{196,408},{192,408},{188,408},{184,408},{180,408},{176,408},{172,408},{168,408},{164,408},{160,408},{156,408},{152,408},{148,408},{248,404},{244,404},{240,404},{236,404},{192,404},{188,404},{184,404},{180,404},{176,404},{172,404},{168,404},{164,404},{160,404},{156,404},{152,404},{148,404},{144,404},{140,404},{136,404},{256,400},{252,400},{248,400},{244,400},{228,400},{208,400},{200,400},{176,400},{172,400},{168,400},{164,400},{160,400},{156,400},{152,400},{148,400},{144,400},{140,400},{136,400},{260,396},{256,396},{252,396},{240,396},{236,396},{224,396},{216,396},{200,396},{192,396},{164,396},{160,396},{156,396},{152,396},{148,396},{144,396},{140,396},{136,396},{132,396},{128,396},{124,396},{120,396},{116,396},{264,392},{260,392},{240,392},{236,392},{232,392},{228,392},{224,392},{220,392},{216,392},{212,392},{208,392},{204,392},{196,392},{192,392},{184,392},{176,392},{172,392},{152,392},{148,392},{144,392},{140,392},{136,392},{132,392},{128,392},{124,392},{120,392},{272,388},{268,388},{244,388},{240,388},{232,388},{224,388},{220,388},{208,388},{204,388},{188,388},{184,388},{176,388},{172,388},{164,388},{140,388},{136,388},{132,388},{128,388},{124,388},{120,388},{112,388},{108,388},{280,384},{276,384},{272,384},{256,384},{252,384},{248,384},{244,384},{240,384},{236,384},{204,384},{200,384},{188,384},{184,384},{164,384},{160,384},{156,384},{152,384},{144,384},{132,384},{128,384},{124,384},{120,384},{116,384},{112,384},{108,384},{284,380},{280,380},{252,380},{248,380},{232,380},{228,380},{224,380},{220,380},{216,380},{212,380},{200,380},{196,380},{188,380},{184,380},{180,380},{176,380},{152,380},{144,380},{124,380},{120,380},{116,380},{288,376},{284,376},{268,376},{260,376},{252,376},{248,376},{244,376},{240,376},{220,376},{208,376},{200,376},{196,376},{192,376},{188,376},{180,376},{176,376},{168,376},{156,376},{144,376},{136,376},{132,376},{120,376},{116,376},{112,376},{108,376},{292,372},{288,372},{276,372},{236,372},{232,372},{224,372},{220,372},{208,372},{200,372},{196,372},{180,372},{164,372},{156,372},{148,372},{120,372},{116,372},{112,372},{108,372},{296,368},{292,368},{268,368},{264,368},{236,368},{232,368},{220,368},{188,368},{180,368},{176,368},{172,368},{164,368},{148,368},{140,368},{136,368},{132,368},{116,368},{112,368},{108,368},{104,368},{100,368},{96,368},{300,364},{296,364},{276,364},{268,364},{264,364},{260,364},{256,364},{248,364},{244,364},{232,364},{228,364},{208,364},{196,364},{180,364},{172,364},{156,364},{124,364},{116,364},{112,364},{108,364},{104,364},{100,364},{96,364},{300,360},{216,360},{212,360},{208,360},{196,360},{188,360},{184,360},{172,360},{168,360},{164,360},{156,360},{152,360},{148,360},{144,360},{132,360},{128,360},{112,360},{108,360},{104,360},{100,360},{96,360},{300,356},{288,356},{284,356},{272,356},{268,356},{244,356},{228,356},{224,356},{188,356},{184,356},{180,356},{176,356},{172,356},{168,356},{164,356},{152,356},{144,356},{140,356},{128,356},{120,356},{112,356},{108,356},{104,356},{100,356},{96,356},{304,352},{300,352},{288,352},{284,352},{272,352},{268,352},{256,352},{252,352},{244,352},{236,352},{216,352},{212,352},{152,352},{144,352},{140,352},{136,352},{132,352},{128,352},{108,352},{104,352},{100,352},{96,352},{92,352},{304,348},{256,348},{252,348},{204,348},{188,348},{184,348},{176,348},{172,348},{164,348},{132,348},{128,348},{120,348},{116,348},{108,348},{104,348},{100,348},{96,348},{92,348},{88,348},{304,344},{224,344},{188,344},{184,344},{176,344},{172,344},{164,344},{156,344},{148,344},{144,344},{140,344},{132,344},{124,344},{120,344},{116,344},{104,344},{100,344},{96,344},{304,340},{284,340},{280,340},{244,340},{236,340},{208,340},{148,340},{144,340},{140,340},{132,340},{124,340},{120,340},{116,340},{104,340},{100,340},{96,340},{304,336},{268,336},{264,336},{220,336},{216,336},{208,336},{200,336},{180,336},{168,336},{164,336},{104,336},{100,336},{96,336},{92,336},{88,336},{308,332},{304,332},{292,332},{288,332},{268,332},{264,332},{220,332},{216,332},{180,332},{168,332},{164,332},{140,332},{124,332},{104,332},{100,332},{96,332},{92,332},{88,332},{84,332},{308,328},{292,328},{288,328},{240,328},{236,328},{228,328},{152,328},{140,328},{104,328},{100,328},{96,328},{92,328},{88,328},{308,324},{272,324},{268,324},{252,324},{248,324},{196,324},{108,324},{104,324},{100,324},{96,324},{92,324},{88,324},{308,320},{284,320},{252,320},{248,320},{220,320},{216,320},{208,320},{180,320},{176,320},{172,320},{128,320},{124,320},{120,320},{116,320},{108,320},{104,320},{100,320},{96,320},{308,316},{264,316},{260,316},{180,316},{176,316},{172,316},{168,316},{164,316},{160,316},{156,316},{152,316},{148,316},{144,316},{140,316},{136,316},{132,316},{128,316},{124,316},{120,316},{116,316},{108,316},{104,316},{100,316},{308,312},{248,312},{244,312},{228,312},{184,312},{180,312},{176,312},{172,312},{168,312},{164,312},{160,312},{156,312},{152,312},{148,312},{144,312},{140,312},{136,312},{132,312},{128,312},{124,312},{120,312},{116,312},{108,312},{104,312},{100,312},{96,312},{92,312},{88,312},{84,312},{80,312},{76,312},{308,308},{248,308},{244,308},{228,308},{212,308},{200,308},{184,308},{180,308},{176,308},{172,308},{168,308},{164,308},{160,308},{156,308},{152,308},{148,308},{144,308},{140,308},{136,308},{132,308},{128,308},{124,308},{120,308},{116,308},{112,308},{104,308},{100,308},{96,308},{92,308},{308,304},{188,304},{184,304},{180,304},{176,304},{172,304},{168,304},{164,304},{160,304},{156,304},{152,304},{148,304},{144,304},{140,304},{136,304},{132,304},{128,304},{124,304},{120,304},{116,304},{112,304},{104,304},{100,304},{96,304},{92,304},{88,304},{84,304},{80,304},{76,304},{72,304},{68,304},{64,304},{60,304},{56,304},{52,304},{48,304},{308,300},{304,300},{232,300},{228,300},{212,300},{188,300},{184,300},{180,300},{176,300},{172,300},{168,300},{164,300},{160,300},{156,300},{152,300},{148,300},{144,300},{140,300},{136,300},{132,300},{128,300},{124,300},{120,300},{116,300},{112,300},{108,300},{100,300},{96,300},{92,300},{88,300},{84,300},{80,300},{308,296},{304,296},{232,296},{228,296},{212,296},{188,296},{184,296},{180,296},{176,296},{172,296},{168,296},{164,296},{160,296},{156,296},{152,296},{148,296},{144,296},{140,296},{136,296},{132,296},{128,296},{124,296},{120,296},{116,296},{112,296},{108,296},{100,296},{96,296},{92,296},{88,296},{84,296},{304,292},{188,292},{184,292},{180,292},{176,292},{172,292},{168,292},{164,292},{160,292},{156,292},{152,292},{148,292},{144,292},{140,292},{136,292},{132,292},{128,292},{124,292},{120,292},{116,292},{112,292},{108,292},{104,292},{96,292},{92,292},{88,292},{84,292},{80,292},{76,292},{72,292},{304,288},{216,288},{188,288},{184,288},{180,288},{176,288},{172,288},{168,288},{164,288},{160,288},{156,288},{152,288},{148,288},{144,288},{140,288},{136,288},{132,288},{128,288},{124,288},{120,288},{116,288},{112,288},{108,288},{104,288},{92,288},{88,288},{84,288},{80,288},{76,288},{72,288},{68,288},{64,288},{60,288},{56,288},{304,284},{192,284},{188,284},{184,284},{180,284},{176,284},{172,284},{168,284},{164,284},{160,284},{156,284},{152,284},{148,284},{144,284},{140,284},{136,284},{132,284},{128,284},{124,284},{120,284},{116,284},{112,284},{108,284},{92,284},{88,284},{84,284},{80,284},{76,284},{304,280},{300,280},{196,280},{192,280},{188,280},{184,280},{180,280},{176,280},{172,280},{168,280},{164,280},{160,280},{156,280},{152,280},{148,280},{116,280},{112,280},{108,280},{92,280},{88,280},{304,276},{300,276},{200,276},{196,276},{192,276},{188,276},{184,276},{180,276},{176,276},{172,276},{168,276},{164,276},{160,276},{120,276},{116,276},{112,276},{108,276},{104,276},{96,276},{92,276},{88,276},{300,272},{200,272},{196,272},{192,272},{188,272},{184,272},{180,272},{176,272},{172,272},{168,272},{164,272},{148,272},{144,272},{140,272},{136,272},{132,272},{128,272},{124,272},{120,272},{116,272},{112,272},{108,272},{96,272},{92,272},{88,272},{84,272},{80,272},{60,272},{56,272},{52,272},{48,272},{300,268},{272,268},{268,268},{264,268},{260,268},{204,268},{200,268},{196,268},{192,268},{188,268},{184,268},{180,268},{176,268},{172,268},{168,268},{152,268},{148,268},{128,268},{124,268},{120,268},{116,268},{112,268},{108,268},{96,268},{92,268},{88,268},{84,268},{80,268},{76,268},{72,268},{68,268},{64,268},{300,264},{272,264},{268,264},{264,264},{260,264},{256,264},{208,264},{204,264},{200,264},{196,264},{192,264},{188,264},{184,264},{180,264},{176,264},{172,264},{168,264},{164,264},{160,264},{156,264},{144,264},{140,264},{136,264},{132,264},{124,264},{120,264},{116,264},{112,264},{92,264},{88,264},{84,264},{80,264},{76,264},{72,264},{300,260},{296,260},{276,260},{272,260},{268,260},{264,260},{260,260},{256,260},{252,260},{248,260},{212,260},{208,260},{204,260},{200,260},{196,260},{192,260},{188,260},{184,260},{180,260},{176,260},{172,260},{168,260},{164,260},{160,260},{152,260},{148,260},{128,260},{124,260},{120,260},{116,260},{88,260},{84,260},{80,260},{76,260},{296,256},{276,256},{272,256},{268,256},{264,256},{260,256},{256,256},{252,256},{248,256},{244,256},{240,256},{216,256},{212,256},{208,256},{204,256},{200,256},{196,256},{192,256},{188,256},{184,256},{180,256},{176,256},{172,256},{168,256},{164,256},{160,256},{156,256},{124,256},{120,256},{116,256},{96,256},{92,256},{88,256},{84,256},{80,256},{76,256},{72,256},{68,256},{64,256},{296,252},{276,252},{272,252},{268,252},{264,252},{260,252},{256,252},{252,252},{248,252},{244,252},{240,252},{236,252},{216,252},{212,252},{208,252},{204,252},{200,252},{196,252},{192,252},{188,252},{184,252},{180,252},{176,252},{172,252},{168,252},{164,252},{148,252},{144,252},{120,252},{116,252},{100,252},{96,252},{92,252},{88,252},{84,252},{80,252},{76,252},{72,252},{68,252},{64,252},{60,252},{296,248},{276,248},{272,248},{268,248},{264,248},{260,248},{256,248},{252,248},{248,248},{244,248},{240,248},{236,248},{216,248},{212,248},{208,248},{204,248},{200,248},{196,248},{192,248},{188,248},{184,248},{180,248},{176,248},{172,248},{168,248},{164,248},{160,248},{156,248},{152,248},{148,248},{128,248},{124,248},{120,248},{112,248},{108,248},{100,248},{96,248},{92,248},{300,244},{296,244},{276,244},{272,244},{268,244},{264,244},{260,244},{256,244},{252,244},{248,244},{244,244},{240,244},{236,244},{220,244},{216,244},{212,244},{208,244},{204,244},{200,244},{196,244},{192,244},{188,244},{184,244},{180,244},{176,244},{172,244},{168,244},{164,244},{160,244},{156,244},{152,244},{148,244},{144,244},{140,244},{136,244},{132,244},{128,244},{124,244},{120,244},{112,244},{108,244},{100,244},{96,244},{92,244},{300,240},{276,240},{272,240},{268,240},{264,240},{260,240},{256,240},{252,240},{248,240},{244,240},{240,240},{236,240},{220,240},{216,240},{212,240},{208,240},{204,240},{200,240},{196,240},{192,240},{188,240},{184,240},{180,240},{176,240},{172,240},{168,240},{164,240},{160,240},{156,240},{152,240},{148,240},{144,240},{140,240},{136,240},{132,240},{128,240},{124,240},{120,240},{116,240},{108,240},{104,240},{96,240},{92,240},{300,236},{272,236},{268,236},{264,236},{260,236},{256,236},{252,236},{248,236},{244,236},{240,236},{236,236},{232,236},{216,236},{212,236},{208,236},{204,236},{200,236},{196,236},{192,236},{188,236},{184,236},{180,236},{176,236},{172,236},{168,236},{164,236},{160,236},{156,236},{152,236},{148,236},{144,236},{140,236},{136,236},{132,236},{128,236},{124,236},{120,236},{116,236},{112,236},{104,236},{96,236},{92,236},{300,232},{268,232},{264,232},{260,232},{256,232},{252,232},{248,232},{244,232},{240,232},{236,232},{232,232},{216,232},{212,232},{208,232},{204,232},{200,232},{196,232},{192,232},{188,232},{184,232},{180,232},{176,232},{172,232},{168,232},{164,232},{160,232},{156,232},{152,232},{148,232},{144,232},{140,232},{136,232},{132,232},{128,232},{124,232},{120,232},{116,232},{112,232},{108,232},{96,232},{92,232},{88,232},{84,232},{80,232},{300,228},{264,228},{260,228},{256,228},{248,228},{244,228},{240,228},{236,228},{232,228},{224,228},{212,228},{208,228},{204,228},{200,228},{196,228},{192,228},{188,228},{184,228},{180,228},{176,228},{172,228},{168,228},{164,228},{160,228},{156,228},{152,228},{148,228},{144,228},{140,228},{136,228},{132,228},{128,228},{124,228},{120,228},{116,228},{112,228},{108,228},{104,228},{96,228},{92,228},{88,228},{84,228},{80,228},{76,228},{72,228},{300,224},{268,224},{252,224},{248,224},{244,224},{240,224},{236,224},{232,224},{224,224},{212,224},{208,224},{204,224},{200,224},{196,224},{192,224},{188,224},{184,224},{180,224},{176,224},{172,224},{168,224},{164,224},{160,224},{156,224},{152,224},{148,224},{144,224},{140,224},{136,224},{132,224},{128,224},{124,224},{120,224},{116,224},{112,224},{108,224},{104,224},{100,224},{92,224},{88,224},{84,224},{80,224},{76,224},{296,220},{272,220},{268,220},{264,220},{260,220},{256,220},{252,220},{248,220},{244,220},{240,220},{236,220},{228,220},{224,220},{216,220},{212,220},{208,220},{204,220},{200,220},{196,220},{192,220},{188,220},{184,220},{180,220},{176,220},{172,220},{168,220},{164,220},{160,220},{156,220},{152,220},{148,220},{144,220},{140,220},{136,220},{132,220},{128,220},{124,220},{120,220},{116,220},{112,220},{108,220},{104,220},{100,220},{96,220},{88,220},{84,220},{80,220},{76,220},{72,220},{68,220},{64,220},{60,220},{56,220},{52,220},{48,220},{44,220},{40,220},{296,216},{292,216},{276,216},{272,216},{268,216},{264,216},{260,216},{256,216},{252,216},{248,216},{244,216},{240,216},{236,216},{232,216},{228,216},{224,216},{216,216},{208,216},{204,216},{200,216},{196,216},{192,216},{188,216},{184,216},{180,216},{176,216},{172,216},{168,216},{164,216},{160,216},{156,216},{152,216},{148,216},{144,216},{140,216},{136,216},{132,216},{128,216},{124,216},{120,216},{116,216},{112,216},{108,216},{104,216},{100,216},{96,216},{88,216},{84,216},{80,216},{76,216},{72,216},{68,216},{292,212},{288,212},{280,212},{276,212},{272,212},{268,212},{264,212},{260,212},{256,212},{252,212},{248,212},{244,212},{240,212},{236,212},{232,212},{228,212},{208,212},{204,212},{200,212},{196,212},{192,212},{188,212},{184,212},{180,212},{176,212},{172,212},{168,212},{164,212},{160,212},{156,212},{152,212},{148,212},{144,212},{140,212},{136,212},{132,212},{128,212},{124,212},{120,212},{108,212},{104,212},{92,212},{88,212},{84,212},{288,208},{276,208},{272,208},{268,208},{264,208},{260,208},{256,208},{252,208},{248,208},{244,208},{240,208},{236,208},{232,208},{228,208},{212,208},{208,208},{204,208},{200,208},{196,208},{192,208},{188,208},{184,208},{180,208},{176,208},{172,208},{168,208},{164,208},{160,208},{156,208},{152,208},{148,208},{144,208},{140,208},{136,208},{132,208},{128,208},{124,208},{120,208},{116,208},{112,208},{96,208},{92,208},{88,208},{288,204},{272,204},{268,204},{264,204},{260,204},{256,204},{252,204},{248,204},{244,204},{240,204},{236,204},{232,204},{224,204},{212,204},{208,204},{204,204},{200,204},{196,204},{192,204},{188,204},{184,204},{180,204},{176,204},{172,204},{168,204},{164,204},{160,204},{156,204},{152,204},{148,204},{144,204},{140,204},{136,204},{132,204},{128,204},{124,204},{120,204},{112,204},{108,204},{96,204},{92,204},{88,204},{84,204},{80,204},{76,204},{288,200},{268,200},{264,200},{260,200},{256,200},{252,200},{248,200},{244,200},{240,200},{236,200},{232,200},{224,200},{212,200},{200,200},{192,200},{188,200},{184,200},{180,200},{176,200},{172,200},{168,200},{164,200},{160,200},{156,200},{152,200},{148,200},{144,200},{140,200},{136,200},{132,200},{128,200},{120,200},{100,200},{92,200},{88,200},{84,200},{80,200},{76,200},{72,200},{68,200},{64,200},{292,196},{288,196},{264,196},{260,196},{256,196},{252,196},{248,196},{244,196},{240,196},{236,196},{232,196},{228,196},{224,196},{200,196},{192,196},{188,196},{184,196},{180,196},{176,196},{172,196},{168,196},{164,196},{160,196},{156,196},{152,196},{148,196},{144,196},{140,196},{136,196},{108,196},{104,196},{100,196},{92,196},{88,196},{84,196},{80,196},{76,196},{72,196},{292,192},{260,192},{256,192},{252,192},{248,192},{244,192},{240,192},{236,192},{232,192},{228,192},{220,192},{204,192},{192,192},{188,192},{180,192},{176,192},{172,192},{168,192},{164,192},{160,192},{156,192},{152,192},{148,192},{144,192},{140,192},{124,192},{120,192},{116,192},{112,192},{108,192},{96,192},{92,192},{88,192},{84,192},{80,192},{292,188},{256,188},{252,188},{248,188},{244,188},{240,188},{236,188},{232,188},{228,188},{224,188},{220,188},{212,188},{204,188},{196,188},{192,188},{180,188},{176,188},{172,188},{168,188},{164,188},{160,188},{156,188},{152,188},{148,188},{144,188},{140,188},{128,188},{124,188},{104,188},{100,188},{96,188},{92,188},{88,188},{292,184},{252,184},{248,184},{244,184},{240,184},{236,184},{232,184},{228,184},{224,184},{220,184},{216,184},{212,184},{196,184},{184,184},{180,184},{176,184},{172,184},{168,184},{164,184},{160,184},{156,184},{152,184},{148,184},{144,184},{140,184},{136,184},{132,184},{128,184},{124,184},{120,184},{116,184},{112,184},{108,184},{100,184},{96,184},{92,184},{88,184},{84,184},{80,184},{296,180},{252,180},{248,180},{244,180},{240,180},{236,180},{232,180},{228,180},{224,180},{220,180},{212,180},{184,180},{180,180},{176,180},{172,180},{168,180},{164,180},{160,180},{156,180},{152,180},{148,180},{144,180},{140,180},{136,180},{132,180},{128,180},{124,180},{120,180},{116,180},{112,180},{108,180},{100,180},{96,180},{92,180},{88,180},{300,176},{296,176},{248,176},{244,176},{240,176},{236,176},{232,176},{228,176},{224,176},{220,176},{212,176},{208,176},{200,176},{184,176},{176,176},{172,176},{168,176},{164,176},{160,176},{156,176},{152,176},{148,176},{144,176},{140,176},{136,176},{132,176},{128,176},{124,176},{120,176},{104,176},{100,176},{96,176},{92,176},{88,176},{84,176},{304,172},{300,172},{244,172},{240,172},{236,172},{232,172},{228,172},{224,172},{220,172},{216,172},{212,172},{204,172},{192,172},{184,172},{176,172},{172,172},{168,172},{164,172},{160,172},{156,172},{152,172},{148,172},{144,172},{140,172},{136,172},{132,172},{128,172},{124,172},{120,172},{116,172},{108,172},{104,172},{100,172},{308,168},{304,168},{240,168},{236,168},{232,168},{228,168},{224,168},{220,168},{216,168},{212,168},{208,168},{204,168},{200,168},{192,168},{188,168},{184,168},{180,168},{176,168},{172,168},{168,168},{164,168},{160,168},{156,168},{152,168},{148,168},{144,168},{140,168},{136,168},{132,168},{128,168},{124,168},{120,168},{116,168},{104,168},{100,168},{96,168},{92,168},{88,168},{312,164},{308,164},{240,164},{236,164},{232,164},{228,164},{224,164},{220,164},{216,164},{212,164},{208,164},{204,164},{200,164},{196,164},{192,164},{188,164},{180,164},{176,164},{172,164},{168,164},{164,164},{160,164},{156,164},{152,164},{148,164},{144,164},{140,164},{136,164},{132,164},{124,164},{116,164},{100,164},{96,164},{92,164},{316,160},{312,160},{236,160},{232,160},{228,160},{224,160},{220,160},{216,160},{212,160},{208,160},{204,160},{200,160},{196,160},{192,160},{188,160},{184,160},{176,160},{172,160},{168,160},{164,160},{160,160},{148,160},{144,160},{136,160},{96,160},{92,160},{320,156},{316,156},{232,156},{228,156},{224,156},{220,156},{216,156},{212,156},{208,156},{204,156},{200,156},{196,156},{192,156},{188,156},{184,156},{180,156},{176,156},{172,156},{168,156},{164,156},{160,156},{144,156},{100,156},{96,156},{92,156},{88,156},{320,152},{228,152},{224,152},{220,152},{216,152},{212,152},{208,152},{204,152},{200,152},{196,152},{192,152},{188,152},{184,152},{180,152},{176,152},{172,152},{168,152},{164,152},{160,152},{152,152},{148,152},{144,152},{140,152},{136,152},{108,152},{100,152},{96,152},{92,152},{88,152},{84,152},{224,148},{220,148},{216,148},{212,148},{208,148},{204,148},{200,148},{196,148},{192,148},{188,148},{184,148},{180,148},{176,148},{172,148},{156,148},{152,148},{148,148},{144,148},{140,148},{136,148},{128,148},{116,148},{112,148},{108,148},{104,148},{100,148},{96,148},{220,144},{216,144},{212,144},{208,144},{204,144},{200,144},{196,144},{192,144},{188,144},{184,144},{180,144},{152,144},{148,144},{144,144},{140,144},{136,144},{132,144},{128,144},{124,144},{120,144},{116,144},{112,144},{108,144},{104,144},{100,144},{96,144},{92,144},{88,144},{84,144},{80,144},{216,140},{212,140},{208,140},{204,140},{200,140},{196,140},{192,140},{188,140},{184,140},{212,136},{208,136},{204,136},{200,136},{196,136},{192,136},{188,136},{208,132},{204,132},{200,132},{196,132},{192,132},{188,132},{204,128},{200,128},{196,128},{192,128},{196,124}};
-const short title_c1[446][2] = {{280,136},{276,136},{288,132},{284,132},{280,132},{276,132},{292,128},{288,128},{272,128},{296,124},{292,124},{284,124},{280,124},{276,124},{272,124},{296,120},{288,120},{284,120},{280,120},{276,120},{272,120},{268,120},{296,116},{288,116},{284,116},{280,116},{276,116},{272,116},{268,116},{264,116},{296,112},{292,112},{284,112},{280,112},{276,112},{272,112},{268,112},{264,112},{260,112},{228,112},{224,112},{292,108},{284,108},{260,108},{256,108},{252,108},{236,108},{232,108},{224,108},{220,108},{292,104},{288,104},{280,104},{276,104},{272,104},{268,104},{264,104},{248,104},{244,104},{240,104},{236,104},{232,104},{228,104},{220,104},{216,104},{292,100},{284,100},{280,100},{276,100},{272,100},{268,100},{264,100},{260,100},{256,100},{252,100},{248,100},{244,100},{240,100},{236,100},{228,100},{224,100},{216,100},{212,100},{292,96},{284,96},{280,96},{276,96},{272,96},{268,96},{264,96},{248,96},{244,96},{240,96},{236,96},{228,96},{224,96},{220,96},{212,96},{292,92},{284,92},{280,92},{276,92},{272,92},{268,92},{264,92},{260,92},{256,92},{252,92},{244,92},{240,92},{236,92},{228,92},{224,92},{220,92},{212,92},{208,92},{292,88},{284,88},{280,88},{276,88},{272,88},{268,88},{264,88},{260,88},{256,88},{252,88},{248,88},{240,88},{236,88},{228,88},{224,88},{220,88},{216,88},{208,88},{292,84},{288,84},{276,84},{272,84},{268,84},{264,84},{260,84},{256,84},{252,84},{248,84},{240,84},{236,84},{232,84},{224,84},{220,84},{216,84},{208,84},{288,80},{284,80},{280,80},{260,80},{256,80},{252,80},{244,80},{240,80},{236,80},{224,80},{220,80},{216,80},{208,80},{280,76},{272,76},{268,76},{264,76},{248,76},{244,76},{240,76},{232,76},{228,76},{224,76},{220,76},{216,76},{208,76},{284,72},{280,72},{272,72},{268,72},{264,72},{260,72},{256,72},{252,72},{248,72},{244,72},{240,72},{232,72},{228,72},{224,72},{220,72},{216,72},{208,72},{284,68},{276,68},{272,68},{268,68},{264,68},{260,68},{256,68},{252,68},{248,68},{244,68},{240,68},{228,68},{224,68},{220,68},{212,68},{208,68},{288,64},{284,64},{276,64},{272,64},{268,64},{264,64},{260,64},{256,64},{252,64},{248,64},{244,64},{240,64},{236,64},{216,64},{212,64},{292,60},{288,60},{280,60},{264,60},{260,60},{256,60},{252,60},{248,60},{244,60},{240,60},{224,60},{220,60},{216,60},{292,56},{284,56},{280,56},{276,56},{272,56},{268,56},{236,56},{232,56},{224,56},{296,52},{292,52},{284,52},{280,52},{276,52},{272,52},{268,52},{264,52},{260,52},{252,52},{248,52},{244,52},{240,52},{236,52},{232,52},{224,52},{220,52},{296,48},{288,48},{284,48},{280,48},{276,48},{272,48},{268,48},{264,48},{256,48},{248,48},{244,48},{240,48},{236,48},{232,48},{228,48},{220,48},{296,44},{288,44},{284,44},{280,44},{276,44},{272,44},{268,44},{260,44},{256,44},{248,44},{244,44},{240,44},{236,44},{232,44},{228,44},{220,44},{296,40},{288,40},{284,40},{280,40},{276,40},{272,40},{268,40},{260,40},{256,40},{248,40},{244,40},{240,40},{236,40},{232,40},{228,40},{220,40},{216,40},{296,36},{288,36},{284,36},{280,36},{276,36},{272,36},{264,36},{260,36},{256,36},{252,36},{244,36},{240,36},{236,36},{232,36},{228,36},{224,36},{216,36},{296,32},{288,32},{284,32},{280,32},{276,32},{272,32},{264,32},{252,32},{244,32},{240,32},{236,32},{232,32},{228,32},{224,32},{216,32},{296,28},{288,28},{284,28},{280,28},{276,28},{268,28},{264,28},{252,28},{248,28},{240,28},{236,28},{232,28},{228,28},{224,28},{216,28},{212,28},{300,24},{296,24},{288,24},{284,24},{280,24},{276,24},{268,24},{248,24},{244,24},{236,24},{232,24},{228,24},{224,24},{220,24},{212,24},{300,20},{292,20},{288,20},{284,20},{280,20},{276,20},{268,20},{244,20},{236,20},{232,20},{228,20},{224,20},{220,20},{212,20},{208,20},{304,16},{300,16},{292,16},{288,16},{284,16},{280,16},{276,16},{268,16},{244,16},{240,16},{232,16},{228,16},{224,16},{220,16},{216,16},{208,16},{204,16},{304,12},{296,12},{292,12},{288,12},{284,12},{280,12},{272,12},{268,12},{240,12},{232,12},{228,12},{224,12},{220,12},{216,12},{212,12},{204,12},{304,8},{296,8},{292,8},{288,8},{284,8},{280,8},{272,8},{240,8},{236,8},{228,8},{224,8},{220,8},{216,8},{212,8},{204,8},{304,4},{300,4},{272,4},{236,4},{232,4},{208,4},{204,4}};
-const short title_c2[407][2] = {{276,120},{272,120},{280,116},{276,116},{268,116},{264,116},{284,112},{280,112},{268,112},{264,112},{260,112},{224,112},{288,108},{284,108},{276,108},{268,108},{264,108},{260,108},{256,108},{252,108},{232,108},{224,108},{220,108},{292,104},{288,104},{280,104},{276,104},{272,104},{264,104},{260,104},{256,104},{252,104},{248,104},{244,104},{236,104},{232,104},{220,104},{216,104},{292,100},{284,100},{280,100},{276,100},{272,100},{268,100},{260,100},{256,100},{252,100},{248,100},{244,100},{236,100},{232,100},{224,100},{216,100},{212,100},{292,96},{284,96},{280,96},{276,96},{272,96},{268,96},{264,96},{228,96},{224,96},{220,96},{212,96},{292,92},{284,92},{280,92},{276,92},{272,92},{268,92},{264,92},{260,92},{256,92},{252,92},{240,92},{236,92},{232,92},{228,92},{224,92},{220,92},{212,92},{208,92},{292,88},{284,88},{280,88},{276,88},{272,88},{268,88},{264,88},{260,88},{256,88},{252,88},{248,88},{240,88},{236,88},{228,88},{224,88},{220,88},{216,88},{208,88},{292,84},{288,84},{276,84},{272,84},{268,84},{264,84},{260,84},{256,84},{252,84},{248,84},{240,84},{236,84},{228,84},{224,84},{220,84},{216,84},{208,84},{288,80},{284,80},{280,80},{260,80},{256,80},{252,80},{240,80},{224,80},{220,80},{216,80},{208,80},{280,76},{272,76},{268,76},{264,76},{244,76},{240,76},{232,76},{228,76},{224,76},{220,76},{216,76},{208,76},{284,72},{280,72},{272,72},{268,72},{264,72},{260,72},{256,72},{252,72},{244,72},{240,72},{232,72},{228,72},{224,72},{220,72},{216,72},{208,72},{284,68},{276,68},{272,68},{268,68},{264,68},{260,68},{256,68},{252,68},{244,68},{240,68},{228,68},{224,68},{220,68},{212,68},{208,68},{288,64},{284,64},{276,64},{272,64},{268,64},{264,64},{260,64},{256,64},{248,64},{244,64},{240,64},{236,64},{216,64},{212,64},{292,60},{288,60},{280,60},{264,60},{260,60},{256,60},{248,60},{244,60},{240,60},{236,60},{224,60},{220,60},{216,60},{292,56},{284,56},{280,56},{276,56},{272,56},{268,56},{252,56},{232,56},{224,56},{296,52},{292,52},{284,52},{280,52},{276,52},{272,52},{268,52},{264,52},{260,52},{252,52},{248,52},{244,52},{240,52},{236,52},{232,52},{224,52},{220,52},{296,48},{288,48},{284,48},{280,48},{276,48},{272,48},{268,48},{264,48},{256,48},{248,48},{244,48},{240,48},{236,48},{232,48},{228,48},{220,48},{296,44},{288,44},{284,44},{280,44},{276,44},{272,44},{268,44},{260,44},{256,44},{248,44},{244,44},{240,44},{236,44},{232,44},{228,44},{220,44},{296,40},{288,40},{284,40},{280,40},{276,40},{272,40},{268,40},{260,40},{256,40},{248,40},{244,40},{240,40},{236,40},{232,40},{228,40},{220,40},{216,40},{296,36},{288,36},{284,36},{280,36},{276,36},{272,36},{264,36},{260,36},{256,36},{252,36},{244,36},{240,36},{236,36},{232,36},{228,36},{224,36},{216,36},{296,32},{288,32},{284,32},{280,32},{276,32},{272,32},{264,32},{252,32},{244,32},{240,32},{236,32},{232,32},{228,32},{224,32},{216,32},{296,28},{288,28},{284,28},{280,28},{276,28},{268,28},{264,28},{252,28},{248,28},{240,28},{236,28},{232,28},{228,28},{224,28},{216,28},{212,28},{300,24},{296,24},{288,24},{284,24},{280,24},{276,24},{268,24},{248,24},{244,24},{236,24},{232,24},{228,24},{224,24},{220,24},{212,24},{300,20},{292,20},{288,20},{284,20},{280,20},{276,20},{268,20},{244,20},{236,20},{232,20},{228,20},{224,20},{220,20},{212,20},{208,20},{304,16},{300,16},{292,16},{288,16},{284,16},{280,16},{276,16},{268,16},{244,16},{240,16},{232,16},{228,16},{224,16},{220,16},{216,16},{208,16},{204,16},{304,12},{296,12},{292,12},{288,12},{284,12},{280,12},{272,12},{268,12},{240,12},{232,12},{228,12},{224,12},{220,12},{216,12},{212,12},{204,12},{304,8},{296,8},{292,8},{288,8},{284,8},{280,8},{272,8},{240,8},{236,8},{228,8},{224,8},{220,8},{216,8},{212,8},{204,8},{304,4},{300,4},{272,4},{236,4},{232,4},{208,4},{204,4}};
-const short title_ready[1236][2] = {{64,188},{60,188},{56,188},{52,188},{48,188},{44,188},{40,188},{36,188},{32,188},{28,188},{24,188},{20,188},{16,188},{12,188},{-8,188},{-12,188},{-16,188},{-20,188},{-24,188},{-28,188},{-32,188},{-36,188},{-40,188},{-44,188},{-48,188},{-52,188},{-56,188},{-60,188},{68,184},{8,184},{-4,184},{-64,184},{68,180},{8,180},{-4,180},{-64,180},{68,176},{8,176},{-4,176},{-64,176},{68,172},{8,172},{-4,172},{-64,172},{68,168},{8,168},{-4,168},{-64,168},{68,164},{8,164},{-4,164},{-64,164},{68,160},{8,160},{-4,160},{-64,160},{68,156},{8,156},{-4,156},{-64,156},{68,152},{8,152},{-4,152},{-64,152},{68,148},{8,148},{-4,148},{-64,148},{64,144},{60,144},{56,144},{52,144},{48,144},{44,144},{40,144},{36,144},{32,144},{28,144},{24,144},{20,144},{16,144},{12,144},{-8,144},{-12,144},{-16,144},{-20,144},{-24,144},{-28,144},{-32,144},{-36,144},{-40,144},{-44,144},{-48,144},{-52,144},{-56,144},{-60,144},{88,124},{84,124},{80,124},{76,124},{72,124},{68,124},{64,124},{60,124},{56,124},{52,124},{48,124},{44,124},{40,124},{36,124},{32,124},{28,124},{24,124},{20,124},{16,124},{76,120},{72,120},{68,120},{64,120},{60,120},{56,120},{52,120},{48,120},{44,120},{40,120},{-36,120},{-40,120},{-44,120},{-48,120},{-52,120},{-56,120},{-60,120},{-64,120},{-68,120},{-72,120},{-76,120},{-80,120},{120,116},{116,116},{112,116},{108,116},{104,116},{100,116},{96,116},{92,116},{88,116},{84,116},{80,116},{76,116},{72,116},{68,116},{64,116},{60,116},{56,116},{52,116},{48,116},{44,116},{40,116},{36,116},{32,116},{28,116},{24,116},{20,116},{16,116},{12,116},{8,116},{4,116},{0,116},{-4,116},{-8,116},{-12,116},{-16,116},{-20,116},{-24,116},{-28,116},{-32,116},{-36,116},{-40,116},{-44,116},{-48,116},{-52,116},{-56,116},{-60,116},{-64,116},{-68,116},{-72,116},{-76,116},{-80,116},{-84,116},{-88,116},{-92,116},{-96,116},{-116,116},{-120,116},{-124,116},{-128,116},{116,112},{112,112},{108,112},{104,112},{100,112},{96,112},{92,112},{88,112},{84,112},{80,112},{76,112},{72,112},{68,112},{64,112},{60,112},{56,112},{52,112},{48,112},{44,112},{40,112},{36,112},{32,112},{28,112},{24,112},{20,112},{16,112},{12,112},{8,112},{4,112},{0,112},{-4,112},{-8,112},{-12,112},{-16,112},{-20,112},{-24,112},{-28,112},{-32,112},{-36,112},{-40,112},{-44,112},{-48,112},{-52,112},{-56,112},{-60,112},{-64,112},{-68,112},{-72,112},{-76,112},{-80,112},{-84,112},{-88,112},{-92,112},{-96,112},{-100,112},{-104,112},{-108,112},{-112,112},{-116,112},{-120,112},{-124,112},{-128,112},{116,108},{112,108},{80,108},{76,108},{72,108},{40,108},{36,108},{32,108},{28,108},{24,108},{20,108},{8,108},{4,108},{0,108},{-4,108},{-8,108},{-32,108},{-36,108},{-40,108},{-44,108},{-48,108},{-60,108},{-64,108},{-68,108},{-72,108},{-84,108},{-88,108},{-92,108},{-120,108},{-124,108},{-128,108},{-132,108},{-136,108},{-140,108},{-144,108},{-148,108},{-152,108},{-156,108},{140,104},{136,104},{132,104},{128,104},{124,104},{120,104},{116,104},{112,104},{76,104},{72,104},{40,104},{36,104},{32,104},{28,104},{24,104},{8,104},{4,104},{0,104},{-4,104},{-8,104},{-32,104},{-36,104},{-40,104},{-44,104},{-48,104},{-60,104},{-64,104},{-68,104},{-72,104},{-84,104},{-88,104},{-124,104},{-128,104},{-132,104},{-136,104},{-140,104},{116,100},{112,100},{100,100},{96,100},{92,100},{88,100},{76,100},{72,100},{60,100},{56,100},{52,100},{48,100},{44,100},{40,100},{36,100},{32,100},{28,100},{24,100},{8,100},{4,100},{0,100},{-4,100},{-8,100},{-20,100},{-24,100},{-28,100},{-40,100},{-44,100},{-48,100},{-60,100},{-64,100},{-68,100},{-72,100},{-84,100},{-88,100},{-100,100},{-104,100},{-108,100},{-112,100},{-124,100},{-128,100},{-132,100},{132,96},{128,96},{124,96},{120,96},{116,96},{112,96},{100,96},{96,96},{92,96},{88,96},{76,96},{72,96},{60,96},{56,96},{52,96},{48,96},{44,96},{40,96},{36,96},{32,96},{28,96},{4,96},{0,96},{-4,96},{-8,96},{-20,96},{-24,96},{-28,96},{-40,96},{-44,96},{-48,96},{-60,96},{-64,96},{-68,96},{-72,96},{-84,96},{-88,96},{-100,96},{-104,96},{-108,96},{-112,96},{-124,96},{-128,96},{-132,96},{-136,96},{-140,96},{-144,96},{-148,96},{136,92},{132,92},{128,92},{124,92},{120,92},{116,92},{112,92},{100,92},{96,92},{92,92},{88,92},{76,92},{72,92},{60,92},{56,92},{52,92},{48,92},{44,92},{40,92},{36,92},{32,92},{28,92},{16,92},{4,92},{0,92},{-4,92},{-8,92},{-20,92},{-24,92},{-28,92},{-32,92},{-44,92},{-48,92},{-60,92},{-64,92},{-68,92},{-72,92},{-84,92},{-88,92},{-100,92},{-104,92},{-108,92},{-112,92},{-124,92},{-128,92},{-132,92},{-136,92},{-140,92},{-144,92},{120,88},{116,88},{112,88},{100,88},{96,88},{92,88},{88,88},{76,88},{72,88},{60,88},{56,88},{52,88},{48,88},{44,88},{40,88},{36,88},{32,88},{28,88},{16,88},{0,88},{-4,88},{-8,88},{-20,88},{-24,88},{-28,88},{-32,88},{-44,88},{-48,88},{-60,88},{-64,88},{-68,88},{-72,88},{-84,88},{-88,88},{-92,88},{-96,88},{-100,88},{-104,88},{-108,88},{-112,88},{-124,88},{-128,88},{-132,88},{-136,88},{-140,88},{-144,88},{-148,88},{-152,88},{-156,88},{160,84},{156,84},{116,84},{112,84},{100,84},{96,84},{92,84},{88,84},{76,84},{72,84},{60,84},{56,84},{52,84},{48,84},{44,84},{40,84},{36,84},{32,84},{28,84},{16,84},{12,84},{0,84},{-4,84},{-8,84},{-20,84},{-24,84},{-28,84},{-32,84},{-44,84},{-48,84},{-64,84},{-68,84},{-84,84},{-88,84},{-92,84},{-96,84},{-100,84},{-104,84},{-108,84},{-112,84},{-124,84},{-128,84},{-132,84},{-136,84},{-140,84},{152,80},{148,80},{144,80},{140,80},{136,80},{132,80},{128,80},{124,80},{120,80},{116,80},{112,80},{76,80},{72,80},{60,80},{56,80},{52,80},{48,80},{44,80},{40,80},{36,80},{32,80},{28,80},{16,80},{12,80},{0,80},{-4,80},{-8,80},{-20,80},{-24,80},{-28,80},{-32,80},{-44,80},{-48,80},{-52,80},{-64,80},{-68,80},{-80,80},{-84,80},{-88,80},{-92,80},{-96,80},{-100,80},{-104,80},{-108,80},{-120,80},{-124,80},{-128,80},{-132,80},{-136,80},{116,76},{112,76},{76,76},{72,76},{44,76},{40,76},{36,76},{32,76},{16,76},{12,76},{-4,76},{-8,76},{-20,76},{-24,76},{-28,76},{-32,76},{-44,76},{-48,76},{-52,76},{-64,76},{-68,76},{-80,76},{-84,76},{-88,76},{-92,76},{-96,76},{-100,76},{-104,76},{-120,76},{-124,76},{-128,76},{-132,76},{120,72},{116,72},{112,72},{92,72},{88,72},{84,72},{80,72},{76,72},{72,72},{44,72},{40,72},{36,72},{32,72},{20,72},{16,72},{12,72},{8,72},{-4,72},{-8,72},{-20,72},{-24,72},{-28,72},{-32,72},{-44,72},{-48,72},{-52,72},{-64,72},{-80,72},{-84,72},{-88,72},{-92,72},{-96,72},{-100,72},{-104,72},{-116,72},{-120,72},{-124,72},{-128,72},{-132,72},{-136,72},{-140,72},{-144,72},{144,68},{140,68},{136,68},{132,68},{128,68},{124,68},{120,68},{116,68},{112,68},{88,68},{84,68},{80,68},{76,68},{72,68},{60,68},{56,68},{52,68},{48,68},{44,68},{40,68},{36,68},{32,68},{20,68},{16,68},{12,68},{8,68},{-4,68},{-8,68},{-20,68},{-24,68},{-28,68},{-32,68},{-44,68},{-48,68},{-52,68},{-56,68},{-76,68},{-80,68},{-84,68},{-88,68},{-92,68},{-96,68},{-100,68},{-112,68},{-116,68},{-120,68},{-124,68},{-128,68},{-132,68},{-136,68},{-140,68},{124,64},{120,64},{116,64},{112,64},{100,64},{84,64},{80,64},{76,64},{72,64},{60,64},{56,64},{52,64},{48,64},{44,64},{40,64},{36,64},{32,64},{-4,64},{-8,64},{-20,64},{-24,64},{-28,64},{-32,64},{-44,64},{-48,64},{-52,64},{-56,64},{-76,64},{-80,64},{-84,64},{-88,64},{-92,64},{-96,64},{-100,64},{-112,64},{-116,64},{-120,64},{-124,64},{-128,64},{-132,64},{136,60},{132,60},{128,60},{124,60},{120,60},{116,60},{112,60},{100,60},{96,60},{80,60},{76,60},{72,60},{60,60},{56,60},{52,60},{48,60},{44,60},{40,60},{36,60},{32,60},{-4,60},{-8,60},{-20,60},{-24,60},{-28,60},{-32,60},{-44,60},{-48,60},{-52,60},{-56,60},{-60,60},{-72,60},{-76,60},{-80,60},{-84,60},{-88,60},{-92,60},{-96,60},{-100,60},{-112,60},{-116,60},{-120,60},{-124,60},{-128,60},{-132,60},{-136,60},{116,56},{112,56},{100,56},{96,56},{92,56},{76,56},{72,56},{60,56},{56,56},{52,56},{48,56},{44,56},{40,56},{36,56},{32,56},{20,56},{16,56},{12,56},{8,56},{-4,56},{-8,56},{-20,56},{-24,56},{-28,56},{-32,56},{-44,56},{-48,56},{-52,56},{-56,56},{-60,56},{-72,56},{-76,56},{-80,56},{-84,56},{-88,56},{-92,56},{-96,56},{-100,56},{-112,56},{-116,56},{-120,56},{-124,56},{-128,56},{136,52},{120,52},{116,52},{112,52},{100,52},{96,52},{92,52},{88,52},{76,52},{72,52},{60,52},{56,52},{52,52},{48,52},{44,52},{40,52},{36,52},{32,52},{20,52},{16,52},{12,52},{8,52},{-4,52},{-8,52},{-20,52},{-24,52},{-28,52},{-32,52},{-44,52},{-48,52},{-52,52},{-56,52},{-60,52},{-72,52},{-76,52},{-80,52},{-84,52},{-88,52},{-92,52},{-96,52},{-100,52},{-104,52},{-108,52},{-112,52},{-116,52},{-120,52},{-124,52},{-128,52},{-132,52},{-136,52},{-140,52},{156,48},{152,48},{148,48},{144,48},{140,48},{136,48},{128,48},{124,48},{120,48},{116,48},{112,48},{100,48},{96,48},{92,48},{88,48},{76,48},{72,48},{60,48},{56,48},{52,48},{48,48},{44,48},{40,48},{36,48},{32,48},{20,48},{16,48},{12,48},{8,48},{-4,48},{-8,48},{-20,48},{-24,48},{-28,48},{-44,48},{-48,48},{-52,48},{-56,48},{-60,48},{-72,48},{-76,48},{-80,48},{-84,48},{-88,48},{-92,48},{-96,48},{-100,48},{-104,48},{-108,48},{-112,48},{-116,48},{116,44},{112,44},{100,44},{96,44},{92,44},{88,44},{76,44},{72,44},{36,44},{32,44},{20,44},{16,44},{12,44},{8,44},{-4,44},{-8,44},{-40,44},{-44,44},{-48,44},{-52,44},{-56,44},{-60,44},{-72,44},{-76,44},{-80,44},{-84,44},{-88,44},{-92,44},{-96,44},{-100,44},{-112,44},{-116,44},{-120,44},{-124,44},{-128,44},{-132,44},{-136,44},{-140,44},{-144,44},{-148,44},{-152,44},{-156,44},{-160,44},{124,40},{120,40},{116,40},{112,40},{100,40},{96,40},{92,40},{88,40},{76,40},{72,40},{36,40},{32,40},{20,40},{16,40},{12,40},{8,40},{-4,40},{-8,40},{-32,40},{-36,40},{-40,40},{-44,40},{-48,40},{-52,40},{-56,40},{-60,40},{-72,40},{-76,40},{-80,40},{-84,40},{-88,40},{-92,40},{-96,40},{-100,40},{-112,40},{-116,40},{-120,40},{-124,40},{-128,40},{-132,40},{172,36},{168,36},{164,36},{148,36},{144,36},{140,36},{136,36},{132,36},{128,36},{124,36},{120,36},{116,36},{112,36},{108,36},{104,36},{100,36},{96,36},{92,36},{88,36},{84,36},{80,36},{76,36},{72,36},{68,36},{64,36},{60,36},{56,36},{52,36},{48,36},{44,36},{40,36},{36,36},{32,36},{28,36},{24,36},{20,36},{16,36},{12,36},{8,36},{4,36},{0,36},{-4,36},{-8,36},{-12,36},{-16,36},{-20,36},{-24,36},{-28,36},{-32,36},{-36,36},{-40,36},{-44,36},{-48,36},{-52,36},{-56,36},{-60,36},{-64,36},{-68,36},{-72,36},{-76,36},{-80,36},{-84,36},{-88,36},{-92,36},{-96,36},{-100,36},{-104,36},{-108,36},{-112,36},{-116,36},{-120,36},{-124,36},{-128,36},{156,32},{152,32},{148,32},{144,32},{140,32},{136,32},{132,32},{128,32},{124,32},{120,32},{116,32},{112,32},{108,32},{104,32},{100,32},{76,32},{72,32},{68,32},{64,32},{60,32},{56,32},{52,32},{48,32},{44,32},{40,32},{36,32},{32,32},{28,32},{24,32},{20,32},{16,32},{12,32},{8,32},{4,32},{0,32},{-4,32},{-8,32},{-12,32},{-16,32},{-20,32},{-24,32},{-28,32},{-32,32},{-36,32},{-40,32},{-44,32},{-48,32},{-52,32},{-56,32},{-60,32},{-64,32},{-68,32},{-72,32},{-76,32},{-80,32},{-84,32},{-88,32},{-92,32},{-96,32},{-100,32},{-104,32},{-108,32},{-112,32},{-116,32},{-120,32},{-124,32},{-128,32},{-132,32},{-136,32},{-140,32},{-144,32},{-148,32},{-152,32},{-156,32},{-160,32},{-164,32},{-168,32},{-172,32},{64,28},{60,28},{56,28},{52,28},{48,28},{44,28},{40,28},{36,28},{32,28},{28,28},{24,28},{20,28},{16,28},{12,28},{8,28},{4,28},{0,28},{-4,28},{-8,28},{-12,28},{-48,28},{-52,28},{-56,28},{-60,28},{-64,28},{-68,28},{-72,28},{-76,28},{-80,28},{-84,28},{-88,28},{-92,28}};
-const short title_vs[93][2] = {{24,196},{20,196},{-16,196},{-20,196},{-24,196},{24,192},{20,192},{16,192},{-12,192},{-16,192},{-20,192},{-24,192},{16,188},{-8,188},{-12,188},{-24,188},{16,184},{-8,184},{-12,184},{52,180},{48,180},{44,180},{16,180},{-8,180},{52,176},{48,176},{44,176},{40,176},{16,176},{-8,176},{-12,176},{44,172},{40,172},{16,172},{-12,172},{-16,172},{-20,172},{40,168},{36,168},{20,168},{16,168},{-16,168},{-20,168},{-24,168},{36,164},{20,164},{16,164},{-24,164},{-28,164},{36,160},{32,160},{20,160},{4,160},{-28,160},{-32,160},{36,156},{32,156},{24,156},{20,156},{4,156},{0,156},{-28,156},{-32,156},{36,152},{32,152},{24,152},{20,152},{0,152},{-4,152},{-8,152},{-28,152},{-32,152},{32,148},{28,148},{24,148},{-4,148},{-8,148},{-12,148},{-16,148},{-20,148},{-24,148},{-28,148},{-44,148},{-48,148},{32,144},{28,144},{24,144},{-12,144},{-16,144},{-20,144},{-24,144},{-44,144},{-48,144}};
-const short title_ready_in[428][2] = {{108,108},{104,108},{100,108},{96,108},{92,108},{88,108},{84,108},{68,108},{64,108},{60,108},{56,108},{52,108},{48,108},{44,108},{16,108},{12,108},{-12,108},{-16,108},{-20,108},{-24,108},{-28,108},{-52,108},{-56,108},{-76,108},{-80,108},{-96,108},{-100,108},{-104,108},{-108,108},{-112,108},{-116,108},{108,104},{104,104},{100,104},{96,104},{92,104},{88,104},{84,104},{80,104},{68,104},{64,104},{60,104},{56,104},{52,104},{48,104},{44,104},{20,104},{16,104},{12,104},{-12,104},{-16,104},{-20,104},{-24,104},{-28,104},{-52,104},{-56,104},{-76,104},{-80,104},{-92,104},{-96,104},{-100,104},{-104,104},{-108,104},{-112,104},{-116,104},{-120,104},{108,100},{104,100},{84,100},{80,100},{68,100},{64,100},{20,100},{16,100},{12,100},{-12,100},{-16,100},{-32,100},{-36,100},{-52,100},{-56,100},{-76,100},{-80,100},{-92,100},{-96,100},{-116,100},{-120,100},{108,96},{104,96},{84,96},{80,96},{68,96},{64,96},{24,96},{20,96},{16,96},{12,96},{8,96},{-12,96},{-16,96},{-32,96},{-36,96},{-52,96},{-56,96},{-76,96},{-80,96},{-92,96},{-96,96},{-116,96},{-120,96},{108,92},{104,92},{84,92},{80,92},{68,92},{64,92},{24,92},{20,92},{12,92},{8,92},{-12,92},{-16,92},{-36,92},{-40,92},{-52,92},{-56,92},{-76,92},{-80,92},{-92,92},{-96,92},{-116,92},{-120,92},{108,88},{104,88},{84,88},{80,88},{68,88},{64,88},{24,88},{20,88},{12,88},{8,88},{4,88},{-12,88},{-16,88},{-36,88},{-40,88},{-52,88},{-56,88},{-76,88},{-80,88},{-116,88},{-120,88},{108,84},{104,84},{84,84},{80,84},{68,84},{64,84},{24,84},{20,84},{8,84},{4,84},{-12,84},{-16,84},{-36,84},{-40,84},{-52,84},{-56,84},{-60,84},{-72,84},{-76,84},{-80,84},{-116,84},{-120,84},{108,80},{104,80},{100,80},{96,80},{92,80},{88,80},{84,80},{80,80},{68,80},{64,80},{24,80},{20,80},{8,80},{4,80},{-12,80},{-16,80},{-36,80},{-40,80},{-56,80},{-60,80},{-72,80},{-76,80},{-112,80},{-116,80},{108,76},{104,76},{100,76},{96,76},{92,76},{88,76},{84,76},{80,76},{68,76},{64,76},{60,76},{56,76},{52,76},{48,76},{28,76},{24,76},{20,76},{8,76},{4,76},{0,76},{-12,76},{-16,76},{-36,76},{-40,76},{-56,76},{-60,76},{-72,76},{-76,76},{-108,76},{-112,76},{-116,76},{108,72},{104,72},{100,72},{96,72},{68,72},{64,72},{60,72},{56,72},{52,72},{48,72},{28,72},{24,72},{4,72},{0,72},{-12,72},{-16,72},{-36,72},{-40,72},{-56,72},{-60,72},{-68,72},{-72,72},{-76,72},{-108,72},{-112,72},{108,68},{104,68},{100,68},{96,68},{92,68},{68,68},{64,68},{28,68},{24,68},{4,68},{0,68},{-12,68},{-16,68},{-36,68},{-40,68},{-60,68},{-64,68},{-68,68},{-72,68},{-104,68},{-108,68},{108,64},{104,64},{96,64},{92,64},{88,64},{68,64},{64,64},{28,64},{24,64},{20,64},{16,64},{12,64},{8,64},{4,64},{0,64},{-12,64},{-16,64},{-36,64},{-40,64},{-60,64},{-64,64},{-68,64},{-72,64},{-104,64},{-108,64},{108,60},{104,60},{92,60},{88,60},{84,60},{68,60},{64,60},{28,60},{24,60},{20,60},{16,60},{12,60},{8,60},{4,60},{0,60},{-12,60},{-16,60},{-36,60},{-40,60},{-64,60},{-68,60},{-104,60},{-108,60},{108,56},{104,56},{88,56},{84,56},{80,56},{68,56},{64,56},{28,56},{24,56},{4,56},{0,56},{-12,56},{-16,56},{-36,56},{-40,56},{-64,56},{-68,56},{-104,56},{-108,56},{108,52},{104,52},{84,52},{80,52},{68,52},{64,52},{28,52},{24,52},{4,52},{0,52},{-12,52},{-16,52},{-36,52},{-40,52},{-64,52},{-68,52},{108,48},{104,48},{84,48},{80,48},{68,48},{64,48},{28,48},{24,48},{4,48},{0,48},{-12,48},{-16,48},{-32,48},{-36,48},{-40,48},{-64,48},{-68,48},{108,44},{104,44},{84,44},{80,44},{68,44},{64,44},{60,44},{56,44},{52,44},{48,44},{44,44},{40,44},{28,44},{24,44},{4,44},{0,44},{-12,44},{-16,44},{-20,44},{-24,44},{-28,44},{-32,44},{-36,44},{-64,44},{-68,44},{-104,44},{-108,44},{108,40},{104,40},{84,40},{80,40},{68,40},{64,40},{60,40},{56,40},{52,40},{48,40},{44,40},{40,40},{28,40},{24,40},{4,40},{0,40},{-12,40},{-16,40},{-20,40},{-24,40},{-28,40},{-64,40},{-68,40},{-104,40},{-108,40}};
-
-const short title_A_lose[1969][2] = {{284,384},{280,384},{244,384},{240,384},{296,380},{292,380},{288,380},{276,380},{272,380},{252,380},{248,380},{236,380},{232,380},{228,380},{224,380},{220,380},{216,380},{212,380},{208,380},{204,380},{200,380},{196,380},{192,380},{188,380},{184,380},{180,380},{176,380},{172,380},{168,380},{164,380},{160,380},{156,380},{152,380},{148,380},{144,380},{140,380},{304,376},{300,376},{284,376},{280,376},{268,376},{264,376},{260,376},{256,376},{244,376},{136,376},{132,376},{320,372},{308,372},{296,372},{292,372},{152,372},{148,372},{128,372},{312,368},{304,368},{140,368},{136,368},{132,368},{320,364},{316,364},{136,364},{128,364},{152,360},{132,360},{144,356},{128,356},{232,352},{224,352},{212,352},{140,352},{128,352},{300,348},{272,348},{256,348},{252,348},{240,348},{236,348},{232,348},{228,348},{224,348},{212,348},{188,348},{124,348},{308,344},{300,344},{296,344},{276,344},{272,344},{260,344},{256,344},{248,344},{244,344},{240,344},{236,344},{232,344},{228,344},{224,344},{212,344},{204,344},{188,344},{120,344},{308,340},{300,340},{296,340},{284,340},{280,340},{276,340},{264,340},{260,340},{256,340},{252,340},{248,340},{244,340},{240,340},{236,340},{232,340},{228,340},{224,340},{216,340},{212,340},{204,340},{196,340},{188,340},{184,340},{168,340},{164,340},{128,340},{116,340},{320,336},{312,336},{308,336},{304,336},{288,336},{284,336},{280,336},{276,336},{264,336},{260,336},{256,336},{252,336},{248,336},{244,336},{236,336},{232,336},{228,336},{224,336},{220,336},{216,336},{212,336},{208,336},{204,336},{196,336},{192,336},{188,336},{184,336},{172,336},{168,336},{164,336},{160,336},{116,336},{320,332},{312,332},{308,332},{288,332},{284,332},{280,332},{268,332},{264,332},{260,332},{256,332},{252,332},{248,332},{236,332},{232,332},{228,332},{216,332},{212,332},{208,332},{204,332},{200,332},{196,332},{192,332},{188,332},{184,332},{176,332},{172,332},{168,332},{160,332},{112,332},{320,328},{316,328},{312,328},{308,328},{292,328},{288,328},{284,328},{280,328},{268,328},{256,328},{216,328},{212,328},{208,328},{204,328},{200,328},{196,328},{184,328},{176,328},{172,328},{168,328},{160,328},{148,328},{124,328},{112,328},{320,324},{316,324},{312,324},{308,324},{288,324},{284,324},{216,324},{212,324},{196,324},{124,324},{112,324},{320,320},{316,320},{312,320},{288,320},{284,320},{196,320},{116,320},{316,316},{312,316},{120,316},{316,312},{136,312},{120,312},{136,308},{124,308},{196,304},{140,304},{128,304},{200,300},{196,300},{140,300},{132,300},{200,296},{184,296},{188,292},{184,292},{180,292},{188,288},{184,288},{180,288},{176,288},{160,288},{156,288},{284,284},{188,284},{184,284},{180,284},{176,284},{172,284},{168,284},{156,284},{152,284},{288,280},{284,280},{276,280},{196,280},{184,280},{180,280},{176,280},{172,280},{168,280},{164,280},{160,280},{152,280},{148,280},{288,276},{284,276},{280,276},{276,276},{200,276},{196,276},{192,276},{188,276},{176,276},{172,276},{168,276},{164,276},{160,276},{156,276},{148,276},{144,276},{292,272},{288,272},{284,272},{280,272},{276,272},{272,272},{204,272},{200,272},{196,272},{192,272},{188,272},{184,272},{180,272},{172,272},{168,272},{164,272},{160,272},{156,272},{152,272},{144,272},{140,272},{292,268},{288,268},{284,268},{280,268},{276,268},{272,268},{268,268},{264,268},{260,268},{256,268},{244,268},{208,268},{204,268},{200,268},{196,268},{192,268},{188,268},{184,268},{180,268},{176,268},{168,268},{164,268},{160,268},{156,268},{152,268},{148,268},{140,268},{292,264},{288,264},{280,264},{276,264},{272,264},{268,264},{264,264},{260,264},{252,264},{248,264},{216,264},{212,264},{204,264},{200,264},{196,264},{192,264},{188,264},{184,264},{180,264},{176,264},{172,264},{164,264},{160,264},{156,264},{152,264},{148,264},{140,264},{136,264},{292,260},{280,260},{272,260},{268,260},{264,260},{260,260},{252,260},{220,260},{216,260},{212,260},{208,260},{196,260},{192,260},{188,260},{172,260},{168,260},{160,260},{156,260},{152,260},{148,260},{144,260},{136,260},{132,260},{292,256},{280,256},{272,256},{268,256},{264,256},{256,256},{220,256},{216,256},{212,256},{208,256},{204,256},{200,256},{172,256},{168,256},{164,256},{156,256},{152,256},{148,256},{144,256},{140,256},{132,256},{272,252},{268,252},{260,252},{256,252},{216,252},{212,252},{208,252},{204,252},{200,252},{196,252},{192,252},{180,252},{176,252},{172,252},{168,252},{164,252},{160,252},{152,252},{148,252},{144,252},{140,252},{132,252},{128,252},{268,248},{260,248},{224,248},{220,248},{208,248},{204,248},{200,248},{196,248},{192,248},{188,248},{184,248},{176,248},{172,248},{168,248},{164,248},{160,248},{156,248},{148,248},{144,248},{140,248},{136,248},{128,248},{260,244},{236,244},{232,244},{228,244},{224,244},{220,244},{204,244},{200,244},{196,244},{192,244},{188,244},{184,244},{180,244},{168,244},{164,244},{160,244},{156,244},{148,244},{144,244},{140,244},{136,244},{132,244},{124,244},{264,240},{240,240},{236,240},{232,240},{228,240},{224,240},{212,240},{208,240},{196,240},{192,240},{188,240},{184,240},{180,240},{176,240},{172,240},{160,240},{156,240},{152,240},{144,240},{140,240},{136,240},{132,240},{128,240},{248,236},{244,236},{240,236},{236,236},{232,236},{228,236},{224,236},{220,236},{216,236},{212,236},{208,236},{204,236},{200,236},{188,236},{184,236},{180,236},{176,236},{172,236},{168,236},{164,236},{156,236},{152,236},{144,236},{140,236},{136,236},{132,236},{128,236},{124,236},{120,236},{320,232},{252,232},{248,232},{244,232},{240,232},{236,232},{232,232},{228,232},{224,232},{220,232},{216,232},{212,232},{208,232},{204,232},{200,232},{196,232},{180,232},{176,232},{172,232},{168,232},{164,232},{160,232},{152,232},{148,232},{140,232},{136,232},{132,232},{128,232},{124,232},{120,232},{320,228},{316,228},{256,228},{252,228},{248,228},{244,228},{240,228},{236,228},{232,228},{228,228},{224,228},{220,228},{216,228},{212,228},{208,228},{204,228},{176,228},{172,228},{168,228},{164,228},{160,228},{156,228},{148,228},{140,228},{136,228},{132,228},{128,228},{124,228},{120,228},{116,228},{320,224},{316,224},{256,224},{252,224},{248,224},{244,224},{240,224},{236,224},{232,224},{228,224},{224,224},{220,224},{216,224},{192,224},{188,224},{184,224},{180,224},{172,224},{168,224},{164,224},{160,224},{156,224},{148,224},{144,224},{136,224},{132,224},{128,224},{124,224},{120,224},{116,224},{112,224},{312,220},{308,220},{256,220},{252,220},{248,220},{244,220},{240,220},{236,220},{232,220},{228,220},{224,220},{220,220},{216,220},{212,220},{208,220},{200,220},{196,220},{192,220},{188,220},{184,220},{180,220},{176,220},{168,220},{164,220},{160,220},{156,220},{152,220},{144,220},{136,220},{132,220},{128,220},{124,220},{120,220},{116,220},{112,220},{256,216},{252,216},{248,216},{244,216},{240,216},{236,216},{232,216},{228,216},{224,216},{220,216},{216,216},{212,216},{208,216},{204,216},{200,216},{196,216},{192,216},{188,216},{184,216},{180,216},{176,216},{172,216},{164,216},{160,216},{156,216},{152,216},{148,216},{140,216},{136,216},{132,216},{128,216},{124,216},{120,216},{116,216},{112,216},{108,216},{252,212},{248,212},{244,212},{240,212},{236,212},{232,212},{228,212},{224,212},{220,212},{216,212},{212,212},{208,212},{204,212},{200,212},{196,212},{192,212},{188,212},{184,212},{180,212},{176,212},{172,212},{168,212},{160,212},{156,212},{152,212},{148,212},{144,212},{140,212},{136,212},{132,212},{128,212},{124,212},{120,212},{116,212},{112,212},{108,212},{264,208},{252,208},{248,208},{244,208},{240,208},{236,208},{232,208},{228,208},{224,208},{220,208},{216,208},{212,208},{208,208},{204,208},{200,208},{196,208},{192,208},{188,208},{184,208},{180,208},{176,208},{172,208},{168,208},{164,208},{156,208},{152,208},{148,208},{144,208},{140,208},{136,208},{132,208},{128,208},{124,208},{120,208},{116,208},{112,208},{108,208},{104,208},{264,204},{252,204},{248,204},{244,204},{240,204},{236,204},{232,204},{228,204},{224,204},{220,204},{216,204},{212,204},{208,204},{204,204},{200,204},{196,204},{192,204},{188,204},{184,204},{180,204},{176,204},{172,204},{168,204},{164,204},{156,204},{152,204},{148,204},{144,204},{140,204},{136,204},{132,204},{128,204},{124,204},{120,204},{116,204},{112,204},{108,204},{104,204},{260,200},{252,200},{248,200},{244,200},{240,200},{236,200},{232,200},{228,200},{224,200},{220,200},{216,200},{212,200},{208,200},{204,200},{200,200},{196,200},{192,200},{188,200},{184,200},{180,200},{176,200},{172,200},{168,200},{164,200},{156,200},{152,200},{148,200},{144,200},{140,200},{136,200},{132,200},{128,200},{124,200},{120,200},{116,200},{112,200},{108,200},{104,200},{100,200},{316,196},{312,196},{308,196},{304,196},{300,196},{268,196},{260,196},{252,196},{248,196},{244,196},{240,196},{236,196},{232,196},{228,196},{224,196},{196,196},{192,196},{188,196},{184,196},{180,196},{176,196},{172,196},{168,196},{160,196},{156,196},{152,196},{148,196},{144,196},{140,196},{136,196},{132,196},{128,196},{124,196},{120,196},{116,196},{112,196},{108,196},{104,196},{100,196},{320,192},{316,192},{312,192},{308,192},{300,192},{296,192},{264,192},{252,192},{248,192},{244,192},{240,192},{236,192},{232,192},{228,192},{220,192},{216,192},{212,192},{208,192},{204,192},{200,192},{164,192},{160,192},{156,192},{152,192},{148,192},{144,192},{140,192},{136,192},{132,192},{128,192},{124,192},{120,192},{116,192},{112,192},{108,192},{104,192},{100,192},{320,188},{316,188},{312,188},{300,188},{296,188},{292,188},{280,188},{276,188},{264,188},{248,188},{244,188},{240,188},{236,188},{232,188},{228,188},{220,188},{216,188},{212,188},{208,188},{204,188},{200,188},{196,188},{192,188},{188,188},{184,188},{180,188},{176,188},{172,188},{168,188},{164,188},{160,188},{156,188},{152,188},{148,188},{144,188},{140,188},{136,188},{132,188},{128,188},{124,188},{120,188},{116,188},{112,188},{108,188},{104,188},{100,188},{96,188},{320,184},{316,184},{312,184},{300,184},{296,184},{292,184},{288,184},{284,184},{280,184},{276,184},{260,184},{256,184},{248,184},{244,184},{240,184},{236,184},{232,184},{228,184},{224,184},{200,184},{196,184},{192,184},{188,184},{184,184},{180,184},{176,184},{172,184},{168,184},{164,184},{160,184},{156,184},{152,184},{148,184},{144,184},{140,184},{136,184},{132,184},{128,184},{124,184},{120,184},{116,184},{112,184},{108,184},{104,184},{100,184},{96,184},{320,180},{316,180},{300,180},{292,180},{288,180},{284,180},{280,180},{276,180},{272,180},{264,180},{252,180},{248,180},{244,180},{240,180},{236,180},{232,180},{228,180},{224,180},{220,180},{216,180},{212,180},{208,180},{204,180},{168,180},{164,180},{160,180},{156,180},{152,180},{148,180},{144,180},{140,180},{136,180},{132,180},{128,180},{124,180},{120,180},{116,180},{112,180},{108,180},{104,180},{100,180},{96,180},{92,180},{320,176},{316,176},{300,176},{288,176},{284,176},{280,176},{276,176},{272,176},{268,176},{264,176},{260,176},{252,176},{248,176},{244,176},{240,176},{236,176},{232,176},{228,176},{224,176},{220,176},{216,176},{212,176},{208,176},{204,176},{200,176},{196,176},{192,176},{188,176},{184,176},{180,176},{176,176},{172,176},{152,176},{148,176},{144,176},{140,176},{136,176},{132,176},{128,176},{124,176},{120,176},{116,176},{112,176},{108,176},{104,176},{100,176},{96,176},{92,176},{320,172},{316,172},{312,172},{284,172},{280,172},{276,172},{272,172},{268,172},{264,172},{260,172},{256,172},{252,172},{248,172},{244,172},{240,172},{236,172},{232,172},{228,172},{224,172},{220,172},{216,172},{212,172},{208,172},{204,172},{200,172},{196,172},{192,172},{188,172},{184,172},{180,172},{176,172},{172,172},{168,172},{164,172},{160,172},{148,172},{144,172},{140,172},{136,172},{132,172},{128,172},{124,172},{120,172},{116,172},{112,172},{108,172},{104,172},{100,172},{96,172},{92,172},{88,172},{316,168},{312,168},{308,168},{296,168},{292,168},{288,168},{284,168},{280,168},{276,168},{272,168},{268,168},{264,168},{260,168},{256,168},{252,168},{248,168},{244,168},{240,168},{236,168},{232,168},{228,168},{224,168},{220,168},{216,168},{212,168},{208,168},{204,168},{200,168},{196,168},{192,168},{188,168},{184,168},{180,168},{176,168},{172,168},{168,168},{164,168},{152,168},{144,168},{140,168},{136,168},{132,168},{128,168},{124,168},{120,168},{116,168},{112,168},{108,168},{104,168},{100,168},{96,168},{92,168},{88,168},{84,168},{312,164},{308,164},{304,164},{300,164},{296,164},{292,164},{288,164},{284,164},{280,164},{276,164},{272,164},{268,164},{264,164},{260,164},{256,164},{252,164},{248,164},{244,164},{240,164},{236,164},{232,164},{228,164},{224,164},{220,164},{216,164},{212,164},{208,164},{204,164},{200,164},{196,164},{192,164},{188,164},{184,164},{180,164},{176,164},{172,164},{168,164},{164,164},{140,164},{136,164},{132,164},{128,164},{124,164},{120,164},{116,164},{112,164},{108,164},{104,164},{100,164},{96,164},{92,164},{88,164},{84,164},{304,160},{300,160},{296,160},{292,160},{288,160},{284,160},{280,160},{272,160},{268,160},{264,160},{260,160},{256,160},{252,160},{248,160},{244,160},{240,160},{236,160},{232,160},{228,160},{224,160},{220,160},{216,160},{212,160},{208,160},{204,160},{200,160},{196,160},{192,160},{188,160},{184,160},{180,160},{176,160},{172,160},{168,160},{164,160},{160,160},{156,160},{152,160},{148,160},{144,160},{136,160},{132,160},{128,160},{124,160},{120,160},{116,160},{112,160},{108,160},{104,160},{100,160},{96,160},{92,160},{88,160},{84,160},{292,156},{288,156},{284,156},{280,156},{272,156},{268,156},{264,156},{260,156},{256,156},{252,156},{248,156},{244,156},{240,156},{236,156},{232,156},{228,156},{224,156},{220,156},{216,156},{212,156},{208,156},{204,156},{200,156},{196,156},{192,156},{188,156},{184,156},{180,156},{176,156},{172,156},{168,156},{164,156},{160,156},{156,156},{152,156},{148,156},{144,156},{136,156},{132,156},{128,156},{124,156},{120,156},{116,156},{112,156},{108,156},{104,156},{100,156},{96,156},{92,156},{88,156},{84,156},{272,152},{268,152},{264,152},{260,152},{256,152},{252,152},{248,152},{244,152},{240,152},{236,152},{232,152},{228,152},{224,152},{220,152},{216,152},{212,152},{208,152},{204,152},{200,152},{196,152},{192,152},{188,152},{184,152},{180,152},{176,152},{172,152},{168,152},{164,152},{160,152},{156,152},{152,152},{148,152},{144,152},{140,152},{132,152},{128,152},{124,152},{120,152},{116,152},{112,152},{108,152},{104,152},{100,152},{96,152},{92,152},{88,152},{84,152},{288,148},{284,148},{280,148},{276,148},{272,148},{268,148},{264,148},{260,148},{256,148},{252,148},{248,148},{244,148},{240,148},{232,148},{228,148},{224,148},{220,148},{216,148},{212,148},{208,148},{204,148},{200,148},{196,148},{192,148},{188,148},{184,148},{180,148},{176,148},{172,148},{168,148},{164,148},{160,148},{156,148},{152,148},{148,148},{144,148},{140,148},{132,148},{128,148},{124,148},{120,148},{116,148},{112,148},{108,148},{104,148},{100,148},{96,148},{92,148},{88,148},{288,144},{284,144},{280,144},{276,144},{272,144},{268,144},{264,144},{260,144},{256,144},{252,144},{248,144},{244,144},{240,144},{236,144},{228,144},{224,144},{220,144},{216,144},{212,144},{208,144},{204,144},{200,144},{196,144},{192,144},{188,144},{184,144},{180,144},{176,144},{172,144},{168,144},{164,144},{160,144},{156,144},{152,144},{148,144},{144,144},{140,144},{136,144},{128,144},{124,144},{120,144},{116,144},{112,144},{108,144},{104,144},{100,144},{96,144},{92,144},{88,144},{288,140},{284,140},{280,140},{276,140},{272,140},{268,140},{264,140},{260,140},{256,140},{252,140},{248,140},{244,140},{240,140},{236,140},{228,140},{224,140},{220,140},{216,140},{212,140},{208,140},{204,140},{200,140},{196,140},{192,140},{188,140},{184,140},{180,140},{176,140},{172,140},{168,140},{164,140},{160,140},{156,140},{152,140},{148,140},{144,140},{140,140},{136,140},{124,140},{120,140},{116,140},{112,140},{108,140},{104,140},{100,140},{96,140},{92,140},{88,140},{284,136},{280,136},{276,136},{272,136},{268,136},{264,136},{260,136},{256,136},{252,136},{248,136},{244,136},{240,136},{236,136},{232,136},{220,136},{216,136},{212,136},{208,136},{204,136},{200,136},{196,136},{192,136},{188,136},{184,136},{180,136},{176,136},{172,136},{168,136},{164,136},{160,136},{156,136},{152,136},{148,136},{144,136},{140,136},{116,136},{112,136},{108,136},{104,136},{100,136},{96,136},{92,136},{88,136},{284,132},{280,132},{276,132},{272,132},{268,132},{264,132},{260,132},{256,132},{252,132},{248,132},{244,132},{240,132},{236,132},{232,132},{228,132},{224,132},{212,132},{208,132},{204,132},{200,132},{196,132},{192,132},{188,132},{184,132},{180,132},{176,132},{172,132},{168,132},{164,132},{160,132},{156,132},{152,132},{108,132},{104,132},{100,132},{96,132},{92,132},{284,128},{280,128},{276,128},{272,128},{268,128},{264,128},{260,128},{256,128},{252,128},{248,128},{244,128},{240,128},{236,128},{232,128},{228,128},{224,128},{220,128},{216,128},{104,128},{100,128},{96,128},{92,128},{280,124},{276,124},{272,124},{268,124},{264,124},{260,124},{256,124},{252,124},{248,124},{244,124},{240,124},{236,124},{232,124},{228,124},{224,124},{220,124},{216,124},{212,124},{208,124},{204,124},{200,124},{196,124},{192,124},{188,124},{184,124},{180,124},{176,124},{172,124},{168,124},{164,124},{104,124},{100,124},{280,120},{276,120},{272,120},{268,120},{264,120},{260,120},{256,120},{252,120},{248,120},{244,120},{240,120},{236,120},{232,120},{228,120},{224,120},{220,120},{216,120},{212,120},{208,120},{204,120},{200,120},{196,120},{192,120},{188,120},{184,120},{180,120},{176,120},{320,116},{280,116},{276,116},{272,116},{268,116},{264,116},{260,116},{256,116},{252,116},{248,116},{244,116},{240,116},{236,116},{232,116},{228,116},{224,116},{220,116},{216,116},{212,116},{208,116},{204,116},{200,116},{196,116},{192,116},{188,116},{184,116},{316,112},{284,112},{280,112},{276,112},{272,112},{268,112},{264,112},{260,112},{256,112},{252,112},{248,112},{244,112},{240,112},{236,112},{232,112},{228,112},{224,112},{220,112},{216,112},{212,112},{208,112},{204,112},{200,112},{196,112},{192,112},{188,112},{184,112},{316,108},{284,108},{280,108},{276,108},{272,108},{268,108},{264,108},{260,108},{256,108},{252,108},{248,108},{244,108},{240,108},{236,108},{232,108},{228,108},{224,108},{220,108},{216,108},{212,108},{208,108},{204,108},{200,108},{196,108},{192,108},{188,108},{184,108},{312,104},{284,104},{280,104},{276,104},{272,104},{268,104},{264,104},{260,104},{256,104},{252,104},{248,104},{244,104},{240,104},{236,104},{232,104},{228,104},{224,104},{220,104},{216,104},{212,104},{208,104},{204,104},{200,104},{196,104},{192,104},{188,104},{184,104},{308,100},{288,100},{284,100},{280,100},{276,100},{272,100},{268,100},{264,100},{260,100},{256,100},{252,100},{248,100},{244,100},{240,100},{236,100},{232,100},{228,100},{224,100},{220,100},{216,100},{212,100},{208,100},{204,100},{200,100},{196,100},{192,100},{188,100},{296,96},{292,96},{288,96},{284,96},{280,96},{276,96},{272,96},{268,96},{264,96},{260,96},{256,96},{252,96},{248,96},{244,96},{240,96},{236,96},{232,96},{228,96},{224,96},{220,96},{216,96},{212,96},{208,96},{204,96},{200,96},{196,96},{192,96},{188,96},{296,92},{292,92},{288,92},{284,92},{280,92},{276,92},{272,92},{268,92},{264,92},{260,92},{256,92},{252,92},{248,92},{244,92},{240,92},{236,92},{232,92},{228,92},{224,92},{220,92},{216,92},{212,92},{208,92},{204,92},{200,92},{196,92},{192,92},{280,88},{276,88},{272,88},{268,88},{264,88},{260,88},{256,88},{252,88},{248,88},{244,88},{240,88},{236,88},{232,88},{228,88},{224,88},{220,88},{216,88},{212,88},{208,88},{204,88},{200,88},{196,88},{256,84},{252,84},{248,84},{244,84},{240,84},{236,84},{232,84},{228,84},{224,84},{220,84},{216,84},{212,84},{208,84},{204,84},{200,84},{196,84},{232,80},{228,80},{224,80},{220,80},{216,80},{212,80},{208,80},{204,80},{200,80},{216,76},{212,76},{208,76},{204,76},{200,76},{208,72},{204,72}};
-const short title_A_win[2807][2] = {{312,400},{308,400},{304,400},{300,400},{296,400},{292,400},{288,400},{284,400},{280,400},{276,400},{320,396},{316,396},{272,396},{268,396},{248,396},{244,396},{240,396},{236,396},{232,396},{228,396},{224,396},{220,396},{216,396},{308,392},{304,392},{300,392},{296,392},{292,392},{288,392},{284,392},{280,392},{264,392},{256,392},{252,392},{212,392},{208,392},{204,392},{200,392},{196,392},{316,388},{312,388},{308,388},{304,388},{300,388},{296,388},{292,388},{288,388},{284,388},{280,388},{276,388},{272,388},{260,388},{244,388},{240,388},{236,388},{232,388},{228,388},{224,388},{220,388},{192,388},{188,388},{184,388},{320,384},{316,384},{312,384},{308,384},{304,384},{300,384},{296,384},{292,384},{288,384},{284,384},{280,384},{276,384},{272,384},{248,384},{244,384},{240,384},{236,384},{232,384},{228,384},{224,384},{220,384},{216,384},{212,384},{180,384},{176,384},{172,384},{168,384},{164,384},{320,380},{316,380},{312,380},{308,380},{304,380},{300,380},{296,380},{292,380},{288,380},{236,380},{232,380},{228,380},{224,380},{220,380},{216,380},{212,380},{208,380},{204,380},{200,380},{196,380},{192,380},{160,380},{156,380},{320,376},{316,376},{312,376},{308,376},{304,376},{300,376},{292,376},{236,376},{232,376},{228,376},{212,376},{208,376},{204,376},{200,376},{196,376},{192,376},{188,376},{184,376},{168,376},{164,376},{152,376},{148,376},{320,372},{316,372},{312,372},{308,372},{304,372},{296,372},{196,372},{192,372},{188,372},{184,372},{180,372},{160,372},{156,372},{144,372},{140,372},{28,372},{-4,372},{320,368},{316,368},{312,368},{308,368},{304,368},{300,368},{296,368},{292,368},{288,368},{284,368},{280,368},{268,368},{264,368},{260,368},{220,368},{216,368},{212,368},{184,368},{180,368},{176,368},{172,368},{156,368},{152,368},{148,368},{136,368},{32,368},{28,368},{-4,368},{320,364},{316,364},{312,364},{308,364},{304,364},{300,364},{296,364},{292,364},{288,364},{284,364},{280,364},{276,364},{272,364},{268,364},{264,364},{260,364},{256,364},{236,364},{232,364},{228,364},{224,364},{220,364},{216,364},{212,364},{208,364},{204,364},{200,364},{196,364},{172,364},{168,364},{152,364},{148,364},{144,364},{140,364},{132,364},{32,364},{28,364},{-4,364},{320,360},{316,360},{312,360},{308,360},{304,360},{300,360},{296,360},{292,360},{288,360},{284,360},{280,360},{276,360},{272,360},{268,360},{264,360},{260,360},{220,360},{216,360},{212,360},{208,360},{204,360},{200,360},{196,360},{192,360},{188,360},{184,360},{148,360},{144,360},{140,360},{136,360},{128,360},{32,360},{28,360},{24,360},{-4,360},{320,356},{316,356},{312,356},{308,356},{304,356},{300,356},{296,356},{292,356},{288,356},{284,356},{280,356},{276,356},{272,356},{268,356},{216,356},{212,356},{208,356},{204,356},{200,356},{196,356},{192,356},{188,356},{184,356},{180,356},{176,356},{140,356},{136,356},{132,356},{124,356},{84,356},{64,356},{36,356},{32,356},{28,356},{24,356},{-4,356},{-8,356},{320,352},{316,352},{312,352},{308,352},{304,352},{300,352},{296,352},{292,352},{288,352},{284,352},{280,352},{276,352},{272,352},{208,352},{204,352},{200,352},{196,352},{192,352},{188,352},{184,352},{180,352},{176,352},{172,352},{168,352},{136,352},{132,352},{128,352},{84,352},{64,352},{32,352},{28,352},{-4,352},{-8,352},{320,348},{316,348},{312,348},{308,348},{304,348},{300,348},{296,348},{292,348},{288,348},{284,348},{280,348},{276,348},{260,348},{204,348},{200,348},{196,348},{192,348},{188,348},{184,348},{180,348},{176,348},{172,348},{168,348},{164,348},{132,348},{128,348},{84,348},{72,348},{64,348},{28,348},{320,344},{316,344},{312,344},{308,344},{304,344},{300,344},{296,344},{292,344},{288,344},{284,344},{280,344},{276,344},{264,344},{260,344},{256,344},{204,344},{200,344},{196,344},{192,344},{188,344},{184,344},{180,344},{176,344},{172,344},{168,344},{164,344},{160,344},{156,344},{128,344},{124,344},{72,344},{64,344},{44,344},{320,340},{316,340},{312,340},{308,340},{304,340},{300,340},{296,340},{292,340},{288,340},{284,340},{280,340},{276,340},{272,340},{268,340},{264,340},{260,340},{256,340},{240,340},{196,340},{192,340},{188,340},{184,340},{180,340},{176,340},{172,340},{168,340},{164,340},{160,340},{156,340},{152,340},{148,340},{124,340},{72,340},{68,340},{64,340},{44,340},{40,340},{36,340},{-8,340},{320,336},{316,336},{312,336},{308,336},{304,336},{300,336},{296,336},{292,336},{288,336},{284,336},{280,336},{276,336},{272,336},{268,336},{264,336},{260,336},{256,336},{240,336},{236,336},{196,336},{192,336},{188,336},{184,336},{180,336},{176,336},{172,336},{168,336},{164,336},{160,336},{156,336},{152,336},{148,336},{144,336},{120,336},{84,336},{72,336},{68,336},{64,336},{44,336},{40,336},{36,336},{32,336},{20,336},{16,336},{12,336},{8,336},{-4,336},{-8,336},{-32,336},{320,332},{316,332},{312,332},{308,332},{304,332},{300,332},{296,332},{292,332},{288,332},{284,332},{280,332},{276,332},{272,332},{268,332},{264,332},{260,332},{252,332},{240,332},{236,332},{196,332},{192,332},{188,332},{184,332},{180,332},{176,332},{172,332},{168,332},{164,332},{160,332},{156,332},{152,332},{148,332},{144,332},{120,332},{104,332},{88,332},{84,332},{72,332},{68,332},{64,332},{60,332},{48,332},{44,332},{40,332},{36,332},{32,332},{28,332},{24,332},{20,332},{16,332},{12,332},{8,332},{4,332},{0,332},{-4,332},{-8,332},{-12,332},{-32,332},{320,328},{316,328},{312,328},{308,328},{304,328},{300,328},{296,328},{292,328},{288,328},{284,328},{280,328},{276,328},{272,328},{268,328},{264,328},{260,328},{256,328},{252,328},{244,328},{240,328},{236,328},{232,328},{200,328},{196,328},{192,328},{188,328},{168,328},{164,328},{160,328},{156,328},{152,328},{148,328},{144,328},{140,328},{120,328},{104,328},{88,328},{84,328},{72,328},{68,328},{64,328},{60,328},{56,328},{52,328},{48,328},{44,328},{40,328},{36,328},{32,328},{28,328},{24,328},{20,328},{16,328},{12,328},{8,328},{4,328},{0,328},{-4,328},{-8,328},{-12,328},{-32,328},{-36,328},{320,324},{316,324},{312,324},{308,324},{304,324},{300,324},{296,324},{292,324},{288,324},{284,324},{280,324},{276,324},{272,324},{268,324},{264,324},{260,324},{256,324},{252,324},{248,324},{244,324},{240,324},{232,324},{196,324},{192,324},{188,324},{156,324},{152,324},{148,324},{144,324},{140,324},{136,324},{116,324},{104,324},{92,324},{88,324},{84,324},{80,324},{76,324},{72,324},{68,324},{64,324},{60,324},{56,324},{52,324},{48,324},{44,324},{40,324},{24,324},{20,324},{16,324},{12,324},{8,324},{4,324},{0,324},{-4,324},{-8,324},{-12,324},{-16,324},{-36,324},{320,320},{312,320},{308,320},{300,320},{296,320},{292,320},{288,320},{284,320},{280,320},{276,320},{272,320},{268,320},{264,320},{260,320},{256,320},{252,320},{248,320},{244,320},{228,320},{224,320},{196,320},{192,320},{188,320},{184,320},{148,320},{144,320},{140,320},{128,320},{116,320},{104,320},{92,320},{88,320},{84,320},{80,320},{76,320},{72,320},{68,320},{64,320},{60,320},{56,320},{52,320},{48,320},{36,320},{32,320},{28,320},{0,320},{-4,320},{-8,320},{-12,320},{-16,320},{-20,320},{-36,320},{316,316},{312,316},{304,316},{300,316},{296,316},{292,316},{288,316},{284,316},{280,316},{276,316},{272,316},{268,316},{264,316},{260,316},{256,316},{252,316},{248,316},{244,316},{228,316},{224,316},{196,316},{192,316},{188,316},{184,316},{128,316},{124,316},{116,316},{96,316},{92,316},{88,316},{84,316},{80,316},{44,316},{40,316},{36,316},{32,316},{28,316},{16,316},{12,316},{8,316},{4,316},{-4,316},{-8,316},{-12,316},{-16,316},{-20,316},{-24,316},{316,312},{312,312},{304,312},{300,312},{296,312},{292,312},{288,312},{284,312},{280,312},{276,312},{272,312},{268,312},{264,312},{260,312},{256,312},{252,312},{248,312},{244,312},{224,312},{200,312},{196,312},{192,312},{188,312},{184,312},{180,312},{176,312},{124,312},{112,312},{96,312},{92,312},{88,312},{76,312},{72,312},{68,312},{64,312},{52,312},{48,312},{44,312},{40,312},{36,312},{32,312},{24,312},{20,312},{16,312},{12,312},{8,312},{4,312},{-16,312},{-20,312},{-24,312},{-28,312},{316,308},{312,308},{300,308},{296,308},{292,308},{288,308},{284,308},{280,308},{276,308},{272,308},{268,308},{264,308},{260,308},{256,308},{252,308},{248,308},{224,308},{192,308},{188,308},{184,308},{180,308},{176,308},{172,308},{168,308},{124,308},{120,308},{112,308},{96,308},{92,308},{88,308},{80,308},{76,308},{72,308},{68,308},{60,308},{56,308},{52,308},{48,308},{44,308},{40,308},{36,308},{28,308},{24,308},{20,308},{16,308},{12,308},{-4,308},{-8,308},{-12,308},{-20,308},{-24,308},{-28,308},{300,304},{296,304},{292,304},{288,304},{284,304},{280,304},{276,304},{272,304},{268,304},{264,304},{260,304},{256,304},{252,304},{248,304},{224,304},{220,304},{184,304},{180,304},{176,304},{172,304},{168,304},{164,304},{124,304},{120,304},{112,304},{96,304},{92,304},{88,304},{80,304},{76,304},{72,304},{68,304},{60,304},{56,304},{52,304},{48,304},{44,304},{40,304},{32,304},{28,304},{24,304},{20,304},{8,304},{4,304},{0,304},{-4,304},{-8,304},{-12,304},{-16,304},{-24,304},{-28,304},{300,300},{296,300},{288,300},{284,300},{280,300},{276,300},{272,300},{268,300},{264,300},{260,300},{256,300},{252,300},{228,300},{224,300},{220,300},{216,300},{212,300},{208,300},{180,300},{176,300},{172,300},{168,300},{164,300},{160,300},{156,300},{120,300},{112,300},{100,300},{96,300},{92,300},{88,300},{56,300},{52,300},{36,300},{32,300},{28,300},{24,300},{16,300},{12,300},{8,300},{4,300},{0,300},{-4,300},{-8,300},{-12,300},{-16,300},{-24,300},{-28,300},{300,296},{296,296},{288,296},{284,296},{280,296},{276,296},{272,296},{268,296},{264,296},{260,296},{256,296},{252,296},{232,296},{228,296},{224,296},{220,296},{216,296},{212,296},{208,296},{204,296},{200,296},{176,296},{172,296},{168,296},{164,296},{160,296},{156,296},{152,296},{148,296},{120,296},{112,296},{96,296},{92,296},{84,296},{80,296},{76,296},{72,296},{40,296},{36,296},{32,296},{28,296},{20,296},{16,296},{12,296},{8,296},{4,296},{0,296},{-4,296},{-12,296},{-16,296},{-24,296},{-28,296},{284,292},{280,292},{276,292},{272,292},{268,292},{264,292},{260,292},{256,292},{232,292},{228,292},{224,292},{220,292},{216,292},{212,292},{208,292},{204,292},{200,292},{196,292},{176,292},{172,292},{168,292},{164,292},{160,292},{156,292},{152,292},{148,292},{124,292},{116,292},{100,292},{96,292},{92,292},{84,292},{80,292},{76,292},{72,292},{68,292},{64,292},{60,292},{56,292},{52,292},{48,292},{40,292},{36,292},{32,292},{28,292},{20,292},{16,292},{12,292},{4,292},{-8,292},{-12,292},{-16,292},{-24,292},{-28,292},{284,288},{276,288},{272,288},{268,288},{264,288},{260,288},{236,288},{232,288},{228,288},{224,288},{220,288},{216,288},{212,288},{208,288},{204,288},{200,288},{196,288},{192,288},{172,288},{168,288},{164,288},{156,288},{152,288},{124,288},{100,288},{96,288},{92,288},{84,288},{80,288},{76,288},{72,288},{68,288},{64,288},{60,288},{56,288},{52,288},{48,288},{40,288},{36,288},{32,288},{28,288},{20,288},{16,288},{12,288},{8,288},{0,288},{-4,288},{-8,288},{-12,288},{-16,288},{-24,288},{-28,288},{272,284},{268,284},{264,284},{236,284},{232,284},{228,284},{224,284},{220,284},{216,284},{212,284},{208,284},{204,284},{200,284},{196,284},{192,284},{188,284},{168,284},{164,284},{160,284},{152,284},{124,284},{96,284},{92,284},{84,284},{80,284},{76,284},{72,284},{68,284},{64,284},{60,284},{56,284},{52,284},{40,284},{36,284},{32,284},{28,284},{20,284},{16,284},{12,284},{8,284},{-12,284},{-16,284},{-24,284},{-28,284},{240,280},{236,280},{232,280},{228,280},{224,280},{220,280},{216,280},{212,280},{208,280},{204,280},{200,280},{196,280},{192,280},{188,280},{184,280},{164,280},{160,280},{124,280},{96,280},{92,280},{84,280},{80,280},{76,280},{68,280},{64,280},{60,280},{48,280},{44,280},{36,280},{32,280},{28,280},{20,280},{16,280},{4,280},{0,280},{-4,280},{-8,280},{-12,280},{-20,280},{-24,280},{-28,280},{244,276},{240,276},{236,276},{232,276},{228,276},{224,276},{220,276},{216,276},{212,276},{208,276},{204,276},{200,276},{196,276},{192,276},{188,276},{184,276},{180,276},{164,276},{160,276},{124,276},{96,276},{92,276},{84,276},{80,276},{76,276},{72,276},{52,276},{48,276},{44,276},{36,276},{32,276},{28,276},{12,276},{8,276},{4,276},{0,276},{-4,276},{-8,276},{-12,276},{-20,276},{-24,276},{-28,276},{244,272},{240,272},{236,272},{232,272},{228,272},{224,272},{220,272},{216,272},{212,272},{208,272},{204,272},{200,272},{196,272},{192,272},{188,272},{184,272},{180,272},{176,272},{128,272},{96,272},{92,272},{84,272},{80,272},{76,272},{72,272},{68,272},{64,272},{60,272},{52,272},{48,272},{44,272},{36,272},{32,272},{28,272},{20,272},{16,272},{12,272},{8,272},{4,272},{0,272},{-4,272},{-8,272},{-12,272},{-20,272},{-24,272},{-28,272},{252,268},{248,268},{244,268},{240,268},{236,268},{232,268},{228,268},{224,268},{220,268},{216,268},{212,268},{208,268},{204,268},{200,268},{196,268},{192,268},{188,268},{184,268},{180,268},{176,268},{128,268},{96,268},{92,268},{88,268},{80,268},{76,268},{72,268},{68,268},{64,268},{40,268},{24,268},{20,268},{16,268},{12,268},{8,268},{4,268},{0,268},{-4,268},{-8,268},{-16,268},{-20,268},{-24,268},{276,264},{256,264},{252,264},{248,264},{244,264},{240,264},{236,264},{232,264},{228,264},{224,264},{220,264},{216,264},{212,264},{208,264},{204,264},{200,264},{196,264},{192,264},{188,264},{184,264},{180,264},{176,264},{172,264},{132,264},{92,264},{88,264},{80,264},{76,264},{72,264},{68,264},{60,264},{56,264},{52,264},{48,264},{44,264},{40,264},{36,264},{32,264},{28,264},{24,264},{20,264},{16,264},{12,264},{8,264},{4,264},{0,264},{-4,264},{-8,264},{-16,264},{-20,264},{-24,264},{292,260},{284,260},{280,260},{268,260},{264,260},{260,260},{256,260},{252,260},{248,260},{244,260},{240,260},{236,260},{232,260},{228,260},{224,260},{220,260},{216,260},{212,260},{208,260},{204,260},{200,260},{196,260},{192,260},{132,260},{92,260},{88,260},{84,260},{76,260},{72,260},{68,260},{64,260},{60,260},{56,260},{52,260},{48,260},{44,260},{40,260},{36,260},{32,260},{28,260},{24,260},{20,260},{16,260},{12,260},{8,260},{4,260},{0,260},{-4,260},{-8,260},{-16,260},{-20,260},{300,256},{288,256},{284,256},{280,256},{276,256},{272,256},{268,256},{240,256},{236,256},{232,256},{228,256},{224,256},{220,256},{216,256},{212,256},{208,256},{204,256},{200,256},{136,256},{92,256},{88,256},{84,256},{80,256},{72,256},{68,256},{64,256},{60,256},{56,256},{52,256},{48,256},{44,256},{40,256},{36,256},{32,256},{28,256},{24,256},{20,256},{16,256},{12,256},{8,256},{4,256},{0,256},{-4,256},{-8,256},{-16,256},{-20,256},{300,252},{296,252},{292,252},{288,252},{284,252},{280,252},{232,252},{228,252},{224,252},{220,252},{216,252},{212,252},{208,252},{204,252},{172,252},{168,252},{136,252},{88,252},{84,252},{80,252},{72,252},{68,252},{64,252},{60,252},{56,252},{52,252},{48,252},{44,252},{40,252},{36,252},{32,252},{28,252},{24,252},{20,252},{16,252},{12,252},{8,252},{4,252},{0,252},{-4,252},{-16,252},{300,248},{296,248},{292,248},{288,248},{284,248},{248,248},{244,248},{240,248},{236,248},{228,248},{224,248},{220,248},{216,248},{212,248},{208,248},{192,248},{188,248},{184,248},{180,248},{176,248},{172,248},{168,248},{140,248},{88,248},{84,248},{80,248},{76,248},{68,248},{64,248},{60,248},{56,248},{52,248},{48,248},{44,248},{40,248},{36,248},{32,248},{28,248},{24,248},{20,248},{16,248},{12,248},{8,248},{4,248},{0,248},{-4,248},{-12,248},{-16,248},{292,244},{264,244},{260,244},{256,244},{252,244},{248,244},{244,244},{240,244},{236,244},{232,244},{228,244},{224,244},{220,244},{216,244},{212,244},{204,244},{200,244},{196,244},{192,244},{188,244},{184,244},{180,244},{176,244},{172,244},{168,244},{164,244},{144,244},{84,244},{80,244},{76,244},{72,244},{64,244},{60,244},{56,244},{52,244},{48,244},{44,244},{40,244},{36,244},{32,244},{28,244},{24,244},{20,244},{16,244},{12,244},{8,244},{4,244},{0,244},{-4,244},{-12,244},{-16,244},{296,240},{292,240},{280,240},{276,240},{272,240},{268,240},{264,240},{260,240},{256,240},{252,240},{248,240},{244,240},{240,240},{236,240},{232,240},{228,240},{224,240},{220,240},{216,240},{212,240},{208,240},{204,240},{200,240},{196,240},{192,240},{172,240},{168,240},{164,240},{148,240},{76,240},{72,240},{68,240},{60,240},{56,240},{52,240},{48,240},{44,240},{40,240},{36,240},{32,240},{28,240},{24,240},{20,240},{16,240},{12,240},{8,240},{4,240},{0,240},{-12,240},{-16,240},{296,236},{292,236},{288,236},{284,236},{280,236},{276,236},{272,236},{268,236},{264,236},{240,236},{236,236},{232,236},{228,236},{224,236},{220,236},{216,236},{212,236},{208,236},{204,236},{200,236},{196,236},{180,236},{176,236},{168,236},{164,236},{152,236},{72,236},{68,236},{64,236},{52,236},{48,236},{44,236},{40,236},{36,236},{32,236},{28,236},{24,236},{20,236},{16,236},{12,236},{8,236},{4,236},{-4,236},{-8,236},{-12,236},{320,232},{296,232},{292,232},{288,232},{284,232},{280,232},{276,232},{272,232},{248,232},{244,232},{236,232},{232,232},{228,232},{224,232},{220,232},{216,232},{212,232},{208,232},{204,232},{200,232},{180,232},{172,232},{168,232},{164,232},{156,232},{64,232},{60,232},{56,232},{48,232},{36,232},{32,232},{28,232},{24,232},{20,232},{16,232},{12,232},{8,232},{4,232},{-4,232},{-8,232},{-12,232},{320,228},{296,228},{292,228},{288,228},{284,228},{280,228},{276,228},{268,228},{248,228},{240,228},{232,228},{228,228},{224,228},{220,228},{216,228},{208,228},{204,228},{196,228},{192,228},{188,228},{184,228},{180,228},{176,228},{172,228},{168,228},{164,228},{156,228},{64,228},{60,228},{56,228},{52,228},{44,228},{40,228},{36,228},{32,228},{20,228},{16,228},{4,228},{-8,228},{-12,228},{320,224},{292,224},{288,224},{284,224},{280,224},{272,224},{268,224},{264,224},{260,224},{256,224},{252,224},{248,224},{244,224},{240,224},{236,224},{232,224},{228,224},{224,224},{220,224},{216,224},{208,224},{204,224},{200,224},{196,224},{192,224},{188,224},{184,224},{180,224},{176,224},{172,224},{168,224},{164,224},{156,224},{60,224},{56,224},{52,224},{44,224},{40,224},{36,224},{32,224},{28,224},{24,224},{12,224},{8,224},{4,224},{0,224},{-12,224},{-16,224},{320,220},{316,220},{292,220},{288,220},{284,220},{280,220},{276,220},{272,220},{268,220},{264,220},{260,220},{256,220},{252,220},{248,220},{244,220},{240,220},{236,220},{232,220},{228,220},{224,220},{220,220},{216,220},{208,220},{204,220},{200,220},{196,220},{192,220},{188,220},{184,220},{180,220},{176,220},{172,220},{168,220},{164,220},{156,220},{56,220},{52,220},{48,220},{40,220},{36,220},{32,220},{28,220},{24,220},{20,220},{16,220},{12,220},{8,220},{4,220},{0,220},{-12,220},{-16,220},{320,216},{312,216},{308,216},{304,216},{292,216},{288,216},{284,216},{280,216},{276,216},{272,216},{268,216},{264,216},{260,216},{256,216},{252,216},{248,216},{244,216},{240,216},{236,216},{232,216},{228,216},{224,216},{220,216},{216,216},{212,216},{204,216},{200,216},{196,216},{192,216},{188,216},{184,216},{180,216},{176,216},{172,216},{168,216},{164,216},{156,216},{52,216},{48,216},{40,216},{36,216},{32,216},{28,216},{24,216},{20,216},{16,216},{12,216},{8,216},{4,216},{0,216},{-16,216},{-20,216},{320,212},{308,212},{304,212},{292,212},{288,212},{284,212},{280,212},{276,212},{272,212},{268,212},{264,212},{260,212},{256,212},{252,212},{248,212},{244,212},{240,212},{236,212},{232,212},{228,212},{224,212},{220,212},{216,212},{212,212},{204,212},{200,212},{196,212},{192,212},{188,212},{184,212},{180,212},{176,212},{172,212},{168,212},{164,212},{156,212},{52,212},{40,212},{36,212},{32,212},{28,212},{24,212},{20,212},{16,212},{12,212},{8,212},{4,212},{-16,212},{-20,212},{320,208},{304,208},{300,208},{292,208},{288,208},{284,208},{280,208},{276,208},{272,208},{268,208},{264,208},{260,208},{256,208},{252,208},{248,208},{244,208},{240,208},{236,208},{232,208},{228,208},{224,208},{220,208},{216,208},{212,208},{204,208},{200,208},{196,208},{192,208},{188,208},{184,208},{180,208},{176,208},{172,208},{168,208},{164,208},{156,208},{56,208},{36,208},{32,208},{28,208},{24,208},{20,208},{16,208},{12,208},{8,208},{4,208},{-16,208},{-20,208},{-24,208},{320,204},{316,204},{312,204},{308,204},{304,204},{300,204},{292,204},{288,204},{284,204},{280,204},{276,204},{272,204},{268,204},{264,204},{260,204},{256,204},{252,204},{248,204},{244,204},{240,204},{236,204},{232,204},{228,204},{224,204},{220,204},{216,204},{212,204},{208,204},{200,204},{196,204},{192,204},{188,204},{184,204},{180,204},{176,204},{172,204},{168,204},{164,204},{156,204},{56,204},{36,204},{32,204},{28,204},{24,204},{20,204},{16,204},{12,204},{8,204},{-16,204},{-20,204},{-24,204},{316,200},{312,200},{308,200},{304,200},{300,200},{292,200},{288,200},{284,200},{280,200},{276,200},{272,200},{268,200},{264,200},{260,200},{256,200},{252,200},{248,200},{244,200},{240,200},{236,200},{232,200},{228,200},{224,200},{220,200},{216,200},{212,200},{208,200},{200,200},{196,200},{192,200},{188,200},{184,200},{180,200},{176,200},{172,200},{168,200},{164,200},{156,200},{56,200},{36,200},{32,200},{28,200},{24,200},{20,200},{16,200},{-20,200},{-24,200},{312,196},{308,196},{304,196},{300,196},{288,196},{284,196},{280,196},{276,196},{272,196},{268,196},{264,196},{260,196},{256,196},{252,196},{248,196},{244,196},{240,196},{236,196},{232,196},{228,196},{224,196},{220,196},{216,196},{212,196},{208,196},{200,196},{196,196},{192,196},{188,196},{184,196},{180,196},{176,196},{172,196},{168,196},{164,196},{156,196},{56,196},{-24,196},{320,192},{312,192},{308,192},{304,192},{300,192},{288,192},{284,192},{280,192},{276,192},{272,192},{268,192},{264,192},{260,192},{256,192},{252,192},{248,192},{244,192},{240,192},{236,192},{232,192},{228,192},{224,192},{220,192},{216,192},{212,192},{204,192},{200,192},{196,192},{192,192},{188,192},{184,192},{180,192},{176,192},{172,192},{168,192},{164,192},{156,192},{56,192},{316,188},{304,188},{288,188},{284,188},{280,188},{276,188},{272,188},{268,188},{264,188},{260,188},{256,188},{252,188},{248,188},{244,188},{240,188},{236,188},{232,188},{228,188},{224,188},{220,188},{216,188},{212,188},{208,188},{204,188},{200,188},{196,188},{192,188},{188,188},{184,188},{180,188},{176,188},{172,188},{168,188},{164,188},{156,188},{312,184},{288,184},{284,184},{280,184},{276,184},{272,184},{268,184},{264,184},{260,184},{256,184},{252,184},{248,184},{244,184},{240,184},{236,184},{232,184},{228,184},{224,184},{220,184},{216,184},{212,184},{208,184},{204,184},{200,184},{196,184},{192,184},{188,184},{184,184},{180,184},{176,184},{172,184},{168,184},{164,184},{156,184},{308,180},{284,180},{280,180},{276,180},{272,180},{268,180},{264,180},{260,180},{256,180},{252,180},{248,180},{244,180},{240,180},{236,180},{232,180},{228,180},{224,180},{220,180},{216,180},{212,180},{208,180},{204,180},{200,180},{196,180},{192,180},{188,180},{184,180},{180,180},{176,180},{172,180},{168,180},{160,180},{312,176},{284,176},{280,176},{276,176},{272,176},{268,176},{264,176},{260,176},{256,176},{252,176},{248,176},{244,176},{240,176},{236,176},{232,176},{228,176},{224,176},{220,176},{216,176},{212,176},{208,176},{204,176},{200,176},{196,176},{192,176},{180,176},{176,176},{172,176},{168,176},{160,176},{312,172},{288,172},{280,172},{276,172},{272,172},{268,172},{264,172},{260,172},{256,172},{252,172},{248,172},{244,172},{240,172},{224,172},{220,172},{216,172},{212,172},{208,172},{204,172},{200,172},{188,172},{184,172},{180,172},{176,172},{172,172},{164,172},{312,168},{288,168},{280,168},{276,168},{272,168},{268,168},{264,168},{260,168},{256,168},{252,168},{248,168},{244,168},{240,168},{236,168},{232,168},{228,168},{196,168},{192,168},{188,168},{184,168},{180,168},{176,168},{172,168},{164,168},{312,164},{288,164},{284,164},{276,164},{272,164},{268,164},{264,164},{260,164},{256,164},{252,164},{248,164},{244,164},{240,164},{236,164},{232,164},{228,164},{224,164},{220,164},{216,164},{212,164},{208,164},{204,164},{200,164},{196,164},{192,164},{188,164},{184,164},{180,164},{176,164},{168,164},{308,160},{304,160},{288,160},{284,160},{280,160},{272,160},{268,160},{264,160},{260,160},{256,160},{252,160},{248,160},{244,160},{240,160},{236,160},{232,160},{228,160},{224,160},{220,160},{216,160},{212,160},{208,160},{204,160},{200,160},{196,160},{192,160},{188,160},{184,160},{180,160},{176,160},{168,160},{300,156},{296,156},{288,156},{284,156},{280,156},{272,156},{268,156},{264,156},{260,156},{256,156},{252,156},{248,156},{244,156},{240,156},{236,156},{232,156},{228,156},{224,156},{220,156},{216,156},{212,156},{208,156},{204,156},{200,156},{196,156},{192,156},{188,156},{184,156},{180,156},{172,156},{288,152},{284,152},{280,152},{276,152},{268,152},{264,152},{260,152},{256,152},{252,152},{248,152},{244,152},{240,152},{236,152},{232,152},{228,152},{224,152},{220,152},{216,152},{212,152},{208,152},{204,152},{200,152},{196,152},{192,152},{188,152},{184,152},{176,152},{288,148},{284,148},{280,148},{276,148},{272,148},{264,148},{260,148},{256,148},{252,148},{248,148},{244,148},{240,148},{236,148},{232,148},{228,148},{224,148},{220,148},{216,148},{212,148},{208,148},{204,148},{200,148},{196,148},{192,148},{188,148},{184,148},{288,144},{284,144},{280,144},{276,144},{272,144},{268,144},{256,144},{252,144},{248,144},{244,144},{240,144},{236,144},{232,144},{228,144},{224,144},{220,144},{216,144},{212,144},{208,144},{204,144},{200,144},{196,144},{192,144},{188,144},{288,140},{284,140},{280,140},{276,140},{272,140},{268,140},{264,140},{260,140},{244,140},{240,140},{236,140},{232,140},{228,140},{224,140},{220,140},{216,140},{212,140},{208,140},{204,140},{200,140},{196,140},{192,140},{52,140},{288,136},{284,136},{280,136},{276,136},{272,136},{268,136},{264,136},{260,136},{256,136},{252,136},{248,136},{220,136},{216,136},{212,136},{208,136},{204,136},{200,136},{196,136},{52,136},{288,132},{284,132},{280,132},{276,132},{272,132},{268,132},{264,132},{260,132},{256,132},{252,132},{248,132},{244,132},{240,132},{236,132},{232,132},{228,132},{224,132},{52,132},{292,128},{288,128},{284,128},{280,128},{276,128},{272,128},{268,128},{264,128},{260,128},{256,128},{252,128},{248,128},{244,128},{240,128},{236,128},{232,128},{228,128},{224,128},{220,128},{216,128},{212,128},{208,128},{204,128},{200,128},{52,128},{296,124},{292,124},{288,124},{284,124},{280,124},{276,124},{272,124},{268,124},{264,124},{260,124},{256,124},{252,124},{248,124},{244,124},{240,124},{236,124},{232,124},{228,124},{224,124},{220,124},{216,124},{212,124},{208,124},{204,124},{200,124},{188,124},{184,124},{180,124},{176,124},{172,124},{168,124},{164,124},{160,124},{156,124},{296,120},{292,120},{288,120},{284,120},{280,120},{276,120},{272,120},{268,120},{264,120},{260,120},{256,120},{252,120},{248,120},{244,120},{240,120},{236,120},{232,120},{228,120},{224,120},{220,120},{216,120},{212,120},{208,120},{204,120},{168,120},{164,120},{160,120},{156,120},{152,120},{148,120},{292,116},{288,116},{284,116},{280,116},{276,116},{272,116},{268,116},{264,116},{260,116},{256,116},{252,116},{248,116},{244,116},{240,116},{236,116},{232,116},{228,116},{224,116},{220,116},{216,116},{212,116},{208,116},{204,116},{156,116},{152,116},{148,116},{144,116},{140,116},{136,116},{284,112},{280,112},{276,112},{272,112},{268,112},{264,112},{260,112},{256,112},{252,112},{248,112},{244,112},{240,112},{236,112},{232,112},{228,112},{224,112},{220,112},{216,112},{212,112},{208,112},{140,112},{136,112},{132,112},{128,112},{124,112},{268,108},{264,108},{260,108},{256,108},{252,108},{248,108},{244,108},{240,108},{236,108},{232,108},{228,108},{224,108},{220,108},{216,108},{212,108},{208,108},{128,108},{124,108},{120,108},{256,104},{252,104},{248,104},{244,104},{240,104},{236,104},{232,104},{228,104},{224,104},{220,104},{216,104},{212,104},{240,100},{236,100},{232,100},{228,100},{224,100},{220,100},{216,100},{228,96},{224,96},{220,96}};
-const short title_E_lose[1597][2] = {{220,392},{216,392},{212,392},{208,392},{204,392},{200,392},{196,392},{192,392},{188,392},{184,392},{240,388},{236,388},{232,388},{228,388},{224,388},{180,388},{176,388},{172,388},{168,388},{248,384},{244,384},{220,384},{216,384},{212,384},{208,384},{204,384},{200,384},{196,384},{192,384},{188,384},{184,384},{164,384},{160,384},{156,384},{152,384},{252,380},{240,380},{236,380},{232,380},{228,380},{224,380},{220,380},{216,380},{212,380},{208,380},{204,380},{200,380},{196,380},{192,380},{188,380},{184,380},{180,380},{176,380},{172,380},{168,380},{148,380},{260,376},{256,376},{248,376},{244,376},{240,376},{236,376},{232,376},{228,376},{224,376},{220,376},{216,376},{212,376},{208,376},{204,376},{200,376},{196,376},{192,376},{188,376},{184,376},{180,376},{176,376},{172,376},{168,376},{164,376},{160,376},{156,376},{152,376},{144,376},{264,372},{252,372},{248,372},{244,372},{240,372},{236,372},{232,372},{228,372},{224,372},{220,372},{216,372},{212,372},{208,372},{204,372},{200,372},{196,372},{192,372},{188,372},{184,372},{180,372},{176,372},{172,372},{168,372},{164,372},{160,372},{156,372},{152,372},{148,372},{140,372},{268,368},{260,368},{256,368},{252,368},{248,368},{244,368},{240,368},{236,368},{232,368},{228,368},{224,368},{220,368},{216,368},{212,368},{208,368},{204,368},{200,368},{196,368},{192,368},{188,368},{184,368},{180,368},{176,368},{172,368},{168,368},{164,368},{160,368},{156,368},{152,368},{148,368},{144,368},{136,368},{272,364},{264,364},{260,364},{256,364},{252,364},{248,364},{244,364},{240,364},{236,364},{232,364},{228,364},{224,364},{220,364},{216,364},{212,364},{208,364},{204,364},{200,364},{196,364},{192,364},{188,364},{184,364},{180,364},{176,364},{172,364},{168,364},{164,364},{160,364},{156,364},{152,364},{148,364},{144,364},{140,364},{132,364},{276,360},{268,360},{264,360},{260,360},{256,360},{252,360},{248,360},{244,360},{240,360},{236,360},{232,360},{228,360},{224,360},{220,360},{216,360},{212,360},{208,360},{204,360},{200,360},{196,360},{192,360},{188,360},{184,360},{180,360},{176,360},{172,360},{168,360},{164,360},{160,360},{156,360},{152,360},{148,360},{144,360},{140,360},{136,360},{128,360},{280,356},{272,356},{268,356},{264,356},{260,356},{256,356},{252,356},{248,356},{244,356},{240,356},{236,356},{232,356},{228,356},{212,356},{208,356},{204,356},{200,356},{196,356},{192,356},{188,356},{184,356},{180,356},{176,356},{164,356},{160,356},{156,356},{152,356},{148,356},{144,356},{140,356},{136,356},{132,356},{124,356},{280,352},{272,352},{268,352},{264,352},{260,352},{256,352},{252,352},{240,352},{236,352},{232,352},{228,352},{224,352},{212,352},{208,352},{204,352},{200,352},{188,352},{184,352},{180,352},{176,352},{164,352},{160,352},{156,352},{152,352},{148,352},{144,352},{140,352},{136,352},{132,352},{128,352},{120,352},{284,348},{276,348},{272,348},{268,348},{264,348},{260,348},{256,348},{252,348},{248,348},{244,348},{240,348},{236,348},{232,348},{228,348},{224,348},{220,348},{216,348},{212,348},{200,348},{196,348},{192,348},{188,348},{184,348},{180,348},{176,348},{172,348},{168,348},{160,348},{156,348},{152,348},{148,348},{144,348},{140,348},{136,348},{132,348},{128,348},{120,348},{288,344},{280,344},{276,344},{272,344},{268,344},{264,344},{252,344},{248,344},{244,344},{228,344},{224,344},{220,344},{216,344},{212,344},{208,344},{204,344},{200,344},{184,344},{180,344},{176,344},{172,344},{168,344},{160,344},{148,344},{144,344},{140,344},{136,344},{132,344},{128,344},{124,344},{116,344},{288,340},{280,340},{276,340},{272,340},{268,340},{264,340},{260,340},{256,340},{252,340},{248,340},{244,340},{228,340},{224,340},{220,340},{200,340},{196,340},{192,340},{188,340},{184,340},{168,340},{164,340},{160,340},{148,340},{144,340},{132,340},{128,340},{124,340},{116,340},{292,336},{284,336},{280,336},{276,336},{272,336},{264,336},{248,336},{244,336},{240,336},{236,336},{232,336},{228,336},{224,336},{204,336},{200,336},{188,336},{184,336},{168,336},{164,336},{160,336},{156,336},{152,336},{148,336},{144,336},{132,336},{128,336},{124,336},{120,336},{112,336},{292,332},{284,332},{272,332},{264,332},{248,332},{244,332},{232,332},{228,332},{224,332},{220,332},{216,332},{212,332},{208,332},{204,332},{200,332},{188,332},{184,332},{180,332},{176,332},{172,332},{168,332},{164,332},{144,332},{140,332},{136,332},{132,332},{120,332},{112,332},{296,328},{288,328},{276,328},{272,328},{268,328},{264,328},{260,328},{256,328},{252,328},{232,328},{228,328},{224,328},{220,328},{216,328},{212,328},{208,328},{204,328},{200,328},{196,328},{192,328},{188,328},{184,328},{180,328},{176,328},{168,328},{164,328},{148,328},{144,328},{140,328},{136,328},{120,328},{116,328},{108,328},{296,324},{288,324},{284,324},{280,324},{276,324},{260,324},{256,324},{252,324},{248,324},{244,324},{232,324},{220,324},{216,324},{212,324},{184,324},{180,324},{176,324},{168,324},{164,324},{156,324},{152,324},{148,324},{144,324},{136,324},{132,324},{128,324},{124,324},{120,324},{116,324},{108,324},{300,320},{292,320},{288,320},{276,320},{272,320},{260,320},{256,320},{252,320},{248,320},{244,320},{240,320},{236,320},{232,320},{220,320},{216,320},{212,320},{208,320},{188,320},{184,320},{180,320},{176,320},{172,320},{156,320},{152,320},{124,320},{120,320},{116,320},{108,320},{300,316},{292,316},{288,316},{276,316},{272,316},{268,316},{264,316},{260,316},{256,316},{244,316},{240,316},{236,316},{232,316},{224,316},{220,316},{180,316},{176,316},{164,316},{148,316},{124,316},{120,316},{116,316},{112,316},{104,316},{300,312},{284,312},{280,312},{276,312},{264,312},{260,312},{256,312},{248,312},{244,312},{240,312},{236,312},{232,312},{228,312},{224,312},{220,312},{216,312},{184,312},{176,312},{172,312},{164,312},{160,312},{156,312},{152,312},{148,312},{144,312},{140,312},{132,312},{128,312},{124,312},{116,312},{112,312},{104,312},{304,308},{296,308},{284,308},{264,308},{260,308},{256,308},{248,308},{236,308},{232,308},{220,308},{216,308},{212,308},{200,308},{196,308},{192,308},{188,308},{184,308},{176,308},{164,308},{152,308},{144,308},{140,308},{132,308},{128,308},{124,308},{112,308},{104,308},{304,304},{296,304},{292,304},{288,304},{264,304},{260,304},{252,304},{248,304},{244,304},{240,304},{216,304},{212,304},{200,304},{160,304},{140,304},{132,304},{112,304},{104,304},{304,300},{296,300},{292,300},{288,300},{276,300},{272,300},{260,300},{252,300},{204,300},{172,300},{168,300},{164,300},{156,300},{152,300},{148,300},{140,300},{120,300},{116,300},{104,300},{304,296},{276,296},{272,296},{260,296},{236,296},{232,296},{228,296},{224,296},{220,296},{204,296},{200,296},{196,296},{184,296},{180,296},{176,296},{168,296},{164,296},{156,296},{144,296},{124,296},{104,296},{304,292},{280,292},{268,292},{264,292},{260,292},{240,292},{236,292},{232,292},{228,292},{200,292},{184,292},{180,292},{176,292},{168,292},{156,292},{144,292},{124,292},{120,292},{112,292},{104,292},{304,288},{296,288},{292,288},{288,288},{284,288},{276,288},{252,288},{248,288},{244,288},{220,288},{216,288},{196,288},{192,288},{188,288},{168,288},{164,288},{144,288},{136,288},{132,288},{104,288},{304,284},{292,284},{288,284},{284,284},{264,284},{252,284},{248,284},{232,284},{228,284},{224,284},{172,284},{168,284},{164,284},{152,284},{136,284},{132,284},{124,284},{116,284},{104,284},{304,280},{264,280},{252,280},{224,280},{220,280},{204,280},{200,280},{196,280},{192,280},{188,280},{184,280},{180,280},{168,280},{164,280},{152,280},{140,280},{136,280},{128,280},{124,280},{112,280},{104,280},{304,276},{296,276},{220,276},{208,276},{204,276},{164,276},{140,276},{136,276},{128,276},{124,276},{120,276},{112,276},{104,276},{304,272},{296,272},{284,272},{280,272},{276,272},{272,272},{260,272},{256,272},{252,272},{236,272},{124,272},{104,272},{304,268},{260,268},{236,268},{232,268},{200,268},{196,268},{192,268},{176,268},{172,268},{168,268},{164,268},{104,268},{304,264},{236,264},{232,264},{200,264},{196,264},{192,264},{188,264},{184,264},{176,264},{172,264},{152,264},{148,264},{144,264},{140,264},{128,264},{124,264},{112,264},{104,264},{304,260},{292,260},{288,260},{276,260},{260,260},{256,260},{252,260},{248,260},{228,260},{224,260},{220,260},{216,260},{212,260},{200,260},{196,260},{160,260},{156,260},{116,260},{108,260},{104,260},{300,256},{292,256},{288,256},{280,256},{276,256},{272,256},{252,256},{248,256},{228,256},{224,256},{172,256},{168,256},{116,256},{108,256},{300,252},{276,252},{272,252},{200,252},{196,252},{172,252},{168,252},{112,252},{300,248},{292,248},{288,248},{284,248},{212,248},{208,248},{204,248},{200,248},{196,248},{112,248},{296,244},{280,244},{276,244},{256,244},{252,244},{248,244},{156,244},{152,244},{148,244},{144,244},{116,244},{296,240},{280,240},{276,240},{260,240},{256,240},{252,240},{248,240},{244,240},{240,240},{236,240},{168,240},{164,240},{160,240},{156,240},{152,240},{148,240},{144,240},{140,240},{116,240},{292,236},{260,236},{256,236},{252,236},{248,236},{244,236},{240,236},{236,236},{232,236},{228,236},{172,236},{168,236},{164,236},{160,236},{156,236},{152,236},{148,236},{144,236},{140,236},{136,236},{120,236},{292,232},{264,232},{260,232},{256,232},{252,232},{248,232},{244,232},{240,232},{236,232},{232,232},{228,232},{224,232},{220,232},{216,232},{184,232},{180,232},{176,232},{172,232},{168,232},{164,232},{160,232},{156,232},{152,232},{148,232},{144,232},{140,232},{136,232},{120,232},{288,228},{264,228},{260,228},{256,228},{252,228},{248,228},{244,228},{240,228},{236,228},{232,228},{228,228},{224,228},{220,228},{216,228},{212,228},{208,228},{204,228},{200,228},{196,228},{192,228},{188,228},{184,228},{180,228},{176,228},{172,228},{168,228},{164,228},{160,228},{156,228},{152,228},{148,228},{144,228},{140,228},{136,228},{124,228},{284,224},{268,224},{264,224},{260,224},{256,224},{252,224},{248,224},{244,224},{240,224},{236,224},{232,224},{228,224},{224,224},{220,224},{216,224},{212,224},{208,224},{204,224},{200,224},{196,224},{192,224},{188,224},{184,224},{180,224},{176,224},{172,224},{168,224},{164,224},{160,224},{156,224},{152,224},{148,224},{144,224},{140,224},{136,224},{124,224},{284,220},{272,220},{268,220},{264,220},{260,220},{256,220},{252,220},{248,220},{244,220},{240,220},{236,220},{232,220},{228,220},{224,220},{220,220},{216,220},{212,220},{208,220},{204,220},{200,220},{196,220},{192,220},{188,220},{184,220},{180,220},{176,220},{172,220},{168,220},{164,220},{160,220},{156,220},{152,220},{148,220},{144,220},{140,220},{136,220},{132,220},{124,220},{284,216},{272,216},{268,216},{264,216},{260,216},{256,216},{252,216},{248,216},{244,216},{240,216},{236,216},{232,216},{228,216},{224,216},{220,216},{216,216},{212,216},{208,216},{204,216},{200,216},{196,216},{192,216},{188,216},{184,216},{180,216},{176,216},{172,216},{168,216},{164,216},{160,216},{156,216},{152,216},{148,216},{144,216},{140,216},{136,216},{132,216},{124,216},{284,212},{272,212},{268,212},{264,212},{240,212},{236,212},{232,212},{228,212},{224,212},{220,212},{216,212},{212,212},{208,212},{204,212},{200,212},{196,212},{192,212},{188,212},{184,212},{180,212},{176,212},{172,212},{168,212},{140,212},{136,212},{132,212},{124,212},{280,208},{272,208},{268,208},{264,208},{260,208},{228,208},{224,208},{220,208},{216,208},{212,208},{208,208},{204,208},{200,208},{196,208},{192,208},{188,208},{184,208},{180,208},{144,208},{140,208},{136,208},{132,208},{124,208},{280,204},{272,204},{268,204},{264,204},{260,204},{256,204},{252,204},{248,204},{244,204},{216,204},{212,204},{208,204},{204,204},{200,204},{196,204},{192,204},{188,204},{168,204},{164,204},{160,204},{156,204},{152,204},{148,204},{144,204},{140,204},{136,204},{132,204},{124,204},{280,200},{272,200},{268,200},{264,200},{260,200},{256,200},{252,200},{244,200},{240,200},{236,200},{232,200},{228,200},{224,200},{220,200},{216,200},{212,200},{208,200},{204,200},{200,200},{196,200},{192,200},{188,200},{184,200},{180,200},{176,200},{172,200},{168,200},{164,200},{160,200},{156,200},{148,200},{144,200},{140,200},{136,200},{132,200},{124,200},{284,196},{280,196},{272,196},{268,196},{264,196},{260,196},{256,196},{252,196},{248,196},{220,196},{216,196},{212,196},{208,196},{204,196},{200,196},{196,196},{192,196},{188,196},{184,196},{180,196},{152,196},{148,196},{144,196},{140,196},{136,196},{132,196},{124,196},{296,192},{292,192},{288,192},{272,192},{268,192},{264,192},{260,192},{256,192},{252,192},{248,192},{244,192},{240,192},{236,192},{232,192},{228,192},{224,192},{220,192},{216,192},{212,192},{208,192},{204,192},{200,192},{196,192},{192,192},{188,192},{184,192},{180,192},{176,192},{172,192},{168,192},{164,192},{160,192},{156,192},{152,192},{148,192},{144,192},{140,192},{136,192},{132,192},{304,188},{300,188},{276,188},{268,188},{264,188},{260,188},{256,188},{252,188},{248,188},{244,188},{240,188},{236,188},{232,188},{228,188},{224,188},{220,188},{216,188},{212,188},{208,188},{204,188},{200,188},{196,188},{192,188},{188,188},{184,188},{180,188},{176,188},{172,188},{168,188},{164,188},{160,188},{156,188},{152,188},{148,188},{144,188},{140,188},{136,188},{128,188},{320,184},{316,184},{312,184},{308,184},{276,184},{268,184},{264,184},{260,184},{256,184},{252,184},{248,184},{244,184},{240,184},{236,184},{232,184},{228,184},{224,184},{220,184},{216,184},{212,184},{208,184},{204,184},{200,184},{196,184},{192,184},{188,184},{184,184},{180,184},{176,184},{172,184},{168,184},{164,184},{160,184},{156,184},{152,184},{148,184},{144,184},{140,184},{136,184},{128,184},{272,180},{264,180},{260,180},{256,180},{252,180},{248,180},{244,180},{240,180},{236,180},{232,180},{228,180},{220,180},{216,180},{212,180},{208,180},{204,180},{200,180},{196,180},{192,180},{188,180},{184,180},{180,180},{172,180},{168,180},{164,180},{160,180},{156,180},{152,180},{148,180},{144,180},{140,180},{132,180},{272,176},{264,176},{260,176},{256,176},{252,176},{248,176},{244,176},{240,176},{236,176},{232,176},{228,176},{220,176},{216,176},{212,176},{208,176},{204,176},{200,176},{196,176},{192,176},{188,176},{184,176},{180,176},{172,176},{168,176},{164,176},{160,176},{156,176},{152,176},{148,176},{144,176},{140,176},{132,176},{268,172},{260,172},{256,172},{252,172},{248,172},{244,172},{232,172},{228,172},{224,172},{216,172},{212,172},{208,172},{204,172},{200,172},{196,172},{192,172},{188,172},{184,172},{176,172},{172,172},{156,172},{152,172},{148,172},{144,172},{136,172},{264,168},{256,168},{252,168},{248,168},{244,168},{232,168},{224,168},{208,168},{204,168},{200,168},{196,168},{192,168},{156,168},{152,168},{148,168},{140,168},{260,164},{248,164},{244,164},{240,164},{232,164},{216,164},{212,164},{188,164},{180,164},{160,164},{156,164},{144,164},{256,160},{252,160},{244,160},{240,160},{236,160},{232,160},{224,160},{216,160},{204,160},{196,160},{188,160},{180,160},{172,160},{168,160},{164,160},{160,160},{152,160},{148,160},{248,156},{240,156},{236,156},{232,156},{228,156},{224,156},{220,156},{216,156},{212,156},{208,156},{204,156},{200,156},{196,156},{192,156},{188,156},{184,156},{180,156},{176,156},{172,156},{168,156},{164,156},{160,156},{152,156},{248,152},{236,152},{232,152},{228,152},{224,152},{220,152},{216,152},{180,152},{176,152},{172,152},{168,152},{164,152},{156,152},{244,148},{232,148},{228,148},{224,148},{220,148},{216,148},{212,148},{208,148},{204,148},{200,148},{196,148},{192,148},{188,148},{184,148},{180,148},{176,148},{172,148},{168,148},{156,148},{244,144},{224,144},{220,144},{216,144},{212,144},{208,144},{204,144},{200,144},{196,144},{192,144},{188,144},{184,144},{180,144},{176,144},{156,144},{244,140},{236,140},{220,140},{216,140},{212,140},{208,140},{204,140},{200,140},{196,140},{192,140},{188,140},{184,140},{180,140},{164,140},{156,140},{240,136},{236,136},{216,136},{212,136},{208,136},{204,136},{200,136},{196,136},{192,136},{188,136},{184,136},{164,136},{160,136},{232,132},{168,132},{232,128},{220,128},{168,128},{232,124},{224,124},{212,124},{196,124},{188,124},{176,124},{168,124},{228,120},{224,120},{220,120},{216,120},{212,120},{204,120},{196,120},{184,120},{180,120},{176,120},{172,120},{208,116},{204,116},{200,116},{196,116},{192,116},{188,116}};
-const short title_E_win[3156][2] = {{220,440},{216,440},{212,440},{208,440},{204,440},{200,440},{196,440},{192,440},{188,440},{184,440},{180,440},{176,440},{172,440},{168,440},{232,436},{228,436},{224,436},{164,436},{160,436},{236,432},{220,432},{216,432},{212,432},{208,432},{204,432},{200,432},{196,432},{192,432},{188,432},{184,432},{180,432},{176,432},{172,432},{168,432},{156,432},{152,432},{240,428},{228,428},{224,428},{220,428},{216,428},{212,428},{208,428},{204,428},{200,428},{196,428},{192,428},{188,428},{184,428},{180,428},{176,428},{172,428},{168,428},{164,428},{160,428},{148,428},{144,428},{244,424},{236,424},{232,424},{228,424},{224,424},{220,424},{216,424},{212,424},{208,424},{204,424},{200,424},{188,424},{184,424},{180,424},{176,424},{172,424},{168,424},{164,424},{160,424},{156,424},{152,424},{140,424},{136,424},{252,420},{248,420},{240,420},{236,420},{232,420},{228,420},{224,420},{220,420},{204,420},{200,420},{196,420},{192,420},{188,420},{184,420},{180,420},{176,420},{160,420},{156,420},{152,420},{148,420},{144,420},{140,420},{132,420},{256,416},{244,416},{240,416},{236,416},{232,416},{228,416},{220,416},{216,416},{212,416},{208,416},{204,416},{200,416},{184,416},{180,416},{176,416},{172,416},{168,416},{164,416},{160,416},{156,416},{152,416},{148,416},{144,416},{140,416},{128,416},{260,412},{248,412},{244,412},{240,412},{236,412},{232,412},{228,412},{224,412},{220,412},{216,412},{212,412},{208,412},{204,412},{200,412},{184,412},{180,412},{176,412},{172,412},{168,412},{164,412},{160,412},{156,412},{140,412},{136,412},{124,412},{264,408},{256,408},{252,408},{248,408},{244,408},{240,408},{236,408},{232,408},{228,408},{224,408},{220,408},{208,408},{204,408},{200,408},{196,408},{192,408},{188,408},{184,408},{164,408},{160,408},{156,408},{140,408},{136,408},{132,408},{120,408},{268,404},{256,404},{252,404},{248,404},{232,404},{228,404},{224,404},{220,404},{216,404},{212,404},{208,404},{204,404},{200,404},{196,404},{192,404},{188,404},{184,404},{160,404},{156,404},{152,404},{148,404},{144,404},{140,404},{136,404},{132,404},{128,404},{116,404},{272,400},{260,400},{256,400},{232,400},{228,400},{212,400},{208,400},{204,400},{188,400},{184,400},{180,400},{176,400},{172,400},{168,400},{164,400},{152,400},{148,400},{144,400},{140,400},{136,400},{132,400},{128,400},{124,400},{112,400},{272,396},{264,396},{260,396},{256,396},{252,396},{248,396},{244,396},{240,396},{236,396},{232,396},{228,396},{224,396},{220,396},{216,396},{212,396},{208,396},{204,396},{188,396},{184,396},{180,396},{176,396},{156,396},{128,396},{124,396},{112,396},{276,392},{268,392},{264,392},{260,392},{256,392},{252,392},{240,392},{236,392},{232,392},{216,392},{196,392},{192,392},{172,392},{168,392},{164,392},{160,392},{156,392},{144,392},{120,392},{108,392},{276,388},{268,388},{264,388},{260,388},{256,388},{252,388},{248,388},{208,388},{204,388},{152,388},{148,388},{144,388},{140,388},{132,388},{128,388},{116,388},{108,388},{276,384},{264,384},{260,384},{256,384},{244,384},{236,384},{232,384},{224,384},{212,384},{188,384},{184,384},{180,384},{176,384},{160,384},{148,384},{128,384},{120,384},{116,384},{104,384},{280,380},{272,380},{268,380},{264,380},{244,380},{220,380},{216,380},{208,380},{204,380},{200,380},{188,380},{184,380},{180,380},{140,380},{136,380},{132,380},{116,380},{112,380},{104,380},{280,376},{272,376},{268,376},{256,376},{252,376},{236,376},{232,376},{228,376},{216,376},{128,376},{124,376},{104,376},{284,372},{272,372},{264,372},{252,372},{244,372},{224,372},{116,372},{112,372},{104,372},{284,368},{268,368},{248,368},{244,368},{236,368},{232,368},{100,368},{288,364},{280,364},{272,364},{264,364},{260,364},{252,364},{116,364},{108,364},{100,364},{288,360},{280,360},{264,360},{256,360},{248,360},{180,360},{176,360},{172,360},{168,360},{164,360},{160,360},{156,360},{100,360},{288,356},{276,356},{260,356},{256,356},{192,356},{188,356},{184,356},{180,356},{176,356},{172,356},{168,356},{164,356},{160,356},{156,356},{152,356},{148,356},{144,356},{140,356},{108,356},{100,356},{292,352},{284,352},{216,352},{212,352},{208,352},{204,352},{200,352},{196,352},{192,352},{188,352},{184,352},{180,352},{176,352},{172,352},{168,352},{164,352},{160,352},{156,352},{152,352},{148,352},{144,352},{140,352},{136,352},{132,352},{128,352},{108,352},{100,352},{292,348},{268,348},{240,348},{236,348},{232,348},{228,348},{224,348},{220,348},{216,348},{212,348},{208,348},{204,348},{200,348},{196,348},{192,348},{188,348},{184,348},{180,348},{176,348},{172,348},{168,348},{164,348},{160,348},{156,348},{152,348},{148,348},{144,348},{140,348},{136,348},{132,348},{128,348},{96,348},{292,344},{280,344},{264,344},{244,344},{240,344},{236,344},{232,344},{228,344},{224,344},{220,344},{216,344},{212,344},{208,344},{204,344},{200,344},{196,344},{192,344},{188,344},{184,344},{180,344},{176,344},{172,344},{168,344},{164,344},{160,344},{156,344},{152,344},{148,344},{144,344},{140,344},{136,344},{132,344},{128,344},{96,344},{292,340},{284,340},{272,340},{268,340},{244,340},{240,340},{236,340},{232,340},{228,340},{224,340},{220,340},{216,340},{212,340},{208,340},{204,340},{200,340},{196,340},{192,340},{188,340},{184,340},{180,340},{176,340},{172,340},{168,340},{164,340},{160,340},{156,340},{152,340},{148,340},{144,340},{140,340},{136,340},{132,340},{128,340},{124,340},{96,340},{292,336},{284,336},{244,336},{240,336},{236,336},{232,336},{228,336},{224,336},{220,336},{216,336},{212,336},{208,336},{204,336},{200,336},{196,336},{192,336},{188,336},{184,336},{180,336},{176,336},{172,336},{168,336},{164,336},{160,336},{156,336},{152,336},{148,336},{144,336},{140,336},{136,336},{132,336},{128,336},{124,336},{96,336},{292,332},{284,332},{276,332},{272,332},{248,332},{244,332},{240,332},{236,332},{232,332},{228,332},{224,332},{220,332},{216,332},{212,332},{208,332},{204,332},{200,332},{196,332},{192,332},{188,332},{184,332},{180,332},{176,332},{172,332},{136,332},{132,332},{128,332},{124,332},{96,332},{292,328},{280,328},{248,328},{244,328},{240,328},{236,328},{232,328},{228,328},{224,328},{220,328},{216,328},{212,328},{208,328},{204,328},{200,328},{196,328},{192,328},{188,328},{184,328},{180,328},{176,328},{128,328},{124,328},{120,328},{96,328},{292,324},{276,324},{248,324},{244,324},{240,324},{236,324},{232,324},{228,324},{204,324},{200,324},{196,324},{192,324},{188,324},{184,324},{180,324},{176,324},{124,324},{120,324},{96,324},{292,320},{252,320},{248,320},{244,320},{240,320},{200,320},{196,320},{192,320},{188,320},{184,320},{180,320},{176,320},{156,320},{152,320},{148,320},{144,320},{140,320},{136,320},{132,320},{128,320},{124,320},{120,320},{96,320},{288,316},{252,316},{248,316},{200,316},{196,316},{192,316},{188,316},{184,316},{180,316},{176,316},{172,316},{168,316},{164,316},{160,316},{156,316},{152,316},{148,316},{144,316},{140,316},{136,316},{132,316},{128,316},{124,316},{120,316},{96,316},{288,312},{256,312},{252,312},{236,312},{232,312},{228,312},{224,312},{220,312},{216,312},{212,312},{208,312},{204,312},{200,312},{196,312},{192,312},{188,312},{184,312},{176,312},{172,312},{168,312},{164,312},{160,312},{132,312},{128,312},{124,312},{120,312},{116,312},{100,312},{288,308},{260,308},{256,308},{248,308},{244,308},{240,308},{236,308},{232,308},{228,308},{224,308},{220,308},{216,308},{212,308},{208,308},{204,308},{200,308},{196,308},{176,308},{172,308},{168,308},{164,308},{156,308},{152,308},{148,308},{144,308},{140,308},{136,308},{128,308},{124,308},{120,308},{116,308},{100,308},{284,304},{260,304},{256,304},{252,304},{248,304},{244,304},{240,304},{212,304},{208,304},{204,304},{200,304},{196,304},{180,304},{176,304},{172,304},{168,304},{160,304},{132,304},{128,304},{124,304},{120,304},{116,304},{112,304},{100,304},{284,300},{260,300},{256,300},{252,300},{248,300},{236,300},{232,300},{228,300},{224,300},{220,300},{216,300},{208,300},{204,300},{200,300},{196,300},{192,300},{180,300},{176,300},{172,300},{168,300},{164,300},{140,300},{136,300},{124,300},{120,300},{116,300},{112,300},{96,300},{288,296},{280,296},{264,296},{260,296},{256,296},{252,296},{244,296},{240,296},{212,296},{208,296},{204,296},{200,296},{196,296},{192,296},{180,296},{176,296},{172,296},{168,296},{160,296},{156,296},{144,296},{140,296},{136,296},{132,296},{128,296},{124,296},{120,296},{116,296},{112,296},{108,296},{96,296},{288,292},{280,292},{264,292},{260,292},{256,292},{252,292},{248,292},{236,292},{216,292},{204,292},{200,292},{196,292},{192,292},{180,292},{176,292},{172,292},{164,292},{160,292},{156,292},{152,292},{148,292},{144,292},{140,292},{136,292},{132,292},{128,292},{124,292},{120,292},{116,292},{112,292},{108,292},{96,292},{288,288},{280,288},{264,288},{260,288},{256,288},{252,288},{240,288},{236,288},{232,288},{220,288},{216,288},{212,288},{208,288},{204,288},{200,288},{196,288},{192,288},{176,288},{172,288},{168,288},{164,288},{160,288},{156,288},{152,288},{148,288},{144,288},{140,288},{136,288},{132,288},{128,288},{124,288},{120,288},{116,288},{112,288},{108,288},{104,288},{96,288},{288,284},{280,284},{264,284},{260,284},{256,284},{252,284},{248,284},{244,284},{240,284},{236,284},{232,284},{228,284},{224,284},{220,284},{216,284},{212,284},{208,284},{204,284},{200,284},{188,284},{184,284},{180,284},{172,284},{168,284},{164,284},{160,284},{156,284},{152,284},{148,284},{144,284},{140,284},{136,284},{132,284},{128,284},{124,284},{120,284},{116,284},{112,284},{108,284},{104,284},{96,284},{288,280},{280,280},{268,280},{264,280},{260,280},{256,280},{252,280},{248,280},{244,280},{240,280},{236,280},{232,280},{228,280},{224,280},{220,280},{216,280},{212,280},{208,280},{204,280},{200,280},{196,280},{192,280},{188,280},{184,280},{180,280},{176,280},{172,280},{168,280},{164,280},{160,280},{156,280},{152,280},{148,280},{144,280},{140,280},{136,280},{132,280},{128,280},{124,280},{120,280},{116,280},{112,280},{108,280},{104,280},{96,280},{288,276},{280,276},{268,276},{264,276},{260,276},{256,276},{252,276},{248,276},{244,276},{240,276},{236,276},{232,276},{228,276},{224,276},{220,276},{216,276},{212,276},{208,276},{204,276},{200,276},{196,276},{192,276},{188,276},{184,276},{180,276},{176,276},{172,276},{168,276},{164,276},{160,276},{156,276},{152,276},{148,276},{144,276},{140,276},{136,276},{132,276},{128,276},{124,276},{120,276},{116,276},{112,276},{108,276},{104,276},{96,276},{288,272},{280,272},{276,272},{268,272},{264,272},{260,272},{256,272},{252,272},{248,272},{244,272},{240,272},{236,272},{232,272},{228,272},{224,272},{220,272},{216,272},{212,272},{208,272},{204,272},{200,272},{196,272},{192,272},{188,272},{184,272},{180,272},{176,272},{172,272},{168,272},{164,272},{160,272},{152,272},{148,272},{144,272},{140,272},{136,272},{132,272},{128,272},{124,272},{120,272},{116,272},{108,272},{104,272},{96,272},{284,268},{276,268},{268,268},{264,268},{260,268},{256,268},{252,268},{248,268},{244,268},{240,268},{236,268},{232,268},{228,268},{224,268},{220,268},{216,268},{212,268},{208,268},{204,268},{200,268},{196,268},{192,268},{188,268},{184,268},{180,268},{176,268},{172,268},{168,268},{164,268},{160,268},{152,268},{148,268},{144,268},{140,268},{136,268},{132,268},{128,268},{124,268},{120,268},{116,268},{108,268},{96,268},{284,264},{276,264},{264,264},{260,264},{256,264},{252,264},{248,264},{244,264},{240,264},{236,264},{232,264},{228,264},{224,264},{220,264},{216,264},{208,264},{204,264},{200,264},{196,264},{192,264},{188,264},{184,264},{180,264},{176,264},{172,264},{168,264},{156,264},{152,264},{148,264},{144,264},{140,264},{136,264},{132,264},{128,264},{124,264},{120,264},{116,264},{108,264},{96,264},{284,260},{276,260},{264,260},{260,260},{256,260},{252,260},{248,260},{244,260},{240,260},{236,260},{232,260},{228,260},{224,260},{220,260},{216,260},{200,260},{196,260},{192,260},{188,260},{184,260},{180,260},{176,260},{172,260},{164,260},{160,260},{156,260},{152,260},{148,260},{144,260},{140,260},{136,260},{132,260},{128,260},{124,260},{120,260},{116,260},{108,260},{100,260},{60,260},{284,256},{276,256},{272,256},{264,256},{260,256},{256,256},{252,256},{248,256},{244,256},{240,256},{236,256},{232,256},{228,256},{224,256},{220,256},{216,256},{212,256},{208,256},{204,256},{184,256},{180,256},{168,256},{156,256},{152,256},{148,256},{144,256},{136,256},{132,256},{128,256},{124,256},{120,256},{112,256},{100,256},{60,256},{56,256},{52,256},{280,252},{264,252},{260,252},{256,252},{252,252},{248,252},{244,252},{240,252},{236,252},{232,252},{228,252},{224,252},{220,252},{216,252},{212,252},{208,252},{204,252},{200,252},{196,252},{192,252},{140,252},{132,252},{128,252},{124,252},{120,252},{100,252},{60,252},{56,252},{52,252},{276,248},{272,248},{260,248},{256,248},{248,248},{244,248},{240,248},{236,248},{232,248},{228,248},{224,248},{184,248},{180,248},{176,248},{172,248},{160,248},{156,248},{132,248},{128,248},{124,248},{120,248},{100,248},{60,248},{56,248},{52,248},{272,244},{260,244},{256,244},{252,244},{244,244},{240,244},{236,244},{232,244},{228,244},{220,244},{200,244},{188,244},{184,244},{180,244},{176,244},{172,244},{168,244},{164,244},{160,244},{156,244},{152,244},{148,244},{132,244},{128,244},{124,244},{116,244},{104,244},{60,244},{56,244},{52,244},{320,240},{268,240},{256,240},{244,240},{240,240},{236,240},{232,240},{208,240},{204,240},{200,240},{196,240},{192,240},{188,240},{184,240},{180,240},{176,240},{172,240},{168,240},{164,240},{160,240},{156,240},{152,240},{148,240},{144,240},{136,240},{132,240},{128,240},{124,240},{104,240},{60,240},{56,240},{320,236},{268,236},{260,236},{256,236},{244,236},{240,236},{236,236},{232,236},{228,236},{216,236},{212,236},{144,236},{140,236},{136,236},{132,236},{128,236},{124,236},{104,236},{60,236},{56,236},{44,236},{40,236},{320,232},{264,232},{256,232},{252,232},{240,232},{236,232},{232,232},{228,232},{216,232},{204,232},{196,232},{188,232},{184,232},{176,232},{172,232},{164,232},{156,232},{148,232},{144,232},{140,232},{136,232},{132,232},{128,232},{116,232},{108,232},{44,232},{40,232},{320,228},{264,228},{252,228},{248,228},{240,228},{236,228},{232,228},{228,228},{224,228},{220,228},{216,228},{212,228},{196,228},{188,228},{184,228},{176,228},{172,228},{164,228},{152,228},{148,228},{144,228},{140,228},{136,228},{132,228},{128,228},{108,228},{76,228},{48,228},{44,228},{40,228},{320,224},{260,224},{252,224},{244,224},{240,224},{236,224},{232,224},{228,224},{224,224},{220,224},{216,224},{212,224},{208,224},{204,224},{200,224},{160,224},{156,224},{152,224},{148,224},{144,224},{140,224},{136,224},{132,224},{128,224},{124,224},{112,224},{92,224},{88,224},{56,224},{52,224},{48,224},{44,224},{40,224},{288,220},{260,220},{244,220},{240,220},{236,220},{232,220},{228,220},{224,220},{220,220},{216,220},{212,220},{208,220},{204,220},{200,220},{196,220},{192,220},{188,220},{184,220},{180,220},{176,220},{172,220},{168,220},{164,220},{160,220},{156,220},{152,220},{148,220},{144,220},{140,220},{136,220},{132,220},{128,220},{112,220},{92,220},{88,220},{72,220},{68,220},{64,220},{60,220},{56,220},{52,220},{48,220},{44,220},{40,220},{36,220},{32,220},{292,216},{288,216},{260,216},{244,216},{236,216},{232,216},{228,216},{224,216},{220,216},{216,216},{212,216},{208,216},{204,216},{200,216},{196,216},{192,216},{188,216},{184,216},{180,216},{176,216},{172,216},{168,216},{164,216},{160,216},{156,216},{152,216},{148,216},{144,216},{140,216},{136,216},{132,216},{128,216},{116,216},{96,216},{92,216},{88,216},{72,216},{68,216},{64,216},{60,216},{56,216},{52,216},{48,216},{44,216},{40,216},{36,216},{32,216},{28,216},{24,216},{292,212},{288,212},{260,212},{232,212},{228,212},{224,212},{220,212},{216,212},{212,212},{208,212},{204,212},{200,212},{196,212},{192,212},{188,212},{184,212},{180,212},{176,212},{172,212},{168,212},{164,212},{160,212},{156,212},{152,212},{148,212},{144,212},{140,212},{136,212},{120,212},{96,212},{92,212},{88,212},{72,212},{68,212},{64,212},{60,212},{56,212},{40,212},{36,212},{32,212},{28,212},{24,212},{12,212},{292,208},{288,208},{256,208},{248,208},{236,208},{232,208},{228,208},{216,208},{212,208},{208,208},{204,208},{200,208},{196,208},{192,208},{188,208},{184,208},{180,208},{176,208},{172,208},{168,208},{164,208},{160,208},{156,208},{152,208},{148,208},{144,208},{140,208},{124,208},{96,208},{92,208},{88,208},{72,208},{68,208},{64,208},{60,208},{52,208},{48,208},{44,208},{36,208},{32,208},{28,208},{24,208},{12,208},{8,208},{320,204},{292,204},{288,204},{256,204},{248,204},{244,204},{228,204},{224,204},{212,204},{208,204},{204,204},{200,204},{196,204},{192,204},{188,204},{184,204},{180,204},{176,204},{172,204},{168,204},{164,204},{160,204},{156,204},{152,204},{148,204},{124,204},{96,204},{92,204},{76,204},{72,204},{68,204},{64,204},{56,204},{52,204},{48,204},{44,204},{40,204},{32,204},{28,204},{24,204},{20,204},{16,204},{12,204},{8,204},{-4,204},{320,200},{304,200},{292,200},{288,200},{256,200},{248,200},{244,200},{240,200},{224,200},{212,200},{208,200},{204,200},{200,200},{196,200},{192,200},{188,200},{184,200},{180,200},{176,200},{172,200},{168,200},{164,200},{160,200},{156,200},{152,200},{144,200},{128,200},{108,200},{80,200},{76,200},{72,200},{68,200},{60,200},{52,200},{48,200},{44,200},{40,200},{36,200},{28,200},{24,200},{20,200},{16,200},{12,200},{8,200},{-4,200},{320,196},{316,196},{304,196},{292,196},{256,196},{248,196},{244,196},{240,196},{236,196},{208,196},{200,196},{192,196},{184,196},{180,196},{176,196},{172,196},{168,196},{164,196},{160,196},{156,196},{148,196},{128,196},{112,196},{108,196},{88,196},{84,196},{80,196},{76,196},{72,196},{52,196},{48,196},{44,196},{40,196},{36,196},{32,196},{24,196},{20,196},{16,196},{12,196},{8,196},{0,196},{-4,196},{320,192},{316,192},{304,192},{292,192},{252,192},{244,192},{240,192},{236,192},{232,192},{204,192},{200,192},{192,192},{180,192},{172,192},{160,192},{156,192},{132,192},{112,192},{108,192},{88,192},{84,192},{80,192},{76,192},{68,192},{64,192},{60,192},{56,192},{48,192},{44,192},{40,192},{36,192},{32,192},{24,192},{20,192},{16,192},{12,192},{8,192},{0,192},{-4,192},{320,188},{316,188},{308,188},{304,188},{272,188},{252,188},{244,188},{240,188},{236,188},{232,188},{228,188},{188,188},{184,188},{172,188},{112,188},{108,188},{88,188},{84,188},{80,188},{72,188},{68,188},{64,188},{60,188},{56,188},{52,188},{40,188},{36,188},{32,188},{28,188},{20,188},{16,188},{12,188},{8,188},{4,188},{0,188},{-4,188},{320,184},{316,184},{308,184},{304,184},{300,184},{284,184},{272,184},{268,184},{252,184},{244,184},{240,184},{236,184},{232,184},{228,184},{224,184},{220,184},{140,184},{112,184},{108,184},{92,184},{88,184},{84,184},{80,184},{72,184},{68,184},{64,184},{60,184},{56,184},{52,184},{44,184},{40,184},{36,184},{32,184},{28,184},{24,184},{16,184},{12,184},{8,184},{4,184},{0,184},{-4,184},{320,180},{316,180},{312,180},{308,180},{304,180},{300,180},{288,180},{284,180},{272,180},{268,180},{252,180},{244,180},{240,180},{236,180},{232,180},{228,180},{224,180},{220,180},{216,180},{140,180},{136,180},{112,180},{108,180},{100,180},{96,180},{92,180},{88,180},{72,180},{68,180},{64,180},{60,180},{56,180},{52,180},{48,180},{44,180},{40,180},{36,180},{28,180},{24,180},{20,180},{8,180},{4,180},{0,180},{-4,180},{-8,180},{320,176},{316,176},{312,176},{308,176},{304,176},{300,176},{296,176},{288,176},{284,176},{276,176},{272,176},{268,176},{240,176},{236,176},{232,176},{228,176},{224,176},{220,176},{216,176},{212,176},{148,176},{140,176},{136,176},{112,176},{108,176},{100,176},{96,176},{92,176},{84,176},{80,176},{76,176},{68,176},{64,176},{60,176},{56,176},{52,176},{48,176},{44,176},{40,176},{32,176},{28,176},{24,176},{20,176},{16,176},{12,176},{4,176},{0,176},{-4,176},{-8,176},{320,172},{316,172},{312,172},{308,172},{304,172},{300,172},{296,172},{288,172},{284,172},{280,172},{276,172},{272,172},{268,172},{236,172},{232,172},{228,172},{224,172},{220,172},{216,172},{212,172},{204,172},{152,172},{148,172},{144,172},{140,172},{112,172},{108,172},{104,172},{100,172},{96,172},{88,172},{84,172},{80,172},{76,172},{72,172},{64,172},{60,172},{56,172},{52,172},{48,172},{44,172},{40,172},{36,172},{32,172},{28,172},{24,172},{20,172},{16,172},{12,172},{4,172},{0,172},{-4,172},{-8,172},{296,168},{292,168},{288,168},{284,168},{280,168},{276,168},{272,168},{268,168},{232,168},{228,168},{224,168},{220,168},{216,168},{212,168},{208,168},{204,168},{196,168},{180,168},{172,168},{164,168},{160,168},{156,168},{152,168},{148,168},{144,168},{140,168},{112,168},{108,168},{104,168},{100,168},{96,168},{88,168},{84,168},{80,168},{76,168},{72,168},{68,168},{64,168},{60,168},{52,168},{48,168},{44,168},{40,168},{36,168},{32,168},{28,168},{24,168},{20,168},{16,168},{12,168},{8,168},{0,168},{-4,168},{-8,168},{320,164},{308,164},{304,164},{292,164},{288,164},{284,164},{280,164},{276,164},{272,164},{268,164},{228,164},{224,164},{220,164},{216,164},{212,164},{208,164},{204,164},{200,164},{196,164},{192,164},{180,164},{176,164},{172,164},{168,164},{164,164},{160,164},{156,164},{152,164},{148,164},{144,164},{112,164},{108,164},{104,164},{100,164},{96,164},{88,164},{84,164},{80,164},{76,164},{72,164},{68,164},{64,164},{60,164},{44,164},{40,164},{36,164},{32,164},{28,164},{24,164},{20,164},{16,164},{12,164},{8,164},{0,164},{-4,164},{-8,164},{-12,164},{320,160},{312,160},{308,160},{304,160},{300,160},{280,160},{276,160},{272,160},{268,160},{260,160},{224,160},{220,160},{216,160},{212,160},{208,160},{204,160},{200,160},{196,160},{192,160},{188,160},{184,160},{180,160},{176,160},{172,160},{168,160},{164,160},{160,160},{156,160},{152,160},{148,160},{112,160},{108,160},{104,160},{100,160},{96,160},{84,160},{80,160},{76,160},{72,160},{68,160},{64,160},{60,160},{56,160},{48,160},{44,160},{40,160},{36,160},{32,160},{28,160},{24,160},{20,160},{16,160},{12,160},{8,160},{4,160},{-4,160},{-8,160},{-12,160},{316,156},{312,156},{308,156},{304,156},{300,156},{288,156},{276,156},{272,156},{268,156},{264,156},{260,156},{256,156},{216,156},{212,156},{208,156},{204,156},{200,156},{196,156},{192,156},{188,156},{184,156},{180,156},{176,156},{172,156},{168,156},{164,156},{160,156},{156,156},{152,156},{148,156},{112,156},{108,156},{104,156},{100,156},{92,156},{84,156},{80,156},{76,156},{68,156},{64,156},{60,156},{56,156},{52,156},{48,156},{44,156},{40,156},{36,156},{32,156},{28,156},{24,156},{20,156},{16,156},{12,156},{8,156},{4,156},{-4,156},{-8,156},{-12,156},{316,152},{312,152},{308,152},{304,152},{300,152},{292,152},{288,152},{284,152},{272,152},{268,152},{264,152},{260,152},{256,152},{212,152},{208,152},{204,152},{200,152},{196,152},{192,152},{188,152},{184,152},{180,152},{176,152},{172,152},{168,152},{164,152},{160,152},{156,152},{152,152},{112,152},{108,152},{104,152},{96,152},{92,152},{88,152},{80,152},{76,152},{68,152},{64,152},{60,152},{56,152},{52,152},{48,152},{44,152},{40,152},{36,152},{32,152},{28,152},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{-4,152},{-8,152},{-12,152},{-16,152},{320,148},{316,148},{312,148},{308,148},{304,148},{300,148},{292,148},{288,148},{284,148},{280,148},{272,148},{268,148},{264,148},{260,148},{256,148},{244,148},{208,148},{204,148},{200,148},{196,148},{192,148},{188,148},{184,148},{180,148},{176,148},{172,148},{168,148},{164,148},{160,148},{156,148},{112,148},{108,148},{104,148},{96,148},{92,148},{88,148},{84,148},{80,148},{76,148},{72,148},{60,148},{56,148},{52,148},{48,148},{44,148},{40,148},{36,148},{32,148},{28,148},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{-4,148},{-8,148},{-12,148},{-16,148},{320,144},{316,144},{312,144},{308,144},{304,144},{296,144},{292,144},{288,144},{284,144},{280,144},{264,144},{260,144},{256,144},{244,144},{200,144},{196,144},{192,144},{188,144},{184,144},{180,144},{176,144},{172,144},{168,144},{164,144},{160,144},{112,144},{108,144},{104,144},{96,144},{92,144},{88,144},{84,144},{80,144},{76,144},{72,144},{64,144},{60,144},{56,144},{52,144},{48,144},{44,144},{40,144},{36,144},{32,144},{28,144},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-8,144},{-12,144},{-16,144},{320,140},{316,140},{312,140},{308,140},{304,140},{296,140},{292,140},{288,140},{284,140},{280,140},{272,140},{260,140},{256,140},{248,140},{244,140},{196,140},{192,140},{188,140},{184,140},{180,140},{176,140},{172,140},{168,140},{164,140},{116,140},{112,140},{108,140},{104,140},{96,140},{92,140},{88,140},{84,140},{76,140},{72,140},{68,140},{64,140},{60,140},{56,140},{52,140},{48,140},{44,140},{40,140},{36,140},{32,140},{28,140},{24,140},{20,140},{16,140},{12,140},{8,140},{4,140},{0,140},{-8,140},{-12,140},{-16,140},{320,136},{316,136},{312,136},{308,136},{304,136},{300,136},{296,136},{292,136},{288,136},{284,136},{276,136},{272,136},{268,136},{260,136},{256,136},{248,136},{244,136},{188,136},{184,136},{180,136},{176,136},{172,136},{168,136},{116,136},{112,136},{108,136},{104,136},{100,136},{92,136},{88,136},{76,136},{72,136},{68,136},{64,136},{60,136},{56,136},{52,136},{48,136},{44,136},{40,136},{36,136},{32,136},{28,136},{24,136},{20,136},{16,136},{12,136},{8,136},{4,136},{0,136},{-8,136},{-12,136},{-16,136},{320,132},{316,132},{312,132},{308,132},{304,132},{300,132},{296,132},{292,132},{288,132},{284,132},{276,132},{272,132},{268,132},{260,132},{256,132},{248,132},{244,132},{180,132},{176,132},{112,132},{108,132},{104,132},{100,132},{96,132},{88,132},{84,132},{80,132},{76,132},{72,132},{68,132},{64,132},{60,132},{56,132},{52,132},{48,132},{44,132},{40,132},{36,132},{32,132},{28,132},{24,132},{20,132},{16,132},{12,132},{8,132},{4,132},{0,132},{-4,132},{-12,132},{-16,132},{320,128},{316,128},{312,128},{308,128},{304,128},{300,128},{296,128},{292,128},{288,128},{280,128},{276,128},{272,128},{268,128},{260,128},{256,128},{244,128},{112,128},{108,128},{104,128},{100,128},{96,128},{88,128},{84,128},{80,128},{76,128},{72,128},{68,128},{64,128},{60,128},{56,128},{52,128},{48,128},{44,128},{40,128},{36,128},{32,128},{28,128},{24,128},{20,128},{16,128},{12,128},{8,128},{4,128},{0,128},{-4,128},{-12,128},{-16,128},{320,124},{316,124},{312,124},{308,124},{304,124},{300,124},{296,124},{292,124},{288,124},{284,124},{280,124},{276,124},{272,124},{268,124},{260,124},{256,124},{252,124},{104,124},{100,124},{96,124},{88,124},{84,124},{80,124},{76,124},{72,124},{68,124},{64,124},{60,124},{56,124},{52,124},{48,124},{44,124},{40,124},{36,124},{32,124},{28,124},{24,124},{20,124},{16,124},{12,124},{8,124},{4,124},{0,124},{-4,124},{-12,124},{-16,124},{320,120},{316,120},{312,120},{308,120},{304,120},{300,120},{296,120},{292,120},{288,120},{284,120},{280,120},{276,120},{272,120},{264,120},{256,120},{252,120},{104,120},{100,120},{96,120},{92,120},{84,120},{80,120},{76,120},{72,120},{68,120},{64,120},{60,120},{56,120},{52,120},{48,120},{44,120},{40,120},{36,120},{32,120},{28,120},{24,120},{20,120},{16,120},{12,120},{8,120},{4,120},{0,120},{-4,120},{-12,120},{-16,120},{320,116},{316,116},{312,116},{308,116},{304,116},{300,116},{296,116},{292,116},{288,116},{284,116},{280,116},{276,116},{272,116},{264,116},{260,116},{252,116},{104,116},{100,116},{96,116},{92,116},{84,116},{80,116},{76,116},{72,116},{68,116},{64,116},{60,116},{56,116},{52,116},{48,116},{44,116},{40,116},{36,116},{32,116},{28,116},{24,116},{20,116},{16,116},{12,116},{8,116},{4,116},{0,116},{-4,116},{-12,116},{-16,116},{320,112},{316,112},{312,112},{308,112},{304,112},{300,112},{296,112},{292,112},{288,112},{284,112},{280,112},{276,112},{272,112},{268,112},{264,112},{260,112},{252,112},{100,112},{96,112},{92,112},{84,112},{80,112},{76,112},{72,112},{68,112},{64,112},{60,112},{56,112},{52,112},{48,112},{44,112},{40,112},{36,112},{32,112},{28,112},{24,112},{20,112},{16,112},{12,112},{8,112},{4,112},{0,112},{-4,112},{-12,112},{-16,112},{320,108},{316,108},{312,108},{308,108},{304,108},{300,108},{296,108},{292,108},{288,108},{284,108},{280,108},{276,108},{272,108},{268,108},{264,108},{260,108},{252,108},{96,108},{92,108},{88,108},{80,108},{76,108},{72,108},{68,108},{64,108},{60,108},{56,108},{52,108},{48,108},{44,108},{40,108},{36,108},{32,108},{28,108},{24,108},{20,108},{16,108},{12,108},{8,108},{4,108},{0,108},{-4,108},{320,104},{316,104},{312,104},{308,104},{304,104},{300,104},{296,104},{292,104},{288,104},{284,104},{280,104},{276,104},{272,104},{268,104},{264,104},{260,104},{252,104},{96,104},{92,104},{88,104},{84,104},{76,104},{72,104},{68,104},{64,104},{60,104},{56,104},{52,104},{48,104},{44,104},{40,104},{36,104},{32,104},{28,104},{24,104},{20,104},{16,104},{12,104},{8,104},{4,104},{0,104},{-4,104},{320,100},{316,100},{312,100},{308,100},{304,100},{300,100},{296,100},{292,100},{288,100},{284,100},{280,100},{276,100},{272,100},{268,100},{264,100},{252,100},{92,100},{88,100},{84,100},{80,100},{72,100},{68,100},{64,100},{60,100},{56,100},{52,100},{48,100},{44,100},{40,100},{36,100},{32,100},{28,100},{24,100},{20,100},{16,100},{12,100},{8,100},{4,100},{0,100},{-4,100},{320,96},{316,96},{312,96},{308,96},{304,96},{300,96},{296,96},{292,96},{288,96},{284,96},{280,96},{276,96},{272,96},{268,96},{264,96},{256,96},{88,96},{84,96},{80,96},{76,96},{68,96},{64,96},{60,96},{56,96},{52,96},{48,96},{44,96},{40,96},{36,96},{32,96},{28,96},{24,96},{20,96},{16,96},{12,96},{8,96},{4,96},{0,96},{320,92},{316,92},{312,92},{308,92},{304,92},{300,92},{296,92},{292,92},{288,92},{284,92},{280,92},{276,92},{272,92},{268,92},{256,92},{84,92},{80,92},{76,92},{72,92},{60,92},{56,92},{52,92},{48,92},{44,92},{40,92},{36,92},{32,92},{28,92},{24,92},{20,92},{16,92},{12,92},{8,92},{4,92},{320,88},{316,88},{312,88},{308,88},{304,88},{300,88},{296,88},{292,88},{288,88},{284,88},{280,88},{276,88},{272,88},{268,88},{260,88},{80,88},{76,88},{72,88},{68,88},{64,88},{52,88},{48,88},{44,88},{40,88},{36,88},{32,88},{28,88},{24,88},{20,88},{16,88},{12,88},{8,88},{320,84},{316,84},{312,84},{308,84},{304,84},{300,84},{296,84},{292,84},{288,84},{284,84},{280,84},{276,84},{272,84},{260,84},{76,84},{72,84},{68,84},{64,84},{60,84},{56,84},{48,84},{44,84},{40,84},{36,84},{32,84},{28,84},{24,84},{20,84},{16,84},{320,80},{316,80},{312,80},{308,80},{304,80},{300,80},{296,80},{292,80},{288,80},{284,80},{280,80},{276,80},{264,80},{68,80},{64,80},{60,80},{56,80},{44,80},{40,80},{36,80},{32,80},{28,80},{320,76},{316,76},{312,76},{308,76},{304,76},{300,76},{296,76},{292,76},{288,76},{284,76},{280,76},{276,76},{268,76},{60,76},{56,76},{52,76},{44,76},{40,76},{36,76},{320,72},{316,72},{312,72},{308,72},{304,72},{300,72},{296,72},{292,72},{288,72},{284,72},{280,72},{56,72},{52,72},{44,72},{320,68},{316,68},{312,68},{308,68},{304,68},{300,68},{296,68},{292,68},{288,68},{284,68},{320,64},{316,64},{312,64},{308,64},{304,64},{300,64},{296,64},{292,64},{320,60},{316,60},{312,60},{308,60},{304,60},{320,56},{316,56},{312,56},{308,56},{316,52},{312,52}};
-
-
-
-//UI
-const short P1[13][2] = {{8,208},{4,208},{0,208},{-8,208},{8,204},{0,204},{-8,204},{8,200},{4,200},{0,200},{-8,200},{8,196},{-8,196}};
-const short P2[15][2] = {{12,208},{8,208},{4,208},{-4,208},{-8,208},{12,204},{4,204},{-8,204},{12,200},{8,200},{4,200},{-4,200},{12,196},{-4,196},{-8,196}};
-
-const short ATK1[37][2] = {{-16,176},{-24,176},{-28,176},{-32,176},{-44,176},{-56,176},{-12,172},{-20,172},{-28,172},{-36,172},{-44,172},{-56,172},{-12,168},{-20,168},{-28,168},{-36,168},{-44,168},{-56,168},{-12,164},{-16,164},{-20,164},{-28,164},{-36,164},{-40,164},{-56,164},{-12,160},{-20,160},{-28,160},{-36,160},{-44,160},{-56,160},{-12,156},{-20,156},{-28,156},{-36,156},{-44,156},{-56,156}};
-const short ATK2[40][2] = {{-16,176},{-24,176},{-28,176},{-32,176},{-44,176},{-52,176},{-56,176},{-12,172},{-20,172},{-28,172},{-36,172},{-44,172},{-56,172},{-12,168},{-20,168},{-28,168},{-36,168},{-44,168},{-56,168},{-12,164},{-16,164},{-20,164},{-28,164},{-36,164},{-40,164},{-52,164},{-56,164},{-12,160},{-20,160},{-28,160},{-36,160},{-44,160},{-52,160},{-12,156},{-20,156},{-28,156},{-36,156},{-44,156},{-52,156},{-56,156}};
-const short DOWN[16][2] = {{-28,176},{-32,176},{-36,176},{-40,176},{-20,172},{-24,172},{-44,172},{-48,172},{-20,168},{-48,168},{-24,164},{-44,164},{-28,160},{-40,160},{-32,156},{-36,156}};
-const short LEFT[16][2] = {{-36,180},{-40,180},{-32,176},{-40,176},{-28,172},{-44,172},{-24,168},{-44,168},{-24,164},{-44,164},{-28,160},{-44,160},{-32,156},{-40,156},{-36,152},{-40,152}};
-const short RIGHT[16][2] = {{-28,180},{-32,180},{-28,176},{-36,176},{-24,172},{-40,172},{-24,168},{-44,168},{-24,164},{-44,164},{-24,160},{-40,160},{-28,156},{-36,156},{-28,152},{-32,152}};
-const short UP[16][2] = {{-32,176},{-36,176},{-28,172},{-40,172},{-24,168},{-44,168},{-20,164},{-48,164},{-20,160},{-24,160},{-44,160},{-48,160},{-28,156},{-32,156},{-36,156},{-40,156}};
-const short ESC[38][2] = {{-12,180},{-16,180},{-20,180},{-24,180},{-36,180},{-40,180},{-48,180},{-52,180},{-56,180},{-12,176},{-32,176},{-48,176},{-12,172},{-32,172},{-48,172},{-12,168},{-32,168},{-48,168},{-12,164},{-16,164},{-20,164},{-36,164},{-48,164},{-12,160},{-40,160},{-48,160},{-12,156},{-40,156},{-48,156},{-12,152},{-16,152},{-20,152},{-24,152},{-32,152},{-36,152},{-48,152},{-52,152},{-56,152}};
-const short clothes[30][2] = {{-20,176},{-24,176},{-28,176},{-40,176},{-44,176},{-48,176},{-20,172},{-24,172},{-28,172},{-32,172},{-36,172},{-40,172},{-44,172},{-48,172},{-28,168},{-32,168},{-36,168},{-40,168},{-28,164},{-32,164},{-36,164},{-40,164},{-28,160},{-32,160},{-36,160},{-40,160},{-28,156},{-32,156},{-36,156},{-40,156}};
-const short countdown_1[28][2] = {{4,256},{0,256},{8,252},{4,252},{0,252},{8,248},{4,248},{0,248},{4,244},{0,244},{4,240},{0,240},{4,236},{0,236},{4,232},{0,232},{4,228},{0,228},{4,224},{0,224},{4,220},{0,220},{4,216},{0,216},{4,212},{0,212},{4,208},{0,208}};
-const short countdown_2[51][2] = {{12,256},{8,256},{4,256},{0,256},{-4,256},{16,252},{12,252},{8,252},{4,252},{0,252},{-4,252},{-8,252},{16,248},{12,248},{0,248},{-4,248},{-8,248},{-4,244},{-8,244},{-4,240},{-8,240},{0,236},{-4,236},{-8,236},{4,232},{0,232},{-4,232},{4,228},{0,228},{8,224},{4,224},{12,220},{8,220},{4,220},{16,216},{12,216},{8,216},{16,212},{12,212},{8,212},{4,212},{0,212},{-4,212},{-8,212},{16,208},{12,208},{8,208},{4,208},{0,208},{-4,208},{-8,208}};
-const short countdown_3[61][2] = {{12,256},{8,256},{4,256},{0,256},{-4,256},{16,252},{12,252},{8,252},{4,252},{0,252},{-4,252},{-8,252},{16,248},{12,248},{0,248},{-4,248},{-8,248},{-4,244},{-8,244},{-4,240},{-8,240},{4,236},{0,236},{-4,236},{-8,236},{4,232},{0,232},{-4,232},{0,228},{-4,228},{-8,228},{20,224},{16,224},{-4,224},{-8,224},{-12,224},{20,220},{16,220},{12,220},{-4,220},{-8,220},{-12,220},{20,216},{16,216},{12,216},{8,216},{4,216},{0,216},{-4,216},{-8,216},{-12,216},{16,212},{12,212},{8,212},{4,212},{0,212},{-4,212},{-8,212},{8,208},{4,208},{0,208}};
-const short heads[24][2] = {{-20,176},{-24,176},{-28,176},{-40,176},{-44,176},{-48,176},{-20,172},{-24,172},{-28,172},{-40,172},{-44,172},{-48,172},{-20,168},{-24,168},{-28,168},{-40,168},{-44,168},{-48,168},{-24,160},{-44,160},{-28,156},{-32,156},{-36,156},{-40,156}};
-const short PAUSE[24][2] = {{-24,176},{-28,176},{-40,176},{-44,176},{-24,172},{-28,172},{-40,172},{-44,172},{-24,168},{-28,168},{-40,168},{-44,168},{-24,164},{-28,164},{-40,164},{-44,164},{-24,160},{-28,160},{-40,160},{-44,160},{-24,156},{-28,156},{-40,156},{-44,156}};
-const short undefined[66][2] = {{-24,180},{-28,180},{-32,180},{-36,180},{-40,180},{-44,180},{-48,180},{-52,180},{-56,180},{-12,176},{-32,176},{-36,176},{-40,176},{-44,176},{-48,176},{-52,176},{-56,176},{-12,172},{-16,172},{-36,172},{-40,172},{-44,172},{-48,172},{-52,172},{-56,172},{-12,168},{-16,168},{-20,168},{-40,168},{-44,168},{-48,168},{-52,168},{-56,168},{-12,164},{-16,164},{-20,164},{-24,164},{-28,164},{-48,164},{-52,164},{-56,164},{-12,160},{-16,160},{-20,160},{-24,160},{-28,160},{-32,160},{-52,160},{-56,160},{-12,156},{-16,156},{-20,156},{-24,156},{-28,156},{-32,156},{-36,156},{-56,156},{-12,152},{-16,152},{-20,152},{-24,152},{-28,152},{-32,152},{-36,152},{-40,152},{-44,152}};
-const short key_in[140][2] = {{-8,184},{-12,184},{-16,184},{-20,184},{-24,184},{-28,184},{-32,184},{-36,184},{-40,184},{-44,184},{-48,184},{-52,184},{-56,184},{-60,184},{-8,180},{-12,180},{-16,180},{-20,180},{-24,180},{-28,180},{-32,180},{-36,180},{-40,180},{-44,180},{-48,180},{-52,180},{-56,180},{-60,180},{-8,176},{-12,176},{-16,176},{-20,176},{-24,176},{-28,176},{-32,176},{-36,176},{-40,176},{-44,176},{-48,176},{-52,176},{-56,176},{-60,176},{-8,172},{-12,172},{-16,172},{-20,172},{-24,172},{-28,172},{-32,172},{-36,172},{-40,172},{-44,172},{-48,172},{-52,172},{-56,172},{-60,172},{-8,168},{-12,168},{-16,168},{-20,168},{-24,168},{-28,168},{-32,168},{-36,168},{-40,168},{-44,168},{-48,168},{-52,168},{-56,168},{-60,168},{-8,164},{-12,164},{-16,164},{-20,164},{-24,164},{-28,164},{-32,164},{-36,164},{-40,164},{-44,164},{-48,164},{-52,164},{-56,164},{-60,164},{-8,160},{-12,160},{-16,160},{-20,160},{-24,160},{-28,160},{-32,160},{-36,160},{-40,160},{-44,160},{-48,160},{-52,160},{-56,160},{-60,160},{-8,156},{-12,156},{-16,156},{-20,156},{-24,156},{-28,156},{-32,156},{-36,156},{-40,156},{-44,156},{-48,156},{-52,156},{-56,156},{-60,156},{-8,152},{-12,152},{-16,152},{-20,152},{-24,152},{-28,152},{-32,152},{-36,152},{-40,152},{-44,152},{-48,152},{-52,152},{-56,152},{-60,152},{-8,148},{-12,148},{-16,148},{-20,148},{-24,148},{-28,148},{-32,148},{-36,148},{-40,148},{-44,148},{-48,148},{-52,148},{-56,148},{-60,148}};
-const short key_out[48][2] = {{-8,188},{-12,188},{-16,188},{-20,188},{-24,188},{-28,188},{-32,188},{-36,188},{-40,188},{-44,188},{-48,188},{-52,188},{-56,188},{-60,188},{-4,184},{-64,184},{-4,180},{-64,180},{-4,176},{-64,176},{-4,172},{-64,172},{-4,168},{-64,168},{-4,164},{-64,164},{-4,160},{-64,160},{-4,156},{-64,156},{-4,152},{-64,152},{-4,148},{-64,148},{-8,144},{-12,144},{-16,144},{-20,144},{-24,144},{-28,144},{-32,144},{-36,144},{-40,144},{-44,144},{-48,144},{-52,144},{-56,144},{-60,144}};
-const short paused[437][2] = {{108,280},{104,280},{100,280},{96,280},{92,280},{88,280},{84,280},{56,280},{52,280},{28,280},{24,280},{4,280},{0,280},{-20,280},{-24,280},{-28,280},{-32,280},{-36,280},{-52,280},{-56,280},{-60,280},{-64,280},{-68,280},{-72,280},{-76,280},{-80,280},{-92,280},{-96,280},{-100,280},{-104,280},{-108,280},{108,276},{104,276},{100,276},{96,276},{92,276},{88,276},{84,276},{80,276},{60,276},{56,276},{52,276},{28,276},{24,276},{4,276},{0,276},{-16,276},{-20,276},{-24,276},{-28,276},{-32,276},{-36,276},{-52,276},{-56,276},{-60,276},{-64,276},{-68,276},{-72,276},{-76,276},{-80,276},{-92,276},{-96,276},{-100,276},{-104,276},{-108,276},{-112,276},{108,272},{104,272},{84,272},{80,272},{60,272},{56,272},{52,272},{28,272},{24,272},{4,272},{0,272},{-12,272},{-16,272},{-20,272},{-52,272},{-56,272},{-92,272},{-96,272},{-112,272},{-116,272},{108,268},{104,268},{84,268},{80,268},{64,268},{60,268},{56,268},{52,268},{48,268},{28,268},{24,268},{4,268},{0,268},{-12,268},{-16,268},{-52,268},{-56,268},{-92,268},{-96,268},{-116,268},{-120,268},{108,264},{104,264},{84,264},{80,264},{64,264},{60,264},{52,264},{48,264},{28,264},{24,264},{4,264},{0,264},{-12,264},{-16,264},{-52,264},{-56,264},{-92,264},{-96,264},{-116,264},{-120,264},{108,260},{104,260},{84,260},{80,260},{64,260},{60,260},{52,260},{48,260},{44,260},{28,260},{24,260},{4,260},{0,260},{-12,260},{-16,260},{-20,260},{-52,260},{-56,260},{-92,260},{-96,260},{-116,260},{-120,260},{108,256},{104,256},{84,256},{80,256},{64,256},{60,256},{48,256},{44,256},{28,256},{24,256},{4,256},{0,256},{-12,256},{-16,256},{-20,256},{-24,256},{-52,256},{-56,256},{-92,256},{-96,256},{-116,256},{-120,256},{108,252},{104,252},{84,252},{80,252},{64,252},{60,252},{48,252},{44,252},{28,252},{24,252},{4,252},{0,252},{-20,252},{-24,252},{-28,252},{-52,252},{-56,252},{-92,252},{-96,252},{-116,252},{-120,252},{108,248},{104,248},{84,248},{80,248},{68,248},{64,248},{60,248},{48,248},{44,248},{40,248},{28,248},{24,248},{4,248},{0,248},{-24,248},{-28,248},{-32,248},{-52,248},{-56,248},{-60,248},{-64,248},{-68,248},{-72,248},{-92,248},{-96,248},{-116,248},{-120,248},{108,244},{104,244},{100,244},{96,244},{92,244},{88,244},{84,244},{80,244},{68,244},{64,244},{44,244},{40,244},{28,244},{24,244},{4,244},{0,244},{-28,244},{-32,244},{-52,244},{-56,244},{-60,244},{-64,244},{-68,244},{-72,244},{-92,244},{-96,244},{-116,244},{-120,244},{108,240},{104,240},{100,240},{96,240},{92,240},{88,240},{84,240},{68,240},{64,240},{44,240},{40,240},{28,240},{24,240},{4,240},{0,240},{-32,240},{-36,240},{-52,240},{-56,240},{-92,240},{-96,240},{-116,240},{-120,240},{108,236},{104,236},{68,236},{64,236},{60,236},{56,236},{52,236},{48,236},{44,236},{40,236},{28,236},{24,236},{4,236},{0,236},{-36,236},{-40,236},{-52,236},{-56,236},{-92,236},{-96,236},{-116,236},{-120,236},{108,232},{104,232},{68,232},{64,232},{60,232},{56,232},{52,232},{48,232},{44,232},{40,232},{28,232},{24,232},{4,232},{0,232},{-36,232},{-40,232},{-52,232},{-56,232},{-92,232},{-96,232},{-116,232},{-120,232},{108,228},{104,228},{68,228},{64,228},{44,228},{40,228},{28,228},{24,228},{4,228},{0,228},{-36,228},{-40,228},{-52,228},{-56,228},{-92,228},{-96,228},{-116,228},{-120,228},{108,224},{104,224},{68,224},{64,224},{44,224},{40,224},{28,224},{24,224},{4,224},{0,224},{-12,224},{-16,224},{-36,224},{-40,224},{-52,224},{-56,224},{-92,224},{-96,224},{-116,224},{-120,224},{108,220},{104,220},{68,220},{64,220},{44,220},{40,220},{28,220},{24,220},{4,220},{0,220},{-12,220},{-16,220},{-32,220},{-36,220},{-52,220},{-56,220},{-92,220},{-96,220},{-112,220},{-116,220},{108,216},{104,216},{68,216},{64,216},{44,216},{40,216},{28,216},{24,216},{20,216},{16,216},{12,216},{8,216},{4,216},{0,216},{-16,216},{-20,216},{-24,216},{-28,216},{-32,216},{-36,216},{-52,216},{-56,216},{-60,216},{-64,216},{-68,216},{-72,216},{-76,216},{-80,216},{-92,216},{-96,216},{-100,216},{-104,216},{-108,216},{-112,216},{108,212},{104,212},{68,212},{64,212},{44,212},{40,212},{28,212},{24,212},{20,212},{16,212},{12,212},{8,212},{4,212},{0,212},{-16,212},{-20,212},{-24,212},{-28,212},{-52,212},{-56,212},{-60,212},{-64,212},{-68,212},{-72,212},{-76,212},{-80,212},{-92,212},{-96,212},{-100,212},{-104,212},{-108,212}};
-
-Frame key_sprites[12] = {{ESC,38}, {ATK1,37}, {UP,16}, {ATK2,40}, {LEFT,16}, {DOWN,16}, {RIGHT,16}, {PAUSE,24}, {heads,24}, {clothes,30}, {undefined,66}, {undefined,66}};
-
-
-// Background Parts
-// const short clouds[479][2] = {{-120,388},{-124,388},{-128,388},{-132,388},{-136,388},{-112,384},{-116,384},{-136,384},{-140,384},{-112,380},{-140,380},{-156,380},{-160,380},{-164,380},{-168,380},{120,376},{116,376},{112,376},{108,376},{104,376},{100,376},{96,376},{-104,376},{-108,376},{-140,376},{-152,376},{-172,376},{128,372},{124,372},{120,372},{96,372},{92,372},{-100,372},{-144,372},{-152,372},{-172,372},{-176,372},{136,368},{132,368},{128,368},{92,368},{88,368},{-100,368},{-120,368},{-124,368},{-144,368},{-156,368},{-160,368},{-176,368},{140,364},{136,364},{88,364},{84,364},{-60,364},{-64,364},{-68,364},{-72,364},{-88,364},{-92,364},{-100,364},{-104,364},{-116,364},{-136,364},{-140,364},{-176,364},{-272,364},{144,360},{140,360},{104,360},{100,360},{96,360},{84,360},{28,360},{-56,360},{-76,360},{-80,360},{-108,360},{-112,360},{-144,360},{-148,360},{-152,360},{-172,360},{-176,360},{-256,360},{-268,360},{180,356},{176,356},{172,356},{168,356},{164,356},{144,356},{108,356},{84,356},{28,356},{24,356},{8,356},{4,356},{-84,356},{-88,356},{-140,356},{-156,356},{-160,356},{-164,356},{-168,356},{-172,356},{-196,356},{-260,356},{-264,356},{-268,356},{188,352},{184,352},{164,352},{160,352},{156,352},{148,352},{144,352},{108,352},{84,352},{24,352},{20,352},{12,352},{8,352},{-92,352},{-96,352},{-100,352},{-104,352},{-108,352},{-112,352},{-140,352},{-196,352},{-200,352},{-264,352},{192,348},{156,348},{152,348},{148,348},{108,348},{92,348},{88,348},{84,348},{80,348},{76,348},{72,348},{16,348},{-116,348},{-120,348},{-124,348},{-128,348},{-132,348},{-136,348},{-196,348},{-200,348},{-204,348},{-208,348},{196,344},{180,344},{176,344},{104,344},{100,344},{96,344},{72,344},{68,344},{-200,344},{-204,344},{-208,344},{-212,344},{216,340},{212,340},{200,340},{172,340},{128,340},{124,340},{120,340},{88,340},{68,340},{-200,340},{-204,340},{-208,340},{-212,340},{208,336},{204,336},{168,336},{132,336},{120,336},{116,336},{84,336},{80,336},{72,336},{68,336},{-204,336},{-208,336},{-212,336},{164,332},{132,332},{116,332},{112,332},{80,332},{76,332},{72,332},{-200,332},{-204,332},{-208,332},{-212,332},{164,328},{160,328},{112,328},{80,328},{0,328},{-4,328},{-92,328},{-96,328},{-100,328},{-104,328},{-108,328},{-200,328},{-204,328},{-208,328},{-212,328},{160,324},{156,324},{124,324},{120,324},{112,324},{84,324},{80,324},{8,324},{-8,324},{-12,324},{-88,324},{-112,324},{-188,324},{-192,324},{-196,324},{-200,324},{-204,324},{-208,324},{-212,324},{-224,324},{-228,324},{196,320},{192,320},{188,320},{184,320},{156,320},{152,320},{148,320},{132,320},{128,320},{124,320},{112,320},{108,320},{92,320},{88,320},{84,320},{16,320},{12,320},{-16,320},{-20,320},{-24,320},{-64,320},{-68,320},{-80,320},{-84,320},{-96,320},{-100,320},{-116,320},{-172,320},{-176,320},{-180,320},{-184,320},{-188,320},{-192,320},{-196,320},{-200,320},{-204,320},{-208,320},{-212,320},{-216,320},{-220,320},{-224,320},{-228,320},{-232,320},{216,316},{212,316},{208,316},{200,316},{180,316},{148,316},{144,316},{140,316},{136,316},{132,316},{108,316},{104,316},{100,316},{96,316},{92,316},{36,316},{32,316},{28,316},{24,316},{16,316},{-24,316},{-28,316},{-32,316},{-36,316},{-40,316},{-72,316},{-76,316},{-104,316},{-116,316},{-196,316},{-200,316},{-204,316},{-208,316},{-212,316},{220,312},{204,312},{200,312},{180,312},{40,312},{20,312},{-4,312},{-8,312},{-28,312},{-44,312},{-48,312},{-52,312},{-84,312},{-88,312},{-104,312},{-108,312},{-112,312},{-192,312},{-196,312},{-200,312},{-204,312},{220,308},{200,308},{188,308},{176,308},{172,308},{168,308},{164,308},{160,308},{40,308},{20,308},{4,308},{0,308},{-12,308},{-28,308},{-40,308},{-56,308},{-92,308},{-96,308},{-100,308},{-184,308},{-188,308},{-192,308},{-196,308},{-200,308},{-204,308},{232,304},{228,304},{224,304},{216,304},{212,304},{196,304},{192,304},{180,304},{156,304},{72,304},{68,304},{64,304},{60,304},{56,304},{40,304},{20,304},{8,304},{-12,304},{-40,304},{-56,304},{-176,304},{-180,304},{-184,304},{-188,304},{-192,304},{-196,304},{-200,304},{268,300},{236,300},{180,300},{156,300},{76,300},{56,300},{52,300},{20,300},{8,300},{-8,300},{-24,300},{-44,300},{-48,300},{-56,300},{-168,300},{-172,300},{-176,300},{-180,300},{-184,300},{-188,300},{-192,300},{264,296},{260,296},{256,296},{252,296},{236,296},{208,296},{204,296},{200,296},{180,296},{176,296},{172,296},{156,296},{80,296},{52,296},{48,296},{44,296},{24,296},{20,296},{8,296},{-20,296},{-28,296},{-56,296},{248,292},{244,292},{240,292},{212,292},{196,292},{192,292},{156,292},{44,292},{40,292},{36,292},{32,292},{28,292},{16,292},{12,292},{4,292},{0,292},{-16,292},{-32,292},{-36,292},{-40,292},{-44,292},{-48,292},{-52,292},{256,288},{216,288},{200,288},{192,288},{188,288},{164,288},{160,288},{-4,288},{-8,288},{-12,288},{244,284},{240,284},{232,284},{228,284},{224,284},{220,284},{212,284},{208,284},{204,284},{184,284},{180,284},{176,284},{172,284},{168,284}};
-// const short clouds_inside[524][2] = {{-120,384},{-124,384},{-128,384},{-132,384},{-116,380},{-120,380},{-124,380},{-128,380},{-132,380},{-136,380},{-112,376},{-116,376},{-120,376},{-124,376},{-128,376},{-132,376},{-136,376},{-156,376},{-160,376},{-164,376},{-168,376},{116,372},{112,372},{108,372},{104,372},{100,372},{-104,372},{-108,372},{-112,372},{-116,372},{-120,372},{-124,372},{-128,372},{-132,372},{-136,372},{-140,372},{-156,372},{-160,372},{-164,372},{-168,372},{124,368},{120,368},{116,368},{112,368},{108,368},{104,368},{100,368},{96,368},{-104,368},{-108,368},{-112,368},{-116,368},{-128,368},{-132,368},{-136,368},{-140,368},{-148,368},{-152,368},{-164,368},{-168,368},{-172,368},{132,364},{128,364},{124,364},{120,364},{116,364},{112,364},{108,364},{104,364},{100,364},{96,364},{92,364},{-108,364},{-112,364},{-120,364},{-124,364},{-128,364},{-132,364},{-144,364},{-148,364},{-152,364},{-156,364},{-160,364},{-164,364},{-168,364},{-172,364},{136,360},{132,360},{128,360},{124,360},{120,360},{116,360},{112,360},{108,360},{92,360},{88,360},{-84,360},{-88,360},{-92,360},{-96,360},{-100,360},{-104,360},{-116,360},{-120,360},{-124,360},{-128,360},{-132,360},{-136,360},{-140,360},{-156,360},{-160,360},{-164,360},{-168,360},{140,356},{136,356},{132,356},{128,356},{124,356},{120,356},{116,356},{112,356},{104,356},{100,356},{96,356},{92,356},{88,356},{-92,356},{-96,356},{-100,356},{-104,356},{-108,356},{-112,356},{-116,356},{-120,356},{-124,356},{-128,356},{-132,356},{-136,356},{180,352},{176,352},{172,352},{168,352},{140,352},{136,352},{132,352},{128,352},{124,352},{120,352},{116,352},{112,352},{104,352},{100,352},{96,352},{92,352},{88,352},{-116,352},{-120,352},{-124,352},{-128,352},{-132,352},{-136,352},{188,348},{184,348},{180,348},{176,348},{172,348},{168,348},{164,348},{160,348},{144,348},{140,348},{136,348},{132,348},{128,348},{124,348},{120,348},{116,348},{112,348},{104,348},{100,348},{96,348},{172,344},{168,344},{164,344},{160,344},{156,344},{152,344},{148,344},{144,344},{140,344},{136,344},{132,344},{128,344},{124,344},{120,344},{116,344},{112,344},{108,344},{92,344},{88,344},{84,344},{80,344},{76,344},{168,340},{164,340},{160,340},{156,340},{152,340},{148,340},{144,340},{140,340},{136,340},{132,340},{116,340},{112,340},{108,340},{104,340},{100,340},{96,340},{92,340},{84,340},{80,340},{76,340},{72,340},{164,336},{160,336},{156,336},{152,336},{148,336},{144,336},{136,336},{128,336},{124,336},{112,336},{108,336},{104,336},{100,336},{96,336},{92,336},{88,336},{76,336},{160,332},{156,332},{152,332},{148,332},{144,332},{140,332},{136,332},{128,332},{124,332},{120,332},{108,332},{104,332},{100,332},{92,332},{88,332},{84,332},{156,328},{152,328},{148,328},{144,328},{140,328},{136,328},{132,328},{128,328},{124,328},{120,328},{116,328},{108,328},{104,328},{100,328},{92,328},{88,328},{84,328},{152,324},{148,324},{144,324},{140,324},{136,324},{132,324},{128,324},{116,324},{108,324},{104,324},{100,324},{96,324},{92,324},{88,324},{4,324},{0,324},{-4,324},{-92,324},{-96,324},{-100,324},{-104,324},{-108,324},{144,320},{140,320},{136,320},{104,320},{100,320},{96,320},{8,320},{4,320},{0,320},{-4,320},{-8,320},{-12,320},{-88,320},{-92,320},{-104,320},{-108,320},{-112,320},{196,316},{192,316},{188,316},{184,316},{12,316},{8,316},{4,316},{0,316},{-4,316},{-8,316},{-12,316},{-16,316},{-20,316},{-80,316},{-84,316},{-88,316},{-92,316},{-96,316},{-100,316},{-108,316},{-112,316},{216,312},{212,312},{208,312},{196,312},{192,312},{188,312},{184,312},{36,312},{32,312},{28,312},{24,312},{16,312},{12,312},{8,312},{4,312},{0,312},{-12,312},{-16,312},{-20,312},{-24,312},{-32,312},{-36,312},{-40,312},{-92,312},{-96,312},{-100,312},{216,308},{212,308},{208,308},{204,308},{196,308},{192,308},{184,308},{180,308},{36,308},{32,308},{28,308},{24,308},{16,308},{12,308},{8,308},{-4,308},{-8,308},{-16,308},{-20,308},{-24,308},{-32,308},{-36,308},{-44,308},{-48,308},{-52,308},{220,304},{208,304},{204,304},{200,304},{188,304},{184,304},{176,304},{172,304},{168,304},{164,304},{160,304},{36,304},{32,304},{28,304},{24,304},{16,304},{12,304},{4,304},{0,304},{-4,304},{-8,304},{-16,304},{-20,304},{-24,304},{-28,304},{-32,304},{-36,304},{-44,304},{-48,304},{-52,304},{232,300},{228,300},{224,300},{220,300},{216,300},{212,300},{208,300},{204,300},{200,300},{192,300},{188,300},{184,300},{176,300},{172,300},{168,300},{164,300},{160,300},{48,300},{44,300},{40,300},{36,300},{32,300},{28,300},{24,300},{16,300},{12,300},{4,300},{0,300},{-4,300},{-12,300},{-16,300},{-20,300},{-28,300},{-32,300},{-36,300},{-40,300},{-52,300},{232,296},{228,296},{224,296},{220,296},{216,296},{212,296},{196,296},{192,296},{188,296},{184,296},{168,296},{164,296},{160,296},{40,296},{36,296},{32,296},{28,296},{16,296},{12,296},{4,296},{0,296},{-4,296},{-8,296},{-12,296},{-16,296},{-32,296},{-36,296},{-40,296},{-44,296},{-48,296},{-52,296},{256,292},{252,292},{236,292},{232,292},{228,292},{224,292},{220,292},{216,292},{208,292},{204,292},{200,292},{188,292},{184,292},{180,292},{176,292},{172,292},{168,292},{164,292},{160,292},{-4,292},{-8,292},{-12,292},{252,288},{248,288},{244,288},{240,288},{236,288},{232,288},{228,288},{224,288},{220,288},{212,288},{208,288},{204,288},{184,288},{180,288},{176,288},{172,288},{168,288},{236,284},{216,284}};
-// const short clouds2[479][2] = {{-292,380},{-296,380},{-300,380},{-304,380},{-308,380},{120,376},{116,376},{112,376},{108,376},{104,376},{100,376},{96,376},{-288,376},{-312,376},{128,372},{124,372},{120,372},{96,372},{92,372},{-264,372},{-268,372},{-280,372},{-284,372},{-296,372},{-300,372},{-316,372},{136,368},{132,368},{128,368},{92,368},{88,368},{-272,368},{-276,368},{-304,368},{-316,368},{140,364},{136,364},{88,364},{84,364},{-160,364},{-164,364},{-168,364},{-172,364},{-176,364},{-284,364},{-288,364},{-304,364},{-308,364},{-312,364},{144,360},{140,360},{104,360},{100,360},{96,360},{84,360},{4,360},{-152,360},{-156,360},{-176,360},{-180,360},{-292,360},{-296,360},{-300,360},{180,356},{176,356},{172,356},{168,356},{164,356},{144,356},{108,356},{84,356},{4,356},{0,356},{-16,356},{-20,356},{-152,356},{-180,356},{-196,356},{-200,356},{-204,356},{-208,356},{188,352},{184,352},{164,352},{160,352},{156,352},{148,352},{144,352},{108,352},{84,352},{0,352},{-4,352},{-12,352},{-16,352},{-144,352},{-148,352},{-180,352},{-192,352},{-212,352},{192,348},{156,348},{152,348},{148,348},{108,348},{92,348},{88,348},{84,348},{80,348},{76,348},{72,348},{-8,348},{-60,348},{-140,348},{-184,348},{-192,348},{-212,348},{-216,348},{196,344},{180,344},{176,344},{104,344},{100,344},{96,344},{72,344},{68,344},{-44,344},{-56,344},{-140,344},{-160,344},{-164,344},{-184,344},{-196,344},{-200,344},{-216,344},{-256,344},{216,340},{212,340},{200,340},{172,340},{128,340},{124,340},{120,340},{88,340},{68,340},{-48,340},{-52,340},{-56,340},{-100,340},{-104,340},{-108,340},{-112,340},{-128,340},{-132,340},{-140,340},{-144,340},{-156,340},{-176,340},{-180,340},{-216,340},{-256,340},{-260,340},{208,336},{204,336},{168,336},{132,336},{120,336},{116,336},{84,336},{80,336},{72,336},{68,336},{-52,336},{-96,336},{-116,336},{-120,336},{-148,336},{-152,336},{-184,336},{-188,336},{-192,336},{-212,336},{-216,336},{-256,336},{-260,336},{-264,336},{-268,336},{164,332},{132,332},{116,332},{112,332},{80,332},{76,332},{72,332},{-124,332},{-128,332},{-180,332},{-196,332},{-200,332},{-204,332},{-208,332},{-212,332},{-260,332},{-264,332},{-268,332},{-272,332},{164,328},{160,328},{112,328},{80,328},{-24,328},{-28,328},{-132,328},{-136,328},{-140,328},{-144,328},{-148,328},{-152,328},{-180,328},{-260,328},{-264,328},{-268,328},{-272,328},{160,324},{156,324},{124,324},{120,324},{112,324},{84,324},{80,324},{-16,324},{-32,324},{-36,324},{-156,324},{-160,324},{-164,324},{-168,324},{-172,324},{-176,324},{-264,324},{-268,324},{-272,324},{248,320},{244,320},{240,320},{236,320},{156,320},{152,320},{148,320},{132,320},{128,320},{124,320},{112,320},{108,320},{92,320},{88,320},{84,320},{-8,320},{-12,320},{-40,320},{-44,320},{-48,320},{-260,320},{-264,320},{-268,320},{-272,320},{268,316},{264,316},{260,316},{252,316},{232,316},{148,316},{144,316},{140,316},{136,316},{132,316},{108,316},{104,316},{100,316},{96,316},{92,316},{12,316},{8,316},{4,316},{0,316},{-8,316},{-48,316},{-52,316},{-56,316},{-60,316},{-64,316},{-260,316},{-264,316},{-268,316},{-272,316},{272,312},{256,312},{252,312},{232,312},{16,312},{-4,312},{-28,312},{-32,312},{-52,312},{-68,312},{-72,312},{-76,312},{-248,312},{-252,312},{-256,312},{-260,312},{-264,312},{-268,312},{-272,312},{-284,312},{-288,312},{272,308},{252,308},{240,308},{228,308},{224,308},{220,308},{216,308},{212,308},{16,308},{-4,308},{-20,308},{-24,308},{-36,308},{-52,308},{-64,308},{-80,308},{-232,308},{-236,308},{-240,308},{-244,308},{-248,308},{-252,308},{-256,308},{-260,308},{-264,308},{-268,308},{-272,308},{-276,308},{-280,308},{-284,308},{-288,308},{-292,308},{284,304},{280,304},{276,304},{268,304},{264,304},{248,304},{244,304},{232,304},{208,304},{48,304},{44,304},{40,304},{36,304},{32,304},{16,304},{-4,304},{-16,304},{-36,304},{-64,304},{-80,304},{-256,304},{-260,304},{-264,304},{-268,304},{-272,304},{320,300},{288,300},{232,300},{208,300},{52,300},{32,300},{28,300},{-4,300},{-16,300},{-32,300},{-48,300},{-68,300},{-72,300},{-80,300},{-252,300},{-256,300},{-260,300},{-264,300},{316,296},{312,296},{308,296},{304,296},{288,296},{260,296},{256,296},{252,296},{232,296},{228,296},{224,296},{208,296},{56,296},{28,296},{24,296},{20,296},{0,296},{-4,296},{-16,296},{-44,296},{-52,296},{-80,296},{-244,296},{-248,296},{-252,296},{-256,296},{-260,296},{-264,296},{300,292},{296,292},{292,292},{264,292},{248,292},{244,292},{208,292},{20,292},{16,292},{12,292},{8,292},{4,292},{-8,292},{-12,292},{-20,292},{-24,292},{-40,292},{-56,292},{-60,292},{-64,292},{-68,292},{-72,292},{-76,292},{-236,292},{-240,292},{-244,292},{-248,292},{-252,292},{-256,292},{-260,292},{308,288},{268,288},{252,288},{244,288},{240,288},{216,288},{212,288},{-28,288},{-32,288},{-36,288},{-228,288},{-232,288},{-236,288},{-240,288},{-244,288},{-248,288},{-252,288},{296,284},{292,284},{284,284},{280,284},{276,284},{272,284},{264,284},{260,284},{256,284},{236,284},{232,284},{228,284},{224,284},{220,284}};
-// const short clouds2_inside[524][2] = {{-292,376},{-296,376},{-300,376},{-304,376},{-308,376},{116,372},{112,372},{108,372},{104,372},{100,372},{-288,372},{-292,372},{-304,372},{-308,372},{-312,372},{124,368},{120,368},{116,368},{112,368},{108,368},{104,368},{100,368},{96,368},{-280,368},{-284,368},{-288,368},{-292,368},{-296,368},{-300,368},{-308,368},{-312,368},{132,364},{128,364},{124,364},{120,364},{116,364},{112,364},{108,364},{104,364},{100,364},{96,364},{92,364},{-292,364},{-296,364},{-300,364},{136,360},{132,360},{128,360},{124,360},{120,360},{116,360},{112,360},{108,360},{92,360},{88,360},{-160,360},{-164,360},{-168,360},{-172,360},{140,356},{136,356},{132,356},{128,356},{124,356},{120,356},{116,356},{112,356},{104,356},{100,356},{96,356},{92,356},{88,356},{-156,356},{-160,356},{-164,356},{-168,356},{-172,356},{-176,356},{180,352},{176,352},{172,352},{168,352},{140,352},{136,352},{132,352},{128,352},{124,352},{120,352},{116,352},{112,352},{104,352},{100,352},{96,352},{92,352},{88,352},{-152,352},{-156,352},{-160,352},{-164,352},{-168,352},{-172,352},{-176,352},{-196,352},{-200,352},{-204,352},{-208,352},{188,348},{184,348},{180,348},{176,348},{172,348},{168,348},{164,348},{160,348},{144,348},{140,348},{136,348},{132,348},{128,348},{124,348},{120,348},{116,348},{112,348},{104,348},{100,348},{96,348},{-144,348},{-148,348},{-152,348},{-156,348},{-160,348},{-164,348},{-168,348},{-172,348},{-176,348},{-180,348},{-196,348},{-200,348},{-204,348},{-208,348},{172,344},{168,344},{164,344},{160,344},{156,344},{152,344},{148,344},{144,344},{140,344},{136,344},{132,344},{128,344},{124,344},{120,344},{116,344},{112,344},{108,344},{92,344},{88,344},{84,344},{80,344},{76,344},{-144,344},{-148,344},{-152,344},{-156,344},{-168,344},{-172,344},{-176,344},{-180,344},{-188,344},{-192,344},{-204,344},{-208,344},{-212,344},{168,340},{164,340},{160,340},{156,340},{152,340},{148,340},{144,340},{140,340},{136,340},{132,340},{116,340},{112,340},{108,340},{104,340},{100,340},{96,340},{92,340},{84,340},{80,340},{76,340},{72,340},{-148,340},{-152,340},{-160,340},{-164,340},{-168,340},{-172,340},{-184,340},{-188,340},{-192,340},{-196,340},{-200,340},{-204,340},{-208,340},{-212,340},{164,336},{160,336},{156,336},{152,336},{148,336},{144,336},{136,336},{128,336},{124,336},{112,336},{108,336},{104,336},{100,336},{96,336},{92,336},{88,336},{76,336},{-124,336},{-128,336},{-132,336},{-136,336},{-140,336},{-144,336},{-156,336},{-160,336},{-164,336},{-168,336},{-172,336},{-176,336},{-180,336},{-196,336},{-200,336},{-204,336},{-208,336},{160,332},{156,332},{152,332},{148,332},{144,332},{140,332},{136,332},{128,332},{124,332},{120,332},{108,332},{104,332},{100,332},{92,332},{88,332},{84,332},{-132,332},{-136,332},{-140,332},{-144,332},{-148,332},{-152,332},{-156,332},{-160,332},{-164,332},{-168,332},{-172,332},{-176,332},{156,328},{152,328},{148,328},{144,328},{140,328},{136,328},{132,328},{128,328},{124,328},{120,328},{116,328},{108,328},{104,328},{100,328},{92,328},{88,328},{84,328},{-156,328},{-160,328},{-164,328},{-168,328},{-172,328},{-176,328},{152,324},{148,324},{144,324},{140,324},{136,324},{132,324},{128,324},{116,324},{108,324},{104,324},{100,324},{96,324},{92,324},{88,324},{-20,324},{-24,324},{-28,324},{144,320},{140,320},{136,320},{104,320},{100,320},{96,320},{-16,320},{-20,320},{-24,320},{-28,320},{-32,320},{-36,320},{248,316},{244,316},{240,316},{236,316},{-12,316},{-16,316},{-20,316},{-24,316},{-28,316},{-32,316},{-36,316},{-40,316},{-44,316},{268,312},{264,312},{260,312},{248,312},{244,312},{240,312},{236,312},{12,312},{8,312},{4,312},{0,312},{-8,312},{-12,312},{-16,312},{-20,312},{-24,312},{-36,312},{-40,312},{-44,312},{-48,312},{-56,312},{-60,312},{-64,312},{268,308},{264,308},{260,308},{256,308},{248,308},{244,308},{236,308},{232,308},{12,308},{8,308},{4,308},{0,308},{-8,308},{-12,308},{-16,308},{-28,308},{-32,308},{-40,308},{-44,308},{-48,308},{-56,308},{-60,308},{-68,308},{-72,308},{-76,308},{272,304},{260,304},{256,304},{252,304},{240,304},{236,304},{228,304},{224,304},{220,304},{216,304},{212,304},{12,304},{8,304},{4,304},{0,304},{-8,304},{-12,304},{-20,304},{-24,304},{-28,304},{-32,304},{-40,304},{-44,304},{-48,304},{-52,304},{-56,304},{-60,304},{-68,304},{-72,304},{-76,304},{284,300},{280,300},{276,300},{272,300},{268,300},{264,300},{260,300},{256,300},{252,300},{244,300},{240,300},{236,300},{228,300},{224,300},{220,300},{216,300},{212,300},{24,300},{20,300},{16,300},{12,300},{8,300},{4,300},{0,300},{-8,300},{-12,300},{-20,300},{-24,300},{-28,300},{-36,300},{-40,300},{-44,300},{-52,300},{-56,300},{-60,300},{-64,300},{-76,300},{284,296},{280,296},{276,296},{272,296},{268,296},{264,296},{248,296},{244,296},{240,296},{236,296},{220,296},{216,296},{212,296},{16,296},{12,296},{8,296},{4,296},{-8,296},{-12,296},{-20,296},{-24,296},{-28,296},{-32,296},{-36,296},{-40,296},{-56,296},{-60,296},{-64,296},{-68,296},{-72,296},{-76,296},{308,292},{304,292},{288,292},{284,292},{280,292},{276,292},{272,292},{268,292},{260,292},{256,292},{252,292},{240,292},{236,292},{232,292},{228,292},{224,292},{220,292},{216,292},{212,292},{-28,292},{-32,292},{-36,292},{304,288},{300,288},{296,288},{292,288},{288,288},{284,288},{280,288},{276,288},{272,288},{264,288},{260,288},{256,288},{236,288},{232,288},{228,288},{224,288},{220,288},{288,284},{268,284}};
-const short stars2[15][2]           = {{-36,412},{192,408},{-288,396},{-220,392},{68,388},{-140,388},{144,384},{-284,332},{20,328},{212,324},{108,316},{-56,308},{-188,308},{264,284},{-300,284}};
-const short clouds3[403][2]         = {{-56,384},{-60,384},{-64,384},{-68,384},{-72,384},{144,380},{140,380},{136,380},{132,380},{128,380},{-48,380},{-52,380},{-76,380},{152,376},{148,376},{128,376},{124,376},{-44,376},{-80,376},{152,372},{124,372},{108,372},{104,372},{100,372},{96,372},{-28,372},{-32,372},{-36,372},{-44,372},{-60,372},{-64,372},{-84,372},{160,368},{156,368},{124,368},{112,368},{92,368},{-24,368},{-40,368},{-68,368},{-84,368},{-92,368},{-96,368},{-280,368},{-284,368},{-288,368},{-292,368},{-296,368},{164,364},{120,364},{112,364},{92,364},{88,364},{8,364},{4,364},{0,364},{-4,364},{-20,364},{-40,364},{-68,364},{-80,364},{-100,364},{-188,364},{-192,364},{-196,364},{-200,364},{-204,364},{-208,364},{-276,364},{-300,364},{164,360},{144,360},{140,360},{120,360},{108,360},{104,360},{88,360},{40,360},{36,360},{16,360},{12,360},{-8,360},{-12,360},{-16,360},{-44,360},{-48,360},{-52,360},{-56,360},{-60,360},{-64,360},{-76,360},{-104,360},{-108,360},{-180,360},{-184,360},{-212,360},{-224,360},{-228,360},{-248,360},{-252,360},{-256,360},{-260,360},{-264,360},{-268,360},{-280,360},{-284,360},{-288,360},{-304,360},{-308,360},{-312,360},{240,356},{236,356},{204,356},{200,356},{196,356},{192,356},{176,356},{172,356},{164,356},{160,356},{148,356},{128,356},{124,356},{88,356},{32,356},{28,356},{24,356},{20,356},{4,356},{0,356},{-24,356},{-28,356},{-32,356},{-36,356},{-72,356},{-84,356},{-88,356},{-92,356},{-112,356},{-176,356},{-212,356},{-232,356},{-236,356},{-240,356},{-244,356},{-272,356},{-316,356},{248,352},{232,352},{228,352},{208,352},{188,352},{184,352},{156,352},{152,352},{120,352},{116,352},{112,352},{92,352},{88,352},{-8,352},{-12,352},{-16,352},{-20,352},{-60,352},{-64,352},{-68,352},{-76,352},{-80,352},{-104,352},{-108,352},{-156,352},{-160,352},{-164,352},{-176,352},{-196,352},{-200,352},{-204,352},{-216,352},{-220,352},{-252,352},{-256,352},{-260,352},{-264,352},{-268,352},{-276,352},{-280,352},{-308,352},{-312,352},{256,348},{252,348},{224,348},{220,348},{216,348},{180,348},{176,348},{124,348},{108,348},{104,348},{100,348},{96,348},{92,348},{-40,348},{-44,348},{-48,348},{-52,348},{-56,348},{-88,348},{-92,348},{-96,348},{-100,348},{-148,348},{-152,348},{-168,348},{-192,348},{-208,348},{-224,348},{-284,348},{-288,348},{-292,348},{-296,348},{-300,348},{-304,348},{276,344},{272,344},{268,344},{264,344},{256,344},{216,344},{212,344},{208,344},{204,344},{200,344},{172,344},{168,344},{164,344},{160,344},{156,344},{152,344},{124,344},{76,344},{72,344},{68,344},{64,344},{60,344},{-124,344},{-128,344},{-132,344},{-144,344},{-172,344},{-192,344},{-220,344},{-224,344},{-232,344},{-236,344},{-240,344},{280,340},{260,340},{236,340},{232,340},{212,340},{196,340},{192,340},{188,340},{148,340},{144,340},{140,340},{136,340},{132,340},{128,340},{80,340},{56,340},{-116,340},{-120,340},{-136,340},{-140,340},{-156,340},{-160,340},{-176,340},{-180,340},{-196,340},{-216,340},{-244,340},{280,336},{260,336},{244,336},{240,336},{228,336},{212,336},{200,336},{184,336},{104,336},{100,336},{88,336},{84,336},{72,336},{68,336},{52,336},{-112,336},{-128,336},{-152,336},{-164,336},{-184,336},{-200,336},{-204,336},{-208,336},{-212,336},{-224,336},{-228,336},{-232,336},{-236,336},{-248,336},{312,332},{308,332},{304,332},{300,332},{296,332},{280,332},{260,332},{248,332},{228,332},{200,332},{184,332},{96,332},{92,332},{64,332},{52,332},{-132,332},{-136,332},{-140,332},{-152,332},{-184,332},{-220,332},{-244,332},{-248,332},{316,328},{296,328},{292,328},{260,328},{248,328},{232,328},{216,328},{196,328},{192,328},{184,328},{84,328},{80,328},{64,328},{60,328},{56,328},{-144,328},{-152,328},{-168,328},{-172,328},{-176,328},{-180,328},{-192,328},{-196,328},{-208,328},{-212,328},{-220,328},{-240,328},{320,324},{292,324},{288,324},{284,324},{264,324},{260,324},{248,324},{220,324},{212,324},{184,324},{76,324},{72,324},{68,324},{-156,324},{-160,324},{-164,324},{-200,324},{-204,324},{-224,324},{-228,324},{-232,324},{-236,324},{284,320},{280,320},{276,320},{272,320},{268,320},{256,320},{252,320},{244,320},{240,320},{224,320},{208,320},{204,320},{200,320},{196,320},{192,320},{188,320},{236,316},{232,316},{228,316}};
-const short clouds3_inside[515][2]  = {{-56,380},{-60,380},{-64,380},{-68,380},{-72,380},{144,376},{140,376},{136,376},{132,376},{-48,376},{-52,376},{-56,376},{-60,376},{-64,376},{-68,376},{-72,376},{-76,376},{148,372},{144,372},{140,372},{136,372},{132,372},{128,372},{-48,372},{-52,372},{-56,372},{-68,372},{-72,372},{-76,372},{-80,372},{152,368},{148,368},{144,368},{140,368},{136,368},{132,368},{128,368},{108,368},{104,368},{100,368},{96,368},{-28,368},{-32,368},{-36,368},{-44,368},{-48,368},{-52,368},{-56,368},{-60,368},{-64,368},{-72,368},{-76,368},{-80,368},{160,364},{156,364},{152,364},{148,364},{144,364},{140,364},{136,364},{132,364},{128,364},{124,364},{108,364},{104,364},{100,364},{96,364},{40,364},{36,364},{-24,364},{-28,364},{-32,364},{-36,364},{-44,364},{-48,364},{-52,364},{-56,364},{-60,364},{-64,364},{-72,364},{-76,364},{-84,364},{-88,364},{-92,364},{-96,364},{-224,364},{-228,364},{-280,364},{-284,364},{-288,364},{-292,364},{-296,364},{204,360},{200,360},{196,360},{192,360},{160,360},{156,360},{152,360},{148,360},{136,360},{132,360},{128,360},{124,360},{116,360},{112,360},{100,360},{96,360},{92,360},{32,360},{28,360},{24,360},{20,360},{8,360},{4,360},{0,360},{-4,360},{-20,360},{-24,360},{-28,360},{-32,360},{-36,360},{-40,360},{-68,360},{-72,360},{-80,360},{-84,360},{-88,360},{-92,360},{-96,360},{-100,360},{-188,360},{-192,360},{-196,360},{-200,360},{-204,360},{-208,360},{-232,360},{-236,360},{-240,360},{-244,360},{-272,360},{-276,360},{-292,360},{-296,360},{-300,360},{208,356},{188,356},{184,356},{156,356},{152,356},{144,356},{140,356},{136,356},{132,356},{120,356},{116,356},{112,356},{108,356},{104,356},{100,356},{96,356},{92,356},{16,356},{12,356},{8,356},{-4,356},{-8,356},{-12,356},{-16,356},{-20,356},{-40,356},{-44,356},{-48,356},{-52,356},{-56,356},{-60,356},{-64,356},{-68,356},{-76,356},{-80,356},{-96,356},{-100,356},{-104,356},{-108,356},{-180,356},{-184,356},{-188,356},{-192,356},{-196,356},{-200,356},{-204,356},{-208,356},{-248,356},{-252,356},{-256,356},{-260,356},{-264,356},{-268,356},{-276,356},{-280,356},{-284,356},{-288,356},{-292,356},{-296,356},{-300,356},{-304,356},{-308,356},{-312,356},{244,352},{240,352},{236,352},{180,352},{176,352},{172,352},{168,352},{164,352},{160,352},{148,352},{144,352},{140,352},{136,352},{132,352},{128,352},{124,352},{108,352},{104,352},{100,352},{96,352},{-40,352},{-44,352},{-48,352},{-52,352},{-56,352},{-84,352},{-88,352},{-92,352},{-96,352},{-100,352},{-180,352},{-184,352},{-188,352},{-192,352},{-208,352},{-212,352},{-284,352},{-288,352},{-292,352},{-296,352},{-300,352},{-304,352},{248,348},{244,348},{240,348},{236,348},{232,348},{228,348},{172,348},{168,348},{164,348},{160,348},{156,348},{152,348},{148,348},{144,348},{140,348},{136,348},{132,348},{128,348},{-156,348},{-160,348},{-164,348},{-176,348},{-180,348},{-184,348},{-188,348},{-196,348},{-200,348},{-204,348},{-212,348},{-216,348},{-220,348},{252,344},{248,344},{244,344},{240,344},{236,344},{232,344},{228,344},{224,344},{220,344},{148,344},{144,344},{140,344},{136,344},{132,344},{128,344},{-148,344},{-152,344},{-156,344},{-160,344},{-164,344},{-168,344},{-176,344},{-180,344},{-184,344},{-188,344},{-196,344},{-200,344},{-204,344},{-208,344},{-212,344},{-216,344},{276,340},{272,340},{268,340},{264,340},{256,340},{252,340},{248,340},{244,340},{240,340},{228,340},{224,340},{220,340},{216,340},{208,340},{204,340},{200,340},{104,340},{100,340},{76,340},{72,340},{68,340},{64,340},{60,340},{-124,340},{-128,340},{-132,340},{-144,340},{-148,340},{-152,340},{-164,340},{-168,340},{-172,340},{-184,340},{-188,340},{-192,340},{-200,340},{-204,340},{-208,340},{-212,340},{-220,340},{-224,340},{-228,340},{-232,340},{-236,340},{-240,340},{312,336},{308,336},{304,336},{300,336},{296,336},{276,336},{272,336},{268,336},{264,336},{256,336},{252,336},{248,336},{236,336},{232,336},{224,336},{220,336},{216,336},{208,336},{204,336},{196,336},{192,336},{188,336},{96,336},{92,336},{80,336},{76,336},{64,336},{60,336},{56,336},{-116,336},{-120,336},{-124,336},{-132,336},{-136,336},{-140,336},{-144,336},{-148,336},{-156,336},{-160,336},{-168,336},{-172,336},{-176,336},{-180,336},{-188,336},{-192,336},{-196,336},{-216,336},{-220,336},{-240,336},{-244,336},{316,332},{292,332},{288,332},{276,332},{272,332},{268,332},{264,332},{256,332},{252,332},{244,332},{240,332},{236,332},{232,332},{224,332},{220,332},{216,332},{212,332},{208,332},{204,332},{196,332},{192,332},{188,332},{88,332},{84,332},{80,332},{76,332},{72,332},{68,332},{60,332},{56,332},{-144,332},{-148,332},{-156,332},{-160,332},{-164,332},{-168,332},{-172,332},{-176,332},{-180,332},{-188,332},{-192,332},{-196,332},{-200,332},{-204,332},{-208,332},{-212,332},{-216,332},{-224,332},{-228,332},{-232,332},{-236,332},{-240,332},{320,328},{288,328},{284,328},{280,328},{276,328},{272,328},{268,328},{264,328},{256,328},{252,328},{244,328},{240,328},{236,328},{228,328},{224,328},{220,328},{212,328},{208,328},{204,328},{200,328},{188,328},{76,328},{72,328},{68,328},{-148,328},{-156,328},{-160,328},{-164,328},{-200,328},{-204,328},{-224,328},{-228,328},{-232,328},{-236,328},{280,324},{276,324},{272,324},{268,324},{256,324},{252,324},{244,324},{240,324},{236,324},{232,324},{228,324},{224,324},{208,324},{204,324},{200,324},{196,324},{192,324},{188,324},{236,320},{232,320},{228,320}};
-const short moon[171][2] = {{308,420},{312,416},{308,416},{304,416},{308,412},{280,404},{276,404},{272,404},{268,404},{264,404},{260,404},{288,400},{284,400},{280,400},{276,400},{272,400},{268,400},{264,400},{260,400},{292,396},{288,396},{284,396},{280,396},{276,396},{272,396},{268,396},{264,396},{296,392},{292,392},{288,392},{284,392},{280,392},{276,392},{272,392},{268,392},{240,392},{300,388},{296,388},{292,388},{288,388},{284,388},{280,388},{276,388},{272,388},{244,388},{240,388},{236,388},{300,384},{296,384},{292,384},{288,384},{284,384},{280,384},{276,384},{240,384},{300,380},{296,380},{292,380},{288,380},{284,380},{280,380},{276,380},{304,376},{300,376},{296,376},{292,376},{288,376},{284,376},{280,376},{232,376},{304,372},{300,372},{296,372},{292,372},{288,372},{284,372},{280,372},{304,368},{300,368},{296,368},{292,368},{288,368},{284,368},{280,368},{304,364},{300,364},{296,364},{292,364},{288,364},{284,364},{280,364},{304,360},{300,360},{296,360},{292,360},{288,360},{284,360},{280,360},{304,356},{300,356},{296,356},{292,356},{288,356},{284,356},{280,356},{300,352},{296,352},{292,352},{288,352},{284,352},{280,352},{276,352},{300,348},{296,348},{292,348},{288,348},{284,348},{280,348},{276,348},{272,348},{296,344},{292,344},{288,344},{284,344},{280,344},{276,344},{272,344},{268,344},{264,344},{260,344},{292,340},{288,340},{284,340},{280,340},{276,340},{272,340},{268,340},{264,340},{260,340},{256,340},{252,340},{248,340},{244,340},{240,340},{288,336},{284,336},{280,336},{276,336},{272,336},{268,336},{264,336},{260,336},{256,336},{252,336},{248,336},{244,336},{240,336},{280,332},{276,332},{272,332},{268,332},{264,332},{260,332},{256,332},{252,332},{308,320},{312,316},{308,316},{304,316},{308,312},{296,312}};
-const short roof_decoration[39][2]  = {{248,96},{256,92},{252,92},{248,92},{260,88},{256,88},{252,88},{248,88},{260,84},{256,84},{252,84},{248,84},{240,84},{256,80},{252,80},{248,80},{244,80},{240,80},{256,76},{252,76},{248,76},{244,76},{240,76},{256,72},{252,72},{248,72},{244,72},{240,72},{256,68},{252,68},{248,68},{244,68},{240,68},{260,64},{256,64},{252,64},{248,64},{244,64},{240,64}};
-const short rooftop[741][2]         = {{260,60},{256,60},{252,60},{248,60},{244,60},{240,60},{236,60},{232,60},{228,60},{224,60},{220,60},{216,60},{212,60},{208,60},{204,60},{200,60},{196,60},{192,60},{188,60},{184,60},{180,60},{176,60},{172,60},{168,60},{164,60},{160,60},{156,60},{152,60},{148,60},{144,60},{140,60},{136,60},{132,60},{128,60},{124,60},{120,60},{116,60},{112,60},{108,60},{104,60},{100,60},{96,60},{92,60},{88,60},{84,60},{80,60},{76,60},{72,60},{68,60},{64,60},{60,60},{56,60},{52,60},{48,60},{44,60},{40,60},{36,60},{32,60},{28,60},{24,60},{20,60},{16,60},{12,60},{8,60},{4,60},{256,56},{252,56},{248,56},{244,56},{240,56},{236,56},{232,56},{228,56},{224,56},{220,56},{216,56},{212,56},{208,56},{204,56},{200,56},{196,56},{192,56},{188,56},{184,56},{180,56},{176,56},{172,56},{168,56},{164,56},{160,56},{156,56},{152,56},{148,56},{144,56},{140,56},{136,56},{132,56},{128,56},{124,56},{120,56},{116,56},{112,56},{108,56},{104,56},{100,56},{96,56},{92,56},{88,56},{84,56},{80,56},{76,56},{72,56},{68,56},{64,56},{60,56},{56,56},{52,56},{48,56},{44,56},{40,56},{36,56},{32,56},{28,56},{24,56},{20,56},{16,56},{12,56},{8,56},{4,56},{260,52},{256,52},{264,48},{260,48},{256,48},{252,48},{248,48},{244,48},{240,48},{236,48},{232,48},{228,48},{224,48},{220,48},{216,48},{212,48},{208,48},{204,48},{200,48},{196,48},{192,48},{188,48},{184,48},{180,48},{176,48},{172,48},{168,48},{164,48},{160,48},{156,48},{152,48},{148,48},{144,48},{140,48},{136,48},{132,48},{128,48},{124,48},{120,48},{116,48},{112,48},{108,48},{104,48},{100,48},{96,48},{92,48},{88,48},{84,48},{80,48},{76,48},{72,48},{68,48},{64,48},{60,48},{56,48},{52,48},{48,48},{44,48},{40,48},{36,48},{32,48},{28,48},{24,48},{20,48},{16,48},{12,48},{8,48},{4,48},{268,44},{264,44},{260,44},{256,44},{252,44},{248,44},{244,44},{240,44},{236,44},{232,44},{228,44},{224,44},{220,44},{216,44},{212,44},{208,44},{204,44},{200,44},{196,44},{192,44},{188,44},{184,44},{180,44},{176,44},{172,44},{168,44},{164,44},{160,44},{156,44},{152,44},{148,44},{144,44},{140,44},{136,44},{132,44},{128,44},{124,44},{120,44},{116,44},{112,44},{108,44},{104,44},{100,44},{96,44},{92,44},{88,44},{84,44},{80,44},{76,44},{72,44},{68,44},{64,44},{60,44},{56,44},{52,44},{48,44},{44,44},{40,44},{36,44},{32,44},{28,44},{24,44},{20,44},{16,44},{12,44},{8,44},{4,44},{316,40},{312,40},{308,40},{272,40},{268,40},{264,40},{244,40},{240,40},{236,40},{232,40},{208,40},{204,40},{200,40},{196,40},{192,40},{168,40},{164,40},{160,40},{156,40},{152,40},{128,40},{124,40},{120,40},{116,40},{112,40},{92,40},{88,40},{84,40},{80,40},{76,40},{72,40},{68,40},{48,40},{44,40},{40,40},{36,40},{32,40},{28,40},{8,40},{4,40},{316,36},{312,36},{308,36},{280,36},{276,36},{272,36},{268,36},{248,36},{244,36},{240,36},{236,36},{212,36},{208,36},{204,36},{200,36},{196,36},{172,36},{168,36},{164,36},{160,36},{156,36},{132,36},{128,36},{124,36},{120,36},{116,36},{112,36},{92,36},{88,36},{84,36},{80,36},{76,36},{72,36},{52,36},{48,36},{44,36},{40,36},{36,36},{32,36},{28,36},{8,36},{4,36},{316,32},{312,32},{308,32},{304,32},{288,32},{284,32},{280,32},{276,32},{256,32},{252,32},{248,32},{244,32},{240,32},{216,32},{212,32},{208,32},{204,32},{200,32},{176,32},{172,32},{168,32},{164,32},{160,32},{136,32},{132,32},{128,32},{124,32},{120,32},{116,32},{96,32},{92,32},{88,32},{84,32},{80,32},{76,32},{52,32},{48,32},{44,32},{40,32},{36,32},{32,32},{12,32},{8,32},{4,32},{316,28},{312,28},{308,28},{304,28},{300,28},{296,28},{292,28},{288,28},{284,28},{260,28},{256,28},{252,28},{248,28},{244,28},{220,28},{216,28},{212,28},{208,28},{204,28},{180,28},{176,28},{172,28},{168,28},{164,28},{160,28},{136,28},{132,28},{128,28},{124,28},{120,28},{100,28},{96,28},{92,28},{88,28},{84,28},{80,28},{76,28},{56,28},{52,28},{48,28},{44,28},{40,28},{36,28},{32,28},{12,28},{8,28},{4,28},{316,24},{312,24},{308,24},{304,24},{300,24},{296,24},{264,24},{260,24},{256,24},{252,24},{248,24},{224,24},{220,24},{216,24},{212,24},{208,24},{184,24},{180,24},{176,24},{172,24},{168,24},{164,24},{140,24},{136,24},{132,24},{128,24},{124,24},{120,24},{100,24},{96,24},{92,24},{88,24},{84,24},{80,24},{60,24},{56,24},{52,24},{48,24},{44,24},{40,24},{36,24},{12,24},{8,24},{4,24},{316,20},{312,20},{308,20},{304,20},{300,20},{296,20},{292,20},{272,20},{268,20},{264,20},{260,20},{256,20},{252,20},{228,20},{224,20},{220,20},{216,20},{212,20},{208,20},{188,20},{184,20},{180,20},{176,20},{172,20},{168,20},{144,20},{140,20},{136,20},{132,20},{128,20},{124,20},{104,20},{100,20},{96,20},{92,20},{88,20},{84,20},{60,20},{56,20},{52,20},{48,20},{44,20},{40,20},{36,20},{16,20},{12,20},{8,20},{4,20},{312,16},{308,16},{304,16},{300,16},{296,16},{292,16},{288,16},{284,16},{280,16},{276,16},{272,16},{252,16},{228,16},{208,16},{192,16},{188,16},{168,16},{148,16},{144,16},{124,16},{104,16},{84,16},{64,16},{60,16},{40,16},{36,16},{16,16},{12,16},{308,12},{304,12},{300,12},{296,12},{292,12},{288,12},{284,12},{280,12},{276,12},{272,12},{268,12},{256,12},{252,12},{248,12},{244,12},{240,12},{236,12},{232,12},{228,12},{224,12},{212,12},{208,12},{204,12},{200,12},{196,12},{192,12},{188,12},{184,12},{172,12},{168,12},{164,12},{160,12},{156,12},{152,12},{148,12},{144,12},{140,12},{128,12},{124,12},{120,12},{116,12},{112,12},{108,12},{104,12},{100,12},{88,12},{84,12},{80,12},{76,12},{72,12},{68,12},{64,12},{60,12},{56,12},{44,12},{40,12},{36,12},{32,12},{28,12},{24,12},{20,12},{16,12},{12,12},{8,12},{300,8},{296,8},{292,8},{288,8},{284,8},{280,8},{276,8},{272,8},{268,8},{264,8},{260,8},{256,8},{252,8},{248,8},{244,8},{240,8},{236,8},{232,8},{228,8},{224,8},{220,8},{216,8},{212,8},{208,8},{204,8},{200,8},{196,8},{192,8},{188,8},{184,8},{180,8},{176,8},{172,8},{168,8},{164,8},{160,8},{156,8},{152,8},{148,8},{144,8},{140,8},{136,8},{132,8},{128,8},{124,8},{120,8},{116,8},{112,8},{108,8},{104,8},{100,8},{96,8},{92,8},{88,8},{84,8},{80,8},{76,8},{72,8},{68,8},{64,8},{60,8},{56,8},{52,8},{48,8},{44,8},{40,8},{36,8},{32,8},{28,8},{24,8},{20,8},{16,8},{12,8},{8,8},{4,8},{280,4},{276,4},{272,4},{268,4},{264,4},{260,4},{256,4},{252,4},{228,4},{224,4},{220,4},{216,4},{212,4},{208,4},{188,4},{184,4},{180,4},{176,4},{172,4},{168,4},{148,4},{144,4},{140,4},{136,4},{132,4},{128,4},{124,4},{104,4},{100,4},{96,4},{92,4},{88,4},{84,4},{64,4},{60,4},{56,4},{52,4},{48,4},{44,4},{40,4},{36,4},{16,4},{12,4},{8,4},{4,4}};
-// const short stars[17][2] = {{204,424},{-288,420},{-36,412},{-136,412},{-220,392},{68,388},{144,384},{-80,384},{-148,320},{-284,280},{20,276},{212,272},{-196,268},{108,264},{-56,256},{296,244},{-300,232}};
-
-
-const short A_Attack_0_0[119][2] = {{16,128},{12,128},{8,128},{4,128},{0,128},{-4,128},{-8,128},{-12,128},{20,124},{16,124},{12,124},{8,124},{4,124},{0,124},{-4,124},{-8,124},{-12,124},{-16,124},{-20,124},{24,120},{20,120},{16,120},{12,120},{8,120},{4,120},{0,120},{-4,120},{-8,120},{-12,120},{-16,120},{-20,120},{-24,120},{24,116},{20,116},{16,116},{12,116},{8,116},{4,116},{0,116},{-4,116},{-8,116},{-12,116},{-16,116},{-20,116},{-24,116},{-28,116},{24,112},{20,112},{16,112},{12,112},{8,112},{4,112},{0,112},{-4,112},{-8,112},{-12,112},{-16,112},{-20,112},{-24,112},{-28,112},{24,108},{20,108},{16,108},{12,108},{8,108},{4,108},{0,108},{-4,108},{-8,108},{-12,108},{-16,108},{-20,108},{-24,108},{-28,108},{20,104},{16,104},{12,104},{8,104},{4,104},{0,104},{-4,104},{-8,104},{-12,104},{-16,104},{-20,104},{-24,104},{-28,104},{20,100},{16,100},{12,100},{8,100},{4,100},{0,100},{-12,100},{-16,100},{-20,100},{-24,100},{-28,100},{16,96},{12,96},{8,96},{4,96},{-20,96},{-24,96},{16,92},{12,92},{4,92},{-20,92},{12,88},{-20,88},{8,84},{-20,84},{4,80},{0,80},{-16,80},{-20,80},{-4,76},{-8,76},{-12,76}};
-const short A_Attack_0_1[119][2] = {{20,124},{16,124},{12,124},{8,124},{4,124},{0,124},{-4,124},{-8,124},{24,120},{20,120},{16,120},{12,120},{8,120},{4,120},{0,120},{-4,120},{-8,120},{-12,120},{-16,120},{28,116},{24,116},{20,116},{16,116},{12,116},{8,116},{4,116},{0,116},{-4,116},{-8,116},{-12,116},{-16,116},{-20,116},{28,112},{24,112},{20,112},{16,112},{12,112},{8,112},{4,112},{0,112},{-4,112},{-8,112},{-12,112},{-16,112},{-20,112},{-24,112},{28,108},{24,108},{20,108},{16,108},{12,108},{8,108},{4,108},{0,108},{-4,108},{-8,108},{-12,108},{-16,108},{-20,108},{-24,108},{28,104},{24,104},{20,104},{16,104},{12,104},{8,104},{4,104},{0,104},{-4,104},{-8,104},{-12,104},{-16,104},{-20,104},{-24,104},{24,100},{20,100},{16,100},{12,100},{8,100},{4,100},{0,100},{-4,100},{-8,100},{-12,100},{-16,100},{-20,100},{-24,100},{24,96},{20,96},{16,96},{12,96},{8,96},{4,96},{-8,96},{-12,96},{-16,96},{-20,96},{-24,96},{20,92},{16,92},{12,92},{8,92},{-16,92},{-20,92},{20,88},{16,88},{8,88},{-16,88},{16,84},{-16,84},{12,80},{-16,80},{8,76},{4,76},{-12,76},{-16,76},{0,72},{-4,72},{-8,72}};
-const short A_Attack_0_2[119][2] = {{40,108},{36,108},{32,108},{28,108},{24,108},{20,108},{16,108},{12,108},{44,104},{40,104},{36,104},{32,104},{28,104},{24,104},{20,104},{16,104},{12,104},{8,104},{4,104},{48,100},{44,100},{40,100},{36,100},{32,100},{28,100},{24,100},{20,100},{16,100},{12,100},{8,100},{4,100},{0,100},{48,96},{44,96},{40,96},{36,96},{32,96},{28,96},{24,96},{20,96},{16,96},{12,96},{8,96},{4,96},{0,96},{-4,96},{48,92},{44,92},{40,92},{36,92},{32,92},{28,92},{24,92},{20,92},{16,92},{12,92},{8,92},{4,92},{0,92},{-4,92},{48,88},{44,88},{40,88},{36,88},{32,88},{28,88},{24,88},{20,88},{16,88},{12,88},{8,88},{4,88},{0,88},{-4,88},{44,84},{40,84},{36,84},{32,84},{28,84},{24,84},{20,84},{16,84},{12,84},{8,84},{4,84},{0,84},{-4,84},{44,80},{40,80},{36,80},{32,80},{28,80},{24,80},{12,80},{8,80},{4,80},{0,80},{-4,80},{40,76},{36,76},{32,76},{28,76},{4,76},{0,76},{40,72},{36,72},{28,72},{4,72},{36,68},{4,68},{32,64},{4,64},{28,60},{24,60},{8,60},{4,60},{20,56},{16,56},{12,56}};
-const short A_Attack_0_3[119][2] = {{36,112},{32,112},{28,112},{24,112},{20,112},{16,112},{12,112},{8,112},{40,108},{36,108},{32,108},{28,108},{24,108},{20,108},{16,108},{12,108},{8,108},{4,108},{0,108},{44,104},{40,104},{36,104},{32,104},{28,104},{24,104},{20,104},{16,104},{12,104},{8,104},{4,104},{0,104},{-4,104},{44,100},{40,100},{36,100},{32,100},{28,100},{24,100},{20,100},{16,100},{12,100},{8,100},{4,100},{0,100},{-4,100},{-8,100},{44,96},{40,96},{36,96},{32,96},{28,96},{24,96},{20,96},{16,96},{12,96},{8,96},{4,96},{0,96},{-4,96},{-8,96},{44,92},{40,92},{36,92},{32,92},{28,92},{24,92},{20,92},{16,92},{12,92},{8,92},{4,92},{0,92},{-4,92},{-8,92},{40,88},{36,88},{32,88},{28,88},{24,88},{20,88},{16,88},{12,88},{8,88},{4,88},{0,88},{-4,88},{-8,88},{40,84},{36,84},{32,84},{28,84},{24,84},{20,84},{8,84},{4,84},{0,84},{-4,84},{-8,84},{36,80},{32,80},{28,80},{24,80},{0,80},{-4,80},{36,76},{32,76},{24,76},{0,76},{32,72},{0,72},{28,68},{0,68},{24,64},{20,64},{4,64},{0,64},{16,60},{12,60},{8,60}};
-const short A_Attack_0_4[119][2] = {{20,124},{16,124},{12,124},{8,124},{4,124},{0,124},{-4,124},{-8,124},{24,120},{20,120},{16,120},{12,120},{8,120},{4,120},{0,120},{-4,120},{-8,120},{-12,120},{-16,120},{28,116},{24,116},{20,116},{16,116},{12,116},{8,116},{4,116},{0,116},{-4,116},{-8,116},{-12,116},{-16,116},{-20,116},{28,112},{24,112},{20,112},{16,112},{12,112},{8,112},{4,112},{0,112},{-4,112},{-8,112},{-12,112},{-16,112},{-20,112},{-24,112},{28,108},{24,108},{20,108},{16,108},{12,108},{8,108},{4,108},{0,108},{-4,108},{-8,108},{-12,108},{-16,108},{-20,108},{-24,108},{28,104},{24,104},{20,104},{16,104},{12,104},{8,104},{4,104},{0,104},{-4,104},{-8,104},{-12,104},{-16,104},{-20,104},{-24,104},{24,100},{20,100},{16,100},{12,100},{8,100},{4,100},{0,100},{-4,100},{-8,100},{-12,100},{-16,100},{-20,100},{-24,100},{24,96},{20,96},{16,96},{12,96},{8,96},{4,96},{-8,96},{-12,96},{-16,96},{-20,96},{-24,96},{20,92},{16,92},{12,92},{8,92},{-16,92},{-20,92},{20,88},{16,88},{8,88},{-16,88},{16,84},{-16,84},{12,80},{-16,80},{8,76},{4,76},{-12,76},{-16,76},{0,72},{-4,72},{-8,72}};
-const short A_Attack_1_0[119][2] = {{16,164},{12,164},{8,164},{4,164},{0,164},{-4,164},{-8,164},{-12,164},{20,160},{16,160},{12,160},{8,160},{4,160},{0,160},{-4,160},{-8,160},{-12,160},{-16,160},{-20,160},{24,156},{20,156},{16,156},{12,156},{8,156},{4,156},{0,156},{-4,156},{-8,156},{-12,156},{-16,156},{-20,156},{-24,156},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{-12,152},{-16,152},{-20,152},{-24,152},{-28,152},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{-16,148},{-20,148},{-24,148},{-28,148},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{-12,144},{-16,144},{-20,144},{-24,144},{-28,144},{20,140},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{-8,140},{-12,140},{-16,140},{-20,140},{-24,140},{-28,140},{20,136},{16,136},{12,136},{8,136},{4,136},{0,136},{-12,136},{-16,136},{-20,136},{-24,136},{-28,136},{16,132},{12,132},{8,132},{4,132},{-20,132},{-24,132},{16,128},{12,128},{4,128},{-20,128},{12,124},{-20,124},{8,120},{-20,120},{4,116},{0,116},{-16,116},{-20,116},{-4,112},{-8,112},{-12,112}};
-const short A_Attack_1_1[119][2] = {{16,160},{12,160},{8,160},{4,160},{0,160},{-4,160},{-8,160},{-12,160},{20,156},{16,156},{12,156},{8,156},{4,156},{0,156},{-4,156},{-8,156},{-12,156},{-16,156},{-20,156},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{-12,152},{-16,152},{-20,152},{-24,152},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{-16,148},{-20,148},{-24,148},{-28,148},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{-12,144},{-16,144},{-20,144},{-24,144},{-28,144},{24,140},{20,140},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{-8,140},{-12,140},{-16,140},{-20,140},{-24,140},{-28,140},{20,136},{16,136},{12,136},{8,136},{4,136},{0,136},{-4,136},{-8,136},{-12,136},{-16,136},{-20,136},{-24,136},{-28,136},{20,132},{16,132},{12,132},{8,132},{4,132},{0,132},{-12,132},{-16,132},{-20,132},{-24,132},{-28,132},{16,128},{12,128},{8,128},{4,128},{-20,128},{-24,128},{16,124},{12,124},{4,124},{-20,124},{12,120},{-20,120},{8,116},{-20,116},{4,112},{0,112},{-16,112},{-20,112},{-4,108},{-8,108},{-12,108}};
-const short A_Attack_1_2[119][2] = {{20,156},{16,156},{12,156},{8,156},{4,156},{0,156},{-4,156},{-8,156},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{-12,152},{-16,152},{28,148},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{-16,148},{-20,148},{28,144},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{-12,144},{-16,144},{-20,144},{-24,144},{28,140},{24,140},{20,140},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{-8,140},{-12,140},{-16,140},{-20,140},{-24,140},{28,136},{24,136},{20,136},{16,136},{12,136},{8,136},{4,136},{0,136},{-4,136},{-8,136},{-12,136},{-16,136},{-20,136},{-24,136},{24,132},{20,132},{16,132},{12,132},{8,132},{4,132},{0,132},{-4,132},{-8,132},{-12,132},{-16,132},{-20,132},{-24,132},{24,128},{20,128},{16,128},{12,128},{8,128},{4,128},{-8,128},{-12,128},{-16,128},{-20,128},{-24,128},{20,124},{16,124},{12,124},{8,124},{-16,124},{-20,124},{20,120},{16,120},{8,120},{-16,120},{16,116},{-16,116},{12,112},{-16,112},{8,108},{4,108},{-12,108},{-16,108},{0,104},{-4,104},{-8,104}};
-const short A_Attack_1_3[119][2] = {{28,156},{24,156},{20,156},{16,156},{12,156},{8,156},{4,156},{0,156},{32,152},{28,152},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{36,148},{32,148},{28,148},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{36,144},{32,144},{28,144},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{-12,144},{-16,144},{36,140},{32,140},{28,140},{24,140},{20,140},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{-8,140},{-12,140},{-16,140},{36,136},{32,136},{28,136},{24,136},{20,136},{16,136},{12,136},{8,136},{4,136},{0,136},{-4,136},{-8,136},{-12,136},{-16,136},{32,132},{28,132},{24,132},{20,132},{16,132},{12,132},{8,132},{4,132},{0,132},{-4,132},{-8,132},{-12,132},{-16,132},{32,128},{28,128},{24,128},{20,128},{16,128},{12,128},{0,128},{-4,128},{-8,128},{-12,128},{-16,128},{28,124},{24,124},{20,124},{16,124},{-8,124},{-12,124},{28,120},{24,120},{16,120},{-8,120},{24,116},{-8,116},{20,112},{-8,112},{16,108},{12,108},{-4,108},{-8,108},{8,104},{4,104},{0,104}};
-const short A_Attack_1_4[119][2] = {{52,152},{48,152},{44,152},{40,152},{36,152},{32,152},{28,152},{24,152},{56,148},{52,148},{48,148},{44,148},{40,148},{36,148},{32,148},{28,148},{24,148},{20,148},{16,148},{60,144},{56,144},{52,144},{48,144},{44,144},{40,144},{36,144},{32,144},{28,144},{24,144},{20,144},{16,144},{12,144},{60,140},{56,140},{52,140},{48,140},{44,140},{40,140},{36,140},{32,140},{28,140},{24,140},{20,140},{16,140},{12,140},{8,140},{60,136},{56,136},{52,136},{48,136},{44,136},{40,136},{36,136},{32,136},{28,136},{24,136},{20,136},{16,136},{12,136},{8,136},{60,132},{56,132},{52,132},{48,132},{44,132},{40,132},{36,132},{32,132},{28,132},{24,132},{20,132},{16,132},{12,132},{8,132},{56,128},{52,128},{48,128},{44,128},{40,128},{36,128},{32,128},{28,128},{24,128},{20,128},{16,128},{12,128},{8,128},{56,124},{52,124},{48,124},{44,124},{40,124},{36,124},{24,124},{20,124},{16,124},{12,124},{8,124},{52,120},{48,120},{44,120},{40,120},{16,120},{12,120},{52,116},{48,116},{40,116},{16,116},{48,112},{16,112},{44,108},{16,108},{40,104},{36,104},{20,104},{16,104},{32,100},{28,100},{24,100}};
-const short A_Attack_1_5[119][2] = {{72,144},{68,144},{64,144},{60,144},{56,144},{52,144},{48,144},{44,144},{80,140},{76,140},{72,140},{68,140},{64,140},{60,140},{56,140},{52,140},{48,140},{44,140},{40,140},{84,136},{80,136},{76,136},{72,136},{68,136},{64,136},{60,136},{56,136},{52,136},{48,136},{44,136},{40,136},{36,136},{88,132},{84,132},{80,132},{76,132},{72,132},{68,132},{64,132},{60,132},{56,132},{52,132},{48,132},{44,132},{40,132},{36,132},{88,128},{84,128},{80,128},{76,128},{72,128},{68,128},{64,128},{60,128},{56,128},{52,128},{48,128},{44,128},{40,128},{36,128},{88,124},{84,124},{80,124},{76,124},{72,124},{68,124},{64,124},{60,124},{56,124},{52,124},{48,124},{44,124},{40,124},{36,124},{88,120},{84,120},{80,120},{76,120},{72,120},{68,120},{64,120},{60,120},{56,120},{52,120},{48,120},{44,120},{40,120},{88,116},{84,116},{80,116},{76,116},{72,116},{60,116},{56,116},{52,116},{48,116},{44,116},{40,116},{84,112},{80,112},{56,112},{52,112},{48,112},{44,112},{80,108},{56,108},{48,108},{44,108},{80,104},{48,104},{80,100},{52,100},{80,96},{76,96},{60,96},{56,96},{72,92},{68,92},{64,92}};
-const short A_Attack_1_6[119][2] = {{64,160},{60,160},{56,160},{52,160},{48,160},{44,160},{40,160},{36,160},{68,156},{64,156},{60,156},{56,156},{52,156},{48,156},{44,156},{40,156},{36,156},{32,156},{28,156},{72,152},{68,152},{64,152},{60,152},{56,152},{52,152},{48,152},{44,152},{40,152},{36,152},{32,152},{28,152},{24,152},{72,148},{68,148},{64,148},{60,148},{56,148},{52,148},{48,148},{44,148},{40,148},{36,148},{32,148},{28,148},{24,148},{20,148},{72,144},{68,144},{64,144},{60,144},{56,144},{52,144},{48,144},{44,144},{40,144},{36,144},{32,144},{28,144},{24,144},{20,144},{72,140},{68,140},{64,140},{60,140},{56,140},{52,140},{48,140},{44,140},{40,140},{36,140},{32,140},{28,140},{24,140},{20,140},{68,136},{64,136},{60,136},{56,136},{52,136},{48,136},{44,136},{40,136},{36,136},{32,136},{28,136},{24,136},{20,136},{68,132},{64,132},{60,132},{56,132},{52,132},{48,132},{36,132},{32,132},{28,132},{24,132},{20,132},{64,128},{60,128},{56,128},{52,128},{28,128},{24,128},{64,124},{60,124},{52,124},{28,124},{60,120},{28,120},{56,116},{28,116},{52,112},{48,112},{32,112},{28,112},{44,108},{40,108},{36,108}};
-const short A_Attack_1_7[119][2] = {{36,164},{32,164},{28,164},{24,164},{20,164},{16,164},{12,164},{8,164},{40,160},{36,160},{32,160},{28,160},{24,160},{20,160},{16,160},{12,160},{8,160},{4,160},{0,160},{44,156},{40,156},{36,156},{32,156},{28,156},{24,156},{20,156},{16,156},{12,156},{8,156},{4,156},{0,156},{-4,156},{44,152},{40,152},{36,152},{32,152},{28,152},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{44,148},{40,148},{36,148},{32,148},{28,148},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{44,144},{40,144},{36,144},{32,144},{28,144},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{40,140},{36,140},{32,140},{28,140},{24,140},{20,140},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{-8,140},{40,136},{36,136},{32,136},{28,136},{24,136},{20,136},{8,136},{4,136},{0,136},{-4,136},{-8,136},{36,132},{32,132},{28,132},{24,132},{0,132},{-4,132},{36,128},{32,128},{24,128},{0,128},{32,124},{0,124},{28,120},{0,120},{24,116},{20,116},{4,116},{0,116},{16,112},{12,112},{8,112}};
-const short A_Attack_3_0[119][2] = {{-4,140},{-8,140},{-12,140},{-16,140},{-20,140},{-24,140},{-28,140},{-32,140},{0,136},{-4,136},{-8,136},{-12,136},{-16,136},{-20,136},{-24,136},{-28,136},{-32,136},{-36,136},{-40,136},{4,132},{0,132},{-4,132},{-8,132},{-12,132},{-16,132},{-20,132},{-24,132},{-28,132},{-32,132},{-36,132},{-40,132},{-44,132},{4,128},{0,128},{-4,128},{-8,128},{-12,128},{-16,128},{-20,128},{-24,128},{-28,128},{-32,128},{-36,128},{-40,128},{-44,128},{-48,128},{4,124},{0,124},{-4,124},{-8,124},{-12,124},{-16,124},{-20,124},{-24,124},{-28,124},{-32,124},{-36,124},{-40,124},{-44,124},{-48,124},{4,120},{0,120},{-4,120},{-8,120},{-12,120},{-16,120},{-20,120},{-24,120},{-28,120},{-32,120},{-36,120},{-40,120},{-44,120},{-48,120},{0,116},{-4,116},{-8,116},{-12,116},{-16,116},{-20,116},{-24,116},{-28,116},{-32,116},{-36,116},{-40,116},{-44,116},{-48,116},{0,112},{-4,112},{-8,112},{-12,112},{-16,112},{-20,112},{-32,112},{-36,112},{-40,112},{-44,112},{-48,112},{-4,108},{-8,108},{-12,108},{-16,108},{-40,108},{-44,108},{-4,104},{-8,104},{-16,104},{-40,104},{-8,100},{-40,100},{-12,96},{-40,96},{-16,92},{-20,92},{-36,92},{-40,92},{-24,88},{-28,88},{-32,88}};
-const short A_Attack_3_1[118][2] = {{-8,136},{-12,136},{-16,136},{-20,136},{-24,136},{-28,136},{-32,136},{-36,136},{-4,132},{-8,132},{-12,132},{-16,132},{-20,132},{-24,132},{-28,132},{-32,132},{-36,132},{-40,132},{-44,132},{0,128},{-4,128},{-8,128},{-12,128},{-16,128},{-20,128},{-24,128},{-28,128},{-32,128},{-36,128},{-40,128},{-44,128},{-48,128},{0,124},{-4,124},{-8,124},{-12,124},{-16,124},{-20,124},{-24,124},{-28,124},{-32,124},{-36,124},{-40,124},{-44,124},{-48,124},{-52,124},{0,120},{-4,120},{-8,120},{-12,120},{-16,120},{-20,120},{-24,120},{-28,120},{-32,120},{-36,120},{-40,120},{-44,120},{-48,120},{-52,120},{0,116},{-4,116},{-8,116},{-12,116},{-16,116},{-20,116},{-24,116},{-28,116},{-32,116},{-36,116},{-40,116},{-44,116},{-48,116},{-52,116},{-4,112},{-8,112},{-12,112},{-16,112},{-20,112},{-24,112},{-28,112},{-32,112},{-36,112},{-40,112},{-44,112},{-48,112},{-52,112},{-4,108},{-8,108},{-12,108},{-16,108},{-20,108},{-24,108},{-28,108},{-32,108},{-36,108},{-44,108},{-48,108},{-8,104},{-12,104},{-16,104},{-20,104},{-24,104},{-28,104},{-32,104},{-44,104},{-16,100},{-20,100},{-28,100},{-44,100},{-20,96},{-44,96},{-24,92},{-28,92},{-44,92},{-32,88},{-36,88},{-40,88}};
-const short A_Attack_3_2[127][2] = {{-8,160},{-12,160},{-16,160},{-20,160},{-24,160},{-28,160},{-32,160},{-36,160},{-4,156},{-8,156},{-12,156},{-16,156},{-20,156},{-24,156},{-28,156},{-32,156},{-36,156},{-40,156},{-44,156},{0,152},{-4,152},{-8,152},{-12,152},{-16,152},{-20,152},{-24,152},{-28,152},{-32,152},{-36,152},{-40,152},{-44,152},{-48,152},{0,148},{-4,148},{-8,148},{-12,148},{-16,148},{-20,148},{-24,148},{-28,148},{-32,148},{-36,148},{-40,148},{-44,148},{-48,148},{-52,148},{0,144},{-4,144},{-8,144},{-12,144},{-16,144},{-20,144},{-24,144},{-28,144},{-32,144},{-36,144},{-40,144},{-44,144},{-48,144},{-52,144},{0,140},{-4,140},{-8,140},{-12,140},{-16,140},{-20,140},{-24,140},{-28,140},{-32,140},{-36,140},{-40,140},{-44,140},{-48,140},{-52,140},{-4,136},{-8,136},{-12,136},{-16,136},{-20,136},{-24,136},{-28,136},{-32,136},{-36,136},{-40,136},{-44,136},{-48,136},{-52,136},{-4,132},{-8,132},{-12,132},{-16,132},{-20,132},{-24,132},{-28,132},{-32,132},{-36,132},{-40,132},{-44,132},{-48,132},{-52,132},{-8,128},{-12,128},{-16,128},{-20,128},{-24,128},{-28,128},{-32,128},{-36,128},{-40,128},{-44,128},{-48,128},{-16,124},{-20,124},{-24,124},{-28,124},{-32,124},{-36,124},{-44,124},{-24,120},{-28,120},{-32,120},{-44,120},{-28,116},{-44,116},{-32,112},{-40,112},{-36,108}};
-const short A_Attack_3_3[77][2] = {{24,184},{20,184},{16,184},{12,184},{8,184},{4,184},{0,184},{28,180},{24,180},{20,180},{16,180},{12,180},{8,180},{4,180},{0,180},{-4,180},{32,176},{28,176},{24,176},{20,176},{16,176},{12,176},{8,176},{4,176},{0,176},{-4,176},{32,172},{28,172},{24,172},{20,172},{16,172},{12,172},{8,172},{4,172},{0,172},{-4,172},{32,168},{28,168},{24,168},{20,168},{16,168},{12,168},{8,168},{4,168},{0,168},{-4,168},{32,164},{28,164},{24,164},{20,164},{16,164},{12,164},{8,164},{4,164},{0,164},{-4,164},{28,160},{24,160},{20,160},{16,160},{12,160},{8,160},{4,160},{0,160},{-4,160},{28,156},{24,156},{20,156},{16,156},{12,156},{8,156},{4,156},{0,156},{-4,156},{24,152},{20,152},{-4,152}};
-const short A_Attack_3_4[135][2] = {{20,180},{16,180},{12,180},{8,180},{4,180},{0,180},{-4,180},{-8,180},{28,176},{24,176},{20,176},{16,176},{12,176},{8,176},{4,176},{0,176},{-4,176},{-8,176},{-12,176},{32,172},{28,172},{24,172},{20,172},{16,172},{12,172},{8,172},{4,172},{0,172},{-4,172},{-8,172},{-12,172},{-16,172},{36,168},{32,168},{28,168},{24,168},{20,168},{16,168},{12,168},{8,168},{4,168},{0,168},{-4,168},{-8,168},{-12,168},{-16,168},{36,164},{32,164},{28,164},{24,164},{20,164},{16,164},{12,164},{8,164},{4,164},{0,164},{-4,164},{-8,164},{-12,164},{-16,164},{36,160},{32,160},{28,160},{24,160},{20,160},{16,160},{12,160},{8,160},{4,160},{0,160},{-4,160},{-8,160},{-12,160},{-16,160},{36,156},{32,156},{28,156},{24,156},{20,156},{16,156},{12,156},{8,156},{4,156},{0,156},{-4,156},{-8,156},{-12,156},{36,152},{32,152},{28,152},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{-12,152},{32,148},{28,148},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{28,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{28,140},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{28,136},{16,136},{12,136},{8,136},{4,136},{24,132},{20,132},{16,132}};
-const short A_Attack_3_5[120][2] = {{20,184},{16,184},{12,184},{8,184},{4,184},{0,184},{-4,184},{-8,184},{-12,184},{24,180},{20,180},{16,180},{12,180},{8,180},{4,180},{0,180},{-4,180},{-8,180},{-12,180},{-16,180},{28,176},{24,176},{20,176},{16,176},{12,176},{8,176},{4,176},{0,176},{-4,176},{-8,176},{-12,176},{-16,176},{-20,176},{32,172},{28,172},{24,172},{20,172},{16,172},{12,172},{8,172},{4,172},{0,172},{-4,172},{-8,172},{-12,172},{-16,172},{-20,172},{32,168},{28,168},{24,168},{20,168},{16,168},{12,168},{8,168},{4,168},{0,168},{-4,168},{-8,168},{-12,168},{-16,168},{-20,168},{32,164},{28,164},{24,164},{20,164},{16,164},{12,164},{8,164},{4,164},{0,164},{-4,164},{-8,164},{-12,164},{-16,164},{-20,164},{32,160},{28,160},{24,160},{20,160},{16,160},{12,160},{8,160},{4,160},{0,160},{-4,160},{-8,160},{-12,160},{-16,160},{32,156},{28,156},{24,156},{20,156},{16,156},{4,156},{0,156},{-4,156},{-8,156},{-12,156},{-16,156},{28,152},{24,152},{0,152},{-4,152},{-8,152},{-12,152},{24,148},{0,148},{-8,148},{-12,148},{24,144},{-8,144},{24,140},{-4,140},{24,136},{20,136},{4,136},{0,136},{16,132},{12,132},{8,132}};
-const short A_Attack_3_6[119][2] = {{28,168},{24,168},{20,168},{16,168},{12,168},{8,168},{4,168},{0,168},{32,164},{28,164},{24,164},{20,164},{16,164},{12,164},{8,164},{4,164},{0,164},{-4,164},{-8,164},{36,160},{32,160},{28,160},{24,160},{20,160},{16,160},{12,160},{8,160},{4,160},{0,160},{-4,160},{-8,160},{-12,160},{36,156},{32,156},{28,156},{24,156},{20,156},{16,156},{12,156},{8,156},{4,156},{0,156},{-4,156},{-8,156},{-12,156},{-16,156},{36,152},{32,152},{28,152},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{-12,152},{-16,152},{36,148},{32,148},{28,148},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{-16,148},{32,144},{28,144},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{-12,144},{-16,144},{32,140},{28,140},{24,140},{20,140},{16,140},{12,140},{0,140},{-4,140},{-8,140},{-12,140},{-16,140},{28,136},{24,136},{20,136},{16,136},{-8,136},{-12,136},{28,132},{24,132},{16,132},{-8,132},{24,128},{-8,128},{20,124},{-8,124},{16,120},{12,120},{-4,120},{-8,120},{8,116},{4,116},{0,116}};
-const short A_Backward_0[119][2] = {{32,160},{28,160},{24,160},{20,160},{16,160},{12,160},{8,160},{4,160},{36,156},{32,156},{28,156},{24,156},{20,156},{16,156},{12,156},{8,156},{4,156},{0,156},{-4,156},{40,152},{36,152},{32,152},{28,152},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{40,148},{36,148},{32,148},{28,148},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{40,144},{36,144},{32,144},{28,144},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{-12,144},{40,140},{36,140},{32,140},{28,140},{24,140},{20,140},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{-8,140},{-12,140},{36,136},{32,136},{28,136},{24,136},{20,136},{16,136},{12,136},{8,136},{4,136},{0,136},{-4,136},{-8,136},{-12,136},{36,132},{32,132},{28,132},{24,132},{20,132},{16,132},{4,132},{0,132},{-4,132},{-8,132},{-12,132},{32,128},{28,128},{24,128},{20,128},{-4,128},{-8,128},{32,124},{28,124},{20,124},{-4,124},{28,120},{-4,120},{24,116},{-4,116},{20,112},{16,112},{0,112},{-4,112},{12,108},{8,108},{4,108}};
-const short A_Backward_1[119][2] = {{36,160},{32,160},{28,160},{24,160},{20,160},{16,160},{12,160},{8,160},{40,156},{36,156},{32,156},{28,156},{24,156},{20,156},{16,156},{12,156},{8,156},{4,156},{0,156},{44,152},{40,152},{36,152},{32,152},{28,152},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{44,148},{40,148},{36,148},{32,148},{28,148},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{44,144},{40,144},{36,144},{32,144},{28,144},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{44,140},{40,140},{36,140},{32,140},{28,140},{24,140},{20,140},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{-8,140},{40,136},{36,136},{32,136},{28,136},{24,136},{20,136},{16,136},{12,136},{8,136},{4,136},{0,136},{-4,136},{-8,136},{40,132},{36,132},{32,132},{28,132},{24,132},{20,132},{8,132},{4,132},{0,132},{-4,132},{-8,132},{36,128},{32,128},{28,128},{24,128},{0,128},{-4,128},{36,124},{32,124},{24,124},{0,124},{32,120},{0,120},{28,116},{0,116},{24,112},{20,112},{4,112},{0,112},{16,108},{12,108},{8,108}};
-const short A_Backward_2[119][2] = {{40,164},{36,164},{32,164},{28,164},{24,164},{20,164},{16,164},{12,164},{44,160},{40,160},{36,160},{32,160},{28,160},{24,160},{20,160},{16,160},{12,160},{8,160},{4,160},{48,156},{44,156},{40,156},{36,156},{32,156},{28,156},{24,156},{20,156},{16,156},{12,156},{8,156},{4,156},{0,156},{48,152},{44,152},{40,152},{36,152},{32,152},{28,152},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{48,148},{44,148},{40,148},{36,148},{32,148},{28,148},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{48,144},{44,144},{40,144},{36,144},{32,144},{28,144},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{44,140},{40,140},{36,140},{32,140},{28,140},{24,140},{20,140},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{44,136},{40,136},{36,136},{32,136},{28,136},{24,136},{12,136},{8,136},{4,136},{0,136},{-4,136},{40,132},{36,132},{32,132},{28,132},{4,132},{0,132},{40,128},{36,128},{28,128},{4,128},{36,124},{4,124},{32,120},{4,120},{28,116},{24,116},{8,116},{4,116},{20,112},{16,112},{12,112}};
-const short A_Backward_3[119][2] = {{40,164},{36,164},{32,164},{28,164},{24,164},{20,164},{16,164},{12,164},{44,160},{40,160},{36,160},{32,160},{28,160},{24,160},{20,160},{16,160},{12,160},{8,160},{4,160},{48,156},{44,156},{40,156},{36,156},{32,156},{28,156},{24,156},{20,156},{16,156},{12,156},{8,156},{4,156},{0,156},{48,152},{44,152},{40,152},{36,152},{32,152},{28,152},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{48,148},{44,148},{40,148},{36,148},{32,148},{28,148},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{48,144},{44,144},{40,144},{36,144},{32,144},{28,144},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{44,140},{40,140},{36,140},{32,140},{28,140},{24,140},{20,140},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{44,136},{40,136},{36,136},{32,136},{28,136},{24,136},{12,136},{8,136},{4,136},{0,136},{-4,136},{40,132},{36,132},{32,132},{28,132},{4,132},{0,132},{40,128},{36,128},{28,128},{4,128},{36,124},{4,124},{32,120},{4,120},{28,116},{24,116},{8,116},{4,116},{20,112},{16,112},{12,112}};
-const short A_Backward_4[119][2] = {{36,160},{32,160},{28,160},{24,160},{20,160},{16,160},{12,160},{8,160},{40,156},{36,156},{32,156},{28,156},{24,156},{20,156},{16,156},{12,156},{8,156},{4,156},{0,156},{44,152},{40,152},{36,152},{32,152},{28,152},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{44,148},{40,148},{36,148},{32,148},{28,148},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{44,144},{40,144},{36,144},{32,144},{28,144},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{44,140},{40,140},{36,140},{32,140},{28,140},{24,140},{20,140},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{-8,140},{40,136},{36,136},{32,136},{28,136},{24,136},{20,136},{16,136},{12,136},{8,136},{4,136},{0,136},{-4,136},{-8,136},{40,132},{36,132},{32,132},{28,132},{24,132},{20,132},{8,132},{4,132},{0,132},{-4,132},{-8,132},{36,128},{32,128},{28,128},{24,128},{0,128},{-4,128},{36,124},{32,124},{24,124},{0,124},{32,120},{0,120},{28,116},{0,116},{24,112},{20,112},{4,112},{0,112},{16,108},{12,108},{8,108}};
-const short A_Backward_5[119][2] = {{32,160},{28,160},{24,160},{20,160},{16,160},{12,160},{8,160},{4,160},{36,156},{32,156},{28,156},{24,156},{20,156},{16,156},{12,156},{8,156},{4,156},{0,156},{-4,156},{40,152},{36,152},{32,152},{28,152},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{40,148},{36,148},{32,148},{28,148},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{40,144},{36,144},{32,144},{28,144},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{-12,144},{40,140},{36,140},{32,140},{28,140},{24,140},{20,140},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{-8,140},{-12,140},{36,136},{32,136},{28,136},{24,136},{20,136},{16,136},{12,136},{8,136},{4,136},{0,136},{-4,136},{-8,136},{-12,136},{36,132},{32,132},{28,132},{24,132},{20,132},{16,132},{4,132},{0,132},{-4,132},{-8,132},{-12,132},{32,128},{28,128},{24,128},{20,128},{-4,128},{-8,128},{32,124},{28,124},{20,124},{-4,124},{28,120},{-4,120},{24,116},{-4,116},{20,112},{16,112},{0,112},{-4,112},{12,108},{8,108},{4,108}};
-const short A_CrouchGuard_0[123][2] = {{32,128},{28,128},{24,128},{20,128},{16,128},{12,128},{8,128},{4,128},{36,124},{32,124},{28,124},{24,124},{20,124},{16,124},{12,124},{8,124},{4,124},{0,124},{-4,124},{40,120},{36,120},{32,120},{28,120},{24,120},{20,120},{16,120},{12,120},{8,120},{4,120},{0,120},{-4,120},{-8,120},{40,116},{36,116},{32,116},{28,116},{24,116},{20,116},{16,116},{12,116},{8,116},{4,116},{0,116},{-4,116},{-8,116},{-12,116},{40,112},{36,112},{32,112},{28,112},{24,112},{20,112},{16,112},{12,112},{8,112},{4,112},{0,112},{-4,112},{-8,112},{-12,112},{40,108},{36,108},{32,108},{28,108},{24,108},{20,108},{16,108},{12,108},{8,108},{4,108},{0,108},{-4,108},{-8,108},{-12,108},{36,104},{32,104},{28,104},{24,104},{20,104},{16,104},{12,104},{8,104},{4,104},{0,104},{-4,104},{-8,104},{-12,104},{36,100},{32,100},{28,100},{24,100},{20,100},{16,100},{4,100},{0,100},{-4,100},{-8,100},{-12,100},{32,96},{28,96},{24,96},{20,96},{-4,96},{-8,96},{32,92},{28,92},{24,92},{20,92},{-4,92},{-8,92},{24,88},{-4,88},{-8,88},{24,84},{20,84},{-4,84},{20,80},{16,80},{12,80},{0,80},{12,76},{8,76},{4,76}};
-const short A_CrouchGuard_1[120][2] = {{32,128},{28,128},{24,128},{20,128},{16,128},{12,128},{8,128},{4,128},{36,124},{32,124},{28,124},{24,124},{20,124},{16,124},{12,124},{8,124},{4,124},{0,124},{-4,124},{40,120},{36,120},{32,120},{28,120},{24,120},{20,120},{16,120},{12,120},{8,120},{4,120},{0,120},{-4,120},{-8,120},{40,116},{36,116},{32,116},{28,116},{24,116},{20,116},{16,116},{12,116},{8,116},{4,116},{0,116},{-4,116},{-8,116},{-12,116},{40,112},{36,112},{32,112},{28,112},{24,112},{20,112},{16,112},{12,112},{8,112},{4,112},{0,112},{-4,112},{-8,112},{-12,112},{40,108},{36,108},{32,108},{28,108},{24,108},{20,108},{16,108},{12,108},{8,108},{4,108},{0,108},{-4,108},{-8,108},{-12,108},{36,104},{32,104},{28,104},{24,104},{20,104},{16,104},{12,104},{8,104},{4,104},{0,104},{-4,104},{-8,104},{-12,104},{36,100},{32,100},{28,100},{24,100},{20,100},{16,100},{4,100},{0,100},{-4,100},{-8,100},{-12,100},{32,96},{28,96},{24,96},{20,96},{-4,96},{-8,96},{32,92},{28,92},{20,92},{-4,92},{28,88},{-4,88},{28,84},{24,84},{-4,84},{20,80},{16,80},{0,80},{-4,80},{12,76},{8,76},{4,76}};
-const short A_Damage_0[119][2] = {{24,156},{20,156},{16,156},{12,156},{8,156},{4,156},{0,156},{-4,156},{28,152},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{-12,152},{32,148},{28,148},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{-16,148},{32,144},{28,144},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{-12,144},{-16,144},{-20,144},{32,140},{28,140},{24,140},{20,140},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{-8,140},{-12,140},{-16,140},{-20,140},{32,136},{28,136},{24,136},{20,136},{16,136},{12,136},{8,136},{4,136},{0,136},{-4,136},{-8,136},{-12,136},{-16,136},{-20,136},{28,132},{24,132},{20,132},{16,132},{12,132},{8,132},{4,132},{0,132},{-4,132},{-8,132},{-12,132},{-16,132},{-20,132},{28,128},{24,128},{20,128},{16,128},{12,128},{8,128},{-4,128},{-8,128},{-12,128},{-16,128},{-20,128},{24,124},{20,124},{16,124},{12,124},{-12,124},{-16,124},{24,120},{20,120},{12,120},{-12,120},{20,116},{-12,116},{16,112},{-12,112},{12,108},{8,108},{-8,108},{-12,108},{4,104},{0,104},{-4,104}};
-const short A_Damage_1[119][2] = {{28,148},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{32,144},{28,144},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{36,140},{32,140},{28,140},{24,140},{20,140},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{-8,140},{-12,140},{36,136},{32,136},{28,136},{24,136},{20,136},{16,136},{12,136},{8,136},{4,136},{0,136},{-4,136},{-8,136},{-12,136},{-16,136},{36,132},{32,132},{28,132},{24,132},{20,132},{16,132},{12,132},{8,132},{4,132},{0,132},{-4,132},{-8,132},{-12,132},{-16,132},{36,128},{32,128},{28,128},{24,128},{20,128},{16,128},{12,128},{8,128},{4,128},{0,128},{-4,128},{-8,128},{-12,128},{-16,128},{32,124},{28,124},{24,124},{20,124},{16,124},{12,124},{8,124},{4,124},{0,124},{-4,124},{-8,124},{-12,124},{-16,124},{32,120},{28,120},{24,120},{20,120},{16,120},{12,120},{0,120},{-4,120},{-8,120},{-12,120},{-16,120},{28,116},{24,116},{20,116},{16,116},{-8,116},{-12,116},{28,112},{24,112},{16,112},{-8,112},{24,108},{-8,108},{20,104},{-8,104},{16,100},{12,100},{-4,100},{-8,100},{8,96},{4,96},{0,96}};
-const short A_Damage_2[119][2] = {{28,156},{24,156},{20,156},{16,156},{12,156},{8,156},{4,156},{0,156},{32,152},{28,152},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{36,148},{32,148},{28,148},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{36,144},{32,144},{28,144},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{-12,144},{-16,144},{36,140},{32,140},{28,140},{24,140},{20,140},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{-8,140},{-12,140},{-16,140},{36,136},{32,136},{28,136},{24,136},{20,136},{16,136},{12,136},{8,136},{4,136},{0,136},{-4,136},{-8,136},{-12,136},{-16,136},{32,132},{28,132},{24,132},{20,132},{16,132},{12,132},{8,132},{4,132},{0,132},{-4,132},{-8,132},{-12,132},{-16,132},{32,128},{28,128},{24,128},{20,128},{16,128},{12,128},{0,128},{-4,128},{-8,128},{-12,128},{-16,128},{28,124},{24,124},{20,124},{16,124},{-8,124},{-12,124},{28,120},{24,120},{16,120},{-8,120},{24,116},{-8,116},{20,112},{-8,112},{16,108},{12,108},{-4,108},{-8,108},{8,104},{4,104},{0,104}};
-const short A_Damage_3[119][2] = {{36,156},{32,156},{28,156},{24,156},{20,156},{16,156},{12,156},{8,156},{40,152},{36,152},{32,152},{28,152},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{44,148},{40,148},{36,148},{32,148},{28,148},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{44,144},{40,144},{36,144},{32,144},{28,144},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{44,140},{40,140},{36,140},{32,140},{28,140},{24,140},{20,140},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{-8,140},{44,136},{40,136},{36,136},{32,136},{28,136},{24,136},{20,136},{16,136},{12,136},{8,136},{4,136},{0,136},{-4,136},{-8,136},{40,132},{36,132},{32,132},{28,132},{24,132},{20,132},{16,132},{12,132},{8,132},{4,132},{0,132},{-4,132},{-8,132},{40,128},{36,128},{32,128},{28,128},{24,128},{20,128},{8,128},{4,128},{0,128},{-4,128},{-8,128},{36,124},{32,124},{28,124},{24,124},{0,124},{-4,124},{36,120},{32,120},{24,120},{0,120},{32,116},{0,116},{28,112},{0,112},{24,108},{20,108},{4,108},{0,108},{16,104},{12,104},{8,104}};
-const short A_Dead_0[123][2] = {{84,144},{80,144},{76,144},{72,144},{68,144},{88,140},{84,140},{80,140},{76,140},{72,140},{68,140},{64,140},{92,136},{88,136},{84,136},{80,136},{76,136},{72,136},{68,136},{64,136},{60,136},{56,136},{52,136},{48,136},{92,132},{88,132},{84,132},{80,132},{76,132},{72,132},{68,132},{64,132},{48,132},{44,132},{96,128},{92,128},{88,128},{84,128},{80,128},{76,128},{72,128},{68,128},{44,128},{96,124},{92,124},{88,124},{84,124},{80,124},{76,124},{72,124},{68,124},{44,124},{96,120},{92,120},{88,120},{84,120},{80,120},{76,120},{72,120},{68,120},{44,120},{96,116},{92,116},{88,116},{84,116},{80,116},{76,116},{72,116},{48,116},{96,112},{92,112},{88,112},{84,112},{80,112},{76,112},{72,112},{68,112},{64,112},{48,112},{96,108},{92,108},{88,108},{84,108},{80,108},{76,108},{72,108},{68,108},{64,108},{52,108},{96,104},{92,104},{88,104},{84,104},{80,104},{76,104},{72,104},{68,104},{64,104},{60,104},{56,104},{96,100},{92,100},{88,100},{84,100},{80,100},{76,100},{72,100},{68,100},{64,100},{60,100},{92,96},{88,96},{84,96},{80,96},{76,96},{72,96},{68,96},{88,92},{84,92},{80,92},{76,92},{72,92},{68,92}};
-const short A_Dead_1[118][2] = {{92,140},{88,140},{84,140},{80,140},{76,140},{96,136},{92,136},{88,136},{84,136},{80,136},{76,136},{72,136},{100,132},{96,132},{92,132},{88,132},{84,132},{80,132},{76,132},{72,132},{68,132},{64,132},{60,132},{56,132},{100,128},{96,128},{92,128},{88,128},{84,128},{80,128},{76,128},{72,128},{56,128},{104,124},{100,124},{96,124},{92,124},{88,124},{84,124},{80,124},{76,124},{52,124},{104,120},{100,120},{96,120},{92,120},{88,120},{84,120},{80,120},{52,120},{104,116},{100,116},{96,116},{92,116},{88,116},{84,116},{80,116},{52,116},{104,112},{100,112},{96,112},{92,112},{88,112},{84,112},{80,112},{76,112},{56,112},{104,108},{100,108},{96,108},{92,108},{88,108},{84,108},{80,108},{76,108},{72,108},{68,108},{56,108},{104,104},{100,104},{96,104},{92,104},{88,104},{84,104},{80,104},{76,104},{72,104},{60,104},{104,100},{100,100},{96,100},{92,100},{88,100},{84,100},{80,100},{76,100},{72,100},{68,100},{64,100},{60,100},{104,96},{100,96},{96,96},{92,96},{88,96},{84,96},{80,96},{76,96},{72,96},{68,96},{100,92},{96,92},{92,92},{88,92},{84,92},{80,92},{96,88},{92,88}};
-const short A_Dead_2[125][2] = {{100,116},{96,116},{92,116},{88,116},{84,116},{104,112},{100,112},{96,112},{92,112},{88,112},{84,112},{80,112},{108,108},{104,108},{100,108},{96,108},{92,108},{88,108},{84,108},{80,108},{76,108},{72,108},{68,108},{64,108},{108,104},{104,104},{100,104},{96,104},{92,104},{88,104},{84,104},{80,104},{64,104},{112,100},{108,100},{104,100},{100,100},{96,100},{92,100},{88,100},{84,100},{60,100},{112,96},{108,96},{104,96},{100,96},{96,96},{92,96},{88,96},{60,96},{112,92},{108,92},{104,92},{100,92},{96,92},{92,92},{88,92},{60,92},{112,88},{108,88},{104,88},{100,88},{96,88},{92,88},{88,88},{84,88},{64,88},{112,84},{108,84},{104,84},{100,84},{96,84},{92,84},{88,84},{84,84},{80,84},{76,84},{64,84},{112,80},{108,80},{104,80},{100,80},{96,80},{92,80},{88,80},{84,80},{80,80},{68,80},{64,80},{112,76},{108,76},{104,76},{100,76},{96,76},{92,76},{88,76},{84,76},{80,76},{76,76},{72,76},{68,76},{112,72},{108,72},{104,72},{100,72},{96,72},{92,72},{88,72},{84,72},{80,72},{76,72},{72,72},{108,68},{104,68},{100,68},{96,68},{92,68},{88,68},{84,68},{80,68},{76,68},{104,64},{100,64},{96,64},{92,64}};
-const short A_Dead_3[100][2] = {{96,44},{92,44},{88,44},{84,44},{80,44},{100,40},{96,40},{92,40},{88,40},{84,40},{80,40},{76,40},{104,36},{100,36},{96,36},{92,36},{88,36},{84,36},{80,36},{76,36},{72,36},{68,36},{64,36},{104,32},{100,32},{96,32},{92,32},{88,32},{84,32},{80,32},{76,32},{72,32},{108,28},{104,28},{100,28},{96,28},{92,28},{88,28},{84,28},{80,28},{108,24},{104,24},{100,24},{96,24},{92,24},{88,24},{84,24},{108,20},{104,20},{100,20},{96,20},{92,20},{88,20},{84,20},{56,20},{108,16},{104,16},{100,16},{96,16},{92,16},{88,16},{84,16},{80,16},{52,16},{108,12},{104,12},{100,12},{96,12},{92,12},{88,12},{84,12},{80,12},{76,12},{72,12},{52,12},{48,12},{108,8},{104,8},{100,8},{96,8},{92,8},{88,8},{84,8},{80,8},{76,8},{56,8},{108,4},{104,4},{100,4},{96,4},{92,4},{88,4},{84,4},{80,4},{76,4},{72,4},{68,4},{64,4},{60,4},{56,4}};
-const short A_Dead_4[5][2] = {{60,36},{64,32},{60,32},{56,32},{56,28}};
-const short A_Dead_5[17][2] = {{64,36},{60,36},{56,36},{68,32},{64,32},{60,32},{56,32},{52,32},{72,28},{68,28},{64,28},{60,28},{48,28},{76,24},{72,24},{68,24},{64,24}};
-const short A_Dead_6[20][2] = {{64,56},{60,56},{56,56},{68,52},{64,52},{60,52},{56,52},{52,52},{72,48},{68,48},{64,48},{60,48},{48,48},{44,48},{76,44},{72,44},{68,44},{64,44},{44,44},{44,40}};
-const short A_Dead_7[19][2] = {{64,36},{60,36},{56,36},{68,32},{64,32},{60,32},{56,32},{52,32},{72,28},{68,28},{64,28},{60,28},{56,28},{48,28},{76,24},{72,24},{68,24},{64,24},{44,24}};
-const short A_Fall_0[119][2] = {{24,168},{20,168},{16,168},{12,168},{8,168},{4,168},{0,168},{-4,168},{28,164},{24,164},{20,164},{16,164},{12,164},{8,164},{4,164},{0,164},{-4,164},{-8,164},{-12,164},{32,160},{28,160},{24,160},{20,160},{16,160},{12,160},{8,160},{4,160},{0,160},{-4,160},{-8,160},{-12,160},{-16,160},{32,156},{28,156},{24,156},{20,156},{16,156},{12,156},{8,156},{4,156},{0,156},{-4,156},{-8,156},{-12,156},{-16,156},{-20,156},{32,152},{28,152},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{-12,152},{-16,152},{-20,152},{32,148},{28,148},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{-16,148},{-20,148},{28,144},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{-12,144},{-16,144},{-20,144},{28,140},{24,140},{20,140},{16,140},{12,140},{8,140},{-4,140},{-8,140},{-12,140},{-16,140},{-20,140},{24,136},{20,136},{16,136},{12,136},{-12,136},{-16,136},{24,132},{20,132},{12,132},{-12,132},{20,128},{-12,128},{16,124},{-12,124},{12,120},{8,120},{-8,120},{-12,120},{4,116},{0,116},{-4,116}};
-const short A_Forward_0[119][2] = {{16,160},{12,160},{8,160},{4,160},{0,160},{-4,160},{-8,160},{-12,160},{20,156},{16,156},{12,156},{8,156},{4,156},{0,156},{-4,156},{-8,156},{-12,156},{-16,156},{-20,156},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{-12,152},{-16,152},{-20,152},{-24,152},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{-16,148},{-20,148},{-24,148},{-28,148},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{-12,144},{-16,144},{-20,144},{-24,144},{-28,144},{24,140},{20,140},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{-8,140},{-12,140},{-16,140},{-20,140},{-24,140},{-28,140},{20,136},{16,136},{12,136},{8,136},{4,136},{0,136},{-4,136},{-8,136},{-12,136},{-16,136},{-20,136},{-24,136},{-28,136},{20,132},{16,132},{12,132},{8,132},{4,132},{0,132},{-12,132},{-16,132},{-20,132},{-24,132},{-28,132},{16,128},{12,128},{8,128},{4,128},{-20,128},{-24,128},{16,124},{12,124},{4,124},{-20,124},{12,120},{-20,120},{8,116},{-20,116},{4,112},{0,112},{-16,112},{-20,112},{-4,108},{-8,108},{-12,108}};
-const short A_Forward_1[119][2] = {{16,160},{12,160},{8,160},{4,160},{0,160},{-4,160},{-8,160},{-12,160},{20,156},{16,156},{12,156},{8,156},{4,156},{0,156},{-4,156},{-8,156},{-12,156},{-16,156},{-20,156},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{-12,152},{-16,152},{-20,152},{-24,152},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{-16,148},{-20,148},{-24,148},{-28,148},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{-12,144},{-16,144},{-20,144},{-24,144},{-28,144},{24,140},{20,140},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{-8,140},{-12,140},{-16,140},{-20,140},{-24,140},{-28,140},{20,136},{16,136},{12,136},{8,136},{4,136},{0,136},{-4,136},{-8,136},{-12,136},{-16,136},{-20,136},{-24,136},{-28,136},{20,132},{16,132},{12,132},{8,132},{4,132},{0,132},{-12,132},{-16,132},{-20,132},{-24,132},{-28,132},{16,128},{12,128},{8,128},{4,128},{-20,128},{-24,128},{16,124},{12,124},{4,124},{-20,124},{12,120},{-20,120},{8,116},{-20,116},{4,112},{0,112},{-16,112},{-20,112},{-4,108},{-8,108},{-12,108}};
-const short A_Forward_2[119][2] = {{16,160},{12,160},{8,160},{4,160},{0,160},{-4,160},{-8,160},{-12,160},{20,156},{16,156},{12,156},{8,156},{4,156},{0,156},{-4,156},{-8,156},{-12,156},{-16,156},{-20,156},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{-12,152},{-16,152},{-20,152},{-24,152},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{-16,148},{-20,148},{-24,148},{-28,148},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{-12,144},{-16,144},{-20,144},{-24,144},{-28,144},{24,140},{20,140},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{-8,140},{-12,140},{-16,140},{-20,140},{-24,140},{-28,140},{20,136},{16,136},{12,136},{8,136},{4,136},{0,136},{-4,136},{-8,136},{-12,136},{-16,136},{-20,136},{-24,136},{-28,136},{20,132},{16,132},{12,132},{8,132},{4,132},{0,132},{-12,132},{-16,132},{-20,132},{-24,132},{-28,132},{16,128},{12,128},{8,128},{4,128},{-20,128},{-24,128},{16,124},{12,124},{4,124},{-20,124},{12,120},{-20,120},{8,116},{-20,116},{4,112},{0,112},{-16,112},{-20,112},{-4,108},{-8,108},{-12,108}};
-const short A_Forward_3[119][2] = {{20,160},{16,160},{12,160},{8,160},{4,160},{0,160},{-4,160},{-8,160},{24,156},{20,156},{16,156},{12,156},{8,156},{4,156},{0,156},{-4,156},{-8,156},{-12,156},{-16,156},{28,152},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{-12,152},{-16,152},{-20,152},{28,148},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{-16,148},{-20,148},{-24,148},{28,144},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{-12,144},{-16,144},{-20,144},{-24,144},{28,140},{24,140},{20,140},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{-8,140},{-12,140},{-16,140},{-20,140},{-24,140},{24,136},{20,136},{16,136},{12,136},{8,136},{4,136},{0,136},{-4,136},{-8,136},{-12,136},{-16,136},{-20,136},{-24,136},{24,132},{20,132},{16,132},{12,132},{8,132},{4,132},{-8,132},{-12,132},{-16,132},{-20,132},{-24,132},{20,128},{16,128},{12,128},{8,128},{-16,128},{-20,128},{20,124},{16,124},{8,124},{-16,124},{16,120},{-16,120},{12,116},{-16,116},{8,112},{4,112},{-12,112},{-16,112},{0,108},{-4,108},{-8,108}};
-const short A_Forward_4[119][2] = {{20,160},{16,160},{12,160},{8,160},{4,160},{0,160},{-4,160},{-8,160},{24,156},{20,156},{16,156},{12,156},{8,156},{4,156},{0,156},{-4,156},{-8,156},{-12,156},{-16,156},{28,152},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{-12,152},{-16,152},{-20,152},{28,148},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{-16,148},{-20,148},{-24,148},{28,144},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{-12,144},{-16,144},{-20,144},{-24,144},{28,140},{24,140},{20,140},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{-8,140},{-12,140},{-16,140},{-20,140},{-24,140},{24,136},{20,136},{16,136},{12,136},{8,136},{4,136},{0,136},{-4,136},{-8,136},{-12,136},{-16,136},{-20,136},{-24,136},{24,132},{20,132},{16,132},{12,132},{8,132},{4,132},{-8,132},{-12,132},{-16,132},{-20,132},{-24,132},{20,128},{16,128},{12,128},{8,128},{-16,128},{-20,128},{20,124},{16,124},{8,124},{-16,124},{16,120},{-16,120},{12,116},{-16,116},{8,112},{4,112},{-12,112},{-16,112},{0,108},{-4,108},{-8,108}};
-const short A_Forward_5[119][2] = {{16,156},{12,156},{8,156},{4,156},{0,156},{-4,156},{-8,156},{-12,156},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{-12,152},{-16,152},{-20,152},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{-16,148},{-20,148},{-24,148},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{-12,144},{-16,144},{-20,144},{-24,144},{-28,144},{24,140},{20,140},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{-8,140},{-12,140},{-16,140},{-20,140},{-24,140},{-28,140},{24,136},{20,136},{16,136},{12,136},{8,136},{4,136},{0,136},{-4,136},{-8,136},{-12,136},{-16,136},{-20,136},{-24,136},{-28,136},{20,132},{16,132},{12,132},{8,132},{4,132},{0,132},{-4,132},{-8,132},{-12,132},{-16,132},{-20,132},{-24,132},{-28,132},{20,128},{16,128},{12,128},{8,128},{4,128},{0,128},{-12,128},{-16,128},{-20,128},{-24,128},{-28,128},{16,124},{12,124},{8,124},{4,124},{-20,124},{-24,124},{16,120},{12,120},{4,120},{-20,120},{12,116},{-20,116},{8,112},{-20,112},{4,108},{0,108},{-16,108},{-20,108},{-4,104},{-8,104},{-12,104}};
-const short A_Idle_0[119][2] = {{16,160},{12,160},{8,160},{4,160},{0,160},{-4,160},{-8,160},{-12,160},{20,156},{16,156},{12,156},{8,156},{4,156},{0,156},{-4,156},{-8,156},{-12,156},{-16,156},{-20,156},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{-12,152},{-16,152},{-20,152},{-24,152},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{-16,148},{-20,148},{-24,148},{-28,148},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{-12,144},{-16,144},{-20,144},{-24,144},{-28,144},{24,140},{20,140},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{-8,140},{-12,140},{-16,140},{-20,140},{-24,140},{-28,140},{20,136},{16,136},{12,136},{8,136},{4,136},{0,136},{-4,136},{-8,136},{-12,136},{-16,136},{-20,136},{-24,136},{-28,136},{20,132},{16,132},{12,132},{8,132},{4,132},{0,132},{-12,132},{-16,132},{-20,132},{-24,132},{-28,132},{16,128},{12,128},{8,128},{4,128},{-20,128},{-24,128},{16,124},{12,124},{4,124},{-20,124},{12,120},{-20,120},{8,116},{-20,116},{4,112},{0,112},{-16,112},{-20,112},{-4,108},{-8,108},{-12,108}};
-const short A_Idle_1[119][2] = {{16,160},{12,160},{8,160},{4,160},{0,160},{-4,160},{-8,160},{-12,160},{20,156},{16,156},{12,156},{8,156},{4,156},{0,156},{-4,156},{-8,156},{-12,156},{-16,156},{-20,156},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{-12,152},{-16,152},{-20,152},{-24,152},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{-16,148},{-20,148},{-24,148},{-28,148},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{-12,144},{-16,144},{-20,144},{-24,144},{-28,144},{24,140},{20,140},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{-8,140},{-12,140},{-16,140},{-20,140},{-24,140},{-28,140},{20,136},{16,136},{12,136},{8,136},{4,136},{0,136},{-4,136},{-8,136},{-12,136},{-16,136},{-20,136},{-24,136},{-28,136},{20,132},{16,132},{12,132},{8,132},{4,132},{0,132},{-12,132},{-16,132},{-20,132},{-24,132},{-28,132},{16,128},{12,128},{8,128},{4,128},{-20,128},{-24,128},{16,124},{12,124},{4,124},{-20,124},{12,120},{-20,120},{8,116},{-20,116},{4,112},{0,112},{-16,112},{-20,112},{-4,108},{-8,108},{-12,108}};
-const short A_Idle_2[119][2] = {{16,164},{12,164},{8,164},{4,164},{0,164},{-4,164},{-8,164},{-12,164},{20,160},{16,160},{12,160},{8,160},{4,160},{0,160},{-4,160},{-8,160},{-12,160},{-16,160},{-20,160},{24,156},{20,156},{16,156},{12,156},{8,156},{4,156},{0,156},{-4,156},{-8,156},{-12,156},{-16,156},{-20,156},{-24,156},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{-12,152},{-16,152},{-20,152},{-24,152},{-28,152},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{-16,148},{-20,148},{-24,148},{-28,148},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{-12,144},{-16,144},{-20,144},{-24,144},{-28,144},{20,140},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{-8,140},{-12,140},{-16,140},{-20,140},{-24,140},{-28,140},{20,136},{16,136},{12,136},{8,136},{4,136},{0,136},{-12,136},{-16,136},{-20,136},{-24,136},{-28,136},{16,132},{12,132},{8,132},{4,132},{-20,132},{-24,132},{16,128},{12,128},{4,128},{-20,128},{12,124},{-20,124},{8,120},{-20,120},{4,116},{0,116},{-16,116},{-20,116},{-4,112},{-8,112},{-12,112}};
-const short A_Idle_3[119][2] = {{16,164},{12,164},{8,164},{4,164},{0,164},{-4,164},{-8,164},{-12,164},{20,160},{16,160},{12,160},{8,160},{4,160},{0,160},{-4,160},{-8,160},{-12,160},{-16,160},{-20,160},{24,156},{20,156},{16,156},{12,156},{8,156},{4,156},{0,156},{-4,156},{-8,156},{-12,156},{-16,156},{-20,156},{-24,156},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{-12,152},{-16,152},{-20,152},{-24,152},{-28,152},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{-16,148},{-20,148},{-24,148},{-28,148},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{-12,144},{-16,144},{-20,144},{-24,144},{-28,144},{20,140},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{-8,140},{-12,140},{-16,140},{-20,140},{-24,140},{-28,140},{20,136},{16,136},{12,136},{8,136},{4,136},{0,136},{-12,136},{-16,136},{-20,136},{-24,136},{-28,136},{16,132},{12,132},{8,132},{4,132},{-20,132},{-24,132},{16,128},{12,128},{4,128},{-20,128},{12,124},{-20,124},{8,120},{-20,120},{4,116},{0,116},{-16,116},{-20,116},{-4,112},{-8,112},{-12,112}};
-const short A_Idle_4[119][2] = {{16,160},{12,160},{8,160},{4,160},{0,160},{-4,160},{-8,160},{-12,160},{20,156},{16,156},{12,156},{8,156},{4,156},{0,156},{-4,156},{-8,156},{-12,156},{-16,156},{-20,156},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{-12,152},{-16,152},{-20,152},{-24,152},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{-16,148},{-20,148},{-24,148},{-28,148},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{-12,144},{-16,144},{-20,144},{-24,144},{-28,144},{24,140},{20,140},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{-8,140},{-12,140},{-16,140},{-20,140},{-24,140},{-28,140},{20,136},{16,136},{12,136},{8,136},{4,136},{0,136},{-4,136},{-8,136},{-12,136},{-16,136},{-20,136},{-24,136},{-28,136},{20,132},{16,132},{12,132},{8,132},{4,132},{0,132},{-12,132},{-16,132},{-20,132},{-24,132},{-28,132},{16,128},{12,128},{8,128},{4,128},{-20,128},{-24,128},{16,124},{12,124},{4,124},{-20,124},{12,120},{-20,120},{8,116},{-20,116},{4,112},{0,112},{-16,112},{-20,112},{-4,108},{-8,108},{-12,108}};
-const short A_Jump_0[119][2] = {{-4,140},{-8,140},{-12,140},{-16,140},{-20,140},{-24,140},{-28,140},{-32,140},{0,136},{-4,136},{-8,136},{-12,136},{-16,136},{-20,136},{-24,136},{-28,136},{-32,136},{-36,136},{-40,136},{4,132},{0,132},{-4,132},{-8,132},{-12,132},{-16,132},{-20,132},{-24,132},{-28,132},{-32,132},{-36,132},{-40,132},{-44,132},{4,128},{0,128},{-4,128},{-8,128},{-12,128},{-16,128},{-20,128},{-24,128},{-28,128},{-32,128},{-36,128},{-40,128},{-44,128},{-48,128},{4,124},{0,124},{-4,124},{-8,124},{-12,124},{-16,124},{-20,124},{-24,124},{-28,124},{-32,124},{-36,124},{-40,124},{-44,124},{-48,124},{4,120},{0,120},{-4,120},{-8,120},{-12,120},{-16,120},{-20,120},{-24,120},{-28,120},{-32,120},{-36,120},{-40,120},{-44,120},{-48,120},{0,116},{-4,116},{-8,116},{-12,116},{-16,116},{-20,116},{-24,116},{-28,116},{-32,116},{-36,116},{-40,116},{-44,116},{-48,116},{0,112},{-4,112},{-8,112},{-12,112},{-16,112},{-20,112},{-32,112},{-36,112},{-40,112},{-44,112},{-48,112},{-4,108},{-8,108},{-12,108},{-16,108},{-40,108},{-44,108},{-4,104},{-8,104},{-16,104},{-40,104},{-8,100},{-40,100},{-12,96},{-40,96},{-16,92},{-20,92},{-36,92},{-40,92},{-24,88},{-28,88},{-32,88}};
-const short A_Jump_1[119][2] = {{-8,156},{-12,156},{-16,156},{-20,156},{-24,156},{-28,156},{-32,156},{-36,156},{-4,152},{-8,152},{-12,152},{-16,152},{-20,152},{-24,152},{-28,152},{-32,152},{-36,152},{-40,152},{-44,152},{0,148},{-4,148},{-8,148},{-12,148},{-16,148},{-20,148},{-24,148},{-28,148},{-32,148},{-36,148},{-40,148},{-44,148},{-48,148},{0,144},{-4,144},{-8,144},{-12,144},{-16,144},{-20,144},{-24,144},{-28,144},{-32,144},{-36,144},{-40,144},{-44,144},{-48,144},{-52,144},{0,140},{-4,140},{-8,140},{-12,140},{-16,140},{-20,140},{-24,140},{-28,140},{-32,140},{-36,140},{-40,140},{-44,140},{-48,140},{-52,140},{0,136},{-4,136},{-8,136},{-12,136},{-16,136},{-20,136},{-24,136},{-28,136},{-32,136},{-36,136},{-40,136},{-44,136},{-48,136},{-52,136},{-4,132},{-8,132},{-12,132},{-16,132},{-20,132},{-24,132},{-28,132},{-32,132},{-36,132},{-40,132},{-44,132},{-48,132},{-52,132},{-4,128},{-8,128},{-12,128},{-16,128},{-20,128},{-24,128},{-36,128},{-40,128},{-44,128},{-48,128},{-52,128},{-8,124},{-12,124},{-16,124},{-20,124},{-44,124},{-48,124},{-8,120},{-12,120},{-20,120},{-44,120},{-12,116},{-44,116},{-16,112},{-44,112},{-20,108},{-24,108},{-40,108},{-44,108},{-28,104},{-32,104},{-36,104}};
-const short A_Jump_2[119][2] = {{20,176},{16,176},{12,176},{8,176},{4,176},{0,176},{-4,176},{-8,176},{24,172},{20,172},{16,172},{12,172},{8,172},{4,172},{0,172},{-4,172},{-8,172},{-12,172},{-16,172},{28,168},{24,168},{20,168},{16,168},{12,168},{8,168},{4,168},{0,168},{-4,168},{-8,168},{-12,168},{-16,168},{-20,168},{28,164},{24,164},{20,164},{16,164},{12,164},{8,164},{4,164},{0,164},{-4,164},{-8,164},{-12,164},{-16,164},{-20,164},{-24,164},{28,160},{24,160},{20,160},{16,160},{12,160},{8,160},{4,160},{0,160},{-4,160},{-8,160},{-12,160},{-16,160},{-20,160},{-24,160},{28,156},{24,156},{20,156},{16,156},{12,156},{8,156},{4,156},{0,156},{-4,156},{-8,156},{-12,156},{-16,156},{-20,156},{-24,156},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{-12,152},{-16,152},{-20,152},{-24,152},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{-8,148},{-12,148},{-16,148},{-20,148},{-24,148},{20,144},{16,144},{12,144},{8,144},{-16,144},{-20,144},{20,140},{16,140},{8,140},{-16,140},{16,136},{-16,136},{12,132},{-16,132},{8,128},{4,128},{-12,128},{-16,128},{0,124},{-4,124},{-8,124}};
-const short A_Land_0[119][2] = {{20,168},{16,168},{12,168},{8,168},{4,168},{0,168},{-4,168},{-8,168},{24,164},{20,164},{16,164},{12,164},{8,164},{4,164},{0,164},{-4,164},{-8,164},{-12,164},{-16,164},{28,160},{24,160},{20,160},{16,160},{12,160},{8,160},{4,160},{0,160},{-4,160},{-8,160},{-12,160},{-16,160},{-20,160},{28,156},{24,156},{20,156},{16,156},{12,156},{8,156},{4,156},{0,156},{-4,156},{-8,156},{-12,156},{-16,156},{-20,156},{-24,156},{28,152},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{-12,152},{-16,152},{-20,152},{-24,152},{28,148},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{-16,148},{-20,148},{-24,148},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{-12,144},{-16,144},{-20,144},{-24,144},{24,140},{20,140},{16,140},{12,140},{8,140},{4,140},{-8,140},{-12,140},{-16,140},{-20,140},{-24,140},{20,136},{16,136},{12,136},{8,136},{-16,136},{-20,136},{20,132},{16,132},{8,132},{-16,132},{16,128},{-16,128},{12,124},{-16,124},{8,120},{4,120},{-12,120},{-16,120},{0,116},{-4,116},{-8,116}};
-const short A_Land_1[119][2] = {{4,112},{0,112},{-4,112},{-8,112},{-12,112},{-16,112},{-20,112},{-24,112},{8,108},{4,108},{0,108},{-4,108},{-8,108},{-12,108},{-16,108},{-20,108},{-24,108},{-28,108},{-32,108},{12,104},{8,104},{4,104},{0,104},{-4,104},{-8,104},{-12,104},{-16,104},{-20,104},{-24,104},{-28,104},{-32,104},{-36,104},{12,100},{8,100},{4,100},{0,100},{-4,100},{-8,100},{-12,100},{-16,100},{-20,100},{-24,100},{-28,100},{-32,100},{-36,100},{-40,100},{12,96},{8,96},{4,96},{0,96},{-4,96},{-8,96},{-12,96},{-16,96},{-20,96},{-24,96},{-28,96},{-32,96},{-36,96},{-40,96},{12,92},{8,92},{4,92},{0,92},{-4,92},{-8,92},{-12,92},{-16,92},{-20,92},{-24,92},{-28,92},{-32,92},{-36,92},{-40,92},{8,88},{4,88},{0,88},{-4,88},{-8,88},{-12,88},{-16,88},{-20,88},{-24,88},{-28,88},{-32,88},{-36,88},{-40,88},{8,84},{4,84},{0,84},{-4,84},{-8,84},{-12,84},{-24,84},{-28,84},{-32,84},{-36,84},{-40,84},{4,80},{0,80},{-4,80},{-8,80},{-32,80},{-36,80},{4,76},{0,76},{-8,76},{-32,76},{0,72},{-32,72},{-4,68},{-32,68},{-8,64},{-12,64},{-28,64},{-32,64},{-16,60},{-20,60},{-24,60}};
-const short A_Land_2[119][2] = {{16,120},{12,120},{8,120},{4,120},{0,120},{-4,120},{-8,120},{-12,120},{20,116},{16,116},{12,116},{8,116},{4,116},{0,116},{-4,116},{-8,116},{-12,116},{-16,116},{-20,116},{24,112},{20,112},{16,112},{12,112},{8,112},{4,112},{0,112},{-4,112},{-8,112},{-12,112},{-16,112},{-20,112},{-24,112},{24,108},{20,108},{16,108},{12,108},{8,108},{4,108},{0,108},{-4,108},{-8,108},{-12,108},{-16,108},{-20,108},{-24,108},{-28,108},{24,104},{20,104},{16,104},{12,104},{8,104},{4,104},{0,104},{-4,104},{-8,104},{-12,104},{-16,104},{-20,104},{-24,104},{-28,104},{24,100},{20,100},{16,100},{12,100},{8,100},{4,100},{0,100},{-4,100},{-8,100},{-12,100},{-16,100},{-20,100},{-24,100},{-28,100},{20,96},{16,96},{12,96},{8,96},{4,96},{0,96},{-4,96},{-8,96},{-12,96},{-16,96},{-20,96},{-24,96},{-28,96},{20,92},{16,92},{12,92},{8,92},{4,92},{0,92},{-12,92},{-16,92},{-20,92},{-24,92},{-28,92},{16,88},{12,88},{8,88},{4,88},{-20,88},{-24,88},{16,84},{12,84},{4,84},{-20,84},{12,80},{-20,80},{8,76},{-20,76},{4,72},{0,72},{-16,72},{-20,72},{-4,68},{-8,68},{-12,68}};
-const short A_StandGuard_0[118][2] = {{24,160},{20,160},{16,160},{12,160},{8,160},{4,160},{0,160},{-4,160},{28,156},{24,156},{20,156},{16,156},{12,156},{8,156},{4,156},{0,156},{-4,156},{-8,156},{-12,156},{32,152},{28,152},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{-12,152},{-16,152},{32,148},{28,148},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{-16,148},{-20,148},{32,144},{28,144},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{-12,144},{-16,144},{-20,144},{32,140},{28,140},{24,140},{20,140},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{-8,140},{-12,140},{-16,140},{-20,140},{28,136},{24,136},{20,136},{16,136},{12,136},{8,136},{4,136},{0,136},{-4,136},{-8,136},{-12,136},{-16,136},{-20,136},{28,132},{24,132},{20,132},{16,132},{12,132},{8,132},{-4,132},{-8,132},{-12,132},{-16,132},{-20,132},{24,128},{20,128},{16,128},{12,128},{-12,128},{-16,128},{24,124},{20,124},{12,124},{-12,124},{20,120},{-12,120},{16,116},{-8,116},{-12,116},{12,112},{8,112},{-4,112},{4,108},{0,108}};
-const short A_StandGuard_1[120][2] = {{28,160},{24,160},{20,160},{16,160},{12,160},{8,160},{4,160},{0,160},{32,156},{28,156},{24,156},{20,156},{16,156},{12,156},{8,156},{4,156},{0,156},{-4,156},{-8,156},{36,152},{32,152},{28,152},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{-12,152},{36,148},{32,148},{28,148},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{-16,148},{36,144},{32,144},{28,144},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{-12,144},{-16,144},{36,140},{32,140},{28,140},{24,140},{20,140},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{-8,140},{-12,140},{-16,140},{32,136},{28,136},{24,136},{20,136},{16,136},{12,136},{8,136},{4,136},{0,136},{-4,136},{-8,136},{-12,136},{-16,136},{32,132},{28,132},{24,132},{20,132},{16,132},{12,132},{0,132},{-4,132},{-8,132},{-12,132},{-16,132},{28,128},{24,128},{20,128},{16,128},{-8,128},{-12,128},{28,124},{24,124},{16,124},{-8,124},{24,120},{-8,120},{20,116},{0,116},{-4,116},{-8,116},{16,112},{12,112},{4,112},{0,112},{8,108},{4,108}};
-const short C1_Attack_0_0[132][2] = {{32,96},{28,96},{24,96},{36,92},{40,88},{40,84},{36,80},{-40,80},{-44,80},{-48,80},{36,76},{28,76},{24,76},{20,76},{16,76},{12,76},{-20,76},{-24,76},{-28,76},{-36,76},{-52,76},{32,72},{28,72},{8,72},{4,72},{0,72},{-4,72},{-8,72},{-12,72},{-16,72},{-28,72},{-32,72},{-52,72},{28,68},{-28,68},{-52,68},{28,64},{-28,64},{-48,64},{28,60},{-20,60},{-24,60},{-28,60},{-44,60},{24,56},{12,56},{-8,56},{-12,56},{-16,56},{-32,56},{-36,56},{-40,56},{20,52},{8,52},{4,52},{0,52},{-4,52},{-24,52},{-28,52},{20,48},{-24,48},{20,44},{-28,44},{-32,44},{-36,44},{24,40},{-20,40},{-24,40},{-40,40},{24,36},{4,36},{0,36},{-4,36},{-8,36},{-12,36},{-16,36},{-44,36},{28,32},{20,32},{16,32},{12,32},{8,32},{-4,32},{-44,32},{32,28},{0,28},{-8,28},{-44,28},{40,24},{36,24},{0,24},{-12,24},{-16,24},{-44,24},{56,20},{52,20},{48,20},{44,20},{4,20},{-20,20},{-44,20},{60,16},{8,16},{-16,16},{-44,16},{64,12},{20,12},{16,12},{12,12},{-16,12},{-40,12},{68,8},{36,8},{32,8},{28,8},{24,8},{-20,8},{-44,8},{68,4},{64,4},{60,4},{56,4},{52,4},{48,4},{44,4},{40,4},{-24,4},{-28,4},{-32,4},{-36,4},{-40,4},{-44,4}};
-const short C1_Attack_0_1[109][2] = {{36,92},{32,92},{28,92},{40,88},{44,84},{44,80},{-36,80},{-40,80},{-44,80},{40,76},{-32,76},{-48,76},{40,72},{32,72},{28,72},{24,72},{20,72},{16,72},{-20,72},{-24,72},{-28,72},{-48,72},{36,68},{12,68},{8,68},{4,68},{-48,68},{40,64},{-44,64},{40,60},{-40,60},{44,56},{-28,56},{-32,56},{-36,56},{44,52},{20,52},{-24,52},{48,48},{24,48},{20,48},{-24,48},{48,44},{28,44},{20,44},{-28,44},{-32,44},{-36,44},{48,40},{28,40},{20,40},{-20,40},{-24,40},{-40,40},{48,36},{32,36},{16,36},{12,36},{8,36},{4,36},{0,36},{-4,36},{-8,36},{-12,36},{-16,36},{-40,36},{48,32},{32,32},{16,32},{-12,32},{-40,32},{48,28},{32,28},{20,28},{-16,28},{-40,28},{44,24},{40,24},{36,24},{24,24},{-16,24},{-40,24},{28,20},{-16,20},{-40,20},{28,16},{-12,16},{-16,16},{-40,16},{28,12},{-8,12},{-12,12},{-36,12},{24,8},{20,8},{16,8},{12,8},{8,8},{4,8},{0,8},{-4,8},{-16,8},{-40,8},{-20,4},{-24,4},{-28,4},{-32,4},{-36,4},{-40,4}};
-const short C1_Attack_0_2[133][2] = {{56,76},{52,76},{48,76},{60,72},{-4,72},{64,68},{-4,68},{64,64},{-4,64},{60,60},{0,60},{60,56},{48,56},{44,56},{40,56},{36,56},{0,56},{56,52},{52,52},{48,52},{32,52},{28,52},{24,52},{-4,52},{-20,52},{-24,52},{-28,52},{-32,52},{52,48},{-8,48},{-12,48},{-16,48},{-36,48},{56,44},{-12,44},{-40,44},{56,40},{-16,40},{-40,40},{60,36},{40,36},{36,36},{32,36},{-16,36},{-40,36},{60,32},{40,32},{28,32},{-20,32},{-24,32},{-40,32},{60,28},{44,28},{40,28},{24,28},{-20,28},{-28,28},{-32,28},{-36,28},{-40,28},{-44,28},{-92,28},{-96,28},{64,24},{44,24},{24,24},{-20,24},{-48,24},{-52,24},{-56,24},{-60,24},{-64,24},{-68,24},{-72,24},{-76,24},{-80,24},{-84,24},{-88,24},{-100,24},{64,20},{48,20},{20,20},{-20,20},{-88,20},{-100,20},{64,16},{48,16},{16,16},{-16,16},{-100,16},{72,12},{68,12},{48,12},{12,12},{-12,12},{-100,12},{76,8},{52,8},{12,8},{-8,8},{-100,8},{76,4},{72,4},{68,4},{64,4},{60,4},{56,4},{8,4},{4,4},{0,4},{-4,4},{-12,4},{-16,4},{-20,4},{-24,4},{-28,4},{-32,4},{-36,4},{-40,4},{-44,4},{-48,4},{-52,4},{-56,4},{-60,4},{-64,4},{-68,4},{-72,4},{-76,4},{-80,4},{-84,4},{-88,4},{-92,4},{-96,4}};
-const short C1_Attack_0_3[126][2] = {{-16,88},{-20,88},{-24,88},{-12,84},{-28,84},{52,80},{48,80},{44,80},{-28,80},{56,76},{-28,76},{60,72},{-20,72},{-24,72},{60,68},{-16,68},{56,64},{-8,64},{-12,64},{56,60},{40,60},{36,60},{32,60},{-4,60},{52,56},{48,56},{44,56},{28,56},{24,56},{20,56},{0,56},{44,52},{-4,52},{48,48},{-8,48},{-12,48},{-16,48},{-20,48},{-24,48},{52,44},{4,44},{0,44},{-4,44},{-28,44},{-32,44},{52,40},{8,40},{-8,40},{-12,40},{-36,40},{-40,40},{56,36},{36,36},{32,36},{8,36},{-16,36},{-20,36},{-40,36},{56,32},{36,32},{28,32},{12,32},{-24,32},{-28,32},{-32,32},{-40,32},{56,28},{40,28},{36,28},{24,28},{12,28},{-36,28},{-40,28},{60,24},{40,24},{24,24},{12,24},{-44,24},{-48,24},{60,20},{44,20},{24,20},{16,20},{-52,20},{60,16},{44,16},{24,16},{16,16},{12,16},{8,16},{4,16},{0,16},{-4,16},{-8,16},{-12,16},{-16,16},{-52,16},{68,12},{64,12},{44,12},{20,12},{-4,12},{-20,12},{-24,12},{-28,12},{-32,12},{-36,12},{-40,12},{-44,12},{-48,12},{-52,12},{72,8},{48,8},{-4,8},{-28,8},{72,4},{68,4},{64,4},{60,4},{56,4},{52,4},{-8,4},{-12,4},{-16,4},{-20,4},{-24,4}};
-const short C1_Attack_0_4[109][2] = {{36,92},{32,92},{28,92},{40,88},{44,84},{44,80},{-36,80},{-40,80},{-44,80},{40,76},{-32,76},{-48,76},{40,72},{32,72},{28,72},{24,72},{20,72},{16,72},{-20,72},{-24,72},{-28,72},{-48,72},{36,68},{12,68},{8,68},{4,68},{-48,68},{40,64},{-44,64},{40,60},{-40,60},{44,56},{-28,56},{-32,56},{-36,56},{44,52},{20,52},{-24,52},{48,48},{24,48},{20,48},{-24,48},{48,44},{28,44},{20,44},{-28,44},{-32,44},{-36,44},{48,40},{28,40},{20,40},{-12,40},{-16,40},{-20,40},{-24,40},{-40,40},{48,36},{32,36},{16,36},{12,36},{8,36},{4,36},{0,36},{-4,36},{-8,36},{-40,36},{48,32},{32,32},{16,32},{-12,32},{-40,32},{48,28},{32,28},{20,28},{-16,28},{-40,28},{44,24},{40,24},{36,24},{24,24},{-16,24},{-40,24},{28,20},{-16,20},{-40,20},{28,16},{-12,16},{-16,16},{-40,16},{28,12},{-8,12},{-12,12},{-36,12},{24,8},{20,8},{16,8},{12,8},{8,8},{4,8},{0,8},{-4,8},{-16,8},{-40,8},{-20,4},{-24,4},{-28,4},{-32,4},{-36,4},{-40,4}};
-const short C1_Attack_1_0[128][2] = {{24,144},{20,144},{28,140},{32,136},{32,132},{36,128},{36,124},{28,124},{24,124},{-24,124},{-28,124},{-32,124},{36,120},{32,120},{20,120},{-36,120},{40,116},{16,116},{-40,116},{44,112},{12,112},{8,112},{-44,112},{48,108},{24,108},{4,108},{0,108},{-32,108},{-36,108},{-48,108},{48,104},{24,104},{20,104},{-20,104},{-24,104},{-28,104},{-48,104},{48,100},{28,100},{24,100},{20,100},{-20,100},{-28,100},{-48,100},{44,96},{40,96},{36,96},{32,96},{20,96},{-20,96},{-28,96},{-48,96},{20,92},{-20,92},{-32,92},{-36,92},{-40,92},{-44,92},{24,88},{-20,88},{24,84},{-20,84},{24,80},{20,80},{-20,80},{28,76},{16,76},{-20,76},{32,72},{12,72},{-24,72},{36,68},{8,68},{4,68},{-24,68},{40,64},{8,64},{0,64},{-4,64},{-8,64},{-12,64},{-16,64},{-20,64},{40,60},{12,60},{-16,60},{44,56},{12,56},{-16,56},{44,52},{12,52},{-16,52},{40,48},{12,48},{-16,48},{40,44},{16,44},{-12,44},{36,40},{16,40},{-12,40},{36,36},{16,36},{-12,36},{32,32},{16,32},{-12,32},{28,28},{16,28},{-12,28},{24,24},{16,24},{-12,24},{20,20},{12,20},{-12,20},{16,16},{12,16},{-12,16},{8,12},{-8,12},{12,8},{-8,8},{12,4},{8,4},{4,4},{0,4},{-4,4}};
-const short C1_Attack_1_1[134][2] = {{24,132},{20,132},{32,128},{28,128},{36,124},{36,120},{28,120},{-24,120},{-28,120},{-32,120},{-36,120},{36,116},{32,116},{24,116},{-40,116},{44,112},{40,112},{36,112},{20,112},{16,112},{-44,112},{48,108},{12,108},{8,108},{-48,108},{52,104},{-36,104},{-40,104},{-52,104},{56,100},{32,100},{20,100},{-20,100},{-24,100},{-28,100},{-32,100},{-52,100},{56,96},{32,96},{28,96},{24,96},{20,96},{-20,96},{-32,96},{-52,96},{56,92},{36,92},{20,92},{-20,92},{-32,92},{-52,92},{52,88},{48,88},{44,88},{40,88},{20,88},{-20,88},{-36,88},{-40,88},{-44,88},{-48,88},{20,84},{-20,84},{20,80},{-20,80},{20,76},{-20,76},{20,72},{-24,72},{24,68},{-24,68},{20,64},{16,64},{-8,64},{-12,64},{-16,64},{-20,64},{20,60},{12,60},{8,60},{4,60},{0,60},{-4,60},{-20,60},{20,56},{8,56},{-16,56},{20,52},{8,52},{-16,52},{-20,52},{16,48},{12,48},{-16,48},{-24,48},{12,44},{-12,44},{-28,44},{12,40},{-12,40},{-32,40},{12,36},{-12,36},{-36,36},{12,32},{-12,32},{-40,32},{12,28},{-12,28},{-16,28},{-20,28},{-40,28},{12,24},{-12,24},{-20,24},{-36,24},{12,20},{-12,20},{-20,20},{-32,20},{12,16},{-12,16},{-24,16},{-28,16},{12,12},{-8,12},{16,8},{-8,8},{16,4},{12,4},{8,4},{4,4},{0,4},{-4,4}};
-const short C1_Attack_1_2[135][2] = {{28,128},{24,128},{36,124},{32,124},{40,120},{40,116},{32,116},{-20,116},{-24,116},{-28,116},{-32,116},{48,112},{44,112},{40,112},{36,112},{28,112},{-36,112},{52,108},{24,108},{20,108},{-40,108},{56,104},{16,104},{12,104},{-44,104},{60,100},{36,100},{24,100},{-32,100},{-36,100},{-48,100},{60,96},{36,96},{32,96},{28,96},{24,96},{-20,96},{-24,96},{-28,96},{-48,96},{60,92},{40,92},{24,92},{-20,92},{-28,92},{-48,92},{56,88},{52,88},{48,88},{44,88},{20,88},{-20,88},{-28,88},{-48,88},{20,84},{-20,84},{-32,84},{-36,84},{-40,84},{-44,84},{20,80},{-20,80},{20,76},{-24,76},{24,72},{-24,72},{24,68},{-28,68},{20,64},{16,64},{12,64},{-12,64},{-16,64},{-20,64},{-24,64},{16,60},{8,60},{4,60},{0,60},{-4,60},{-8,60},{-24,60},{16,56},{8,56},{-24,56},{12,52},{8,52},{-20,52},{12,48},{-16,48},{-20,48},{12,44},{-12,44},{-16,44},{-24,44},{12,40},{-12,40},{-24,40},{12,36},{-12,36},{-28,36},{16,32},{-8,32},{-32,32},{16,28},{-8,28},{-36,28},{16,24},{-8,24},{-12,24},{-36,24},{16,20},{-4,20},{-16,20},{-36,20},{16,16},{-4,16},{-20,16},{-36,16},{16,12},{0,12},{-20,12},{-36,12},{20,8},{0,8},{-20,8},{-36,8},{20,4},{16,4},{12,4},{8,4},{4,4},{-24,4},{-28,4},{-32,4}};
-const short C1_Attack_1_3[128][2] = {{40,132},{36,132},{32,132},{44,128},{44,124},{48,120},{48,116},{40,116},{36,116},{48,112},{44,112},{32,112},{-12,112},{-16,112},{-20,112},{-24,112},{48,108},{28,108},{-28,108},{52,104},{24,104},{20,104},{-32,104},{52,100},{16,100},{12,100},{-36,100},{56,96},{36,96},{32,96},{-24,96},{-28,96},{-40,96},{60,92},{36,92},{32,92},{-16,92},{-20,92},{-40,92},{60,88},{40,88},{32,88},{-20,88},{-40,88},{60,84},{40,84},{28,84},{-20,84},{-40,84},{56,80},{52,80},{48,80},{44,80},{24,80},{-20,80},{-24,80},{-28,80},{-32,80},{-36,80},{28,76},{-20,76},{28,72},{24,72},{20,72},{-20,72},{20,68},{16,68},{12,68},{8,68},{-24,68},{24,64},{20,64},{4,64},{-24,64},{28,60},{0,60},{-4,60},{-8,60},{-12,60},{-16,60},{-20,60},{28,56},{-24,56},{32,52},{4,52},{-24,52},{32,48},{0,48},{-4,48},{-8,48},{-24,48},{28,44},{0,44},{-24,44},{28,40},{0,40},{-4,40},{-24,40},{24,36},{-8,36},{-28,36},{20,32},{-12,32},{-32,32},{16,28},{-12,28},{-36,28},{12,24},{-16,24},{-36,24},{8,20},{4,20},{-16,20},{-40,20},{0,16},{-4,16},{-8,16},{-12,16},{-20,16},{-40,16},{-20,12},{-40,12},{-20,8},{-40,8},{-24,4},{-28,4},{-32,4},{-36,4}};
-const short C1_Attack_1_4[115][2] = {{56,116},{60,112},{12,112},{8,112},{4,112},{0,112},{60,108},{-4,108},{64,104},{52,104},{-8,104},{64,100},{56,100},{48,100},{44,100},{40,100},{-8,100},{64,96},{56,96},{40,96},{36,96},{20,96},{-8,96},{60,92},{32,92},{24,92},{-4,92},{-8,92},{60,88},{32,88},{24,88},{4,88},{0,88},{-4,88},{60,84},{36,84},{20,84},{16,84},{12,84},{8,84},{-8,84},{60,80},{40,80},{36,80},{-12,80},{56,76},{52,76},{48,76},{44,76},{32,76},{-12,76},{32,72},{28,72},{8,72},{4,72},{0,72},{-4,72},{-8,72},{-12,72},{-16,72},{32,68},{24,68},{20,68},{16,68},{12,68},{-20,68},{36,64},{-24,64},{36,60},{-24,60},{36,56},{-24,56},{36,52},{-12,52},{-24,52},{36,48},{20,48},{16,48},{12,48},{8,48},{4,48},{0,48},{-4,48},{-8,48},{-12,48},{-24,48},{32,44},{28,44},{24,44},{12,44},{-12,44},{-16,44},{-20,44},{8,40},{-12,40},{4,36},{-16,36},{0,32},{-20,32},{0,28},{-20,28},{-4,24},{-24,24},{-4,20},{-24,20},{-4,16},{-28,16},{-8,12},{-28,12},{-8,8},{-28,8},{-12,4},{-16,4},{-20,4},{-24,4}};
-const short C1_Attack_1_5[172][2] = {{-96,128},{-100,128},{-104,128},{-108,128},{36,124},{32,124},{28,124},{-92,124},{-112,124},{24,120},{-24,120},{-28,120},{-32,120},{-36,120},{-84,120},{-88,120},{-112,120},{20,116},{-20,116},{-40,116},{-72,116},{-76,116},{-80,116},{-112,116},{20,112},{-20,112},{-40,112},{-56,112},{-60,112},{-64,112},{-68,112},{-112,112},{28,108},{24,108},{20,108},{16,108},{12,108},{8,108},{4,108},{0,108},{-4,108},{-8,108},{-12,108},{-16,108},{-36,108},{-48,108},{-52,108},{-112,108},{36,104},{32,104},{-32,104},{-36,104},{-40,104},{-44,104},{-112,104},{40,100},{-24,100},{-28,100},{-96,100},{-100,100},{-112,100},{44,96},{-16,96},{-20,96},{-84,96},{-88,96},{-92,96},{-104,96},{-108,96},{52,92},{48,92},{40,92},{36,92},{32,92},{28,92},{24,92},{20,92},{16,92},{12,92},{8,92},{4,92},{0,92},{-4,92},{-8,92},{-12,92},{-16,92},{-64,92},{-68,92},{-72,92},{-76,92},{-80,92},{64,88},{60,88},{56,88},{-16,88},{-56,88},{-60,88},{60,84},{-16,84},{-40,84},{-44,84},{-48,84},{-52,84},{56,80},{-12,80},{-32,80},{-36,80},{52,76},{-12,76},{-28,76},{48,72},{44,72},{40,72},{36,72},{32,72},{28,72},{24,72},{20,72},{-8,72},{-24,72},{48,68},{24,68},{16,68},{-4,68},{-24,68},{44,64},{28,64},{16,64},{4,64},{0,64},{-24,64},{40,60},{36,60},{32,60},{12,60},{8,60},{4,60},{-24,60},{4,56},{-24,56},{4,52},{-24,52},{4,48},{-24,48},{4,44},{-20,44},{4,40},{-20,40},{4,36},{-20,36},{4,32},{-20,32},{4,28},{-20,28},{4,24},{-20,24},{4,20},{-16,20},{4,16},{-16,16},{8,12},{-16,12},{12,8},{-16,8},{16,4},{12,4},{8,4},{4,4},{0,4},{-4,4},{-8,4},{-12,4}};
-const short C1_Attack_1_6[152][2] = {{64,124},{24,124},{20,124},{16,124},{12,124},{8,124},{4,124},{0,124},{-4,124},{-8,124},{-12,124},{-16,124},{68,120},{-20,120},{72,116},{-24,116},{72,112},{12,112},{-28,112},{76,108},{60,108},{56,108},{8,108},{4,108},{0,108},{-12,108},{-28,108},{76,104},{64,104},{52,104},{48,104},{44,104},{40,104},{4,104},{0,104},{-8,104},{-28,104},{72,100},{64,100},{48,100},{36,100},{0,100},{-4,100},{-8,100},{-28,100},{68,96},{32,96},{0,96},{-12,96},{-28,96},{72,92},{32,92},{-4,92},{-16,92},{-20,92},{-24,92},{72,88},{40,88},{36,88},{-8,88},{-12,88},{72,84},{48,84},{44,84},{40,84},{-12,84},{68,80},{56,80},{52,80},{36,80},{-8,80},{-16,80},{64,76},{60,76},{36,76},{-4,76},{-20,76},{32,72},{28,72},{24,72},{8,72},{4,72},{0,72},{-24,72},{32,68},{20,68},{16,68},{12,68},{4,68},{-28,68},{-32,68},{-36,68},{32,64},{4,64},{0,64},{-40,64},{32,60},{4,60},{-4,60},{-44,60},{-48,60},{32,56},{4,56},{-8,56},{-52,56},{32,52},{4,52},{-12,52},{-56,52},{32,48},{4,48},{-16,48},{-20,48},{-24,48},{-28,48},{-32,48},{-36,48},{-60,48},{32,44},{4,44},{-40,44},{-60,44},{32,40},{4,40},{-40,40},{-60,40},{32,36},{0,36},{-44,36},{-48,36},{-52,36},{-56,36},{32,32},{0,32},{28,28},{0,28},{24,24},{0,24},{20,20},{0,20},{20,16},{0,16},{24,12},{0,12},{28,8},{4,8},{24,4},{20,4},{16,4},{12,4},{8,4},{4,4}};
-const short C1_Attack_1_7[134][2] = {{40,128},{44,124},{48,120},{48,116},{-4,116},{48,112},{36,112},{32,112},{20,112},{-8,112},{-12,112},{48,108},{40,108},{28,108},{24,108},{-16,108},{44,104},{16,104},{12,104},{-20,104},{44,100},{24,100},{20,100},{8,100},{-20,100},{44,96},{4,96},{-20,96},{44,92},{4,92},{0,92},{-4,92},{-20,92},{40,88},{8,88},{4,88},{-20,88},{40,84},{36,84},{20,84},{16,84},{12,84},{4,84},{-20,84},{36,80},{32,80},{28,80},{24,80},{4,80},{0,80},{-16,80},{32,76},{0,76},{-4,76},{-8,76},{-12,76},{32,72},{-12,72},{36,68},{-16,68},{36,64},{-16,64},{32,60},{28,60},{24,60},{20,60},{-12,60},{32,56},{16,56},{12,56},{8,56},{4,56},{0,56},{-4,56},{-8,56},{-16,56},{32,52},{8,52},{-20,52},{36,48},{12,48},{4,48},{-20,48},{36,44},{12,44},{4,44},{-20,44},{40,40},{12,40},{4,40},{-20,40},{40,36},{16,36},{4,36},{-24,36},{40,32},{16,32},{0,32},{-24,32},{40,28},{16,28},{0,28},{-28,28},{40,24},{20,24},{0,24},{-28,24},{44,20},{20,20},{-4,20},{-28,20},{44,16},{20,16},{-8,16},{-32,16},{48,12},{24,12},{-8,12},{-36,12},{48,8},{24,8},{-12,8},{-36,8},{44,4},{40,4},{36,4},{32,4},{28,4},{24,4},{-16,4},{-20,4},{-24,4},{-28,4},{-32,4}};
-const short C1_Attack_3_0[130][2] = {{12,108},{8,108},{4,108},{16,104},{20,100},{20,96},{16,96},{12,96},{8,96},{4,96},{0,96},{28,92},{24,92},{-4,92},{-8,92},{36,88},{32,88},{40,84},{-32,84},{44,80},{0,80},{-4,80},{-32,80},{44,76},{24,76},{20,76},{16,76},{12,76},{8,76},{4,76},{-28,76},{-32,76},{48,72},{28,72},{16,72},{-28,72},{-36,72},{48,68},{24,68},{20,68},{-24,68},{-40,68},{48,64},{28,64},{20,64},{-20,64},{-40,64},{44,60},{40,60},{36,60},{32,60},{20,60},{-16,60},{-40,60},{20,56},{-16,56},{-20,56},{-24,56},{-28,56},{-32,56},{-36,56},{20,52},{-20,52},{-40,52},{-44,52},{-48,52},{20,48},{-12,48},{-16,48},{-52,48},{20,44},{0,44},{-4,44},{-8,44},{-12,44},{-52,44},{20,40},{12,40},{8,40},{4,40},{-16,40},{-52,40},{16,36},{12,36},{-20,36},{-52,36},{20,32},{8,32},{-20,32},{-48,32},{28,28},{24,28},{4,28},{-20,28},{-44,28},{32,24},{-20,24},{-40,24},{36,20},{-16,20},{-36,20},{36,16},{-8,16},{-12,16},{-32,16},{40,12},{16,12},{12,12},{8,12},{4,12},{0,12},{-4,12},{-8,12},{-32,12},{44,8},{20,8},{-12,8},{-16,8},{-36,8},{44,4},{40,4},{36,4},{32,4},{28,4},{24,4},{-20,4},{-24,4},{-28,4},{-32,4},{-36,4}};
-const short C1_Attack_3_1[137][2] = {{8,104},{4,104},{0,104},{16,100},{12,100},{28,96},{24,96},{20,96},{16,96},{32,92},{16,92},{32,88},{12,88},{32,84},{12,84},{-20,84},{-24,84},{-36,84},{28,80},{8,80},{-12,80},{-16,80},{-28,80},{-32,80},{-40,80},{24,76},{12,76},{4,76},{-8,76},{-40,76},{20,72},{12,72},{0,72},{-4,72},{-40,72},{16,68},{12,68},{-40,68},{16,64},{-16,64},{-40,64},{-52,64},{-56,64},{-60,64},{-64,64},{20,60},{-16,60},{-36,60},{-48,60},{-68,60},{24,56},{-12,56},{-36,56},{-40,56},{-44,56},{-48,56},{-68,56},{28,52},{-12,52},{-68,52},{28,48},{-12,48},{-64,48},{24,44},{-16,44},{-60,44},{20,40},{16,40},{12,40},{8,40},{-20,40},{-24,40},{-28,40},{-32,40},{-36,40},{-40,40},{-44,40},{-48,40},{-52,40},{-56,40},{16,36},{4,36},{0,36},{-4,36},{-8,36},{-12,36},{-16,36},{-24,36},{-40,36},{12,32},{-28,32},{-40,32},{8,28},{-32,28},{-40,28},{12,24},{-32,24},{-36,24},{36,20},{32,20},{28,20},{24,20},{20,20},{16,20},{-28,20},{-36,20},{36,16},{-24,16},{-32,16},{40,12},{-16,12},{-20,12},{-32,12},{44,8},{8,8},{4,8},{0,8},{-4,8},{-8,8},{-12,8},{-36,8},{44,4},{40,4},{36,4},{32,4},{28,4},{24,4},{20,4},{16,4},{12,4},{-12,4},{-16,4},{-20,4},{-24,4},{-28,4},{-32,4},{-36,4}};
-const short C1_Attack_3_2[146][2] = {{8,128},{4,128},{0,128},{12,124},{16,120},{24,116},{20,116},{16,116},{32,112},{28,112},{16,112},{36,108},{12,108},{-24,108},{-28,108},{36,104},{8,104},{-12,104},{-16,104},{-20,104},{-32,104},{-36,104},{-44,104},{-48,104},{-52,104},{-56,104},{-60,104},{32,100},{12,100},{4,100},{-8,100},{-40,100},{-64,100},{28,96},{12,96},{0,96},{-4,96},{-40,96},{-64,96},{24,92},{20,92},{12,92},{-40,92},{-64,92},{16,88},{12,88},{-44,88},{-64,88},{12,84},{-20,84},{-44,84},{-64,84},{12,80},{-20,80},{-44,80},{-64,80},{12,76},{-24,76},{-64,76},{12,72},{-28,72},{-64,72},{16,68},{-28,68},{-32,68},{-60,68},{16,64},{-28,64},{-36,64},{-40,64},{-44,64},{-48,64},{-52,64},{-56,64},{12,60},{8,60},{4,60},{0,60},{-28,60},{12,56},{-4,56},{-8,56},{-12,56},{-16,56},{-20,56},{-24,56},{-28,56},{8,52},{-16,52},{-32,52},{8,48},{-16,48},{-32,48},{8,44},{-16,44},{-36,44},{8,40},{-16,40},{-36,40},{12,36},{8,36},{-16,36},{-36,36},{20,32},{16,32},{-16,32},{-36,32},{24,28},{-16,28},{-36,28},{36,24},{32,24},{28,24},{-12,24},{-36,24},{40,20},{-4,20},{-8,20},{-12,20},{-36,20},{40,16},{0,16},{-12,16},{-36,16},{40,12},{8,12},{4,12},{-12,12},{-32,12},{40,8},{20,8},{16,8},{12,8},{-12,8},{-36,8},{36,4},{32,4},{28,4},{24,4},{-12,4},{-16,4},{-20,4},{-24,4},{-28,4},{-32,4},{-36,4}};
-const short C1_Attack_3_3[148][2] = {{-12,200},{-16,200},{-20,200},{-24,200},{-8,196},{-28,196},{-4,192},{-32,192},{-4,188},{-32,188},{-4,184},{-32,184},{-8,180},{-28,180},{-8,176},{-28,176},{-8,172},{-28,172},{-8,168},{-28,168},{-8,164},{-28,164},{-8,160},{-28,160},{-8,156},{-28,156},{-8,152},{-28,152},{28,148},{-12,148},{-28,148},{32,144},{-12,144},{-24,144},{32,140},{-8,140},{-24,140},{28,136},{-8,136},{-24,136},{32,132},{28,132},{24,132},{20,132},{16,132},{0,132},{-4,132},{-24,132},{36,128},{12,128},{8,128},{4,128},{-24,128},{36,124},{-24,124},{36,120},{20,120},{-24,120},{-28,120},{-32,120},{-36,120},{-40,120},{-44,120},{36,116},{16,116},{-20,116},{-48,116},{36,112},{16,112},{-20,112},{-48,112},{36,108},{16,108},{-16,108},{-48,108},{32,104},{20,104},{16,104},{-16,104},{-48,104},{28,100},{24,100},{16,100},{-12,100},{-44,100},{16,96},{-8,96},{-20,96},{-44,96},{20,92},{-4,92},{-16,92},{-44,92},{20,88},{4,88},{0,88},{-12,88},{-16,88},{-40,88},{16,84},{12,84},{8,84},{-8,84},{-16,84},{-40,84},{16,80},{-8,80},{-16,80},{-40,80},{16,76},{-8,76},{-16,76},{-40,76},{16,72},{-8,72},{-16,72},{-36,72},{16,68},{-8,68},{-16,68},{-32,68},{16,64},{-8,64},{-20,64},{-24,64},{-28,64},{16,60},{-8,60},{16,56},{-8,56},{12,52},{-8,52},{12,48},{-8,48},{12,44},{-12,44},{12,40},{-12,40},{12,36},{-12,36},{8,32},{-8,32},{8,28},{-8,28},{4,24},{-8,24},{0,20},{-4,20}};
-const short C1_Attack_3_4[125][2] = {{16,196},{12,196},{20,192},{8,192},{24,188},{4,188},{24,184},{4,184},{-16,148},{-20,148},{-24,148},{-28,144},{-32,140},{-32,136},{-28,132},{20,128},{12,128},{8,128},{4,128},{0,128},{-28,128},{20,124},{-4,124},{-24,124},{20,120},{-8,120},{-20,120},{20,116},{-4,116},{-12,116},{-16,116},{-20,116},{44,112},{40,112},{20,112},{-4,112},{-20,112},{48,108},{36,108},{32,108},{20,108},{-4,108},{-20,108},{48,104},{28,104},{24,104},{20,104},{0,104},{-24,104},{48,100},{0,100},{-24,100},{48,96},{0,96},{-24,96},{44,92},{40,92},{36,92},{32,92},{4,92},{-20,92},{-24,92},{28,88},{24,88},{20,88},{16,88},{12,88},{8,88},{-12,88},{-16,88},{-24,88},{24,84},{-4,84},{-8,84},{-20,84},{24,80},{20,80},{16,80},{12,80},{8,80},{4,80},{0,80},{-16,80},{28,76},{-8,76},{-12,76},{-16,76},{28,72},{-4,72},{-20,72},{-24,72},{28,68},{-4,68},{-28,68},{28,64},{-4,64},{-28,64},{28,60},{-4,60},{-28,60},{24,56},{-8,56},{-28,56},{20,52},{-12,52},{-28,52},{16,48},{-16,48},{-24,48},{12,44},{-20,44},{8,40},{-16,40},{4,36},{-16,36},{4,32},{-12,32},{4,28},{-12,28},{4,24},{-12,24},{0,20},{-12,20},{-4,16},{-8,16}};
-const short C1_Attack_3_5[165][2] = {{40,188},{36,188},{32,188},{28,188},{24,188},{44,184},{44,180},{44,176},{44,172},{44,168},{44,164},{44,160},{44,156},{44,152},{-20,152},{-24,152},{-28,152},{44,148},{-32,148},{44,144},{-36,144},{44,140},{-36,140},{40,136},{-32,136},{40,132},{-8,132},{-12,132},{-16,132},{-20,132},{-24,132},{-32,132},{40,128},{24,128},{4,128},{0,128},{-4,128},{-28,128},{40,124},{24,124},{-32,124},{36,120},{32,120},{28,120},{24,120},{-8,120},{-32,120},{24,116},{-8,116},{-32,116},{24,112},{8,112},{4,112},{0,112},{-12,112},{-32,112},{24,108},{12,108},{-4,108},{-8,108},{-12,108},{-32,108},{24,104},{12,104},{-32,104},{24,100},{12,100},{-28,100},{28,96},{8,96},{-28,96},{32,92},{24,92},{4,92},{0,92},{-4,92},{-8,92},{-12,92},{-16,92},{-20,92},{-24,92},{36,88},{20,88},{16,88},{-20,88},{40,84},{12,84},{8,84},{-24,84},{44,80},{4,80},{0,80},{-4,80},{-8,80},{-20,80},{44,76},{-12,76},{-16,76},{44,72},{12,72},{-20,72},{48,68},{16,68},{8,68},{-20,68},{48,64},{20,64},{8,64},{-20,64},{48,60},{24,60},{8,60},{-20,60},{44,56},{20,56},{8,56},{-16,56},{44,52},{20,52},{8,52},{-16,52},{44,48},{20,48},{8,48},{-16,48},{40,44},{20,44},{8,44},{-16,44},{40,40},{20,40},{8,40},{-12,40},{36,36},{20,36},{8,36},{-12,36},{40,32},{20,32},{4,32},{-12,32},{44,28},{20,28},{8,28},{-12,28},{48,24},{24,24},{8,24},{-12,24},{48,20},{28,20},{8,20},{-12,20},{44,16},{40,16},{36,16},{32,16},{8,16},{-12,16},{8,12},{-12,12},{4,8},{-8,8},{0,4},{-4,4}};
-const short C1_Attack_3_6[146][2] = {{48,140},{44,140},{40,140},{36,140},{52,136},{32,136},{52,132},{32,132},{-16,132},{52,128},{32,128},{-20,128},{52,124},{32,124},{28,124},{-20,124},{56,120},{32,120},{24,120},{-16,120},{-24,120},{56,116},{36,116},{20,116},{-8,116},{-12,116},{-28,116},{56,112},{16,112},{12,112},{4,112},{-16,112},{-32,112},{52,108},{48,108},{4,108},{-20,108},{-32,108},{44,104},{40,104},{4,104},{-32,104},{36,100},{32,100},{0,100},{-32,100},{28,96},{-4,96},{-32,96},{28,92},{-8,92},{-28,92},{28,88},{-12,88},{-16,88},{-20,88},{-24,88},{28,84},{-12,84},{28,80},{-16,80},{32,76},{-16,76},{36,72},{28,72},{-16,72},{40,68},{24,68},{20,68},{16,68},{12,68},{-16,68},{44,64},{8,64},{4,64},{0,64},{-4,64},{-8,64},{-12,64},{-20,64},{48,60},{16,60},{-20,60},{48,56},{20,56},{12,56},{-20,56},{48,52},{24,52},{8,52},{-20,52},{48,48},{24,48},{8,48},{-24,48},{48,44},{24,44},{4,44},{-28,44},{48,40},{24,40},{4,40},{-28,40},{48,36},{24,36},{0,36},{-28,36},{48,32},{24,32},{-4,32},{-28,32},{48,28},{24,28},{-4,28},{-28,28},{44,24},{24,24},{-8,24},{-32,24},{44,20},{24,20},{-12,20},{-32,20},{44,16},{24,16},{-12,16},{-36,16},{48,12},{24,12},{-16,12},{-36,12},{52,8},{28,8},{-20,8},{-40,8},{48,4},{44,4},{40,4},{36,4},{32,4},{-20,4},{-24,4},{-28,4},{-32,4},{-36,4},{-40,4}};
-const short C1_Backward_0[141][2] = {{48,128},{44,128},{40,128},{52,124},{56,120},{56,116},{52,112},{-8,112},{52,108},{40,108},{36,108},{32,108},{28,108},{-8,108},{-12,108},{48,104},{44,104},{24,104},{20,104},{16,104},{12,104},{8,104},{-16,104},{-20,104},{44,100},{20,100},{16,100},{4,100},{-24,100},{48,96},{0,96},{-28,96},{48,92},{0,92},{-32,92},{48,88},{4,88},{-36,88},{48,84},{16,84},{12,84},{8,84},{-16,84},{-20,84},{-36,84},{44,80},{40,80},{36,80},{32,80},{28,80},{24,80},{20,80},{-12,80},{-36,80},{36,76},{-12,76},{-36,76},{36,72},{-12,72},{-16,72},{-32,72},{36,68},{-16,68},{-20,68},{-24,68},{-28,68},{36,64},{-16,64},{36,60},{32,60},{28,60},{24,60},{20,60},{-4,60},{-8,60},{-12,60},{36,56},{16,56},{12,56},{8,56},{4,56},{0,56},{-12,56},{40,52},{12,52},{-16,52},{40,48},{12,48},{8,48},{-20,48},{40,44},{16,44},{4,44},{-24,44},{44,40},{16,40},{0,40},{-28,40},{44,36},{20,36},{-4,36},{-32,36},{44,32},{20,32},{-8,32},{-32,32},{44,28},{20,28},{-8,28},{-36,28},{48,24},{20,24},{-12,24},{-36,24},{52,20},{24,20},{-12,20},{-36,20},{56,16},{28,16},{-12,16},{-36,16},{60,12},{32,12},{-12,12},{-40,12},{60,8},{32,8},{-16,8},{-20,8},{-40,8},{56,4},{52,4},{48,4},{44,4},{40,4},{36,4},{-24,4},{-28,4},{-32,4},{-36,4}};
-const short C1_Backward_1[137][2] = {{52,128},{48,128},{44,128},{56,124},{60,120},{60,116},{56,112},{-4,112},{-8,112},{56,108},{44,108},{40,108},{36,108},{32,108},{28,108},{-12,108},{-16,108},{52,104},{48,104},{24,104},{20,104},{8,104},{-20,104},{48,100},{28,100},{4,100},{-24,100},{52,96},{4,96},{-28,96},{52,92},{8,92},{-32,92},{52,88},{12,88},{-12,88},{-16,88},{-32,88},{52,84},{24,84},{20,84},{16,84},{-8,84},{-32,84},{48,80},{44,80},{40,80},{36,80},{32,80},{28,80},{-8,80},{-32,80},{36,76},{-8,76},{-12,76},{-28,76},{36,72},{-8,72},{-12,72},{-16,72},{-20,72},{-24,72},{36,68},{0,68},{-4,68},{-8,68},{36,64},{32,64},{28,64},{4,64},{-8,64},{36,60},{24,60},{20,60},{16,60},{12,60},{8,60},{-12,60},{40,56},{12,56},{-12,56},{40,52},{12,52},{8,52},{-16,52},{40,48},{16,48},{4,48},{-20,48},{40,44},{16,44},{4,44},{-20,44},{44,40},{16,40},{0,40},{-24,40},{44,36},{20,36},{0,36},{-28,36},{44,32},{20,32},{-4,32},{-28,32},{44,28},{20,28},{-4,28},{-28,28},{44,24},{20,24},{-4,24},{-28,24},{48,20},{20,20},{-4,20},{-32,20},{52,16},{24,16},{-8,16},{-32,16},{56,12},{28,12},{-12,12},{-32,12},{56,8},{28,8},{-16,8},{-20,8},{-24,8},{-28,8},{52,4},{48,4},{44,4},{40,4},{36,4},{32,4}};
-const short C1_Backward_2[141][2] = {{56,132},{52,132},{48,132},{60,128},{64,124},{64,120},{60,116},{0,116},{-4,116},{60,112},{48,112},{44,112},{40,112},{36,112},{32,112},{-8,112},{-12,112},{56,108},{52,108},{28,108},{24,108},{12,108},{-16,108},{52,104},{32,104},{8,104},{-20,104},{56,100},{8,100},{-24,100},{56,96},{12,96},{-28,96},{56,92},{16,92},{-8,92},{-12,92},{-28,92},{56,88},{28,88},{24,88},{20,88},{-4,88},{-28,88},{52,84},{48,84},{44,84},{40,84},{36,84},{32,84},{-4,84},{-28,84},{40,80},{-4,80},{-8,80},{-24,80},{40,76},{-4,76},{-8,76},{-12,76},{-16,76},{-20,76},{40,72},{4,72},{0,72},{-4,72},{-8,72},{40,68},{8,68},{-8,68},{40,64},{36,64},{20,64},{16,64},{12,64},{-12,64},{40,60},{32,60},{28,60},{24,60},{12,60},{-12,60},{40,56},{16,56},{12,56},{-12,56},{40,52},{16,52},{8,52},{-16,52},{40,48},{16,48},{8,48},{-16,48},{40,44},{16,44},{4,44},{-16,44},{44,40},{16,40},{4,40},{-20,40},{44,36},{20,36},{4,36},{-20,36},{44,32},{20,32},{0,32},{-24,32},{44,28},{20,28},{0,28},{-24,28},{44,24},{20,24},{0,24},{-24,24},{44,20},{20,20},{0,20},{-24,20},{44,16},{20,16},{-4,16},{-24,16},{48,12},{20,12},{-8,12},{-20,12},{48,8},{20,8},{-12,8},{-16,8},{48,4},{44,4},{40,4},{36,4},{32,4},{28,4},{24,4}};
-const short C1_Backward_3[146][2] = {{56,132},{52,132},{48,132},{60,128},{64,124},{64,120},{60,116},{0,116},{-4,116},{60,112},{48,112},{44,112},{40,112},{36,112},{32,112},{-8,112},{-12,112},{60,108},{56,108},{52,108},{28,108},{24,108},{12,108},{-16,108},{52,104},{32,104},{8,104},{-20,104},{56,100},{8,100},{-24,100},{56,96},{12,96},{-28,96},{56,92},{16,92},{-8,92},{-12,92},{-28,92},{56,88},{28,88},{24,88},{20,88},{-4,88},{-28,88},{52,84},{48,84},{44,84},{40,84},{36,84},{32,84},{-4,84},{-28,84},{40,80},{-4,80},{-8,80},{-24,80},{40,76},{-4,76},{-8,76},{-12,76},{-16,76},{-20,76},{40,72},{-4,72},{-8,72},{40,68},{36,68},{-8,68},{40,64},{32,64},{-4,64},{-12,64},{40,60},{28,60},{24,60},{20,60},{16,60},{12,60},{8,60},{4,60},{0,60},{-12,60},{40,56},{16,56},{12,56},{-12,56},{40,52},{16,52},{8,52},{-16,52},{44,48},{20,48},{16,48},{8,48},{-16,48},{48,44},{20,44},{4,44},{-20,44},{48,40},{24,40},{4,40},{-20,40},{48,36},{24,36},{4,36},{-20,36},{48,32},{24,32},{4,32},{-20,32},{48,28},{24,28},{4,28},{-20,28},{48,24},{24,24},{4,24},{-20,24},{48,20},{24,20},{0,20},{-20,20},{48,16},{44,16},{24,16},{0,16},{-24,16},{44,12},{24,12},{-4,12},{-28,12},{44,8},{40,8},{36,8},{32,8},{28,8},{-4,8},{-28,8},{-4,4},{-8,4},{-12,4},{-16,4},{-20,4},{-24,4}};
-const short C1_Backward_4[138][2] = {{52,128},{48,128},{44,128},{56,124},{60,120},{60,116},{56,112},{-4,112},{-8,112},{56,108},{48,108},{44,108},{40,108},{36,108},{32,108},{-12,108},{-16,108},{52,104},{48,104},{28,104},{24,104},{20,104},{16,104},{12,104},{-20,104},{48,100},{24,100},{20,100},{8,100},{-24,100},{52,96},{28,96},{4,96},{-28,96},{52,92},{4,92},{-32,92},{52,88},{8,88},{-12,88},{-16,88},{-32,88},{52,84},{16,84},{12,84},{-8,84},{-32,84},{48,80},{44,80},{40,80},{36,80},{32,80},{28,80},{24,80},{20,80},{-8,80},{-32,80},{36,76},{-8,76},{-12,76},{-28,76},{36,72},{-8,72},{-12,72},{-16,72},{-20,72},{-24,72},{36,68},{-8,68},{36,64},{-8,64},{36,60},{32,60},{0,60},{-4,60},{-12,60},{40,56},{28,56},{24,56},{20,56},{16,56},{12,56},{8,56},{4,56},{-12,56},{40,52},{16,52},{8,52},{-16,52},{40,48},{16,48},{8,48},{-16,48},{44,44},{16,44},{4,44},{-20,44},{48,40},{20,40},{4,40},{-20,40},{52,36},{24,36},{4,36},{-20,36},{56,32},{28,32},{0,32},{-24,32},{60,28},{28,28},{0,28},{-24,28},{60,24},{32,24},{0,24},{-24,24},{60,20},{36,20},{0,20},{-24,20},{60,16},{44,16},{40,16},{0,16},{-24,16},{56,12},{52,12},{48,12},{-4,12},{-28,12},{-4,8},{-28,8},{-8,4},{-12,4},{-16,4},{-20,4},{-24,4}};
-const short C1_Backward_5[140][2] = {{48,128},{44,128},{40,128},{52,124},{56,120},{56,116},{52,112},{-8,112},{-12,112},{52,108},{40,108},{36,108},{32,108},{28,108},{-16,108},{-20,108},{48,104},{44,104},{24,104},{20,104},{16,104},{-24,104},{44,100},{16,100},{12,100},{8,100},{-28,100},{48,96},{20,96},{4,96},{-32,96},{48,92},{0,92},{-32,92},{48,88},{0,88},{-36,88},{48,84},{4,84},{-16,84},{-20,84},{-36,84},{44,80},{40,80},{36,80},{32,80},{28,80},{24,80},{20,80},{16,80},{12,80},{8,80},{-12,80},{-36,80},{32,76},{-12,76},{-36,76},{32,72},{-12,72},{-16,72},{-32,72},{32,68},{-12,68},{-16,68},{-20,68},{-24,68},{-28,68},{32,64},{-12,64},{32,60},{28,60},{24,60},{-4,60},{-8,60},{-16,60},{32,56},{20,56},{16,56},{12,56},{8,56},{4,56},{0,56},{-16,56},{36,52},{8,52},{-20,52},{40,48},{12,48},{4,48},{-20,48},{40,44},{16,44},{0,44},{-24,44},{40,40},{16,40},{0,40},{-24,40},{44,36},{16,36},{0,36},{-24,36},{48,32},{20,32},{-4,32},{-28,32},{48,28},{20,28},{-4,28},{-28,28},{48,24},{20,24},{-4,24},{-28,24},{52,20},{24,20},{-4,20},{-28,20},{52,16},{28,16},{-4,16},{-28,16},{52,12},{28,12},{-8,12},{-32,12},{52,8},{32,8},{-8,8},{-32,8},{48,4},{44,4},{40,4},{36,4},{32,4},{-12,4},{-16,4},{-20,4},{-24,4},{-28,4}};
-const short C1_CrouchGuard_0[132][2] = {{36,88},{32,88},{28,88},{-16,88},{-20,88},{48,84},{44,84},{40,84},{36,84},{28,84},{-8,84},{-12,84},{-24,84},{48,80},{32,80},{28,80},{-4,80},{-28,80},{52,76},{36,76},{0,76},{-28,76},{52,72},{48,72},{40,72},{-28,72},{48,68},{40,68},{-28,68},{48,64},{44,64},{40,64},{-12,64},{-16,64},{-20,64},{-24,64},{40,60},{-8,60},{-24,60},{40,56},{16,56},{12,56},{8,56},{4,56},{0,56},{-4,56},{-28,56},{40,52},{-32,52},{36,48},{-12,48},{-36,48},{32,44},{-16,44},{-40,44},{32,40},{4,40},{0,40},{-4,40},{-8,40},{-12,40},{-16,40},{-20,40},{-40,40},{36,36},{32,36},{28,36},{24,36},{20,36},{16,36},{12,36},{8,36},{4,36},{-16,36},{-20,36},{-24,36},{-44,36},{40,32},{4,32},{-24,32},{-48,32},{40,28},{8,28},{0,28},{-24,28},{-48,28},{40,24},{8,24},{-4,24},{-28,24},{-32,24},{-36,24},{-40,24},{-44,24},{44,20},{40,20},{8,20},{-8,20},{-36,20},{48,16},{40,16},{8,16},{-12,16},{-36,16},{52,12},{40,12},{12,12},{-12,12},{-36,12},{-40,12},{52,8},{40,8},{12,8},{-12,8},{-44,8},{48,4},{44,4},{40,4},{36,4},{32,4},{28,4},{24,4},{20,4},{16,4},{-16,4},{-20,4},{-24,4},{-28,4},{-32,4},{-36,4},{-40,4},{-44,4}};
-const short C1_CrouchGuard_1[120][2] = {{-8,88},{-12,88},{44,84},{40,84},{36,84},{32,84},{-16,84},{52,80},{48,80},{44,80},{32,80},{-20,80},{52,76},{36,76},{32,76},{-20,76},{52,72},{40,72},{-20,72},{52,68},{40,68},{-20,68},{52,64},{40,64},{-4,64},{-8,64},{-12,64},{-16,64},{52,60},{48,60},{44,60},{40,60},{0,60},{-16,60},{40,56},{20,56},{16,56},{12,56},{8,56},{4,56},{-20,56},{40,52},{-24,52},{36,48},{-4,48},{-28,48},{32,44},{-8,44},{-32,44},{36,40},{-12,40},{-32,40},{40,36},{12,36},{8,36},{4,36},{0,36},{-4,36},{-8,36},{-12,36},{-16,36},{-36,36},{44,32},{40,32},{36,32},{32,32},{28,32},{24,32},{20,32},{16,32},{12,32},{8,32},{4,32},{-16,32},{-40,32},{44,28},{12,28},{0,28},{-16,28},{-40,28},{44,24},{12,24},{-4,24},{-20,24},{-24,24},{-28,24},{-32,24},{-36,24},{44,20},{12,20},{-4,20},{-28,20},{48,16},{44,16},{12,16},{-8,16},{-28,16},{52,12},{44,12},{16,12},{-8,12},{-28,12},{52,8},{44,8},{16,8},{-8,8},{-32,8},{48,4},{44,4},{40,4},{36,4},{32,4},{28,4},{24,4},{20,4},{-12,4},{-16,4},{-20,4},{-24,4},{-28,4}};
-const short C1_Damage_0[141][2] = {{44,132},{40,132},{36,132},{48,128},{52,124},{52,120},{48,116},{48,112},{40,112},{36,112},{32,112},{28,112},{48,108},{44,108},{24,108},{20,108},{48,104},{52,100},{28,100},{24,100},{-4,100},{-24,100},{-28,100},{-32,100},{-36,100},{52,96},{32,96},{-8,96},{-12,96},{-16,96},{-20,96},{-40,96},{52,92},{32,92},{28,92},{24,92},{-40,92},{52,88},{20,88},{12,88},{-40,88},{52,84},{20,84},{8,84},{4,84},{-24,84},{-28,84},{-32,84},{-36,84},{48,80},{44,80},{20,80},{4,80},{0,80},{-4,80},{-8,80},{-12,80},{-16,80},{-20,80},{52,76},{40,76},{36,76},{32,76},{28,76},{24,76},{4,76},{52,72},{8,72},{0,72},{52,68},{8,68},{-4,68},{52,64},{16,64},{12,64},{-8,64},{48,60},{28,60},{24,60},{20,60},{-8,60},{48,56},{40,56},{36,56},{32,56},{20,56},{-12,56},{44,52},{20,52},{16,52},{-12,52},{44,48},{20,48},{12,48},{-12,48},{44,44},{20,44},{8,44},{-16,44},{40,40},{16,40},{8,40},{-16,40},{40,36},{16,36},{4,36},{-16,36},{40,32},{16,32},{4,32},{-16,32},{36,28},{16,28},{4,28},{-16,28},{36,24},{16,24},{4,24},{-16,24},{36,20},{16,20},{4,20},{-20,20},{36,16},{16,16},{0,16},{-24,16},{36,12},{16,12},{-4,12},{-8,12},{-12,12},{-16,12},{-20,12},{36,8},{12,8},{32,4},{28,4},{24,4},{20,4},{16,4}};
-const short C1_Damage_1[134][2] = {{48,124},{44,124},{40,124},{52,120},{56,116},{56,112},{52,108},{44,108},{40,108},{36,108},{52,104},{48,104},{32,104},{28,104},{52,100},{-16,100},{-20,100},{-24,100},{-28,100},{56,96},{32,96},{-4,96},{-8,96},{-12,96},{-32,96},{56,92},{36,92},{-32,92},{56,88},{36,88},{32,88},{28,88},{12,88},{-32,88},{56,84},{24,84},{8,84},{-16,84},{-20,84},{-24,84},{-28,84},{56,80},{24,80},{8,80},{4,80},{0,80},{-4,80},{-8,80},{-12,80},{52,76},{48,76},{24,76},{8,76},{56,72},{44,72},{40,72},{36,72},{32,72},{28,72},{12,72},{4,72},{56,68},{12,68},{4,68},{0,68},{56,64},{20,64},{16,64},{-4,64},{52,60},{32,60},{28,60},{24,60},{-4,60},{52,56},{44,56},{40,56},{36,56},{24,56},{-8,56},{48,52},{24,52},{20,52},{-8,52},{48,48},{24,48},{16,48},{-8,48},{48,44},{24,44},{12,44},{-12,44},{44,40},{20,40},{12,40},{-12,40},{44,36},{20,36},{8,36},{-12,36},{44,32},{20,32},{8,32},{-12,32},{40,28},{20,28},{8,28},{-12,28},{40,24},{20,24},{8,24},{-12,24},{40,20},{20,20},{8,20},{-16,20},{40,16},{20,16},{4,16},{-20,16},{40,12},{20,12},{0,12},{-4,12},{-8,12},{-12,12},{-16,12},{40,8},{16,8},{36,4},{32,4},{28,4},{24,4},{20,4}};
-const short C1_Damage_2[135][2] = {{48,132},{44,132},{40,132},{52,128},{56,124},{56,120},{52,116},{52,112},{44,112},{40,112},{36,112},{32,112},{48,108},{28,108},{24,108},{48,104},{52,100},{28,100},{24,100},{-4,100},{-12,100},{-16,100},{-20,100},{52,96},{32,96},{-8,96},{-24,96},{52,92},{32,92},{28,92},{24,92},{-8,92},{-24,92},{52,88},{20,88},{12,88},{-24,88},{52,84},{20,84},{8,84},{-24,84},{48,80},{44,80},{20,80},{8,80},{4,80},{0,80},{-4,80},{-20,80},{48,76},{40,76},{36,76},{32,76},{28,76},{24,76},{4,76},{-8,76},{-12,76},{-16,76},{52,72},{4,72},{52,68},{8,68},{0,68},{52,64},{8,64},{0,64},{48,60},{16,60},{12,60},{-4,60},{48,56},{24,56},{20,56},{-8,56},{44,52},{40,52},{36,52},{32,52},{28,52},{20,52},{16,52},{-12,52},{44,48},{20,48},{12,48},{-12,48},{44,44},{20,44},{8,44},{-12,44},{40,40},{16,40},{8,40},{-12,40},{40,36},{16,36},{8,36},{-12,36},{40,32},{16,32},{8,32},{-12,32},{36,28},{16,28},{8,28},{-12,28},{36,24},{16,24},{8,24},{-12,24},{36,20},{16,20},{8,20},{-12,20},{36,16},{16,16},{8,16},{-16,16},{36,12},{16,12},{4,12},{-20,12},{36,8},{12,8},{0,8},{-4,8},{-8,8},{-12,8},{-16,8},{32,4},{28,4},{24,4},{20,4},{16,4}};
-const short C1_Damage_3[132][2] = {{48,124},{44,124},{52,120},{56,116},{56,112},{52,108},{-4,108},{52,104},{40,104},{36,104},{32,104},{-8,104},{-12,104},{48,100},{44,100},{28,100},{24,100},{20,100},{-16,100},{44,96},{16,96},{12,96},{-20,96},{44,92},{24,92},{20,92},{8,92},{-20,92},{44,88},{4,88},{-20,88},{44,84},{4,84},{0,84},{-4,84},{-20,84},{40,80},{8,80},{4,80},{-20,80},{40,76},{36,76},{20,76},{16,76},{12,76},{4,76},{-20,76},{36,72},{32,72},{28,72},{24,72},{4,72},{0,72},{-16,72},{32,68},{0,68},{-4,68},{-8,68},{-12,68},{32,64},{-12,64},{32,60},{-8,60},{-12,60},{32,56},{28,56},{0,56},{-4,56},{-16,56},{32,52},{24,52},{20,52},{16,52},{12,52},{8,52},{4,52},{-20,52},{32,48},{8,48},{0,48},{-24,48},{32,44},{8,44},{0,44},{-24,44},{36,40},{8,40},{0,40},{-24,40},{36,36},{12,36},{0,36},{-28,36},{36,32},{12,32},{-4,32},{-28,32},{36,28},{12,28},{-4,28},{-32,28},{36,24},{16,24},{-4,24},{-32,24},{40,20},{16,20},{-8,20},{-32,20},{40,16},{16,16},{-12,16},{-36,16},{44,12},{20,12},{-12,12},{-40,12},{44,8},{20,8},{-16,8},{-40,8},{40,4},{36,4},{32,4},{28,4},{24,4},{20,4},{-20,4},{-24,4},{-28,4},{-32,4},{-36,4}};
-const short C1_Dead_0[149][2] = {{40,128},{40,124},{36,124},{32,124},{28,124},{24,124},{-16,124},{-20,124},{-24,124},{20,120},{16,120},{12,120},{8,120},{4,120},{0,120},{-4,120},{-8,120},{-12,120},{-28,120},{-28,116},{40,112},{-28,112},{44,108},{40,108},{-28,108},{44,104},{-16,104},{-20,104},{-24,104},{-32,104},{44,100},{8,100},{4,100},{0,100},{-4,100},{-8,100},{-12,100},{-16,100},{-36,100},{48,96},{44,96},{24,96},{20,96},{16,96},{12,96},{-20,96},{-32,96},{64,92},{48,92},{44,92},{40,92},{36,92},{-24,92},{-28,92},{68,88},{64,88},{60,88},{56,88},{52,88},{48,88},{36,88},{-24,88},{32,84},{-28,84},{28,80},{-32,80},{24,76},{-32,76},{20,72},{16,72},{12,72},{-24,72},{-28,72},{-32,72},{-36,72},{20,68},{12,68},{8,68},{4,68},{0,68},{-4,68},{-8,68},{-12,68},{-16,68},{-20,68},{-24,68},{-36,68},{20,64},{-8,64},{-36,64},{20,60},{-8,60},{-36,60},{20,56},{-8,56},{-36,56},{20,52},{-8,52},{-36,52},{20,48},{-4,48},{-12,48},{-36,48},{20,44},{-4,44},{-12,44},{-40,44},{20,40},{0,40},{-16,40},{-40,40},{20,36},{0,36},{-16,36},{-40,36},{20,32},{0,32},{-16,32},{-40,32},{20,28},{0,28},{-16,28},{-40,28},{20,24},{0,24},{-16,24},{-40,24},{24,20},{4,20},{-20,20},{-40,20},{24,16},{4,16},{-20,16},{-44,16},{24,12},{4,12},{-24,12},{-28,12},{-32,12},{-36,12},{-40,12},{-44,12},{24,8},{4,8},{20,4},{16,4},{12,4},{8,4}};
-const short C1_Dead_1[143][2] = {{48,120},{44,120},{40,120},{36,120},{32,120},{-4,120},{-8,120},{-12,120},{28,116},{24,116},{20,116},{16,116},{12,116},{8,116},{4,116},{0,116},{-16,116},{-20,116},{-24,116},{-16,112},{-28,112},{48,108},{-16,108},{-28,108},{48,104},{-16,104},{-28,104},{52,100},{48,100},{-4,100},{-8,100},{-12,100},{-20,100},{-24,100},{52,96},{32,96},{28,96},{24,96},{20,96},{16,96},{12,96},{8,96},{4,96},{0,96},{-8,96},{-16,96},{76,92},{72,92},{60,92},{56,92},{-12,92},{76,88},{72,88},{68,88},{64,88},{60,88},{52,88},{48,88},{-16,88},{76,84},{72,84},{44,84},{-20,84},{-24,84},{40,80},{-20,80},{-28,80},{36,76},{-12,76},{-16,76},{-20,76},{-32,76},{32,72},{-4,72},{-8,72},{-12,72},{-36,72},{28,68},{24,68},{4,68},{0,68},{-4,68},{-12,68},{-40,68},{20,64},{12,64},{8,64},{4,64},{-16,64},{-44,64},{16,60},{12,60},{-16,60},{-48,60},{12,56},{-16,56},{-48,56},{8,52},{-20,52},{-24,52},{-48,52},{4,48},{-20,48},{-28,48},{-48,48},{4,44},{-20,44},{-28,44},{-48,44},{4,40},{-20,40},{-28,40},{-48,40},{4,36},{-20,36},{-28,36},{-48,36},{4,32},{-20,32},{-28,32},{-48,32},{4,28},{-20,28},{-28,28},{-48,28},{4,24},{-16,24},{-32,24},{-52,24},{8,20},{-16,20},{-36,20},{-56,20},{8,16},{-12,16},{-40,16},{-44,16},{-48,16},{-52,16},{4,12},{0,12},{-4,12},{-8,12}};
-const short C1_Dead_2[160][2] = {{20,116},{16,116},{12,116},{32,112},{28,112},{24,112},{8,112},{4,112},{0,112},{-4,112},{-8,112},{36,108},{20,108},{16,108},{12,108},{-12,108},{56,104},{52,104},{48,104},{44,104},{40,104},{28,104},{24,104},{-12,104},{-16,104},{-20,104},{-24,104},{-28,104},{-32,104},{-36,104},{-40,104},{-44,104},{-48,104},{-52,104},{-56,104},{-60,104},{-64,104},{-68,104},{-72,104},{-96,104},{-100,104},{-104,104},{36,100},{32,100},{-12,100},{-32,100},{-36,100},{-76,100},{-80,100},{-84,100},{-88,100},{-96,100},{-104,100},{48,96},{44,96},{40,96},{4,96},{0,96},{-4,96},{-8,96},{-12,96},{-32,96},{-92,96},{-104,96},{12,92},{8,92},{-32,92},{-104,92},{16,88},{-28,88},{-44,88},{-104,88},{28,84},{24,84},{20,84},{-28,84},{-48,84},{-52,84},{-56,84},{-60,84},{-64,84},{-68,84},{-72,84},{-76,84},{-80,84},{-84,84},{-88,84},{-104,84},{-24,80},{-28,80},{-64,80},{-68,80},{-72,80},{-92,80},{-96,80},{-100,80},{60,76},{-20,76},{-24,76},{-76,76},{-80,76},{60,72},{40,72},{36,72},{32,72},{28,72},{24,72},{20,72},{16,72},{12,72},{8,72},{4,72},{0,72},{-4,72},{-8,72},{-12,72},{-20,72},{-80,72},{60,68},{56,68},{52,68},{48,68},{44,68},{-16,68},{-20,68},{-24,68},{-28,68},{-80,68},{80,64},{60,64},{-32,64},{-36,64},{-40,64},{-80,64},{80,60},{76,60},{64,60},{60,60},{-44,60},{-48,60},{-52,60},{-84,60},{72,56},{68,56},{64,56},{-56,56},{-60,56},{-84,56},{-64,52},{-84,52},{-68,48},{-84,48},{-68,44},{-88,44},{-68,40},{-72,40},{-88,40},{-76,36},{-80,36},{-84,36}};
-const short C1_Dead_3[144][2] = {{-40,128},{-44,128},{-36,124},{-48,124},{-32,120},{-48,120},{-20,116},{-24,116},{-28,116},{-48,116},{-12,112},{-16,112},{-48,112},{-8,108},{-44,108},{-60,108},{-64,108},{4,104},{0,104},{-4,104},{-44,104},{-56,104},{-68,104},{8,100},{-28,100},{-32,100},{-36,100},{-40,100},{-56,100},{-68,100},{12,96},{-24,96},{-52,96},{-68,96},{44,92},{40,92},{16,92},{-16,92},{-20,92},{-24,92},{-28,92},{-32,92},{-36,92},{-40,92},{-44,92},{-48,92},{-68,92},{48,88},{36,88},{20,88},{-8,88},{-12,88},{-64,88},{52,84},{36,84},{24,84},{20,84},{16,84},{-4,84},{-64,84},{52,80},{36,80},{28,80},{16,80},{12,80},{0,80},{-48,80},{-52,80},{-56,80},{-60,80},{56,76},{36,76},{32,76},{12,76},{8,76},{4,76},{-40,76},{-44,76},{56,72},{40,72},{4,72},{0,72},{-28,72},{-32,72},{-36,72},{56,68},{40,68},{0,68},{-4,68},{-12,68},{-16,68},{-20,68},{-24,68},{60,64},{44,64},{-8,64},{60,60},{44,60},{-4,60},{60,56},{44,56},{0,56},{60,52},{40,52},{4,52},{60,48},{40,48},{8,48},{60,44},{40,44},{8,44},{60,40},{40,40},{8,40},{60,36},{36,36},{8,36},{60,32},{32,32},{8,32},{60,28},{56,28},{32,28},{8,28},{56,24},{32,24},{12,24},{52,20},{48,20},{36,20},{32,20},{16,20},{48,16},{44,16},{40,16},{24,16},{20,16},{44,12},{28,12},{44,8},{40,8},{36,8},{32,8},{44,4}};
-const short C1_Dead_4[128][2] = {{96,84},{92,84},{88,84},{100,80},{84,80},{80,80},{76,80},{104,76},{72,76},{68,76},{64,76},{108,72},{96,72},{92,72},{88,72},{84,72},{80,72},{76,72},{72,72},{60,72},{56,72},{112,68},{100,68},{68,68},{64,68},{52,68},{116,64},{104,64},{60,64},{56,64},{48,64},{44,64},{112,60},{108,60},{104,60},{52,60},{48,60},{40,60},{36,60},{112,56},{92,56},{44,56},{32,56},{28,56},{24,56},{20,56},{16,56},{12,56},{116,52},{96,52},{88,52},{40,52},{36,52},{28,52},{8,52},{4,52},{112,48},{108,48},{104,48},{100,48},{84,48},{80,48},{28,48},{0,48},{88,44},{76,44},{32,44},{28,44},{0,44},{88,40},{72,40},{68,40},{64,40},{60,40},{36,40},{32,40},{-4,40},{88,36},{68,36},{56,36},{52,36},{48,36},{44,36},{40,36},{36,36},{-4,36},{84,32},{68,32},{40,32},{-4,32},{84,28},{64,28},{60,28},{40,28},{36,28},{32,28},{28,28},{24,28},{20,28},{-4,28},{80,24},{56,24},{52,24},{44,24},{0,24},{76,20},{48,20},{0,20},{76,16},{0,16},{72,12},{68,12},{4,12},{64,8},{8,8},{60,4},{56,4},{52,4},{48,4},{44,4},{40,4},{36,4},{32,4},{28,4},{24,4},{20,4},{16,4},{12,4}};
-const short C1_Dead_5[136][2] = {{36,100},{32,100},{28,100},{24,100},{-4,100},{-8,100},{-12,100},{40,96},{20,96},{16,96},{0,96},{-16,96},{40,92},{12,92},{8,92},{0,92},{-20,92},{36,88},{8,88},{-4,88},{-24,88},{36,84},{32,84},{8,84},{-8,84},{-28,84},{28,80},{8,80},{-8,80},{-28,80},{24,76},{8,76},{-4,76},{-24,76},{24,72},{8,72},{0,72},{-20,72},{24,68},{4,68},{-20,68},{28,64},{4,64},{-16,64},{28,60},{4,60},{-16,60},{28,56},{0,56},{-16,56},{28,52},{0,52},{-16,52},{28,48},{0,48},{-16,48},{28,44},{0,44},{-16,44},{28,40},{0,40},{-16,40},{36,36},{32,36},{28,36},{-4,36},{-16,36},{40,32},{28,32},{-8,32},{-16,32},{44,28},{24,28},{-12,28},{-16,28},{48,24},{24,24},{-16,24},{104,20},{100,20},{96,20},{92,20},{88,20},{84,20},{80,20},{76,20},{72,20},{68,20},{64,20},{60,20},{56,20},{52,20},{20,20},{-16,20},{108,16},{16,16},{12,16},{8,16},{4,16},{-16,16},{112,12},{0,12},{-4,12},{-16,12},{108,8},{104,8},{100,8},{96,8},{-4,8},{-12,8},{92,4},{88,4},{84,4},{80,4},{76,4},{72,4},{68,4},{64,4},{60,4},{56,4},{52,4},{48,4},{44,4},{40,4},{36,4},{32,4},{28,4},{24,4},{20,4},{16,4},{12,4},{8,4},{4,4},{0,4},{-4,4},{-8,4}};
-const short C1_Dead_6[152][2] = {{12,60},{8,60},{4,60},{0,60},{-4,60},{-8,60},{-12,60},{-16,60},{-20,60},{-24,60},{-28,60},{-32,60},{-36,60},{100,56},{96,56},{92,56},{28,56},{24,56},{20,56},{16,56},{-24,56},{-40,56},{-44,56},{104,52},{88,52},{84,52},{32,52},{-24,52},{-48,52},{104,48},{80,48},{40,48},{36,48},{-24,48},{-32,48},{-36,48},{-52,48},{-56,48},{100,44},{-24,44},{-40,44},{-60,44},{-64,44},{-68,44},{-72,44},{96,40},{92,40},{88,40},{84,40},{80,40},{76,40},{72,40},{68,40},{64,40},{60,40},{56,40},{52,40},{-28,40},{-44,40},{-48,40},{-76,40},{108,36},{104,36},{100,36},{48,36},{-28,36},{-52,36},{-56,36},{-80,36},{112,32},{44,32},{40,32},{-28,32},{-60,32},{-64,32},{-84,32},{-88,32},{112,28},{-28,28},{-68,28},{-72,28},{-92,28},{112,24},{96,24},{92,24},{88,24},{84,24},{80,24},{76,24},{72,24},{12,24},{8,24},{4,24},{0,24},{-4,24},{-8,24},{-12,24},{-16,24},{-20,24},{-24,24},{-28,24},{-32,24},{-36,24},{-76,24},{-80,24},{-96,24},{108,20},{104,20},{100,20},{68,20},{20,20},{16,20},{-40,20},{-84,20},{-100,20},{68,16},{64,16},{60,16},{32,16},{28,16},{24,16},{-44,16},{-48,16},{-52,16},{-56,16},{-88,16},{-104,16},{68,12},{56,12},{52,12},{48,12},{44,12},{40,12},{36,12},{-60,12},{-64,12},{-68,12},{-72,12},{-92,12},{-104,12},{68,8},{64,8},{60,8},{56,8},{52,8},{-76,8},{-92,8},{-100,8},{-80,4},{-84,4},{-88,4},{-96,4}};
-const short C1_Dead_7[155][2] = {{-36,44},{-40,44},{-44,44},{-48,44},{-52,44},{-56,44},{20,40},{16,40},{12,40},{8,40},{4,40},{0,40},{-4,40},{-8,40},{-12,40},{-16,40},{-20,40},{-24,40},{-28,40},{-32,40},{-60,40},{40,36},{36,36},{32,36},{28,36},{24,36},{-8,36},{-64,36},{88,32},{84,32},{44,32},{-8,32},{-68,32},{92,28},{80,28},{-8,28},{-20,28},{-24,28},{-28,28},{-32,28},{-72,28},{112,24},{108,24},{104,24},{92,24},{40,24},{-4,24},{-8,24},{-12,24},{-16,24},{-36,24},{-40,24},{-44,24},{-48,24},{-52,24},{-76,24},{-108,24},{-112,24},{116,20},{100,20},{96,20},{92,20},{88,20},{84,20},{80,20},{76,20},{72,20},{68,20},{64,20},{60,20},{56,20},{52,20},{48,20},{44,20},{-4,20},{-56,20},{-60,20},{-64,20},{-68,20},{-72,20},{-76,20},{-80,20},{-84,20},{-88,20},{-92,20},{-96,20},{-100,20},{-104,20},{-116,20},{116,16},{-4,16},{-116,16},{116,12},{0,12},{-4,12},{-116,12},{112,8},{0,8},{-116,8},{108,4},{104,4},{100,4},{96,4},{92,4},{88,4},{84,4},{80,4},{76,4},{72,4},{68,4},{64,4},{60,4},{56,4},{52,4},{48,4},{44,4},{40,4},{36,4},{32,4},{28,4},{24,4},{20,4},{16,4},{12,4},{8,4},{4,4},{0,4},{-4,4},{-8,4},{-12,4},{-16,4},{-20,4},{-24,4},{-28,4},{-32,4},{-36,4},{-40,4},{-44,4},{-48,4},{-52,4},{-56,4},{-60,4},{-64,4},{-68,4},{-72,4},{-76,4},{-80,4},{-84,4},{-88,4},{-92,4},{-96,4},{-100,4},{-104,4},{-108,4},{-112,4}};
-const short C1_Fall_0[139][2] = {{32,148},{28,148},{36,144},{40,140},{40,136},{44,132},{44,128},{36,128},{32,128},{44,124},{40,124},{28,124},{-16,124},{-20,124},{-24,124},{-28,124},{44,120},{24,120},{-32,120},{48,116},{20,116},{16,116},{-36,116},{48,112},{12,112},{8,112},{-40,112},{52,108},{32,108},{-24,108},{-28,108},{-32,108},{-44,108},{56,104},{32,104},{28,104},{-20,104},{-44,104},{56,100},{36,100},{28,100},{-20,100},{-44,100},{56,96},{36,96},{24,96},{-20,96},{-44,96},{52,92},{48,92},{44,92},{40,92},{20,92},{-24,92},{-28,92},{-32,92},{-36,92},{-40,92},{20,88},{-8,88},{-12,88},{-24,88},{20,84},{0,84},{-4,84},{-16,84},{-20,84},{-24,84},{24,80},{4,80},{-20,80},{24,76},{20,76},{8,76},{4,76},{-24,76},{28,72},{16,72},{12,72},{4,72},{-24,72},{32,68},{4,68},{-24,68},{32,64},{4,64},{-24,64},{36,60},{4,60},{-24,60},{36,56},{8,56},{0,56},{-24,56},{36,52},{12,52},{0,52},{-24,52},{36,48},{12,48},{0,48},{-20,48},{36,44},{12,44},{0,44},{-20,44},{36,40},{12,40},{0,40},{-20,40},{36,36},{12,36},{0,36},{-20,36},{36,32},{16,32},{-4,32},{-20,32},{36,28},{16,28},{-4,28},{-20,28},{36,24},{16,24},{-8,24},{-12,24},{-16,24},{36,20},{16,20},{40,16},{16,16},{40,12},{16,12},{36,8},{16,8},{32,4},{28,4},{24,4},{20,4}};
-const short C1_Forward_0[138][2] = {{36,128},{32,128},{28,128},{24,128},{40,124},{44,120},{44,116},{40,112},{40,108},{28,108},{24,108},{20,108},{8,108},{-24,108},{-28,108},{36,104},{32,104},{16,104},{12,104},{-32,104},{36,100},{8,100},{4,100},{0,100},{-36,100},{36,96},{-4,96},{-40,96},{36,92},{-8,92},{-44,92},{36,88},{-8,88},{-44,88},{32,84},{28,84},{-4,84},{-24,84},{-44,84},{24,80},{20,80},{16,80},{12,80},{8,80},{4,80},{0,80},{-24,80},{-28,80},{-44,80},{24,76},{-20,76},{-44,76},{24,72},{-20,72},{-44,72},{28,68},{-20,68},{-24,68},{-40,68},{28,64},{-24,64},{-28,64},{-32,64},{-36,64},{32,60},{24,60},{20,60},{-16,60},{-20,60},{-24,60},{36,56},{16,56},{12,56},{8,56},{4,56},{0,56},{-4,56},{-8,56},{-12,56},{-24,56},{36,52},{4,52},{-24,52},{40,48},{8,48},{0,48},{-28,48},{44,44},{12,44},{-4,44},{-32,44},{44,40},{12,40},{-4,40},{-32,40},{48,36},{16,36},{-8,36},{-32,36},{48,32},{20,32},{-8,32},{-32,32},{52,28},{24,28},{-12,28},{-32,28},{52,24},{28,24},{-12,24},{-36,24},{56,20},{32,20},{-12,20},{-36,20},{56,16},{32,16},{-16,16},{-40,16},{60,12},{36,12},{-16,12},{-44,12},{60,8},{36,8},{-20,8},{-44,8},{56,4},{52,4},{48,4},{44,4},{40,4},{36,4},{-24,4},{-28,4},{-32,4},{-36,4},{-40,4}};
-const short C1_Forward_1[138][2] = {{36,128},{32,128},{28,128},{24,128},{40,124},{44,120},{44,116},{40,112},{40,108},{36,108},{28,108},{24,108},{20,108},{16,108},{12,108},{-24,108},{-28,108},{32,104},{8,104},{4,104},{0,104},{-4,104},{-32,104},{36,100},{12,100},{-8,100},{-36,100},{36,96},{-8,96},{-40,96},{36,92},{-8,92},{-44,92},{36,88},{0,88},{-4,88},{-44,88},{32,84},{28,84},{8,84},{4,84},{-24,84},{-44,84},{24,80},{20,80},{16,80},{12,80},{-24,80},{-44,80},{24,76},{-24,76},{-28,76},{-44,76},{24,72},{-20,72},{-44,72},{28,68},{-20,68},{-44,68},{28,64},{-20,64},{-24,64},{-40,64},{32,60},{24,60},{20,60},{16,60},{-16,60},{-24,60},{-28,60},{-32,60},{-36,60},{36,56},{12,56},{8,56},{4,56},{0,56},{-4,56},{-8,56},{-12,56},{-24,56},{36,52},{4,52},{-24,52},{40,48},{8,48},{4,48},{-24,48},{40,44},{8,44},{0,44},{-28,44},{40,40},{8,40},{0,40},{-28,40},{44,36},{12,36},{-4,36},{-28,36},{44,32},{16,32},{-4,32},{-28,32},{44,28},{16,28},{-8,28},{-28,28},{44,24},{20,24},{-8,24},{-32,24},{48,20},{24,20},{-8,20},{-32,20},{48,16},{24,16},{-8,16},{-32,16},{48,12},{28,12},{-8,12},{-36,12},{48,8},{28,8},{-12,8},{-36,8},{44,4},{40,4},{36,4},{32,4},{28,4},{-16,4},{-20,4},{-24,4},{-28,4},{-32,4}};
-const short C1_Forward_2[137][2] = {{32,128},{28,128},{24,128},{36,124},{40,120},{40,116},{36,112},{24,112},{20,112},{16,112},{-24,112},{36,108},{28,108},{12,108},{8,108},{-28,108},{32,104},{8,104},{4,104},{0,104},{-4,104},{-32,104},{36,100},{12,100},{-8,100},{-36,100},{36,96},{-8,96},{-40,96},{36,92},{-8,92},{-44,92},{36,88},{0,88},{-4,88},{-44,88},{32,84},{28,84},{8,84},{4,84},{-24,84},{-44,84},{24,80},{20,80},{16,80},{12,80},{-24,80},{-44,80},{24,76},{-24,76},{-28,76},{-44,76},{24,72},{-20,72},{-44,72},{28,68},{-20,68},{-44,68},{28,64},{-20,64},{-24,64},{-40,64},{32,60},{24,60},{20,60},{16,60},{-12,60},{-16,60},{-24,60},{-28,60},{-32,60},{-36,60},{32,56},{12,56},{8,56},{4,56},{0,56},{-4,56},{-8,56},{-24,56},{32,52},{0,52},{-28,52},{36,48},{4,48},{0,48},{-28,48},{36,44},{4,44},{-4,44},{-32,44},{36,40},{4,40},{-4,40},{-32,40},{36,36},{4,36},{-8,36},{-32,36},{36,32},{8,32},{-8,32},{-32,32},{36,28},{8,28},{-12,28},{-32,28},{36,24},{12,24},{-12,24},{-36,24},{40,20},{16,20},{-12,20},{-36,20},{40,16},{16,16},{-12,16},{-36,16},{40,12},{20,12},{-12,12},{-36,12},{40,8},{20,8},{-16,8},{-36,8},{36,4},{32,4},{28,4},{24,4},{20,4},{-20,4},{-24,4},{-28,4},{-32,4},{-36,4}};
-const short C1_Forward_3[133][2] = {{36,128},{32,128},{28,128},{40,124},{44,120},{44,116},{40,112},{-20,112},{40,108},{32,108},{28,108},{24,108},{20,108},{16,108},{-24,108},{36,104},{12,104},{8,104},{4,104},{0,104},{-28,104},{40,100},{16,100},{-4,100},{-32,100},{40,96},{-4,96},{-36,96},{40,92},{-4,92},{-40,92},{40,88},{4,88},{0,88},{-40,88},{36,84},{32,84},{12,84},{8,84},{-20,84},{-40,84},{28,80},{24,80},{20,80},{16,80},{-20,80},{-40,80},{28,76},{-20,76},{-24,76},{-40,76},{28,72},{-16,72},{-40,72},{32,68},{-16,68},{-40,68},{32,64},{-16,64},{-20,64},{-36,64},{28,60},{24,60},{20,60},{16,60},{-8,60},{-12,60},{-20,60},{-24,60},{-28,60},{-32,60},{28,56},{12,56},{8,56},{4,56},{0,56},{-4,56},{-24,56},{32,52},{0,52},{-28,52},{32,48},{4,48},{0,48},{-28,48},{32,44},{4,44},{-4,44},{-32,44},{32,40},{4,40},{-4,40},{-32,40},{32,36},{4,36},{-8,36},{-32,36},{32,32},{4,32},{-12,32},{-32,32},{32,28},{4,28},{-12,28},{-36,28},{28,24},{4,24},{-12,24},{-36,24},{28,20},{4,20},{-16,20},{-40,20},{28,16},{0,16},{-20,16},{-40,16},{24,12},{20,12},{0,12},{-20,12},{-36,12},{20,8},{0,8},{-24,8},{-28,8},{-32,8},{20,4},{16,4},{12,4},{8,4},{4,4},{0,4}};
-const short C1_Forward_4[130][2] = {{36,128},{32,128},{28,128},{40,124},{44,120},{44,116},{40,112},{-20,112},{40,108},{32,108},{28,108},{12,108},{-24,108},{36,104},{24,104},{20,104},{16,104},{-28,104},{40,100},{12,100},{8,100},{4,100},{0,100},{-4,100},{-32,100},{40,96},{16,96},{-4,96},{-36,96},{40,92},{-4,92},{-40,92},{40,88},{-4,88},{-40,88},{36,84},{32,84},{4,84},{0,84},{-20,84},{-40,84},{28,80},{24,80},{20,80},{16,80},{12,80},{8,80},{-20,80},{-24,80},{-40,80},{24,76},{-16,76},{-40,76},{24,72},{-16,72},{-40,72},{28,68},{-16,68},{-20,68},{-36,68},{28,64},{-20,64},{-24,64},{-28,64},{-32,64},{28,60},{24,60},{20,60},{16,60},{-12,60},{-16,60},{-24,60},{28,56},{12,56},{8,56},{4,56},{0,56},{-4,56},{-8,56},{-24,56},{32,52},{0,52},{-28,52},{32,48},{4,48},{-4,48},{-32,48},{32,44},{4,44},{-8,44},{-32,44},{36,40},{8,40},{-12,40},{-36,40},{36,36},{12,36},{-16,36},{-36,36},{36,32},{12,32},{-16,32},{-40,32},{40,28},{16,28},{-20,28},{-40,28},{40,24},{16,24},{-20,24},{-44,24},{40,20},{16,20},{-24,20},{-44,20},{40,16},{16,16},{-28,16},{-44,16},{40,12},{20,12},{-32,12},{-36,12},{-40,12},{40,8},{20,8},{36,4},{32,4},{28,4},{24,4}};
-const short C1_Forward_5[138][2] = {{32,124},{28,124},{24,124},{36,120},{40,116},{40,112},{36,108},{-24,108},{36,104},{28,104},{24,104},{8,104},{-28,104},{32,100},{20,100},{16,100},{12,100},{-32,100},{36,96},{8,96},{4,96},{0,96},{-4,96},{-8,96},{-36,96},{36,92},{12,92},{-8,92},{-40,92},{36,88},{-8,88},{-44,88},{36,84},{-8,84},{-44,84},{32,80},{28,80},{0,80},{-4,80},{-24,80},{-44,80},{24,76},{20,76},{16,76},{12,76},{8,76},{4,76},{-24,76},{-28,76},{-44,76},{20,72},{-20,72},{-44,72},{20,68},{-20,68},{-44,68},{24,64},{-20,64},{-24,64},{-40,64},{24,60},{-24,60},{-28,60},{-32,60},{-36,60},{28,56},{24,56},{-20,56},{-28,56},{32,52},{20,52},{16,52},{12,52},{-8,52},{-12,52},{-16,52},{-28,52},{-32,52},{32,48},{8,48},{4,48},{0,48},{-4,48},{-36,48},{32,44},{4,44},{-8,44},{-36,44},{36,40},{8,40},{-12,40},{-40,40},{36,36},{12,36},{-16,36},{-40,36},{36,32},{12,32},{-16,32},{-40,32},{40,28},{16,28},{-16,28},{-40,28},{40,24},{16,24},{-16,24},{-44,24},{44,20},{20,20},{-20,20},{-44,20},{44,16},{20,16},{-24,16},{-48,16},{44,12},{24,12},{-24,12},{-48,12},{-52,12},{48,8},{24,8},{-24,8},{-52,8},{48,4},{44,4},{40,4},{36,4},{32,4},{28,4},{-28,4},{-32,4},{-36,4},{-40,4},{-44,4},{-48,4},{-52,4}};
-const short C1_Idle_0[141][2] = {{32,128},{28,128},{24,128},{36,124},{40,120},{40,116},{36,112},{36,108},{28,108},{24,108},{20,108},{16,108},{12,108},{-24,108},{32,104},{8,104},{4,104},{0,104},{-28,104},{36,100},{-20,100},{-32,100},{36,96},{8,96},{4,96},{0,96},{-20,96},{-36,96},{36,92},{-4,92},{-20,92},{-36,92},{36,88},{-8,88},{-20,88},{-40,88},{32,84},{28,84},{-8,84},{-24,84},{-40,84},{24,80},{20,80},{16,80},{12,80},{-4,80},{-20,80},{-24,80},{-40,80},{24,76},{8,76},{4,76},{0,76},{-16,76},{-40,76},{24,72},{-16,72},{-40,72},{28,68},{-16,68},{-20,68},{-36,68},{28,64},{-20,64},{-24,64},{-28,64},{-32,64},{32,60},{24,60},{20,60},{16,60},{-16,60},{-20,60},{-24,60},{36,56},{12,56},{8,56},{4,56},{0,56},{-4,56},{-8,56},{-12,56},{-24,56},{36,52},{4,52},{-24,52},{40,48},{8,48},{0,48},{-28,48},{40,44},{12,44},{0,44},{-28,44},{40,40},{12,40},{0,40},{-28,40},{40,36},{16,36},{-4,36},{-32,36},{40,32},{16,32},{-4,32},{-32,32},{40,28},{20,28},{-8,28},{-32,28},{40,24},{20,24},{-12,24},{-36,24},{44,20},{20,20},{-12,20},{-36,20},{44,16},{20,16},{-16,16},{-40,16},{48,12},{24,12},{-16,12},{-44,12},{48,8},{24,8},{-20,8},{-44,8},{44,4},{40,4},{36,4},{32,4},{28,4},{24,4},{-24,4},{-28,4},{-32,4},{-36,4},{-40,4}};
-const short C1_Idle_1[138][2] = {{32,128},{28,128},{24,128},{36,124},{40,120},{40,116},{36,112},{36,108},{28,108},{24,108},{20,108},{16,108},{12,108},{8,108},{-24,108},{32,104},{-28,104},{36,100},{8,100},{4,100},{0,100},{-20,100},{-32,100},{36,96},{-4,96},{-20,96},{-36,96},{36,92},{-8,92},{-20,92},{-36,92},{36,88},{-8,88},{-20,88},{-40,88},{32,84},{-4,84},{-20,84},{-24,84},{-40,84},{28,80},{24,80},{20,80},{16,80},{12,80},{8,80},{4,80},{0,80},{-16,80},{-40,80},{24,76},{-16,76},{-40,76},{24,72},{-16,72},{-20,72},{-36,72},{28,68},{-20,68},{-24,68},{-28,68},{-32,68},{28,64},{-24,64},{32,60},{24,60},{20,60},{16,60},{-16,60},{-20,60},{-24,60},{36,56},{12,56},{8,56},{4,56},{0,56},{-4,56},{-8,56},{-12,56},{-24,56},{36,52},{4,52},{-28,52},{36,48},{8,48},{0,48},{-28,48},{40,44},{12,44},{-4,44},{-28,44},{40,40},{12,40},{-4,40},{-32,40},{40,36},{16,36},{-4,36},{-32,36},{40,32},{16,32},{-8,32},{-32,32},{40,28},{16,28},{-8,28},{-36,28},{40,24},{20,24},{-12,24},{-36,24},{44,20},{20,20},{-12,20},{-36,20},{44,16},{20,16},{-16,16},{-40,16},{48,12},{24,12},{-20,12},{-44,12},{48,8},{24,8},{-20,8},{-44,8},{44,4},{40,4},{36,4},{32,4},{28,4},{24,4},{-24,4},{-28,4},{-32,4},{-36,4},{-40,4}};
-const short C1_Idle_2[143][2] = {{32,132},{28,132},{24,132},{36,128},{40,124},{40,120},{36,116},{36,112},{28,112},{24,112},{20,112},{16,112},{12,112},{8,112},{-24,112},{32,108},{-28,108},{36,104},{8,104},{4,104},{0,104},{-20,104},{-32,104},{36,100},{12,100},{-4,100},{-20,100},{-36,100},{36,96},{-8,96},{-20,96},{-36,96},{36,92},{-8,92},{-20,92},{-40,92},{32,88},{0,88},{-4,88},{-20,88},{-24,88},{-40,88},{28,84},{24,84},{20,84},{16,84},{12,84},{8,84},{4,84},{-16,84},{-40,84},{24,80},{-16,80},{-40,80},{28,76},{-16,76},{-20,76},{-36,76},{28,72},{-20,72},{-24,72},{-28,72},{-32,72},{28,68},{-24,68},{32,64},{24,64},{20,64},{16,64},{-16,64},{-20,64},{-24,64},{32,60},{12,60},{8,60},{4,60},{0,60},{-4,60},{-8,60},{-12,60},{-24,60},{36,56},{4,56},{-24,56},{36,52},{8,52},{0,52},{-28,52},{36,48},{8,48},{0,48},{-28,48},{36,44},{12,44},{-4,44},{-28,44},{40,40},{16,40},{-4,40},{-28,40},{40,36},{16,36},{-4,36},{-32,36},{40,32},{16,32},{-8,32},{-32,32},{40,28},{16,28},{-8,28},{-36,28},{40,24},{20,24},{-12,24},{-36,24},{44,20},{20,20},{-12,20},{-36,20},{44,16},{20,16},{-16,16},{-40,16},{48,12},{24,12},{-16,12},{-44,12},{48,8},{24,8},{-20,8},{-44,8},{44,4},{40,4},{36,4},{32,4},{28,4},{24,4},{-24,4},{-28,4},{-32,4},{-36,4},{-40,4}};
-const short C1_Idle_3[143][2] = {{28,132},{24,132},{36,128},{32,128},{40,124},{40,120},{40,116},{36,112},{28,112},{24,112},{20,112},{16,112},{12,112},{8,112},{-24,112},{32,108},{-28,108},{36,104},{8,104},{4,104},{0,104},{-20,104},{-32,104},{36,100},{12,100},{-4,100},{-20,100},{-36,100},{36,96},{-8,96},{-20,96},{-36,96},{36,92},{-8,92},{-20,92},{-40,92},{32,88},{0,88},{-4,88},{-20,88},{-24,88},{-40,88},{28,84},{24,84},{20,84},{16,84},{12,84},{8,84},{4,84},{-16,84},{-40,84},{24,80},{-16,80},{-40,80},{28,76},{-16,76},{-20,76},{-36,76},{28,72},{-20,72},{-24,72},{-28,72},{-32,72},{28,68},{-24,68},{32,64},{24,64},{20,64},{16,64},{-16,64},{-20,64},{-24,64},{32,60},{12,60},{8,60},{4,60},{0,60},{-4,60},{-8,60},{-12,60},{-24,60},{36,56},{4,56},{-24,56},{36,52},{8,52},{0,52},{-28,52},{36,48},{8,48},{0,48},{-28,48},{36,44},{12,44},{-4,44},{-28,44},{40,40},{16,40},{-4,40},{-28,40},{40,36},{16,36},{-4,36},{-32,36},{40,32},{16,32},{-8,32},{-32,32},{40,28},{16,28},{-8,28},{-36,28},{40,24},{20,24},{-12,24},{-36,24},{44,20},{20,20},{-12,20},{-36,20},{44,16},{20,16},{-16,16},{-40,16},{48,12},{24,12},{-16,12},{-44,12},{48,8},{24,8},{-20,8},{-44,8},{44,4},{40,4},{36,4},{32,4},{28,4},{24,4},{-24,4},{-28,4},{-32,4},{-36,4},{-40,4}};
-const short C1_Idle_4[139][2] = {{32,128},{28,128},{24,128},{36,124},{40,120},{40,116},{40,112},{36,108},{28,108},{24,108},{20,108},{16,108},{12,108},{8,108},{-24,108},{32,104},{-28,104},{36,100},{8,100},{4,100},{0,100},{-20,100},{-32,100},{36,96},{-4,96},{-20,96},{-36,96},{36,92},{-8,92},{-20,92},{-36,92},{36,88},{-8,88},{-20,88},{-40,88},{32,84},{28,84},{-4,84},{-20,84},{-24,84},{-40,84},{24,80},{20,80},{16,80},{12,80},{8,80},{4,80},{0,80},{-16,80},{-40,80},{24,76},{-16,76},{-40,76},{24,72},{-16,72},{-20,72},{-36,72},{28,68},{-20,68},{-24,68},{-28,68},{-32,68},{32,64},{28,64},{-24,64},{32,60},{24,60},{20,60},{16,60},{-16,60},{-20,60},{-24,60},{36,56},{12,56},{8,56},{4,56},{0,56},{-4,56},{-8,56},{-12,56},{-24,56},{36,52},{4,52},{-28,52},{40,48},{8,48},{0,48},{-28,48},{40,44},{12,44},{0,44},{-28,44},{40,40},{12,40},{-4,40},{-28,40},{40,36},{16,36},{-4,36},{-32,36},{40,32},{16,32},{-8,32},{-32,32},{40,28},{16,28},{-8,28},{-36,28},{40,24},{20,24},{-8,24},{-36,24},{44,20},{20,20},{-12,20},{-36,20},{44,16},{20,16},{-16,16},{-40,16},{48,12},{24,12},{-16,12},{-44,12},{48,8},{24,8},{-20,8},{-44,8},{44,4},{40,4},{36,4},{32,4},{28,4},{24,4},{-24,4},{-28,4},{-32,4},{-36,4},{-40,4}};
-const short C1_Jump_0[130][2] = {{12,108},{8,108},{4,108},{16,104},{20,100},{20,96},{16,96},{12,96},{8,96},{4,96},{0,96},{28,92},{24,92},{-4,92},{-8,92},{36,88},{32,88},{40,84},{-32,84},{44,80},{0,80},{-4,80},{-32,80},{44,76},{24,76},{20,76},{16,76},{12,76},{8,76},{4,76},{-28,76},{-32,76},{48,72},{28,72},{16,72},{-28,72},{-36,72},{48,68},{24,68},{20,68},{-24,68},{-40,68},{48,64},{28,64},{20,64},{-20,64},{-40,64},{44,60},{40,60},{36,60},{32,60},{20,60},{-16,60},{-40,60},{20,56},{-16,56},{-20,56},{-24,56},{-28,56},{-32,56},{-36,56},{20,52},{-20,52},{-40,52},{-44,52},{-48,52},{20,48},{-12,48},{-16,48},{-52,48},{20,44},{0,44},{-4,44},{-8,44},{-12,44},{-52,44},{20,40},{12,40},{8,40},{4,40},{-16,40},{-52,40},{16,36},{12,36},{-20,36},{-52,36},{20,32},{8,32},{-20,32},{-48,32},{28,28},{24,28},{4,28},{-20,28},{-44,28},{32,24},{-20,24},{-40,24},{36,20},{-16,20},{-36,20},{36,16},{-8,16},{-12,16},{-32,16},{40,12},{16,12},{12,12},{8,12},{4,12},{0,12},{-4,12},{-8,12},{-32,12},{44,8},{20,8},{-12,8},{-16,8},{-36,8},{44,4},{40,4},{36,4},{32,4},{28,4},{24,4},{-20,4},{-24,4},{-28,4},{-32,4},{-36,4}};
-const short C1_Jump_1[137][2] = {{4,124},{0,124},{-4,124},{8,120},{12,116},{12,112},{8,112},{4,112},{0,112},{-4,112},{-8,112},{20,108},{16,108},{-12,108},{-16,108},{28,104},{24,104},{32,100},{-40,100},{36,96},{-8,96},{-12,96},{-40,96},{36,92},{16,92},{12,92},{8,92},{4,92},{0,92},{-4,92},{-36,92},{-40,92},{40,88},{20,88},{8,88},{-36,88},{-44,88},{40,84},{16,84},{12,84},{-32,84},{-48,84},{40,80},{20,80},{12,80},{-28,80},{-48,80},{36,76},{32,76},{28,76},{24,76},{12,76},{-24,76},{-48,76},{12,72},{-24,72},{-28,72},{-32,72},{-36,72},{-40,72},{-44,72},{12,68},{-28,68},{12,64},{-24,64},{-28,64},{12,60},{-8,60},{-12,60},{-16,60},{-20,60},{-32,60},{12,56},{4,56},{0,56},{-4,56},{-16,56},{-32,56},{8,52},{-16,52},{-32,52},{8,48},{-16,48},{-32,48},{8,44},{-16,44},{-36,44},{8,40},{-16,40},{-36,40},{12,36},{8,36},{-16,36},{-36,36},{20,32},{16,32},{-16,32},{-36,32},{24,28},{-16,28},{-36,28},{36,24},{32,24},{28,24},{-12,24},{-36,24},{40,20},{-4,20},{-8,20},{-12,20},{-36,20},{40,16},{0,16},{-12,16},{-36,16},{40,12},{8,12},{4,12},{-12,12},{-32,12},{40,8},{20,8},{16,8},{12,8},{-12,8},{-36,8},{36,4},{32,4},{28,4},{24,4},{-12,4},{-16,4},{-20,4},{-24,4},{-28,4},{-32,4},{-36,4}};
-const short C1_Jump_2[123][2] = {{32,136},{28,136},{24,136},{36,132},{40,128},{40,124},{20,124},{16,124},{-20,124},{36,120},{24,120},{12,120},{8,120},{4,120},{-24,120},{36,116},{28,116},{-24,116},{32,112},{-28,112},{36,108},{-20,108},{-32,108},{36,104},{8,104},{4,104},{0,104},{-20,104},{-24,104},{-28,104},{-32,104},{-36,104},{-40,104},{-44,104},{36,100},{-4,100},{-16,100},{-48,100},{36,96},{-8,96},{-16,96},{-48,96},{32,92},{28,92},{-8,92},{-16,92},{-48,92},{24,88},{20,88},{16,88},{12,88},{-4,88},{-12,88},{-48,88},{24,84},{8,84},{4,84},{0,84},{-12,84},{-44,84},{24,80},{-8,80},{-20,80},{-44,80},{20,76},{-4,76},{-16,76},{-44,76},{20,72},{4,72},{0,72},{-12,72},{-16,72},{-40,72},{16,68},{12,68},{8,68},{-8,68},{-16,68},{-40,68},{16,64},{-8,64},{-16,64},{-40,64},{16,60},{-8,60},{-16,60},{-40,60},{16,56},{-8,56},{-16,56},{-36,56},{16,52},{-8,52},{-16,52},{-32,52},{16,48},{-8,48},{-20,48},{-24,48},{-28,48},{16,44},{-8,44},{16,40},{-8,40},{16,36},{-4,36},{16,32},{-4,32},{20,28},{-4,28},{20,24},{-4,24},{20,20},{-4,20},{16,16},{0,16},{16,12},{0,12},{16,8},{4,8},{12,4},{8,4}};
-const short C1_Land_0[151][2] = {{36,156},{32,156},{28,156},{24,156},{40,152},{44,148},{48,144},{48,140},{56,136},{52,136},{48,136},{44,136},{40,136},{36,136},{60,132},{32,132},{-20,132},{64,128},{28,128},{-24,128},{64,124},{24,124},{-28,124},{64,120},{44,120},{40,120},{20,120},{16,120},{-32,120},{60,116},{36,116},{-36,116},{56,112},{32,112},{-40,112},{56,108},{32,108},{-16,108},{-20,108},{-24,108},{-40,108},{52,104},{36,104},{32,104},{28,104},{-12,104},{-24,104},{-44,104},{48,100},{44,100},{40,100},{28,100},{-12,100},{-28,100},{-44,100},{28,96},{-12,96},{-28,96},{-44,96},{28,92},{-12,92},{-32,92},{-36,92},{-40,92},{28,88},{-4,88},{-8,88},{-12,88},{-16,88},{-20,88},{28,84},{0,84},{-24,84},{32,80},{8,80},{4,80},{-28,80},{32,76},{16,76},{12,76},{-28,76},{36,72},{28,72},{24,72},{20,72},{-28,72},{36,68},{8,68},{4,68},{0,68},{-28,68},{40,64},{12,64},{-4,64},{-28,64},{40,60},{12,60},{-8,60},{-32,60},{40,56},{16,56},{-8,56},{-32,56},{40,52},{16,52},{-8,52},{-32,52},{44,48},{20,48},{-12,48},{-32,48},{44,44},{20,44},{-12,44},{-32,44},{44,40},{20,40},{-12,40},{-32,40},{44,36},{24,36},{-12,36},{-36,36},{48,32},{28,32},{-12,32},{-36,32},{48,28},{28,28},{-12,28},{-36,28},{48,24},{28,24},{-16,24},{-20,24},{-36,24},{48,20},{28,20},{-24,20},{-28,20},{-32,20},{48,16},{28,16},{52,12},{32,12},{52,8},{32,8},{48,4},{44,4},{40,4},{36,4}};
-const short C1_Land_1[133][2] = {{-44,120},{-48,120},{-52,120},{-56,120},{-60,120},{-28,116},{-32,116},{-36,116},{-40,116},{-64,116},{-68,116},{-72,112},{-72,108},{-44,104},{-48,104},{-52,104},{-56,104},{-72,104},{20,100},{16,100},{12,100},{8,100},{-56,100},{-60,100},{-64,100},{-68,100},{24,96},{28,92},{32,88},{32,84},{32,80},{28,76},{24,72},{20,68},{16,68},{12,68},{16,64},{8,64},{16,60},{4,60},{16,56},{0,56},{-4,56},{-8,56},{-12,56},{-16,56},{20,52},{-20,52},{-24,52},{-28,52},{-32,52},{-36,52},{-40,52},{20,48},{-16,48},{-40,48},{-44,48},{24,44},{20,44},{0,44},{-16,44},{-44,44},{28,40},{20,40},{0,40},{-12,40},{-44,40},{32,36},{20,36},{0,36},{-4,36},{-8,36},{-24,36},{-44,36},{32,32},{20,32},{0,32},{-24,32},{-44,32},{40,28},{36,28},{16,28},{0,28},{-8,28},{-12,28},{-16,28},{-20,28},{-48,28},{44,24},{16,24},{-4,24},{-20,24},{-24,24},{-48,24},{44,20},{20,20},{12,20},{-4,20},{-24,20},{-28,20},{-52,20},{44,16},{28,16},{24,16},{12,16},{-8,16},{-28,16},{-52,16},{44,12},{32,12},{12,12},{-8,12},{-28,12},{-52,12},{44,8},{32,8},{12,8},{-8,8},{-28,8},{-52,8},{44,4},{40,4},{36,4},{8,4},{4,4},{0,4},{-4,4},{-32,4},{-36,4},{-40,4},{-44,4},{-48,4},{-52,4}};
-const short C1_Land_2[126][2] = {{-20,128},{-24,128},{-28,128},{-32,128},{-36,128},{-40,128},{-16,124},{-44,124},{-44,120},{-28,116},{-44,116},{-32,112},{-36,112},{-40,112},{24,88},{20,88},{32,84},{28,84},{-24,84},{36,80},{32,80},{36,76},{36,72},{36,68},{16,68},{12,68},{-16,68},{32,64},{20,64},{8,64},{4,64},{0,64},{-12,64},{32,60},{20,60},{-16,60},{28,56},{24,56},{-16,56},{24,52},{20,52},{-20,52},{-24,52},{-28,52},{-32,52},{-36,52},{-40,52},{20,48},{-16,48},{-40,48},{-44,48},{24,44},{20,44},{-4,44},{-16,44},{-44,44},{28,40},{16,40},{-4,40},{-12,40},{-44,40},{32,36},{16,36},{-4,36},{-8,36},{-24,36},{-44,36},{32,32},{16,32},{-4,32},{-24,32},{-44,32},{40,28},{36,28},{16,28},{-4,28},{-8,28},{-12,28},{-16,28},{-20,28},{-48,28},{44,24},{16,24},{-4,24},{-20,24},{-24,24},{-48,24},{44,20},{20,20},{12,20},{-4,20},{-24,20},{-28,20},{-52,20},{44,16},{28,16},{24,16},{12,16},{-8,16},{-28,16},{-52,16},{44,12},{32,12},{12,12},{-8,12},{-28,12},{-52,12},{44,8},{32,8},{12,8},{-8,8},{-28,8},{-52,8},{44,4},{40,4},{36,4},{8,4},{4,4},{0,4},{-4,4},{-32,4},{-36,4},{-40,4},{-44,4},{-48,4},{-52,4}};
-const short C1_StandGuard_0[146][2] = {{36,120},{32,120},{28,120},{48,116},{44,116},{40,116},{36,116},{32,116},{28,116},{24,116},{-16,116},{48,112},{36,112},{-8,112},{-12,112},{-20,112},{48,108},{40,108},{-4,108},{-24,108},{48,104},{44,104},{40,104},{-4,104},{-28,104},{44,100},{40,100},{16,100},{12,100},{8,100},{-4,100},{-28,100},{40,96},{20,96},{4,96},{-4,96},{-28,96},{40,92},{0,92},{-4,92},{-28,92},{36,88},{0,88},{-4,88},{-28,88},{32,84},{8,84},{4,84},{-8,84},{-28,84},{28,80},{24,80},{20,80},{16,80},{12,80},{-12,80},{-24,80},{28,76},{-12,76},{-16,76},{-20,76},{32,72},{-12,72},{36,68},{-16,68},{40,64},{36,64},{32,64},{28,64},{24,64},{-12,64},{-16,64},{44,60},{24,60},{20,60},{16,60},{12,60},{8,60},{4,60},{0,60},{-4,60},{-8,60},{-12,60},{-20,60},{44,56},{8,56},{-20,56},{44,52},{12,52},{4,52},{-24,52},{44,48},{16,48},{4,48},{-24,48},{44,44},{16,44},{4,44},{-24,44},{44,40},{16,40},{0,40},{-28,40},{44,36},{16,36},{0,36},{-28,36},{40,32},{16,32},{0,32},{-28,32},{40,28},{16,28},{-4,28},{-32,28},{40,24},{20,24},{-4,24},{-32,24},{44,20},{20,20},{-8,20},{-32,20},{44,16},{20,16},{-8,16},{-32,16},{48,12},{24,12},{-12,12},{-36,12},{48,8},{24,8},{-12,8},{-36,8},{44,4},{40,4},{36,4},{32,4},{28,4},{24,4},{-16,4},{-20,4},{-24,4},{-28,4},{-32,4}};
-const short C1_StandGuard_1[143][2] = {{48,120},{44,120},{40,120},{36,120},{32,120},{56,116},{52,116},{48,116},{36,116},{32,116},{28,116},{56,112},{40,112},{-4,112},{-8,112},{-12,112},{56,108},{44,108},{0,108},{-16,108},{52,104},{48,104},{44,104},{4,104},{-20,104},{44,100},{20,100},{16,100},{12,100},{4,100},{-20,100},{44,96},{24,96},{8,96},{4,96},{-20,96},{44,92},{4,92},{-20,92},{40,88},{4,88},{-20,88},{36,84},{12,84},{8,84},{0,84},{-20,84},{32,80},{28,80},{24,80},{20,80},{16,80},{-4,80},{-16,80},{32,76},{-8,76},{-12,76},{32,72},{-12,72},{36,68},{-16,68},{40,64},{36,64},{-16,64},{44,60},{36,60},{32,60},{28,60},{24,60},{20,60},{16,60},{-4,60},{-8,60},{-12,60},{-16,60},{-20,60},{44,56},{16,56},{12,56},{8,56},{4,56},{0,56},{-4,56},{-20,56},{44,52},{12,52},{4,52},{-24,52},{44,48},{16,48},{4,48},{-24,48},{44,44},{16,44},{4,44},{-24,44},{44,40},{16,40},{0,40},{-28,40},{44,36},{16,36},{0,36},{-28,36},{40,32},{16,32},{0,32},{-28,32},{40,28},{16,28},{-4,28},{-32,28},{40,24},{20,24},{-4,24},{-32,24},{44,20},{20,20},{-8,20},{-32,20},{44,16},{20,16},{-8,16},{-32,16},{48,12},{24,12},{-12,12},{-36,12},{48,8},{24,8},{-12,8},{-36,8},{44,4},{40,4},{36,4},{32,4},{28,4},{24,4},{-16,4},{-20,4},{-24,4},{-28,4},{-32,4}};
-const short C2_Attack_0_0[131][2] = {{16,88},{12,88},{20,84},{24,80},{20,80},{-40,80},{-44,80},{-48,80},{28,76},{20,76},{-20,76},{-24,76},{-28,76},{-36,76},{-52,76},{28,72},{16,72},{8,72},{4,72},{0,72},{-4,72},{-8,72},{-12,72},{-16,72},{-28,72},{-32,72},{-52,72},{28,68},{12,68},{-28,68},{-52,68},{28,64},{-28,64},{-48,64},{28,60},{-20,60},{-24,60},{-28,60},{-44,60},{24,56},{12,56},{-8,56},{-12,56},{-16,56},{-32,56},{-36,56},{-40,56},{20,52},{8,52},{4,52},{0,52},{-4,52},{-12,52},{-24,52},{-28,52},{20,48},{-12,48},{-24,48},{20,44},{-8,44},{-28,44},{-32,44},{-36,44},{24,40},{-8,40},{-20,40},{-24,40},{-40,40},{24,36},{4,36},{0,36},{-4,36},{-8,36},{-12,36},{-16,36},{-44,36},{28,32},{20,32},{16,32},{12,32},{8,32},{-4,32},{-44,32},{32,28},{0,28},{-8,28},{-44,28},{40,24},{36,24},{0,24},{-12,24},{-16,24},{-44,24},{56,20},{52,20},{48,20},{44,20},{4,20},{-20,20},{-44,20},{60,16},{8,16},{-16,16},{-44,16},{64,12},{20,12},{16,12},{12,12},{-16,12},{-40,12},{68,8},{36,8},{32,8},{28,8},{24,8},{-20,8},{-44,8},{68,4},{64,4},{60,4},{56,4},{52,4},{48,4},{44,4},{40,4},{-24,4},{-28,4},{-32,4},{-36,4},{-40,4},{-44,4}};
-const short C2_Attack_0_1[119][2] = {{20,84},{16,84},{24,80},{-36,80},{-40,80},{-44,80},{28,76},{24,76},{-32,76},{-48,76},{32,72},{24,72},{-20,72},{-24,72},{-28,72},{-48,72},{36,68},{20,68},{-8,68},{-20,68},{-48,68},{40,64},{16,64},{-8,64},{-20,64},{-44,64},{40,60},{12,60},{8,60},{4,60},{0,60},{-4,60},{-8,60},{-12,60},{-16,60},{-40,60},{44,56},{-8,56},{-28,56},{-32,56},{-36,56},{44,52},{20,52},{-8,52},{-24,52},{48,48},{24,48},{20,48},{-8,48},{-24,48},{48,44},{28,44},{20,44},{-8,44},{-28,44},{-32,44},{-36,44},{48,40},{28,40},{20,40},{-12,40},{-20,40},{-24,40},{-40,40},{48,36},{32,36},{16,36},{12,36},{8,36},{4,36},{0,36},{-4,36},{-8,36},{-12,36},{-16,36},{-40,36},{48,32},{32,32},{16,32},{-12,32},{-40,32},{48,28},{32,28},{20,28},{-16,28},{-40,28},{44,24},{40,24},{36,24},{24,24},{-16,24},{-40,24},{28,20},{-16,20},{-40,20},{28,16},{-12,16},{-16,16},{-40,16},{28,12},{-8,12},{-12,12},{-36,12},{24,8},{20,8},{16,8},{12,8},{8,8},{4,8},{0,8},{-4,8},{-16,8},{-40,8},{-20,4},{-24,4},{-28,4},{-32,4},{-36,4},{-40,4}};
-const short C2_Attack_0_2[143][2] = {{0,76},{4,72},{-4,72},{40,68},{36,68},{-4,68},{44,64},{-4,64},{44,60},{0,60},{44,56},{0,56},{48,52},{40,52},{12,52},{0,52},{-4,52},{-20,52},{-24,52},{-28,52},{-32,52},{52,48},{36,48},{8,48},{0,48},{-8,48},{-12,48},{-16,48},{-36,48},{56,44},{32,44},{28,44},{24,44},{20,44},{16,44},{12,44},{8,44},{4,44},{-12,44},{-40,44},{56,40},{0,40},{-16,40},{-40,40},{60,36},{40,36},{36,36},{32,36},{-4,36},{-16,36},{-40,36},{60,32},{40,32},{28,32},{-4,32},{-20,32},{-24,32},{-40,32},{60,28},{44,28},{40,28},{24,28},{-8,28},{-12,28},{-20,28},{-28,28},{-32,28},{-36,28},{-40,28},{-44,28},{-92,28},{-96,28},{64,24},{44,24},{24,24},{-16,24},{-20,24},{-48,24},{-52,24},{-56,24},{-60,24},{-64,24},{-68,24},{-72,24},{-76,24},{-80,24},{-84,24},{-88,24},{-100,24},{64,20},{48,20},{20,20},{-20,20},{-88,20},{-100,20},{64,16},{48,16},{16,16},{-16,16},{-100,16},{72,12},{68,12},{48,12},{12,12},{-12,12},{-100,12},{76,8},{52,8},{12,8},{-8,8},{-100,8},{76,4},{72,4},{68,4},{64,4},{60,4},{56,4},{8,4},{4,4},{0,4},{-4,4},{-12,4},{-16,4},{-20,4},{-24,4},{-28,4},{-32,4},{-36,4},{-40,4},{-44,4},{-48,4},{-52,4},{-56,4},{-60,4},{-64,4},{-68,4},{-72,4},{-76,4},{-80,4},{-84,4},{-88,4},{-92,4},{-96,4}};
-const short C2_Attack_0_3[129][2] = {{-16,88},{-20,88},{-24,88},{-12,84},{-28,84},{-4,80},{-8,80},{-28,80},{0,76},{-28,76},{36,72},{32,72},{-20,72},{-24,72},{40,68},{-16,68},{40,64},{-8,64},{-12,64},{40,60},{-4,60},{36,56},{8,56},{-4,56},{44,52},{32,52},{8,52},{-4,52},{48,48},{28,48},{24,48},{20,48},{16,48},{12,48},{8,48},{4,48},{0,48},{-8,48},{-12,48},{-16,48},{-20,48},{-24,48},{52,44},{4,44},{0,44},{-4,44},{-28,44},{-32,44},{52,40},{8,40},{-8,40},{-12,40},{-36,40},{-40,40},{56,36},{36,36},{32,36},{8,36},{-16,36},{-20,36},{-40,36},{56,32},{36,32},{28,32},{12,32},{-24,32},{-28,32},{-32,32},{-40,32},{56,28},{40,28},{36,28},{24,28},{12,28},{-36,28},{-40,28},{60,24},{40,24},{24,24},{12,24},{-44,24},{-48,24},{60,20},{44,20},{24,20},{16,20},{-52,20},{60,16},{44,16},{24,16},{16,16},{12,16},{8,16},{4,16},{0,16},{-4,16},{-8,16},{-12,16},{-16,16},{-52,16},{68,12},{64,12},{44,12},{20,12},{-4,12},{-20,12},{-24,12},{-28,12},{-32,12},{-36,12},{-40,12},{-44,12},{-48,12},{-52,12},{72,8},{48,8},{-4,8},{-28,8},{72,4},{68,4},{64,4},{60,4},{56,4},{52,4},{-8,4},{-12,4},{-16,4},{-20,4},{-24,4}};
-const short C2_Attack_0_4[117][2] = {{20,84},{24,80},{-36,80},{-40,80},{-44,80},{28,76},{24,76},{-32,76},{-48,76},{32,72},{24,72},{-20,72},{-24,72},{-28,72},{-48,72},{36,68},{20,68},{-8,68},{-20,68},{-48,68},{40,64},{16,64},{-8,64},{-20,64},{-44,64},{40,60},{12,60},{8,60},{4,60},{0,60},{-4,60},{-8,60},{-12,60},{-16,60},{-40,60},{44,56},{-8,56},{-28,56},{-32,56},{-36,56},{44,52},{20,52},{-8,52},{-24,52},{48,48},{24,48},{20,48},{-8,48},{-24,48},{48,44},{28,44},{20,44},{-8,44},{-28,44},{-32,44},{-36,44},{48,40},{28,40},{20,40},{-12,40},{-16,40},{-20,40},{-24,40},{-40,40},{48,36},{32,36},{16,36},{12,36},{8,36},{4,36},{0,36},{-4,36},{-8,36},{-40,36},{48,32},{32,32},{16,32},{-12,32},{-40,32},{48,28},{32,28},{20,28},{-16,28},{-40,28},{44,24},{40,24},{36,24},{24,24},{-16,24},{-40,24},{28,20},{-16,20},{-40,20},{28,16},{-12,16},{-16,16},{-40,16},{28,12},{-8,12},{-12,12},{-36,12},{24,8},{20,8},{16,8},{12,8},{8,8},{4,8},{0,8},{-4,8},{-16,8},{-40,8},{-20,4},{-24,4},{-28,4},{-32,4},{-36,4},{-40,4}};
-const short C2_Attack_1_0[140][2] = {{16,128},{24,124},{20,124},{16,124},{-24,124},{-28,124},{-32,124},{36,120},{32,120},{28,120},{20,120},{-36,120},{40,116},{20,116},{-40,116},{44,112},{16,112},{-24,112},{-44,112},{48,108},{24,108},{12,108},{-8,108},{-20,108},{-32,108},{-36,108},{-48,108},{48,104},{24,104},{20,104},{8,104},{4,104},{0,104},{-4,104},{-8,104},{-12,104},{-16,104},{-20,104},{-24,104},{-28,104},{-48,104},{48,100},{28,100},{24,100},{20,100},{-8,100},{-20,100},{-28,100},{-48,100},{44,96},{40,96},{36,96},{32,96},{20,96},{-8,96},{-20,96},{-28,96},{-48,96},{20,92},{-8,92},{-20,92},{-32,92},{-36,92},{-40,92},{-44,92},{24,88},{-8,88},{-20,88},{24,84},{-4,84},{-20,84},{24,80},{20,80},{-4,80},{-20,80},{28,76},{16,76},{0,76},{-20,76},{32,72},{12,72},{4,72},{-24,72},{36,68},{8,68},{4,68},{-24,68},{40,64},{8,64},{0,64},{-4,64},{-8,64},{-12,64},{-16,64},{-20,64},{40,60},{12,60},{-16,60},{44,56},{12,56},{-16,56},{44,52},{12,52},{-16,52},{40,48},{12,48},{-16,48},{40,44},{16,44},{-12,44},{36,40},{16,40},{-12,40},{36,36},{16,36},{-12,36},{32,32},{16,32},{-12,32},{28,28},{16,28},{-12,28},{24,24},{16,24},{-12,24},{20,20},{12,20},{-12,20},{16,16},{12,16},{-12,16},{8,12},{-8,12},{12,8},{-8,8},{12,4},{8,4},{4,4},{0,4},{-4,4}};
-const short C2_Attack_1_1[147][2] = {{16,124},{24,120},{20,120},{16,120},{-24,120},{-28,120},{-32,120},{-36,120},{32,116},{28,116},{20,116},{-40,116},{44,112},{40,112},{36,112},{20,112},{-44,112},{48,108},{16,108},{-20,108},{-48,108},{52,104},{12,104},{-4,104},{-16,104},{-36,104},{-40,104},{-52,104},{56,100},{32,100},{20,100},{8,100},{4,100},{0,100},{-4,100},{-8,100},{-12,100},{-20,100},{-24,100},{-28,100},{-32,100},{-52,100},{56,96},{32,96},{28,96},{24,96},{20,96},{-4,96},{-20,96},{-32,96},{-52,96},{56,92},{36,92},{20,92},{-4,92},{-20,92},{-32,92},{-52,92},{52,88},{48,88},{44,88},{40,88},{20,88},{-4,88},{-20,88},{-36,88},{-40,88},{-44,88},{-48,88},{20,84},{-4,84},{-20,84},{20,80},{-4,80},{-20,80},{20,76},{0,76},{-20,76},{20,72},{0,72},{-24,72},{24,68},{0,68},{-24,68},{20,64},{16,64},{0,64},{-12,64},{-16,64},{-20,64},{20,60},{12,60},{8,60},{4,60},{-4,60},{-8,60},{-20,60},{20,56},{8,56},{-16,56},{20,52},{8,52},{-16,52},{-20,52},{16,48},{12,48},{-16,48},{-24,48},{12,44},{-12,44},{-28,44},{12,40},{-12,40},{-32,40},{12,36},{-12,36},{-36,36},{12,32},{-12,32},{-40,32},{12,28},{-12,28},{-16,28},{-20,28},{-40,28},{12,24},{-12,24},{-20,24},{-36,24},{12,20},{-12,20},{-20,20},{-32,20},{12,16},{-12,16},{-24,16},{-28,16},{12,12},{-8,12},{16,8},{-8,8},{16,4},{12,4},{8,4},{4,4},{0,4},{-4,4}};
-const short C2_Attack_1_2[150][2] = {{28,120},{24,120},{20,120},{36,116},{32,116},{24,116},{-20,116},{-24,116},{-28,116},{-32,116},{48,112},{44,112},{40,112},{24,112},{-36,112},{52,108},{20,108},{-20,108},{-40,108},{56,104},{16,104},{-20,104},{-44,104},{60,100},{36,100},{24,100},{12,100},{8,100},{4,100},{0,100},{-16,100},{-32,100},{-36,100},{-48,100},{60,96},{36,96},{32,96},{28,96},{24,96},{0,96},{-4,96},{-8,96},{-12,96},{-20,96},{-24,96},{-28,96},{-48,96},{60,92},{40,92},{24,92},{0,92},{-20,92},{-28,92},{-48,92},{56,88},{52,88},{48,88},{44,88},{20,88},{0,88},{-20,88},{-28,88},{-48,88},{20,84},{0,84},{-20,84},{-32,84},{-36,84},{-40,84},{-44,84},{20,80},{0,80},{-20,80},{20,76},{4,76},{-24,76},{24,72},{4,72},{-24,72},{24,68},{4,68},{-28,68},{20,64},{16,64},{12,64},{4,64},{-20,64},{-24,64},{16,60},{8,60},{4,60},{-8,60},{-12,60},{-16,60},{-24,60},{16,56},{8,56},{0,56},{-4,56},{-24,56},{12,52},{8,52},{-20,52},{12,48},{-16,48},{-20,48},{12,44},{-12,44},{-16,44},{-24,44},{12,40},{-12,40},{-24,40},{12,36},{-12,36},{-28,36},{16,32},{-8,32},{-32,32},{16,28},{-8,28},{-36,28},{16,24},{-8,24},{-12,24},{-36,24},{16,20},{-4,20},{-16,20},{-36,20},{16,16},{-4,16},{-20,16},{-36,16},{16,12},{0,12},{-20,12},{-36,12},{20,8},{0,8},{-20,8},{-36,8},{20,4},{16,4},{12,4},{8,4},{4,4},{-24,4},{-28,4},{-32,4}};
-const short C2_Attack_1_3[136][2] = {{32,120},{36,116},{44,112},{40,112},{36,112},{-12,112},{-16,112},{-20,112},{-24,112},{48,108},{32,108},{-28,108},{52,104},{28,104},{-12,104},{-32,104},{52,100},{24,100},{20,100},{4,100},{-8,100},{-36,100},{56,96},{36,96},{32,96},{16,96},{12,96},{8,96},{4,96},{0,96},{-4,96},{-24,96},{-28,96},{-40,96},{60,92},{36,92},{32,92},{4,92},{-16,92},{-20,92},{-40,92},{60,88},{40,88},{32,88},{4,88},{-20,88},{-40,88},{60,84},{40,84},{28,84},{0,84},{-20,84},{-40,84},{56,80},{52,80},{48,80},{44,80},{24,80},{0,80},{-20,80},{-24,80},{-28,80},{-32,80},{-36,80},{28,76},{0,76},{-20,76},{28,72},{24,72},{20,72},{0,72},{-20,72},{20,68},{16,68},{12,68},{8,68},{0,68},{-24,68},{24,64},{20,64},{4,64},{-24,64},{28,60},{0,60},{-4,60},{-8,60},{-12,60},{-16,60},{-20,60},{28,56},{-24,56},{32,52},{4,52},{-24,52},{32,48},{0,48},{-4,48},{-8,48},{-24,48},{28,44},{0,44},{-24,44},{28,40},{0,40},{-4,40},{-24,40},{24,36},{-8,36},{-28,36},{20,32},{-12,32},{-32,32},{16,28},{-12,28},{-36,28},{12,24},{-16,24},{-36,24},{8,20},{4,20},{-16,20},{-40,20},{0,16},{-4,16},{-8,16},{-12,16},{-20,16},{-40,16},{-20,12},{-40,12},{-20,8},{-40,8},{-24,4},{-28,4},{-32,4},{-36,4}};
-const short C2_Attack_1_4[115][2] = {{52,112},{12,112},{8,112},{4,112},{0,112},{52,108},{-4,108},{52,104},{-8,104},{56,100},{48,100},{-8,100},{56,96},{44,96},{40,96},{36,96},{28,96},{20,96},{-8,96},{60,92},{32,92},{24,92},{-4,92},{-8,92},{60,88},{32,88},{24,88},{4,88},{0,88},{-4,88},{60,84},{36,84},{20,84},{16,84},{12,84},{8,84},{-8,84},{60,80},{40,80},{36,80},{20,80},{-12,80},{56,76},{52,76},{48,76},{44,76},{36,76},{16,76},{-12,76},{36,72},{32,72},{28,72},{12,72},{8,72},{4,72},{0,72},{-4,72},{-8,72},{-12,72},{-16,72},{32,68},{24,68},{20,68},{16,68},{12,68},{-20,68},{36,64},{-24,64},{36,60},{-24,60},{36,56},{-24,56},{36,52},{-12,52},{-24,52},{36,48},{20,48},{16,48},{12,48},{8,48},{4,48},{0,48},{-4,48},{-8,48},{-12,48},{-24,48},{32,44},{28,44},{24,44},{12,44},{-12,44},{-16,44},{-20,44},{8,40},{-12,40},{4,36},{-16,36},{0,32},{-20,32},{0,28},{-20,28},{-4,24},{-24,24},{-4,20},{-24,20},{-4,16},{-28,16},{-8,12},{-28,12},{-8,8},{-28,8},{-12,4},{-16,4},{-20,4},{-24,4}};
-const short C2_Attack_1_5[168][2] = {{-96,128},{-100,128},{-104,128},{-108,128},{-92,124},{-112,124},{-24,120},{-28,120},{-32,120},{-36,120},{-84,120},{-88,120},{-112,120},{-20,116},{-40,116},{-72,116},{-76,116},{-80,116},{-112,116},{-20,112},{-40,112},{-56,112},{-60,112},{-64,112},{-68,112},{-112,112},{36,108},{32,108},{28,108},{24,108},{20,108},{16,108},{12,108},{8,108},{4,108},{0,108},{-4,108},{-8,108},{-12,108},{-16,108},{-36,108},{-48,108},{-52,108},{-112,108},{36,104},{-32,104},{-36,104},{-40,104},{-44,104},{-112,104},{36,100},{-24,100},{-28,100},{-96,100},{-100,100},{-112,100},{40,96},{-16,96},{-20,96},{-84,96},{-88,96},{-92,96},{-104,96},{-108,96},{44,92},{40,92},{36,92},{32,92},{28,92},{24,92},{20,92},{16,92},{12,92},{8,92},{4,92},{0,92},{-4,92},{-8,92},{-12,92},{-16,92},{-64,92},{-68,92},{-72,92},{-76,92},{-80,92},{64,88},{56,88},{52,88},{48,88},{44,88},{-16,88},{-56,88},{-60,88},{60,84},{-16,84},{-40,84},{-44,84},{-48,84},{-52,84},{56,80},{-12,80},{-32,80},{-36,80},{52,76},{-12,76},{-28,76},{48,72},{44,72},{40,72},{36,72},{32,72},{28,72},{24,72},{20,72},{-8,72},{-24,72},{48,68},{24,68},{16,68},{-4,68},{-24,68},{44,64},{28,64},{16,64},{4,64},{0,64},{-24,64},{40,60},{36,60},{32,60},{12,60},{8,60},{4,60},{-24,60},{4,56},{-24,56},{4,52},{-24,52},{4,48},{-24,48},{4,44},{-20,44},{4,40},{-20,40},{4,36},{-20,36},{4,32},{-20,32},{4,28},{-20,28},{4,24},{-20,24},{4,20},{-16,20},{4,16},{-16,16},{8,12},{-16,12},{12,8},{-16,8},{16,4},{12,4},{8,4},{4,4},{0,4},{-4,4},{-8,4},{-12,4}};
-const short C2_Attack_1_6[157][2] = {{24,124},{20,124},{16,124},{12,124},{8,124},{4,124},{0,124},{-4,124},{-8,124},{-12,124},{-16,124},{20,120},{-20,120},{20,116},{-24,116},{60,112},{20,112},{12,112},{-28,112},{60,108},{24,108},{8,108},{4,108},{0,108},{-12,108},{-28,108},{60,104},{56,104},{52,104},{44,104},{40,104},{32,104},{28,104},{4,104},{0,104},{-8,104},{-28,104},{64,100},{48,100},{36,100},{0,100},{-4,100},{-8,100},{-28,100},{68,96},{32,96},{0,96},{-12,96},{-28,96},{72,92},{32,92},{28,92},{-4,92},{-16,92},{-20,92},{-24,92},{72,88},{40,88},{36,88},{24,88},{-8,88},{-12,88},{72,84},{48,84},{44,84},{40,84},{24,84},{-12,84},{68,80},{56,80},{52,80},{36,80},{20,80},{-8,80},{-16,80},{64,76},{60,76},{36,76},{16,76},{12,76},{-4,76},{-20,76},{32,72},{28,72},{24,72},{8,72},{4,72},{0,72},{-24,72},{32,68},{20,68},{16,68},{12,68},{4,68},{-28,68},{-32,68},{-36,68},{32,64},{4,64},{0,64},{-40,64},{32,60},{4,60},{-4,60},{-44,60},{-48,60},{32,56},{4,56},{-8,56},{-52,56},{32,52},{4,52},{-12,52},{-56,52},{32,48},{4,48},{-16,48},{-20,48},{-24,48},{-28,48},{-32,48},{-36,48},{-60,48},{32,44},{4,44},{-40,44},{-60,44},{32,40},{4,40},{-40,40},{-60,40},{32,36},{0,36},{-44,36},{-48,36},{-52,36},{-56,36},{32,32},{0,32},{28,28},{0,28},{24,24},{0,24},{20,20},{0,20},{20,16},{0,16},{24,12},{0,12},{28,8},{4,8},{24,4},{20,4},{16,4},{12,4},{8,4},{4,4}};
-const short C2_Attack_1_7[137][2] = {{32,116},{-4,116},{36,112},{-8,112},{-12,112},{40,108},{32,108},{8,108},{-8,108},{-16,108},{44,104},{32,104},{28,104},{16,104},{12,104},{4,104},{0,104},{-4,104},{-20,104},{44,100},{24,100},{20,100},{8,100},{-20,100},{44,96},{4,96},{-20,96},{44,92},{4,92},{0,92},{-4,92},{-20,92},{40,88},{8,88},{4,88},{-20,88},{40,84},{36,84},{20,84},{16,84},{12,84},{4,84},{-20,84},{36,80},{32,80},{28,80},{24,80},{4,80},{0,80},{-16,80},{32,76},{8,76},{0,76},{-4,76},{-8,76},{-12,76},{32,72},{8,72},{-12,72},{36,68},{8,68},{-16,68},{36,64},{8,64},{-16,64},{32,60},{28,60},{12,60},{8,60},{-12,60},{32,56},{24,56},{20,56},{16,56},{4,56},{0,56},{-4,56},{-8,56},{-16,56},{32,52},{8,52},{-20,52},{36,48},{12,48},{4,48},{-20,48},{36,44},{12,44},{4,44},{-20,44},{40,40},{12,40},{4,40},{-20,40},{40,36},{16,36},{4,36},{-24,36},{40,32},{16,32},{0,32},{-24,32},{40,28},{16,28},{0,28},{-28,28},{40,24},{20,24},{0,24},{-28,24},{44,20},{20,20},{-4,20},{-28,20},{44,16},{20,16},{-8,16},{-32,16},{48,12},{24,12},{-8,12},{-36,12},{48,8},{24,8},{-12,8},{-36,8},{44,4},{40,4},{36,4},{32,4},{28,4},{24,4},{-16,4},{-20,4},{-24,4},{-28,4},{-32,4}};
-const short C2_Attack_3_0[132][2] = {{0,100},{-4,100},{20,96},{16,96},{12,96},{8,96},{4,96},{28,92},{24,92},{4,92},{36,88},{32,88},{4,88},{40,84},{0,84},{-32,84},{44,80},{0,80},{-4,80},{-32,80},{44,76},{24,76},{20,76},{16,76},{12,76},{8,76},{4,76},{-8,76},{-12,76},{-16,76},{-20,76},{-24,76},{-28,76},{-32,76},{48,72},{28,72},{16,72},{-28,72},{-36,72},{48,68},{24,68},{20,68},{-24,68},{-40,68},{48,64},{28,64},{20,64},{-20,64},{-40,64},{44,60},{40,60},{36,60},{32,60},{20,60},{-16,60},{-40,60},{20,56},{-16,56},{-20,56},{-24,56},{-28,56},{-32,56},{-36,56},{20,52},{-20,52},{-40,52},{-44,52},{-48,52},{20,48},{-12,48},{-16,48},{-52,48},{20,44},{0,44},{-4,44},{-8,44},{-12,44},{-52,44},{20,40},{12,40},{8,40},{4,40},{-16,40},{-52,40},{16,36},{12,36},{-20,36},{-52,36},{20,32},{8,32},{-20,32},{-48,32},{28,28},{24,28},{4,28},{-20,28},{-44,28},{32,24},{-20,24},{-40,24},{36,20},{-16,20},{-36,20},{36,16},{-8,16},{-12,16},{-32,16},{40,12},{16,12},{12,12},{8,12},{4,12},{0,12},{-4,12},{-8,12},{-32,12},{44,8},{20,8},{-12,8},{-16,8},{-36,8},{44,4},{40,4},{36,4},{32,4},{28,4},{24,4},{-20,4},{-24,4},{-28,4},{-32,4},{-36,4}};
-const short C2_Attack_3_1[133][2] = {{16,100},{12,100},{8,100},{4,100},{0,100},{-4,100},{28,96},{24,96},{20,96},{0,96},{32,92},{-4,92},{32,88},{-4,88},{32,84},{-8,84},{28,80},{-12,80},{-16,80},{-40,80},{24,76},{12,76},{-20,76},{-24,76},{-40,76},{20,72},{12,72},{-28,72},{-32,72},{-36,72},{-40,72},{16,68},{12,68},{-40,68},{16,64},{-16,64},{-40,64},{-52,64},{-56,64},{-60,64},{-64,64},{20,60},{-16,60},{-36,60},{-48,60},{-68,60},{24,56},{-12,56},{-36,56},{-40,56},{-44,56},{-48,56},{-68,56},{28,52},{-12,52},{-68,52},{28,48},{-12,48},{-64,48},{24,44},{-16,44},{-60,44},{20,40},{16,40},{12,40},{8,40},{-20,40},{-24,40},{-28,40},{-32,40},{-36,40},{-40,40},{-44,40},{-48,40},{-52,40},{-56,40},{16,36},{4,36},{0,36},{-4,36},{-8,36},{-12,36},{-16,36},{-24,36},{-40,36},{12,32},{-28,32},{-40,32},{8,28},{-32,28},{-40,28},{12,24},{-32,24},{-36,24},{36,20},{32,20},{28,20},{24,20},{20,20},{16,20},{-28,20},{-36,20},{36,16},{-24,16},{-32,16},{40,12},{-16,12},{-20,12},{-32,12},{44,8},{8,8},{4,8},{0,8},{-4,8},{-8,8},{-12,8},{-36,8},{44,4},{40,4},{36,4},{32,4},{28,4},{24,4},{20,4},{16,4},{12,4},{-12,4},{-16,4},{-20,4},{-24,4},{-28,4},{-32,4},{-36,4}};
-const short C2_Attack_3_2[143][2] = {{12,120},{8,120},{4,120},{0,120},{-4,120},{24,116},{20,116},{16,116},{0,116},{32,112},{28,112},{-4,112},{-8,112},{36,108},{-12,108},{-16,108},{36,104},{-20,104},{-24,104},{-28,104},{-36,104},{-44,104},{-48,104},{-52,104},{-56,104},{-60,104},{32,100},{12,100},{-32,100},{-36,100},{-40,100},{-64,100},{28,96},{12,96},{-40,96},{-64,96},{24,92},{20,92},{12,92},{-40,92},{-64,92},{16,88},{12,88},{-44,88},{-64,88},{12,84},{-20,84},{-44,84},{-64,84},{12,80},{-20,80},{-44,80},{-64,80},{12,76},{-24,76},{-64,76},{12,72},{-28,72},{-64,72},{16,68},{-28,68},{-32,68},{-60,68},{16,64},{-28,64},{-36,64},{-40,64},{-44,64},{-48,64},{-52,64},{-56,64},{12,60},{8,60},{4,60},{0,60},{-28,60},{12,56},{-4,56},{-8,56},{-12,56},{-16,56},{-20,56},{-24,56},{-28,56},{8,52},{-16,52},{-32,52},{8,48},{-16,48},{-32,48},{8,44},{-16,44},{-36,44},{8,40},{-16,40},{-36,40},{12,36},{8,36},{-16,36},{-36,36},{20,32},{16,32},{-16,32},{-36,32},{24,28},{-16,28},{-36,28},{36,24},{32,24},{28,24},{-12,24},{-36,24},{40,20},{-4,20},{-8,20},{-12,20},{-36,20},{40,16},{0,16},{-12,16},{-36,16},{40,12},{8,12},{4,12},{-12,12},{-32,12},{40,8},{20,8},{16,8},{12,8},{-12,8},{-36,8},{36,4},{32,4},{28,4},{24,4},{-12,4},{-16,4},{-20,4},{-24,4},{-28,4},{-32,4},{-36,4}};
-const short C2_Attack_3_3[142][2] = {{-12,200},{-16,200},{-20,200},{-24,200},{-8,196},{-28,196},{-4,192},{-32,192},{-4,188},{-32,188},{-4,184},{-32,184},{-8,180},{-28,180},{-8,176},{-28,176},{-8,172},{-28,172},{-8,168},{-28,168},{-8,164},{-28,164},{-8,160},{-28,160},{-8,156},{-28,156},{-8,152},{-28,152},{-8,148},{-28,148},{-4,144},{-24,144},{-4,140},{-24,140},{0,136},{-24,136},{32,132},{28,132},{24,132},{8,132},{4,132},{-24,132},{36,128},{20,128},{16,128},{12,128},{-24,128},{36,124},{-24,124},{36,120},{20,120},{-24,120},{-28,120},{-32,120},{-36,120},{-40,120},{-44,120},{36,116},{16,116},{-20,116},{-48,116},{36,112},{16,112},{-20,112},{-48,112},{36,108},{16,108},{-16,108},{-48,108},{32,104},{20,104},{16,104},{-16,104},{-48,104},{28,100},{24,100},{16,100},{-12,100},{-44,100},{16,96},{-8,96},{-20,96},{-44,96},{20,92},{-4,92},{-16,92},{-44,92},{20,88},{4,88},{0,88},{-12,88},{-16,88},{-40,88},{16,84},{12,84},{8,84},{-8,84},{-16,84},{-40,84},{16,80},{-8,80},{-16,80},{-40,80},{16,76},{-8,76},{-16,76},{-40,76},{16,72},{-8,72},{-16,72},{-36,72},{16,68},{-8,68},{-16,68},{-32,68},{16,64},{-8,64},{-20,64},{-24,64},{-28,64},{16,60},{-8,60},{16,56},{-8,56},{12,52},{-8,52},{12,48},{-8,48},{12,44},{-12,44},{12,40},{-12,40},{12,36},{-12,36},{8,32},{-8,32},{8,28},{-8,28},{4,24},{-8,24},{0,20},{-4,20}};
-const short C2_Attack_3_4[132][2] = {{16,196},{12,196},{20,192},{8,192},{24,188},{4,188},{24,184},{4,184},{20,180},{0,180},{16,176},{0,176},{-4,172},{-4,168},{-8,160},{-12,156},{-16,152},{-16,148},{-12,144},{-20,144},{-8,140},{-20,140},{-4,136},{-20,136},{4,132},{0,132},{-20,132},{20,128},{12,128},{8,128},{-20,128},{20,124},{16,124},{-20,124},{20,120},{-20,120},{20,116},{-4,116},{-20,116},{44,112},{40,112},{20,112},{-4,112},{-20,112},{48,108},{36,108},{32,108},{20,108},{-4,108},{-20,108},{48,104},{28,104},{24,104},{20,104},{0,104},{-24,104},{48,100},{0,100},{-24,100},{48,96},{0,96},{-24,96},{44,92},{40,92},{36,92},{32,92},{4,92},{-20,92},{-24,92},{28,88},{24,88},{20,88},{16,88},{12,88},{8,88},{-12,88},{-16,88},{-24,88},{24,84},{-4,84},{-8,84},{-20,84},{24,80},{20,80},{16,80},{12,80},{8,80},{4,80},{0,80},{-16,80},{28,76},{-8,76},{-12,76},{-16,76},{28,72},{-4,72},{-20,72},{-24,72},{28,68},{-4,68},{-28,68},{28,64},{-4,64},{-28,64},{28,60},{-4,60},{-28,60},{24,56},{-8,56},{-28,56},{20,52},{-12,52},{-28,52},{16,48},{-16,48},{-24,48},{12,44},{-20,44},{8,40},{-16,40},{4,36},{-16,36},{4,32},{-12,32},{4,28},{-12,28},{4,24},{-12,24},{0,20},{-12,20},{-4,16},{-8,16}};
-const short C2_Attack_3_5[173][2] = {{40,188},{36,188},{32,188},{28,188},{24,188},{44,184},{20,184},{44,180},{20,180},{44,176},{44,172},{44,168},{44,164},{44,160},{44,156},{44,152},{44,148},{44,144},{-8,144},{-12,144},{44,140},{-16,140},{-20,140},{40,136},{-16,136},{-24,136},{40,132},{-16,132},{-28,132},{40,128},{24,128},{16,128},{-12,128},{-32,128},{40,124},{24,124},{16,124},{-8,124},{-32,124},{36,120},{32,120},{28,120},{24,120},{20,120},{16,120},{12,120},{8,120},{4,120},{0,120},{-4,120},{-32,120},{24,116},{16,116},{-8,116},{-32,116},{24,112},{16,112},{8,112},{4,112},{0,112},{-12,112},{-32,112},{24,108},{12,108},{-4,108},{-8,108},{-12,108},{-32,108},{24,104},{12,104},{-32,104},{24,100},{12,100},{-28,100},{28,96},{12,96},{8,96},{-28,96},{32,92},{24,92},{8,92},{4,92},{0,92},{-4,92},{-8,92},{-12,92},{-16,92},{-20,92},{-24,92},{36,88},{20,88},{16,88},{8,88},{-20,88},{40,84},{12,84},{4,84},{-24,84},{44,80},{0,80},{-4,80},{-8,80},{-20,80},{44,76},{-12,76},{-16,76},{44,72},{12,72},{-20,72},{48,68},{16,68},{8,68},{-20,68},{48,64},{20,64},{8,64},{-20,64},{48,60},{24,60},{8,60},{-20,60},{44,56},{20,56},{8,56},{-16,56},{44,52},{20,52},{8,52},{-16,52},{44,48},{20,48},{8,48},{-16,48},{40,44},{20,44},{8,44},{-16,44},{40,40},{20,40},{8,40},{-12,40},{36,36},{20,36},{8,36},{-12,36},{40,32},{20,32},{4,32},{-12,32},{44,28},{20,28},{8,28},{-12,28},{48,24},{24,24},{8,24},{-12,24},{48,20},{28,20},{8,20},{-12,20},{44,16},{40,16},{36,16},{32,16},{8,16},{-12,16},{8,12},{-12,12},{4,8},{-8,8},{0,4},{-4,4}};
-const short C2_Attack_3_6[156][2] = {{48,140},{44,140},{40,140},{36,140},{52,136},{32,136},{52,132},{32,132},{52,128},{32,128},{28,128},{24,128},{52,124},{32,124},{-12,124},{-16,124},{-20,124},{56,120},{32,120},{-20,120},{-24,120},{56,116},{36,116},{32,116},{-8,116},{-12,116},{-28,116},{56,112},{28,112},{4,112},{-16,112},{-32,112},{52,108},{48,108},{24,108},{20,108},{16,108},{12,108},{8,108},{4,108},{-20,108},{-32,108},{44,104},{40,104},{4,104},{-32,104},{36,100},{32,100},{0,100},{-32,100},{28,96},{4,96},{-4,96},{-32,96},{28,92},{4,92},{-8,92},{-28,92},{28,88},{4,88},{-12,88},{-16,88},{-20,88},{-24,88},{28,84},{4,84},{-12,84},{28,80},{4,80},{-16,80},{32,76},{8,76},{-16,76},{36,72},{28,72},{8,72},{-16,72},{40,68},{24,68},{20,68},{16,68},{12,68},{4,68},{-16,68},{44,64},{0,64},{-4,64},{-8,64},{-12,64},{-20,64},{48,60},{16,60},{-20,60},{48,56},{20,56},{12,56},{-20,56},{48,52},{24,52},{8,52},{-20,52},{48,48},{24,48},{8,48},{-24,48},{48,44},{24,44},{4,44},{-28,44},{48,40},{24,40},{4,40},{-28,40},{48,36},{24,36},{0,36},{-28,36},{48,32},{24,32},{-4,32},{-28,32},{48,28},{24,28},{-4,28},{-28,28},{44,24},{24,24},{-8,24},{-32,24},{44,20},{24,20},{-12,20},{-32,20},{44,16},{24,16},{-12,16},{-36,16},{48,12},{24,12},{-16,12},{-36,12},{52,8},{28,8},{-20,8},{-40,8},{48,4},{44,4},{40,4},{36,4},{32,4},{-20,4},{-24,4},{-28,4},{-32,4},{-36,4},{-40,4}};
-const short C2_Backward_0[144][2] = {{32,120},{28,120},{36,116},{36,112},{-8,112},{40,108},{36,108},{-8,108},{-12,108},{44,104},{32,104},{12,104},{8,104},{4,104},{-8,104},{-16,104},{-20,104},{44,100},{28,100},{24,100},{20,100},{16,100},{4,100},{-8,100},{-24,100},{48,96},{0,96},{-4,96},{-28,96},{48,92},{0,92},{-32,92},{48,88},{4,88},{-36,88},{48,84},{16,84},{12,84},{8,84},{4,84},{-16,84},{-20,84},{-36,84},{44,80},{40,80},{36,80},{32,80},{28,80},{24,80},{20,80},{4,80},{-12,80},{-36,80},{36,76},{4,76},{-12,76},{-36,76},{36,72},{4,72},{-12,72},{-16,72},{-32,72},{36,68},{8,68},{-16,68},{-20,68},{-24,68},{-28,68},{36,64},{8,64},{-16,64},{36,60},{32,60},{28,60},{24,60},{20,60},{8,60},{-8,60},{-12,60},{36,56},{16,56},{12,56},{4,56},{0,56},{-4,56},{-12,56},{40,52},{12,52},{-16,52},{40,48},{12,48},{8,48},{-20,48},{40,44},{16,44},{4,44},{-24,44},{44,40},{16,40},{0,40},{-28,40},{44,36},{20,36},{-4,36},{-32,36},{44,32},{20,32},{-8,32},{-32,32},{44,28},{20,28},{-8,28},{-36,28},{48,24},{20,24},{-12,24},{-36,24},{52,20},{24,20},{-12,20},{-36,20},{56,16},{28,16},{-12,16},{-36,16},{60,12},{32,12},{-12,12},{-40,12},{60,8},{32,8},{-16,8},{-20,8},{-40,8},{56,4},{52,4},{48,4},{44,4},{40,4},{36,4},{-24,4},{-28,4},{-32,4},{-36,4}};
-const short C2_Backward_1[141][2] = {{36,120},{32,120},{40,116},{-4,116},{40,112},{-8,112},{44,108},{40,108},{-8,108},{-12,108},{-16,108},{48,104},{36,104},{24,104},{20,104},{8,104},{4,104},{-8,104},{-20,104},{48,100},{32,100},{28,100},{4,100},{0,100},{-4,100},{-24,100},{52,96},{4,96},{-28,96},{52,92},{8,92},{-32,92},{52,88},{12,88},{8,88},{-12,88},{-16,88},{-32,88},{52,84},{24,84},{20,84},{16,84},{8,84},{-8,84},{-32,84},{48,80},{44,80},{40,80},{36,80},{32,80},{28,80},{8,80},{-8,80},{-32,80},{36,76},{12,76},{-8,76},{-12,76},{-28,76},{36,72},{12,72},{-12,72},{-16,72},{-20,72},{-24,72},{36,68},{12,68},{-12,68},{36,64},{32,64},{28,64},{16,64},{8,64},{-8,64},{-12,64},{36,60},{24,60},{20,60},{4,60},{0,60},{-4,60},{-12,60},{40,56},{12,56},{-12,56},{40,52},{12,52},{8,52},{-16,52},{40,48},{16,48},{4,48},{-20,48},{40,44},{16,44},{4,44},{-20,44},{44,40},{16,40},{0,40},{-24,40},{44,36},{20,36},{0,36},{-28,36},{44,32},{20,32},{-4,32},{-28,32},{44,28},{20,28},{-4,28},{-28,28},{44,24},{20,24},{-4,24},{-28,24},{48,20},{20,20},{-4,20},{-32,20},{52,16},{24,16},{-8,16},{-32,16},{56,12},{28,12},{-12,12},{-32,12},{56,8},{28,8},{-16,8},{-20,8},{-24,8},{-28,8},{52,4},{48,4},{44,4},{40,4},{36,4},{32,4}};
-const short C2_Backward_2[144][2] = {{40,124},{36,124},{44,120},{44,116},{0,116},{-4,116},{48,112},{44,112},{0,112},{-8,112},{-12,112},{52,108},{40,108},{28,108},{24,108},{12,108},{0,108},{-16,108},{52,104},{36,104},{32,104},{8,104},{0,104},{-20,104},{56,100},{8,100},{4,100},{-24,100},{56,96},{12,96},{-28,96},{56,92},{16,92},{12,92},{-8,92},{-12,92},{-28,92},{56,88},{28,88},{24,88},{20,88},{12,88},{-4,88},{-28,88},{52,84},{48,84},{44,84},{40,84},{36,84},{32,84},{12,84},{-4,84},{-28,84},{40,80},{12,80},{-4,80},{-8,80},{-24,80},{40,76},{12,76},{-8,76},{-12,76},{-16,76},{-20,76},{40,72},{12,72},{-8,72},{40,68},{12,68},{-8,68},{40,64},{36,64},{20,64},{16,64},{8,64},{-4,64},{-12,64},{40,60},{32,60},{28,60},{24,60},{12,60},{4,60},{0,60},{-12,60},{40,56},{16,56},{12,56},{-12,56},{40,52},{16,52},{8,52},{-16,52},{40,48},{16,48},{8,48},{-16,48},{40,44},{16,44},{4,44},{-16,44},{44,40},{16,40},{4,40},{-20,40},{44,36},{20,36},{4,36},{-20,36},{44,32},{20,32},{0,32},{-24,32},{44,28},{20,28},{0,28},{-24,28},{44,24},{20,24},{0,24},{-24,24},{44,20},{20,20},{0,20},{-24,20},{44,16},{20,16},{-4,16},{-24,16},{48,12},{20,12},{-8,12},{-20,12},{48,8},{20,8},{-12,8},{-16,8},{48,4},{44,4},{40,4},{36,4},{32,4},{28,4},{24,4}};
-const short C2_Backward_3[148][2] = {{40,124},{36,124},{44,120},{44,116},{0,116},{-4,116},{48,112},{44,112},{0,112},{-8,112},{-12,112},{52,108},{40,108},{28,108},{24,108},{12,108},{0,108},{-16,108},{52,104},{36,104},{32,104},{8,104},{0,104},{-20,104},{56,100},{8,100},{4,100},{-24,100},{56,96},{12,96},{-28,96},{56,92},{16,92},{12,92},{-8,92},{-12,92},{-28,92},{56,88},{28,88},{24,88},{20,88},{12,88},{-4,88},{-28,88},{52,84},{48,84},{44,84},{40,84},{36,84},{32,84},{12,84},{-4,84},{-28,84},{40,80},{12,80},{-4,80},{-8,80},{-24,80},{40,76},{12,76},{-8,76},{-12,76},{-16,76},{-20,76},{40,72},{12,72},{-8,72},{40,68},{36,68},{12,68},{-8,68},{40,64},{32,64},{16,64},{8,64},{-4,64},{-12,64},{40,60},{28,60},{24,60},{20,60},{12,60},{4,60},{0,60},{-12,60},{40,56},{16,56},{12,56},{-12,56},{40,52},{16,52},{8,52},{-16,52},{44,48},{20,48},{16,48},{8,48},{-16,48},{48,44},{20,44},{4,44},{-20,44},{48,40},{24,40},{4,40},{-20,40},{48,36},{24,36},{4,36},{-20,36},{48,32},{24,32},{4,32},{-20,32},{48,28},{24,28},{4,28},{-20,28},{48,24},{24,24},{4,24},{-20,24},{48,20},{24,20},{0,20},{-20,20},{48,16},{44,16},{24,16},{0,16},{-24,16},{44,12},{24,12},{-4,12},{-28,12},{44,8},{40,8},{36,8},{32,8},{28,8},{-4,8},{-28,8},{-4,4},{-8,4},{-12,4},{-16,4},{-20,4},{-24,4}};
-const short C2_Backward_4[140][2] = {{36,120},{32,120},{40,116},{40,112},{-4,112},{-8,112},{44,108},{40,108},{-4,108},{-12,108},{-16,108},{48,104},{36,104},{16,104},{12,104},{8,104},{-4,104},{-20,104},{48,100},{32,100},{28,100},{24,100},{20,100},{8,100},{-4,100},{-24,100},{52,96},{28,96},{4,96},{0,96},{-28,96},{52,92},{4,92},{-32,92},{52,88},{8,88},{-12,88},{-16,88},{-32,88},{52,84},{16,84},{12,84},{-8,84},{-32,84},{48,80},{44,80},{40,80},{36,80},{32,80},{28,80},{24,80},{20,80},{8,80},{-8,80},{-32,80},{36,76},{8,76},{-8,76},{-12,76},{-28,76},{36,72},{12,72},{-8,72},{-12,72},{-16,72},{-20,72},{-24,72},{36,68},{12,68},{-8,68},{36,64},{12,64},{-8,64},{36,60},{32,60},{20,60},{16,60},{8,60},{-4,60},{-12,60},{40,56},{28,56},{24,56},{12,56},{4,56},{0,56},{-12,56},{40,52},{16,52},{8,52},{-16,52},{40,48},{16,48},{8,48},{-16,48},{44,44},{16,44},{4,44},{-20,44},{48,40},{20,40},{4,40},{-20,40},{52,36},{24,36},{4,36},{-20,36},{56,32},{28,32},{0,32},{-24,32},{60,28},{28,28},{0,28},{-24,28},{60,24},{32,24},{0,24},{-24,24},{60,20},{36,20},{0,20},{-24,20},{60,16},{44,16},{40,16},{0,16},{-24,16},{56,12},{52,12},{48,12},{-4,12},{-28,12},{-4,8},{-28,8},{-8,4},{-12,4},{-16,4},{-20,4},{-24,4}};
-const short C2_Backward_5[144][2] = {{32,120},{28,120},{36,116},{36,112},{-8,112},{-12,112},{40,108},{36,108},{-8,108},{-16,108},{-20,108},{44,104},{32,104},{4,104},{-8,104},{-24,104},{44,100},{28,100},{24,100},{16,100},{12,100},{8,100},{4,100},{-8,100},{-28,100},{48,96},{20,96},{4,96},{0,96},{-4,96},{-32,96},{48,92},{0,92},{-32,92},{48,88},{0,88},{-36,88},{48,84},{4,84},{-16,84},{-20,84},{-36,84},{44,80},{40,80},{36,80},{32,80},{28,80},{24,80},{20,80},{16,80},{12,80},{8,80},{4,80},{-12,80},{-36,80},{32,76},{4,76},{-12,76},{-36,76},{32,72},{4,72},{-12,72},{-16,72},{-32,72},{32,68},{8,68},{-12,68},{-16,68},{-20,68},{-24,68},{-28,68},{32,64},{8,64},{-12,64},{32,60},{28,60},{12,60},{4,60},{-8,60},{-16,60},{32,56},{24,56},{20,56},{16,56},{0,56},{-4,56},{-16,56},{36,52},{8,52},{-20,52},{40,48},{12,48},{4,48},{-20,48},{40,44},{16,44},{0,44},{-24,44},{40,40},{16,40},{0,40},{-24,40},{44,36},{16,36},{0,36},{-24,36},{48,32},{20,32},{-4,32},{-28,32},{48,28},{20,28},{-4,28},{-28,28},{48,24},{20,24},{-4,24},{-28,24},{52,20},{24,20},{-4,20},{-28,20},{52,16},{28,16},{-4,16},{-28,16},{52,12},{28,12},{-8,12},{-32,12},{52,8},{32,8},{-8,8},{-32,8},{48,4},{44,4},{40,4},{36,4},{32,4},{-12,4},{-16,4},{-20,4},{-24,4},{-28,4}};
-const short C2_CrouchGuard_0[133][2] = {{-16,88},{-20,88},{-12,84},{-24,84},{32,80},{28,80},{-12,80},{-28,80},{36,76},{28,76},{24,76},{-8,76},{-28,76},{40,72},{24,72},{12,72},{8,72},{4,72},{0,72},{-4,72},{-28,72},{40,68},{20,68},{16,68},{12,68},{-28,68},{40,64},{12,64},{8,64},{-12,64},{-16,64},{-20,64},{-24,64},{40,60},{-8,60},{-24,60},{40,56},{20,56},{16,56},{12,56},{8,56},{4,56},{0,56},{-4,56},{-28,56},{40,52},{4,52},{-32,52},{36,48},{4,48},{-12,48},{-36,48},{32,44},{4,44},{-16,44},{-40,44},{32,40},{4,40},{0,40},{-4,40},{-8,40},{-12,40},{-16,40},{-20,40},{-40,40},{36,36},{32,36},{28,36},{24,36},{20,36},{16,36},{12,36},{8,36},{4,36},{-16,36},{-20,36},{-24,36},{-44,36},{40,32},{4,32},{-24,32},{-48,32},{40,28},{8,28},{0,28},{-24,28},{-48,28},{40,24},{8,24},{-4,24},{-28,24},{-32,24},{-36,24},{-40,24},{-44,24},{44,20},{40,20},{8,20},{-8,20},{-36,20},{48,16},{40,16},{8,16},{-12,16},{-36,16},{52,12},{40,12},{12,12},{-12,12},{-36,12},{-40,12},{52,8},{40,8},{12,8},{-12,8},{-44,8},{48,4},{44,4},{40,4},{36,4},{32,4},{28,4},{24,4},{20,4},{16,4},{-16,4},{-20,4},{-24,4},{-28,4},{-32,4},{-36,4},{-40,4},{-44,4}};
-const short C2_CrouchGuard_1[123][2] = {{-8,88},{-12,88},{-16,84},{32,80},{-20,80},{36,76},{32,76},{-4,76},{-20,76},{40,72},{32,72},{12,72},{8,72},{4,72},{0,72},{-20,72},{40,68},{32,68},{28,68},{24,68},{20,68},{16,68},{12,68},{-20,68},{40,64},{16,64},{-4,64},{-8,64},{-12,64},{-16,64},{40,60},{0,60},{-16,60},{40,56},{20,56},{16,56},{12,56},{8,56},{4,56},{-20,56},{40,52},{8,52},{-24,52},{36,48},{8,48},{-4,48},{-28,48},{32,44},{8,44},{-8,44},{-32,44},{36,40},{8,40},{-12,40},{-32,40},{40,36},{12,36},{8,36},{4,36},{0,36},{-4,36},{-8,36},{-12,36},{-16,36},{-36,36},{44,32},{40,32},{36,32},{32,32},{28,32},{24,32},{20,32},{16,32},{12,32},{8,32},{4,32},{-16,32},{-40,32},{44,28},{12,28},{0,28},{-16,28},{-40,28},{44,24},{12,24},{-4,24},{-20,24},{-24,24},{-28,24},{-32,24},{-36,24},{44,20},{12,20},{-4,20},{-28,20},{48,16},{44,16},{12,16},{-8,16},{-28,16},{52,12},{44,12},{16,12},{-8,12},{-28,12},{52,8},{44,8},{16,8},{-8,8},{-32,8},{48,4},{44,4},{40,4},{36,4},{32,4},{28,4},{24,4},{20,4},{-12,4},{-16,4},{-20,4},{-24,4},{-28,4}};
-const short C2_Damage_0[146][2] = {{36,120},{32,120},{28,120},{40,116},{36,116},{44,112},{36,112},{48,108},{32,108},{48,104},{28,104},{52,100},{28,100},{24,100},{20,100},{16,100},{12,100},{8,100},{-4,100},{-24,100},{-28,100},{-32,100},{-36,100},{52,96},{32,96},{12,96},{4,96},{0,96},{-8,96},{-12,96},{-16,96},{-20,96},{-40,96},{52,92},{32,92},{28,92},{24,92},{16,92},{-40,92},{52,88},{20,88},{12,88},{-40,88},{52,84},{20,84},{8,84},{4,84},{-24,84},{-28,84},{-32,84},{-36,84},{48,80},{44,80},{20,80},{4,80},{0,80},{-4,80},{-8,80},{-12,80},{-16,80},{-20,80},{52,76},{40,76},{36,76},{32,76},{28,76},{24,76},{4,76},{52,72},{20,72},{8,72},{0,72},{52,68},{20,68},{8,68},{-4,68},{52,64},{24,64},{16,64},{12,64},{-8,64},{48,60},{28,60},{24,60},{20,60},{-8,60},{48,56},{40,56},{36,56},{32,56},{20,56},{-12,56},{44,52},{20,52},{16,52},{-12,52},{44,48},{20,48},{12,48},{-12,48},{44,44},{20,44},{8,44},{-16,44},{40,40},{16,40},{8,40},{-16,40},{40,36},{16,36},{4,36},{-16,36},{40,32},{16,32},{4,32},{-16,32},{36,28},{16,28},{4,28},{-16,28},{36,24},{16,24},{4,24},{-16,24},{36,20},{16,20},{4,20},{-20,20},{36,16},{16,16},{0,16},{-24,16},{36,12},{16,12},{-4,12},{-8,12},{-12,12},{-16,12},{-20,12},{36,8},{12,8},{32,4},{28,4},{24,4},{20,4},{16,4}};
-const short C2_Damage_1[138][2] = {{40,116},{36,116},{32,116},{44,112},{40,112},{48,108},{40,108},{52,104},{48,104},{36,104},{52,100},{32,100},{-16,100},{-20,100},{-24,100},{-28,100},{56,96},{32,96},{28,96},{-8,96},{-12,96},{-32,96},{56,92},{36,92},{24,92},{20,92},{16,92},{12,92},{-32,92},{56,88},{36,88},{32,88},{28,88},{24,88},{12,88},{-32,88},{56,84},{24,84},{8,84},{-16,84},{-20,84},{-24,84},{-28,84},{56,80},{24,80},{8,80},{4,80},{0,80},{-4,80},{-8,80},{-12,80},{52,76},{48,76},{24,76},{8,76},{56,72},{44,72},{40,72},{36,72},{32,72},{28,72},{12,72},{4,72},{56,68},{28,68},{12,68},{4,68},{0,68},{56,64},{24,64},{20,64},{16,64},{-4,64},{52,60},{32,60},{28,60},{24,60},{-4,60},{52,56},{44,56},{40,56},{36,56},{24,56},{-8,56},{48,52},{24,52},{20,52},{-8,52},{48,48},{24,48},{16,48},{-8,48},{48,44},{24,44},{12,44},{-12,44},{44,40},{20,40},{12,40},{-12,40},{44,36},{20,36},{8,36},{-12,36},{44,32},{20,32},{8,32},{-12,32},{40,28},{20,28},{8,28},{-12,28},{40,24},{20,24},{8,24},{-12,24},{40,20},{20,20},{8,20},{-16,20},{40,16},{20,16},{4,16},{-20,16},{40,12},{20,12},{0,12},{-4,12},{-8,12},{-12,12},{-16,12},{40,8},{16,8},{36,4},{32,4},{28,4},{24,4},{20,4}};
-const short C2_Damage_2[142][2] = {{40,120},{36,120},{32,120},{40,116},{44,112},{40,112},{48,108},{36,108},{48,104},{32,104},{52,100},{28,100},{24,100},{20,100},{16,100},{12,100},{-4,100},{-12,100},{-16,100},{-20,100},{52,96},{32,96},{12,96},{8,96},{4,96},{0,96},{-8,96},{-24,96},{52,92},{32,92},{28,92},{24,92},{16,92},{-8,92},{-24,92},{52,88},{20,88},{12,88},{-24,88},{52,84},{20,84},{8,84},{-24,84},{48,80},{44,80},{20,80},{8,80},{4,80},{0,80},{-4,80},{-20,80},{48,76},{40,76},{36,76},{32,76},{28,76},{24,76},{4,76},{-8,76},{-12,76},{-16,76},{52,72},{28,72},{4,72},{52,68},{28,68},{8,68},{0,68},{52,64},{24,64},{20,64},{8,64},{0,64},{48,60},{24,60},{16,60},{12,60},{-4,60},{48,56},{24,56},{20,56},{-8,56},{44,52},{40,52},{36,52},{32,52},{28,52},{20,52},{16,52},{-12,52},{44,48},{20,48},{12,48},{-12,48},{44,44},{20,44},{8,44},{-12,44},{40,40},{16,40},{8,40},{-12,40},{40,36},{16,36},{8,36},{-12,36},{40,32},{16,32},{8,32},{-12,32},{36,28},{16,28},{8,28},{-12,28},{36,24},{16,24},{8,24},{-12,24},{36,20},{16,20},{8,20},{-12,20},{36,16},{16,16},{8,16},{-16,16},{36,12},{16,12},{4,12},{-20,12},{36,8},{12,8},{0,8},{-4,8},{-8,8},{-12,8},{-16,8},{32,4},{28,4},{24,4},{20,4},{16,4}};
-const short C2_Damage_3[137][2] = {{32,112},{36,108},{-4,108},{36,104},{-4,104},{-8,104},{-12,104},{40,100},{36,100},{8,100},{-4,100},{-16,100},{44,96},{32,96},{16,96},{12,96},{8,96},{4,96},{0,96},{-4,96},{-20,96},{44,92},{28,92},{24,92},{20,92},{8,92},{-20,92},{44,88},{4,88},{-20,88},{44,84},{4,84},{0,84},{-4,84},{-20,84},{40,80},{8,80},{4,80},{-20,80},{40,76},{36,76},{20,76},{16,76},{12,76},{4,76},{-20,76},{36,72},{32,72},{28,72},{24,72},{12,72},{4,72},{0,72},{-16,72},{32,68},{12,68},{0,68},{-4,68},{-8,68},{-12,68},{32,64},{8,64},{-12,64},{32,60},{8,60},{4,60},{-8,60},{-12,60},{32,56},{28,56},{12,56},{4,56},{0,56},{-4,56},{-16,56},{32,52},{24,52},{20,52},{16,52},{12,52},{4,52},{-20,52},{32,48},{8,48},{0,48},{-24,48},{32,44},{8,44},{0,44},{-24,44},{36,40},{8,40},{0,40},{-24,40},{36,36},{12,36},{0,36},{-28,36},{36,32},{12,32},{-4,32},{-28,32},{36,28},{12,28},{-4,28},{-32,28},{36,24},{16,24},{-4,24},{-32,24},{40,20},{16,20},{-8,20},{-32,20},{40,16},{16,16},{-12,16},{-36,16},{44,12},{20,12},{-12,12},{-40,12},{44,8},{20,8},{-16,8},{-40,8},{40,4},{36,4},{32,4},{28,4},{24,4},{20,4},{-20,4},{-24,4},{-28,4},{-32,4},{-36,4}};
-const short C2_Dead_0[155][2] = {{40,128},{40,124},{36,124},{32,124},{28,124},{24,124},{-16,124},{-20,124},{-24,124},{28,120},{20,120},{16,120},{12,120},{8,120},{4,120},{0,120},{-4,120},{-8,120},{-12,120},{-28,120},{32,116},{28,116},{-28,116},{36,112},{32,112},{-28,112},{48,108},{44,108},{40,108},{36,108},{-28,108},{56,104},{52,104},{-16,104},{-20,104},{-24,104},{-32,104},{52,100},{8,100},{4,100},{0,100},{-4,100},{-8,100},{-12,100},{-16,100},{-36,100},{48,96},{24,96},{20,96},{16,96},{12,96},{4,96},{0,96},{-20,96},{-32,96},{44,92},{40,92},{36,92},{0,92},{-4,92},{-8,92},{-24,92},{-28,92},{36,88},{-8,88},{-12,88},{-24,88},{32,84},{-12,84},{-28,84},{28,80},{-12,80},{-24,80},{-28,80},{-32,80},{24,76},{-8,76},{-12,76},{-16,76},{-20,76},{-24,76},{-32,76},{20,72},{16,72},{12,72},{8,72},{4,72},{0,72},{-4,72},{-36,72},{20,68},{16,68},{-36,68},{20,64},{-8,64},{-36,64},{20,60},{-8,60},{-36,60},{20,56},{-8,56},{-36,56},{20,52},{-8,52},{-36,52},{20,48},{-4,48},{-12,48},{-36,48},{20,44},{-4,44},{-12,44},{-40,44},{20,40},{0,40},{-16,40},{-40,40},{20,36},{0,36},{-16,36},{-40,36},{20,32},{0,32},{-16,32},{-40,32},{20,28},{0,28},{-16,28},{-40,28},{20,24},{0,24},{-16,24},{-40,24},{24,20},{4,20},{-20,20},{-40,20},{24,16},{4,16},{-20,16},{-44,16},{24,12},{4,12},{-24,12},{-28,12},{-32,12},{-36,12},{-40,12},{-44,12},{24,8},{4,8},{20,4},{16,4},{12,4},{8,4}};
-const short C2_Dead_1[150][2] = {{68,132},{48,124},{48,120},{44,120},{40,120},{36,120},{32,120},{-4,120},{-8,120},{-12,120},{32,116},{28,116},{24,116},{20,116},{16,116},{12,116},{8,116},{4,116},{0,116},{-16,116},{-20,116},{-24,116},{32,112},{-16,112},{-28,112},{40,108},{36,108},{32,108},{-16,108},{-28,108},{56,104},{52,104},{48,104},{44,104},{40,104},{-16,104},{-28,104},{64,100},{60,100},{-4,100},{-8,100},{-12,100},{-20,100},{-24,100},{60,96},{32,96},{28,96},{24,96},{20,96},{16,96},{12,96},{8,96},{4,96},{0,96},{-8,96},{-16,96},{56,92},{8,92},{4,92},{-12,92},{52,88},{48,88},{4,88},{-16,88},{44,84},{0,84},{-20,84},{-24,84},{40,80},{-4,80},{-20,80},{-24,80},{-28,80},{36,76},{-4,76},{-8,76},{-12,76},{-16,76},{-20,76},{-32,76},{32,72},{4,72},{0,72},{-4,72},{-8,72},{-36,72},{28,68},{24,68},{16,68},{12,68},{8,68},{4,68},{-12,68},{-40,68},{20,64},{16,64},{-16,64},{-44,64},{16,60},{-16,60},{-48,60},{12,56},{-16,56},{-48,56},{8,52},{-20,52},{-24,52},{-48,52},{4,48},{-20,48},{-28,48},{-48,48},{4,44},{-20,44},{-28,44},{-48,44},{4,40},{-20,40},{-28,40},{-48,40},{4,36},{-20,36},{-28,36},{-48,36},{4,32},{-20,32},{-28,32},{-48,32},{4,28},{-20,28},{-28,28},{-48,28},{4,24},{-16,24},{-32,24},{-52,24},{8,20},{-16,20},{-36,20},{-56,20},{8,16},{-12,16},{-40,16},{-44,16},{-48,16},{-52,16},{4,12},{0,12},{-4,12},{-8,12}};
-const short C2_Dead_2[176][2] = {{20,116},{16,116},{12,116},{32,112},{28,112},{24,112},{8,112},{4,112},{0,112},{-4,112},{-8,112},{76,108},{36,108},{20,108},{16,108},{12,108},{-12,108},{56,104},{52,104},{48,104},{44,104},{40,104},{28,104},{24,104},{-12,104},{-16,104},{-20,104},{-24,104},{-28,104},{-32,104},{-36,104},{-40,104},{-44,104},{-48,104},{-52,104},{-56,104},{-60,104},{-64,104},{-68,104},{-72,104},{-96,104},{-100,104},{-104,104},{36,100},{32,100},{-12,100},{-40,100},{-44,100},{-76,100},{-80,100},{-84,100},{-88,100},{-96,100},{-104,100},{48,96},{44,96},{40,96},{4,96},{0,96},{-4,96},{-8,96},{-12,96},{-40,96},{-92,96},{-104,96},{48,92},{12,92},{8,92},{0,92},{-4,92},{-8,92},{-12,92},{-16,92},{-40,92},{-104,92},{48,88},{16,88},{12,88},{8,88},{4,88},{-20,88},{-24,88},{-28,88},{-32,88},{-36,88},{-44,88},{-104,88},{48,84},{28,84},{24,84},{20,84},{-32,84},{-36,84},{-48,84},{-52,84},{-56,84},{-60,84},{-64,84},{-68,84},{-72,84},{-76,84},{-80,84},{-84,84},{-88,84},{-104,84},{48,80},{-28,80},{-32,80},{-64,80},{-68,80},{-72,80},{-92,80},{-96,80},{-100,80},{72,76},{68,76},{52,76},{48,76},{-28,76},{-76,76},{-80,76},{72,72},{56,72},{52,72},{40,72},{36,72},{32,72},{28,72},{24,72},{20,72},{16,72},{12,72},{8,72},{4,72},{0,72},{-4,72},{-8,72},{-12,72},{-24,72},{-28,72},{-80,72},{68,68},{64,68},{60,68},{56,68},{52,68},{48,68},{44,68},{-16,68},{-20,68},{-24,68},{-28,68},{-80,68},{-32,64},{-36,64},{-40,64},{-80,64},{-44,60},{-48,60},{-52,60},{-84,60},{-56,56},{-60,56},{-84,56},{-64,52},{-84,52},{-68,48},{-84,48},{-68,44},{-88,44},{-68,40},{-72,40},{-88,40},{-76,36},{-80,36},{-84,36}};
-const short C2_Dead_3[157][2] = {{-40,128},{-44,128},{-36,124},{-48,124},{-32,120},{-48,120},{-20,116},{-24,116},{-28,116},{-48,116},{-12,112},{-16,112},{-48,112},{-8,108},{-44,108},{-60,108},{-64,108},{4,104},{0,104},{-4,104},{-44,104},{-56,104},{-68,104},{8,100},{-28,100},{-32,100},{-36,100},{-40,100},{-56,100},{-68,100},{12,96},{8,96},{-24,96},{-52,96},{-68,96},{44,92},{40,92},{16,92},{8,92},{-16,92},{-20,92},{-24,92},{-28,92},{-32,92},{-36,92},{-40,92},{-44,92},{-48,92},{-68,92},{48,88},{36,88},{20,88},{8,88},{-8,88},{-12,88},{-64,88},{52,84},{36,84},{24,84},{8,84},{-4,84},{-64,84},{52,80},{36,80},{28,80},{8,80},{4,80},{0,80},{-48,80},{-52,80},{-56,80},{-60,80},{56,76},{36,76},{32,76},{12,76},{8,76},{4,76},{0,76},{-40,76},{-44,76},{56,72},{40,72},{16,72},{12,72},{0,72},{-28,72},{-32,72},{-36,72},{56,68},{40,68},{20,68},{16,68},{0,68},{-4,68},{-12,68},{-16,68},{-20,68},{-24,68},{60,64},{44,64},{24,64},{20,64},{-4,64},{-8,64},{60,60},{44,60},{28,60},{24,60},{-4,60},{60,56},{44,56},{32,56},{28,56},{0,56},{60,52},{40,52},{36,52},{32,52},{4,52},{60,48},{40,48},{36,48},{8,48},{60,44},{40,44},{8,44},{60,40},{40,40},{8,40},{60,36},{36,36},{8,36},{60,32},{32,32},{8,32},{60,28},{32,28},{8,28},{32,24},{12,24},{48,20},{36,20},{32,20},{16,20},{48,16},{44,16},{40,16},{24,16},{20,16},{28,12},{40,8},{36,8},{32,8},{52,4},{48,4},{44,4}};
-const short C2_Dead_4[127][2] = {{96,84},{92,84},{88,84},{100,80},{84,80},{80,80},{76,80},{104,76},{72,76},{68,76},{64,76},{108,72},{96,72},{92,72},{88,72},{84,72},{80,72},{76,72},{72,72},{60,72},{56,72},{112,68},{100,68},{68,68},{64,68},{52,68},{116,64},{104,64},{60,64},{56,64},{48,64},{44,64},{112,60},{108,60},{104,60},{52,60},{48,60},{40,60},{36,60},{112,56},{92,56},{44,56},{32,56},{28,56},{24,56},{20,56},{16,56},{12,56},{116,52},{96,52},{88,52},{40,52},{36,52},{8,52},{4,52},{112,48},{108,48},{104,48},{100,48},{84,48},{80,48},{0,48},{88,44},{76,44},{0,44},{88,40},{72,40},{68,40},{64,40},{60,40},{-4,40},{88,36},{68,36},{52,36},{48,36},{44,36},{-4,36},{84,32},{68,32},{64,32},{40,32},{-4,32},{84,28},{64,28},{60,28},{56,28},{40,28},{36,28},{32,28},{28,28},{24,28},{20,28},{16,28},{-4,28},{80,24},{56,24},{52,24},{48,24},{44,24},{12,24},{8,24},{0,24},{76,20},{48,20},{8,20},{0,20},{76,16},{4,16},{0,16},{72,12},{68,12},{4,12},{64,8},{8,8},{60,4},{56,4},{52,4},{48,4},{44,4},{40,4},{36,4},{32,4},{28,4},{24,4},{20,4},{16,4},{12,4}};
-const short C2_Dead_5[139][2] = {{36,100},{32,100},{28,100},{24,100},{-4,100},{-8,100},{-12,100},{40,96},{20,96},{16,96},{0,96},{-16,96},{40,92},{12,92},{8,92},{0,92},{-20,92},{36,88},{8,88},{-4,88},{-24,88},{36,84},{32,84},{8,84},{-8,84},{-28,84},{28,80},{8,80},{-8,80},{-28,80},{24,76},{8,76},{-4,76},{-24,76},{24,72},{8,72},{0,72},{-20,72},{24,68},{4,68},{-20,68},{28,64},{4,64},{-16,64},{28,60},{4,60},{-16,60},{28,56},{0,56},{-16,56},{28,52},{0,52},{-16,52},{28,48},{0,48},{-16,48},{28,44},{0,44},{-16,44},{28,40},{0,40},{-16,40},{36,36},{32,36},{28,36},{-4,36},{-16,36},{40,32},{28,32},{-8,32},{-16,32},{24,28},{-12,28},{-16,28},{48,24},{44,24},{40,24},{36,24},{32,24},{28,24},{24,24},{-16,24},{104,20},{100,20},{96,20},{92,20},{88,20},{84,20},{80,20},{76,20},{72,20},{68,20},{64,20},{60,20},{56,20},{52,20},{20,20},{16,20},{-16,20},{108,16},{12,16},{8,16},{-16,16},{112,12},{8,12},{4,12},{-16,12},{108,8},{104,8},{100,8},{96,8},{4,8},{-12,8},{92,4},{88,4},{84,4},{80,4},{76,4},{72,4},{68,4},{64,4},{60,4},{56,4},{52,4},{48,4},{44,4},{40,4},{36,4},{32,4},{28,4},{24,4},{20,4},{16,4},{12,4},{8,4},{4,4},{0,4},{-4,4},{-8,4}};
-const short C2_Dead_6[164][2] = {{12,60},{8,60},{4,60},{0,60},{-4,60},{-8,60},{-12,60},{-16,60},{-20,60},{-24,60},{-28,60},{-32,60},{-36,60},{100,56},{96,56},{92,56},{28,56},{24,56},{20,56},{16,56},{-28,56},{-40,56},{-44,56},{104,52},{88,52},{84,52},{32,52},{-28,52},{-48,52},{104,48},{80,48},{40,48},{36,48},{-24,48},{-32,48},{-36,48},{-52,48},{-56,48},{100,44},{20,44},{16,44},{12,44},{8,44},{4,44},{0,44},{-4,44},{-8,44},{-12,44},{-16,44},{-24,44},{-40,44},{-60,44},{-64,44},{-68,44},{-72,44},{96,40},{92,40},{88,40},{84,40},{80,40},{76,40},{72,40},{68,40},{64,40},{60,40},{56,40},{52,40},{44,40},{36,40},{32,40},{28,40},{24,40},{20,40},{-20,40},{-24,40},{-44,40},{-48,40},{-76,40},{108,36},{104,36},{100,36},{48,36},{-20,36},{-52,36},{-56,36},{-80,36},{112,32},{44,32},{40,32},{-20,32},{-60,32},{-64,32},{-84,32},{-88,32},{112,28},{-16,28},{-20,28},{-68,28},{-72,28},{-92,28},{112,24},{96,24},{92,24},{88,24},{84,24},{80,24},{76,24},{72,24},{12,24},{8,24},{4,24},{0,24},{-4,24},{-8,24},{-12,24},{-16,24},{-20,24},{-24,24},{-28,24},{-32,24},{-36,24},{-76,24},{-80,24},{-96,24},{108,20},{104,20},{100,20},{68,20},{20,20},{16,20},{-40,20},{-84,20},{-100,20},{68,16},{64,16},{60,16},{32,16},{28,16},{24,16},{-44,16},{-48,16},{-52,16},{-56,16},{-88,16},{-104,16},{56,12},{52,12},{48,12},{44,12},{40,12},{36,12},{-60,12},{-64,12},{-68,12},{-72,12},{-92,12},{-104,12},{-76,8},{-92,8},{-100,8},{-80,4},{-84,4},{-88,4},{-96,4}};
-const short C2_Dead_7[169][2] = {{-36,44},{-40,44},{-44,44},{-48,44},{-52,44},{-56,44},{20,40},{16,40},{12,40},{8,40},{4,40},{0,40},{-4,40},{-8,40},{-12,40},{-16,40},{-20,40},{-24,40},{-28,40},{-32,40},{-60,40},{40,36},{36,36},{32,36},{28,36},{24,36},{-8,36},{-64,36},{88,32},{84,32},{44,32},{-4,32},{-8,32},{-68,32},{92,28},{80,28},{-4,28},{-20,28},{-24,28},{-28,28},{-32,28},{-72,28},{112,24},{108,24},{104,24},{92,24},{76,24},{44,24},{40,24},{36,24},{32,24},{28,24},{24,24},{20,24},{16,24},{12,24},{8,24},{4,24},{0,24},{-4,24},{-8,24},{-12,24},{-16,24},{-36,24},{-40,24},{-44,24},{-48,24},{-52,24},{-76,24},{-108,24},{-112,24},{116,20},{100,20},{96,20},{92,20},{88,20},{84,20},{80,20},{76,20},{72,20},{68,20},{64,20},{60,20},{56,20},{52,20},{48,20},{44,20},{0,20},{-4,20},{-56,20},{-60,20},{-64,20},{-68,20},{-72,20},{-76,20},{-80,20},{-84,20},{-88,20},{-92,20},{-96,20},{-100,20},{-104,20},{-116,20},{116,16},{0,16},{-116,16},{116,12},{4,12},{0,12},{-116,12},{112,8},{4,8},{-116,8},{108,4},{104,4},{100,4},{96,4},{92,4},{88,4},{84,4},{80,4},{76,4},{72,4},{68,4},{64,4},{60,4},{56,4},{52,4},{48,4},{44,4},{40,4},{36,4},{32,4},{28,4},{24,4},{20,4},{16,4},{12,4},{8,4},{4,4},{0,4},{-4,4},{-8,4},{-12,4},{-16,4},{-20,4},{-24,4},{-28,4},{-32,4},{-36,4},{-40,4},{-44,4},{-48,4},{-52,4},{-56,4},{-60,4},{-64,4},{-68,4},{-72,4},{-76,4},{-80,4},{-84,4},{-88,4},{-92,4},{-96,4},{-100,4},{-104,4},{-108,4},{-112,4}};
-const short C2_Fall_0[148][2] = {{36,128},{32,128},{24,128},{40,124},{28,124},{-16,124},{-20,124},{-24,124},{-28,124},{44,120},{28,120},{-32,120},{48,116},{28,116},{-16,116},{-36,116},{48,112},{24,112},{-4,112},{-16,112},{-40,112},{52,108},{32,108},{20,108},{-4,108},{-16,108},{-24,108},{-28,108},{-32,108},{-44,108},{56,104},{32,104},{28,104},{16,104},{12,104},{8,104},{4,104},{0,104},{-4,104},{-8,104},{-12,104},{-20,104},{-44,104},{56,100},{36,100},{28,100},{-4,100},{-20,100},{-44,100},{56,96},{36,96},{24,96},{-4,96},{-20,96},{-44,96},{52,92},{48,92},{44,92},{40,92},{20,92},{0,92},{-24,92},{-28,92},{-32,92},{-36,92},{-40,92},{20,88},{0,88},{-8,88},{-12,88},{-24,88},{20,84},{0,84},{-4,84},{-16,84},{-20,84},{-24,84},{24,80},{4,80},{-20,80},{24,76},{20,76},{8,76},{4,76},{-24,76},{28,72},{16,72},{12,72},{4,72},{-24,72},{32,68},{4,68},{-24,68},{32,64},{4,64},{-24,64},{36,60},{4,60},{-24,60},{36,56},{8,56},{0,56},{-24,56},{36,52},{12,52},{0,52},{-24,52},{36,48},{12,48},{0,48},{-20,48},{36,44},{12,44},{0,44},{-20,44},{36,40},{12,40},{0,40},{-20,40},{36,36},{12,36},{0,36},{-20,36},{36,32},{16,32},{-4,32},{-20,32},{36,28},{16,28},{-4,28},{-20,28},{36,24},{16,24},{-8,24},{-12,24},{-16,24},{36,20},{16,20},{40,16},{16,16},{40,12},{16,12},{36,8},{16,8},{32,4},{28,4},{24,4},{20,4}};
-const short C2_Forward_0[144][2] = {{16,120},{20,116},{24,112},{20,112},{28,108},{20,108},{-24,108},{-28,108},{32,104},{16,104},{12,104},{-12,104},{-24,104},{-32,104},{36,100},{8,100},{4,100},{0,100},{-12,100},{-24,100},{-36,100},{36,96},{-4,96},{-8,96},{-12,96},{-16,96},{-20,96},{-40,96},{36,92},{-8,92},{-44,92},{36,88},{-8,88},{-44,88},{32,84},{28,84},{-4,84},{-8,84},{-24,84},{-44,84},{24,80},{20,80},{16,80},{12,80},{8,80},{4,80},{0,80},{-4,80},{-24,80},{-28,80},{-44,80},{24,76},{-4,76},{-20,76},{-44,76},{24,72},{-4,72},{-20,72},{-44,72},{28,68},{0,68},{-20,68},{-24,68},{-40,68},{28,64},{0,64},{-24,64},{-28,64},{-32,64},{-36,64},{32,60},{24,60},{20,60},{0,60},{-16,60},{-20,60},{-24,60},{36,56},{16,56},{12,56},{8,56},{4,56},{-4,56},{-8,56},{-12,56},{-24,56},{36,52},{4,52},{-24,52},{40,48},{8,48},{0,48},{-28,48},{44,44},{12,44},{-4,44},{-32,44},{44,40},{12,40},{-4,40},{-32,40},{48,36},{16,36},{-8,36},{-32,36},{48,32},{20,32},{-8,32},{-32,32},{52,28},{24,28},{-12,28},{-32,28},{52,24},{28,24},{-12,24},{-36,24},{56,20},{32,20},{-12,20},{-36,20},{56,16},{32,16},{-16,16},{-40,16},{60,12},{36,12},{-16,12},{-44,12},{60,8},{36,8},{-20,8},{-44,8},{56,4},{52,4},{48,4},{44,4},{40,4},{36,4},{-24,4},{-28,4},{-32,4},{-36,4},{-40,4}};
-const short C2_Forward_1[145][2] = {{20,120},{16,120},{24,116},{24,112},{28,108},{24,108},{-24,108},{-28,108},{32,104},{20,104},{16,104},{8,104},{4,104},{0,104},{-4,104},{-12,104},{-24,104},{-32,104},{36,100},{12,100},{-8,100},{-12,100},{-24,100},{-36,100},{36,96},{-8,96},{-12,96},{-16,96},{-20,96},{-40,96},{36,92},{-8,92},{-44,92},{36,88},{0,88},{-4,88},{-8,88},{-44,88},{32,84},{28,84},{8,84},{4,84},{-4,84},{-24,84},{-44,84},{24,80},{20,80},{16,80},{12,80},{-4,80},{-24,80},{-44,80},{24,76},{-4,76},{-24,76},{-28,76},{-44,76},{24,72},{-4,72},{-20,72},{-44,72},{28,68},{0,68},{-20,68},{-44,68},{28,64},{0,64},{-20,64},{-24,64},{-40,64},{32,60},{24,60},{20,60},{16,60},{0,60},{-16,60},{-24,60},{-28,60},{-32,60},{-36,60},{36,56},{12,56},{8,56},{4,56},{-4,56},{-8,56},{-12,56},{-24,56},{36,52},{4,52},{-24,52},{40,48},{8,48},{4,48},{-24,48},{40,44},{8,44},{0,44},{-28,44},{40,40},{8,40},{0,40},{-28,40},{44,36},{12,36},{-4,36},{-28,36},{44,32},{16,32},{-4,32},{-28,32},{44,28},{16,28},{-8,28},{-28,28},{44,24},{20,24},{-8,24},{-32,24},{48,20},{24,20},{-8,20},{-32,20},{48,16},{24,16},{-8,16},{-32,16},{48,12},{28,12},{-8,12},{-36,12},{48,8},{28,8},{-12,8},{-36,8},{44,4},{40,4},{36,4},{32,4},{28,4},{-16,4},{-20,4},{-24,4},{-28,4},{-32,4}};
-const short C2_Forward_2[144][2] = {{16,120},{20,116},{24,112},{20,112},{-24,112},{28,108},{20,108},{-24,108},{-28,108},{32,104},{16,104},{8,104},{4,104},{0,104},{-4,104},{-12,104},{-24,104},{-32,104},{36,100},{12,100},{-8,100},{-12,100},{-24,100},{-36,100},{36,96},{-8,96},{-12,96},{-16,96},{-20,96},{-40,96},{36,92},{-8,92},{-44,92},{36,88},{0,88},{-4,88},{-44,88},{32,84},{28,84},{8,84},{4,84},{-8,84},{-24,84},{-44,84},{24,80},{20,80},{16,80},{12,80},{-8,80},{-24,80},{-44,80},{24,76},{-4,76},{-24,76},{-28,76},{-44,76},{24,72},{-4,72},{-20,72},{-44,72},{28,68},{0,68},{-20,68},{-44,68},{28,64},{0,64},{-20,64},{-24,64},{-40,64},{32,60},{24,60},{20,60},{16,60},{4,60},{0,60},{-16,60},{-24,60},{-28,60},{-32,60},{-36,60},{32,56},{12,56},{8,56},{-4,56},{-8,56},{-12,56},{-24,56},{32,52},{0,52},{-28,52},{36,48},{4,48},{0,48},{-28,48},{36,44},{4,44},{-4,44},{-32,44},{36,40},{4,40},{-4,40},{-32,40},{36,36},{4,36},{-8,36},{-32,36},{36,32},{8,32},{-8,32},{-32,32},{36,28},{8,28},{-12,28},{-32,28},{36,24},{12,24},{-12,24},{-36,24},{40,20},{16,20},{-12,20},{-36,20},{40,16},{16,16},{-12,16},{-36,16},{40,12},{20,12},{-12,12},{-36,12},{40,8},{20,8},{-16,8},{-36,8},{36,4},{32,4},{28,4},{24,4},{20,4},{-20,4},{-24,4},{-28,4},{-32,4},{-36,4}};
-const short C2_Forward_3[142][2] = {{20,120},{24,116},{28,112},{24,112},{-20,112},{32,108},{24,108},{-20,108},{-24,108},{36,104},{20,104},{12,104},{8,104},{4,104},{0,104},{-8,104},{-20,104},{-28,104},{40,100},{16,100},{-4,100},{-8,100},{-20,100},{-32,100},{40,96},{-4,96},{-8,96},{-12,96},{-16,96},{-36,96},{40,92},{-4,92},{-40,92},{40,88},{4,88},{0,88},{-4,88},{-40,88},{36,84},{32,84},{12,84},{8,84},{-4,84},{-20,84},{-40,84},{28,80},{24,80},{20,80},{16,80},{-4,80},{-20,80},{-40,80},{28,76},{-4,76},{-20,76},{-24,76},{-40,76},{28,72},{0,72},{-16,72},{-40,72},{32,68},{0,68},{-16,68},{-40,68},{32,64},{0,64},{-16,64},{-20,64},{-36,64},{28,60},{24,60},{20,60},{4,60},{0,60},{-12,60},{-20,60},{-24,60},{-28,60},{-32,60},{28,56},{16,56},{12,56},{8,56},{-4,56},{-8,56},{-24,56},{32,52},{0,52},{-28,52},{32,48},{4,48},{0,48},{-28,48},{32,44},{4,44},{-4,44},{-32,44},{32,40},{4,40},{-4,40},{-32,40},{32,36},{4,36},{-8,36},{-32,36},{32,32},{4,32},{-12,32},{-32,32},{32,28},{4,28},{-12,28},{-36,28},{28,24},{4,24},{-12,24},{-36,24},{28,20},{4,20},{-16,20},{-40,20},{28,16},{0,16},{-20,16},{-40,16},{24,12},{20,12},{0,12},{-20,12},{-36,12},{20,8},{0,8},{-24,8},{-28,8},{-32,8},{20,4},{16,4},{12,4},{8,4},{4,4},{0,4}};
-const short C2_Forward_4[137][2] = {{20,120},{24,116},{28,112},{24,112},{-20,112},{32,108},{24,108},{-20,108},{-24,108},{36,104},{20,104},{16,104},{-8,104},{-20,104},{-28,104},{40,100},{12,100},{8,100},{4,100},{0,100},{-4,100},{-8,100},{-20,100},{-32,100},{40,96},{16,96},{-4,96},{-8,96},{-12,96},{-16,96},{-36,96},{40,92},{-4,92},{-40,92},{40,88},{-4,88},{-40,88},{36,84},{32,84},{4,84},{0,84},{-20,84},{-40,84},{28,80},{24,80},{20,80},{16,80},{12,80},{8,80},{-4,80},{-20,80},{-24,80},{-40,80},{24,76},{-4,76},{-16,76},{-40,76},{24,72},{0,72},{-16,72},{-40,72},{28,68},{0,68},{-16,68},{-20,68},{-36,68},{28,64},{0,64},{-20,64},{-24,64},{-28,64},{-32,64},{28,60},{24,60},{0,60},{-4,60},{-16,60},{-24,60},{28,56},{20,56},{16,56},{12,56},{8,56},{4,56},{-8,56},{-12,56},{-24,56},{32,52},{0,52},{-28,52},{32,48},{4,48},{-4,48},{-32,48},{32,44},{4,44},{-8,44},{-32,44},{36,40},{8,40},{-12,40},{-36,40},{36,36},{12,36},{-16,36},{-36,36},{36,32},{12,32},{-16,32},{-40,32},{40,28},{16,28},{-20,28},{-40,28},{40,24},{16,24},{-20,24},{-44,24},{40,20},{16,20},{-24,20},{-44,20},{40,16},{16,16},{-28,16},{-44,16},{40,12},{20,12},{-32,12},{-36,12},{-40,12},{40,8},{20,8},{36,4},{32,4},{28,4},{24,4}};
-const short C2_Forward_5[147][2] = {{16,116},{20,112},{24,108},{20,108},{-24,108},{28,104},{20,104},{-24,104},{-28,104},{32,100},{16,100},{12,100},{-12,100},{-24,100},{-32,100},{36,96},{8,96},{4,96},{0,96},{-4,96},{-8,96},{-12,96},{-24,96},{-36,96},{36,92},{12,92},{-8,92},{-12,92},{-16,92},{-20,92},{-40,92},{36,88},{-8,88},{-44,88},{36,84},{-8,84},{-44,84},{32,80},{28,80},{0,80},{-4,80},{-24,80},{-44,80},{24,76},{20,76},{16,76},{12,76},{8,76},{4,76},{-4,76},{-24,76},{-28,76},{-44,76},{20,72},{-4,72},{-20,72},{-44,72},{20,68},{-4,68},{-20,68},{-44,68},{24,64},{0,64},{-20,64},{-24,64},{-40,64},{24,60},{0,60},{-24,60},{-28,60},{-32,60},{-36,60},{28,56},{24,56},{20,56},{0,56},{-4,56},{-20,56},{-28,56},{32,52},{16,52},{12,52},{8,52},{4,52},{-8,52},{-12,52},{-16,52},{-28,52},{-32,52},{32,48},{0,48},{-4,48},{-36,48},{32,44},{4,44},{-8,44},{-36,44},{36,40},{8,40},{-12,40},{-40,40},{36,36},{12,36},{-16,36},{-40,36},{36,32},{12,32},{-16,32},{-40,32},{40,28},{16,28},{-16,28},{-40,28},{40,24},{16,24},{-16,24},{-44,24},{44,20},{20,20},{-20,20},{-44,20},{44,16},{20,16},{-24,16},{-48,16},{44,12},{24,12},{-24,12},{-48,12},{-52,12},{48,8},{24,8},{-24,8},{-52,8},{48,4},{44,4},{40,4},{36,4},{32,4},{28,4},{-28,4},{-32,4},{-36,4},{-40,4},{-44,4},{-48,4},{-52,4}};
-const short C2_Idle_0[147][2] = {{16,120},{12,120},{20,116},{24,112},{20,112},{28,108},{20,108},{-24,108},{32,104},{16,104},{-12,104},{-24,104},{-28,104},{36,100},{12,100},{-12,100},{-24,100},{-32,100},{36,96},{8,96},{4,96},{0,96},{-4,96},{-8,96},{-12,96},{-16,96},{-20,96},{-36,96},{36,92},{-4,92},{-8,92},{-36,92},{36,88},{-8,88},{-20,88},{-40,88},{32,84},{28,84},{-8,84},{-20,84},{-40,84},{24,80},{20,80},{16,80},{12,80},{-4,80},{-8,80},{-16,80},{-20,80},{-24,80},{-40,80},{24,76},{8,76},{4,76},{0,76},{-4,76},{-16,76},{-40,76},{24,72},{-4,72},{-16,72},{-40,72},{28,68},{-4,68},{-16,68},{-20,68},{-36,68},{28,64},{0,64},{-20,64},{-24,64},{-28,64},{-32,64},{32,60},{24,60},{20,60},{16,60},{0,60},{-20,60},{-24,60},{36,56},{12,56},{8,56},{4,56},{-4,56},{-8,56},{-12,56},{-16,56},{-24,56},{36,52},{4,52},{-24,52},{40,48},{8,48},{0,48},{-28,48},{40,44},{12,44},{0,44},{-28,44},{40,40},{12,40},{0,40},{-28,40},{40,36},{16,36},{-4,36},{-32,36},{40,32},{16,32},{-4,32},{-32,32},{40,28},{20,28},{-8,28},{-32,28},{40,24},{20,24},{-12,24},{-36,24},{44,20},{20,20},{-12,20},{-36,20},{44,16},{20,16},{-16,16},{-40,16},{48,12},{24,12},{-16,12},{-44,12},{48,8},{24,8},{-20,8},{-44,8},{44,4},{40,4},{36,4},{32,4},{28,4},{24,4},{-24,4},{-28,4},{-32,4},{-36,4},{-40,4}};
-const short C2_Idle_1[146][2] = {{16,120},{12,120},{20,116},{24,112},{20,112},{28,108},{20,108},{-24,108},{32,104},{16,104},{-12,104},{-24,104},{-28,104},{36,100},{12,100},{8,100},{4,100},{0,100},{-12,100},{-20,100},{-32,100},{36,96},{-4,96},{-8,96},{-12,96},{-16,96},{-20,96},{-36,96},{36,92},{-8,92},{-36,92},{36,88},{-8,88},{-20,88},{-40,88},{32,84},{-4,84},{-8,84},{-20,84},{-24,84},{-40,84},{28,80},{24,80},{20,80},{16,80},{12,80},{8,80},{4,80},{0,80},{-4,80},{-8,80},{-16,80},{-40,80},{24,76},{-4,76},{-16,76},{-40,76},{24,72},{-4,72},{-16,72},{-20,72},{-36,72},{28,68},{-4,68},{-20,68},{-24,68},{-28,68},{-32,68},{28,64},{0,64},{-24,64},{32,60},{24,60},{20,60},{16,60},{0,60},{-16,60},{-20,60},{-24,60},{36,56},{12,56},{8,56},{4,56},{0,56},{-4,56},{-8,56},{-12,56},{-24,56},{36,52},{4,52},{-28,52},{36,48},{8,48},{0,48},{-28,48},{40,44},{12,44},{-4,44},{-28,44},{40,40},{12,40},{-4,40},{-32,40},{40,36},{16,36},{-4,36},{-32,36},{40,32},{16,32},{-8,32},{-32,32},{40,28},{16,28},{-8,28},{-36,28},{40,24},{20,24},{-12,24},{-36,24},{44,20},{20,20},{-12,20},{-36,20},{44,16},{20,16},{-16,16},{-40,16},{48,12},{24,12},{-20,12},{-44,12},{48,8},{24,8},{-20,8},{-44,8},{44,4},{40,4},{36,4},{32,4},{28,4},{24,4},{-24,4},{-28,4},{-32,4},{-36,4},{-40,4}};
-const short C2_Idle_2[150][2] = {{16,124},{12,124},{24,120},{20,120},{28,116},{20,116},{32,112},{20,112},{-24,112},{32,108},{16,108},{12,108},{-12,108},{-24,108},{-28,108},{36,104},{8,104},{4,104},{0,104},{-4,104},{-12,104},{-20,104},{-32,104},{36,100},{-4,100},{-8,100},{-12,100},{-16,100},{-36,100},{36,96},{-8,96},{-20,96},{-36,96},{36,92},{-8,92},{-20,92},{-40,92},{32,88},{0,88},{-4,88},{-20,88},{-24,88},{-40,88},{28,84},{24,84},{20,84},{16,84},{12,84},{8,84},{4,84},{-4,84},{-16,84},{-40,84},{24,80},{-4,80},{-16,80},{-40,80},{28,76},{0,76},{-16,76},{-20,76},{-36,76},{28,72},{0,72},{-20,72},{-24,72},{-28,72},{-32,72},{28,68},{4,68},{-24,68},{32,64},{24,64},{20,64},{16,64},{4,64},{-16,64},{-20,64},{-24,64},{32,60},{12,60},{8,60},{4,60},{0,60},{-4,60},{-8,60},{-12,60},{-24,60},{36,56},{4,56},{-24,56},{36,52},{8,52},{0,52},{-28,52},{36,48},{8,48},{0,48},{-28,48},{36,44},{12,44},{-4,44},{-28,44},{40,40},{16,40},{-4,40},{-28,40},{40,36},{16,36},{-4,36},{-32,36},{40,32},{16,32},{-8,32},{-32,32},{40,28},{16,28},{-8,28},{-36,28},{40,24},{20,24},{-12,24},{-36,24},{44,20},{20,20},{-12,20},{-36,20},{44,16},{20,16},{-16,16},{-40,16},{48,12},{24,12},{-16,12},{-44,12},{48,8},{24,8},{-20,8},{-44,8},{44,4},{40,4},{36,4},{32,4},{28,4},{24,4},{-24,4},{-28,4},{-32,4},{-36,4},{-40,4}};
-const short C2_Idle_3[150][2] = {{16,124},{12,124},{24,120},{20,120},{28,116},{20,116},{32,112},{20,112},{-24,112},{32,108},{16,108},{-12,108},{-24,108},{-28,108},{36,104},{12,104},{8,104},{4,104},{0,104},{-4,104},{-12,104},{-20,104},{-32,104},{36,100},{-4,100},{-8,100},{-12,100},{-16,100},{-36,100},{36,96},{-8,96},{-20,96},{-36,96},{36,92},{-8,92},{-20,92},{-40,92},{32,88},{0,88},{-4,88},{-20,88},{-24,88},{-40,88},{28,84},{24,84},{20,84},{16,84},{12,84},{8,84},{4,84},{-4,84},{-16,84},{-40,84},{24,80},{-4,80},{-16,80},{-40,80},{28,76},{0,76},{-16,76},{-20,76},{-36,76},{28,72},{0,72},{-20,72},{-24,72},{-28,72},{-32,72},{28,68},{4,68},{-24,68},{32,64},{24,64},{20,64},{16,64},{4,64},{-16,64},{-20,64},{-24,64},{32,60},{12,60},{8,60},{4,60},{0,60},{-4,60},{-8,60},{-12,60},{-24,60},{36,56},{4,56},{-24,56},{36,52},{8,52},{0,52},{-28,52},{36,48},{8,48},{0,48},{-28,48},{36,44},{12,44},{-4,44},{-28,44},{40,40},{16,40},{-4,40},{-28,40},{40,36},{16,36},{-4,36},{-32,36},{40,32},{16,32},{-8,32},{-32,32},{40,28},{16,28},{-8,28},{-36,28},{40,24},{20,24},{-12,24},{-36,24},{44,20},{20,20},{-12,20},{-36,20},{44,16},{20,16},{-16,16},{-40,16},{48,12},{24,12},{-16,12},{-44,12},{48,8},{24,8},{-20,8},{-44,8},{44,4},{40,4},{36,4},{32,4},{28,4},{24,4},{-24,4},{-28,4},{-32,4},{-36,4},{-40,4}};
-const short C2_Idle_4[146][2] = {{16,120},{12,120},{20,116},{24,112},{20,112},{28,108},{20,108},{-24,108},{32,104},{16,104},{-12,104},{-28,104},{36,100},{12,100},{8,100},{4,100},{0,100},{-12,100},{-20,100},{-32,100},{36,96},{-4,96},{-8,96},{-12,96},{-16,96},{-20,96},{-36,96},{36,92},{-8,92},{-20,92},{-36,92},{36,88},{-8,88},{-20,88},{-40,88},{32,84},{28,84},{-4,84},{-8,84},{-20,84},{-24,84},{-40,84},{24,80},{20,80},{16,80},{12,80},{8,80},{4,80},{0,80},{-8,80},{-16,80},{-40,80},{24,76},{-4,76},{-16,76},{-40,76},{24,72},{-4,72},{-16,72},{-20,72},{-36,72},{28,68},{-4,68},{-20,68},{-24,68},{-28,68},{-32,68},{32,64},{28,64},{0,64},{-24,64},{32,60},{24,60},{20,60},{16,60},{0,60},{-16,60},{-20,60},{-24,60},{36,56},{12,56},{8,56},{4,56},{0,56},{-4,56},{-8,56},{-12,56},{-24,56},{36,52},{4,52},{-28,52},{40,48},{8,48},{0,48},{-28,48},{40,44},{12,44},{0,44},{-28,44},{40,40},{12,40},{-4,40},{-28,40},{40,36},{16,36},{-4,36},{-32,36},{40,32},{16,32},{-8,32},{-32,32},{40,28},{16,28},{-8,28},{-36,28},{40,24},{20,24},{-8,24},{-36,24},{44,20},{20,20},{-12,20},{-36,20},{44,16},{20,16},{-16,16},{-40,16},{48,12},{24,12},{-16,12},{-44,12},{48,8},{24,8},{-20,8},{-44,8},{44,4},{40,4},{36,4},{32,4},{28,4},{24,4},{-24,4},{-28,4},{-32,4},{-36,4},{-40,4}};
-const short C2_Jump_0[140][2] = {{0,108},{4,104},{8,100},{4,100},{-8,100},{20,96},{16,96},{12,96},{4,96},{28,92},{24,92},{4,92},{36,88},{32,88},{0,88},{-44,88},{40,84},{-4,84},{-32,84},{-44,84},{44,80},{0,80},{-4,80},{-8,80},{-32,80},{-44,80},{44,76},{24,76},{20,76},{16,76},{12,76},{8,76},{4,76},{-12,76},{-16,76},{-20,76},{-24,76},{-28,76},{-32,76},{-36,76},{-40,76},{-44,76},{48,72},{28,72},{16,72},{-28,72},{-36,72},{48,68},{24,68},{20,68},{-24,68},{-40,68},{48,64},{28,64},{20,64},{-20,64},{-40,64},{44,60},{40,60},{36,60},{32,60},{20,60},{-16,60},{-40,60},{20,56},{-16,56},{-20,56},{-24,56},{-28,56},{-32,56},{-36,56},{20,52},{-20,52},{-40,52},{-44,52},{-48,52},{20,48},{-12,48},{-16,48},{-52,48},{20,44},{0,44},{-4,44},{-8,44},{-12,44},{-52,44},{20,40},{12,40},{8,40},{4,40},{-16,40},{-52,40},{16,36},{12,36},{-20,36},{-52,36},{20,32},{8,32},{-20,32},{-48,32},{28,28},{24,28},{4,28},{-20,28},{-44,28},{32,24},{-20,24},{-40,24},{36,20},{-16,20},{-36,20},{36,16},{-8,16},{-12,16},{-32,16},{40,12},{16,12},{12,12},{8,12},{4,12},{0,12},{-4,12},{-8,12},{-32,12},{44,8},{20,8},{-12,8},{-16,8},{-36,8},{44,4},{40,4},{36,4},{32,4},{28,4},{24,4},{-20,4},{-24,4},{-28,4},{-32,4},{-36,4}};
-const short C2_Jump_1[140][2] = {{-4,116},{12,112},{8,112},{4,112},{0,112},{20,108},{16,108},{0,108},{28,104},{24,104},{0,104},{-44,104},{32,100},{-4,100},{-32,100},{-44,100},{36,96},{-8,96},{-12,96},{-16,96},{-20,96},{-24,96},{-28,96},{-32,96},{-36,96},{-40,96},{36,92},{16,92},{12,92},{8,92},{4,92},{0,92},{-4,92},{-32,92},{-44,92},{40,88},{20,88},{8,88},{-32,88},{-44,88},{40,84},{16,84},{12,84},{-32,84},{-48,84},{40,80},{20,80},{12,80},{-28,80},{-48,80},{36,76},{32,76},{28,76},{24,76},{12,76},{-24,76},{-48,76},{12,72},{-24,72},{-28,72},{-32,72},{-36,72},{-40,72},{-44,72},{12,68},{-28,68},{12,64},{-24,64},{-28,64},{12,60},{-8,60},{-12,60},{-16,60},{-20,60},{-32,60},{12,56},{4,56},{0,56},{-4,56},{-16,56},{-32,56},{8,52},{-16,52},{-32,52},{8,48},{-16,48},{-32,48},{8,44},{-16,44},{-36,44},{8,40},{-16,40},{-36,40},{12,36},{8,36},{-16,36},{-36,36},{20,32},{16,32},{-16,32},{-36,32},{24,28},{-16,28},{-36,28},{36,24},{32,24},{28,24},{-12,24},{-36,24},{40,20},{-4,20},{-8,20},{-12,20},{-36,20},{40,16},{0,16},{-12,16},{-36,16},{40,12},{8,12},{4,12},{-12,12},{-32,12},{40,8},{20,8},{16,8},{12,8},{-12,8},{-36,8},{36,4},{32,4},{28,4},{24,4},{-12,4},{-16,4},{-20,4},{-24,4},{-28,4},{-32,4},{-36,4}};
-const short C2_Jump_2[130][2] = {{20,136},{16,136},{24,132},{24,128},{24,124},{-20,124},{28,120},{20,120},{-8,120},{-24,120},{32,116},{16,116},{-8,116},{-20,116},{-24,116},{32,112},{12,112},{8,112},{4,112},{0,112},{-4,112},{-8,112},{-12,112},{-16,112},{-28,112},{36,108},{-12,108},{-20,108},{-32,108},{36,104},{8,104},{4,104},{0,104},{-12,104},{-20,104},{-24,104},{-28,104},{-32,104},{-36,104},{-40,104},{-44,104},{36,100},{-4,100},{-16,100},{-48,100},{36,96},{-8,96},{-16,96},{-48,96},{32,92},{28,92},{-8,92},{-16,92},{-48,92},{24,88},{20,88},{16,88},{12,88},{-4,88},{-12,88},{-48,88},{24,84},{8,84},{4,84},{0,84},{-12,84},{-44,84},{24,80},{-8,80},{-20,80},{-44,80},{20,76},{-4,76},{-16,76},{-44,76},{20,72},{4,72},{0,72},{-12,72},{-16,72},{-40,72},{16,68},{12,68},{8,68},{-8,68},{-16,68},{-40,68},{16,64},{-8,64},{-16,64},{-40,64},{16,60},{-8,60},{-16,60},{-40,60},{16,56},{-8,56},{-16,56},{-36,56},{16,52},{-8,52},{-16,52},{-32,52},{16,48},{-8,48},{-20,48},{-24,48},{-28,48},{16,44},{-8,44},{16,40},{-8,40},{16,36},{-4,36},{16,32},{-4,32},{20,28},{-4,28},{20,24},{-4,24},{20,20},{-4,20},{16,16},{0,16},{16,12},{0,12},{16,8},{4,8},{12,4},{8,4}};
-const short C2_Land_0[162][2] = {{28,140},{24,140},{56,136},{52,136},{48,136},{44,136},{40,136},{36,136},{32,136},{60,132},{32,132},{64,128},{32,128},{16,128},{-24,128},{64,124},{32,124},{-28,124},{64,120},{44,120},{40,120},{28,120},{-32,120},{60,116},{36,116},{24,116},{-20,116},{-36,116},{56,112},{32,112},{20,112},{-8,112},{-20,112},{-40,112},{56,108},{32,108},{16,108},{-8,108},{-16,108},{-20,108},{-24,108},{-40,108},{52,104},{36,104},{32,104},{28,104},{12,104},{8,104},{4,104},{0,104},{-4,104},{-8,104},{-12,104},{-24,104},{-44,104},{48,100},{44,100},{40,100},{28,100},{-4,100},{-12,100},{-28,100},{-44,100},{28,96},{0,96},{-12,96},{-28,96},{-44,96},{28,92},{0,92},{-16,92},{-32,92},{-36,92},{-40,92},{28,88},{0,88},{-4,88},{-8,88},{-12,88},{-16,88},{-20,88},{28,84},{0,84},{-24,84},{32,80},{8,80},{4,80},{-28,80},{32,76},{16,76},{12,76},{-28,76},{36,72},{28,72},{24,72},{20,72},{-28,72},{36,68},{8,68},{4,68},{0,68},{-28,68},{40,64},{12,64},{-4,64},{-28,64},{40,60},{12,60},{-8,60},{-32,60},{40,56},{16,56},{-8,56},{-32,56},{40,52},{16,52},{-8,52},{-32,52},{44,48},{20,48},{-12,48},{-32,48},{44,44},{20,44},{-12,44},{-32,44},{44,40},{20,40},{-12,40},{-32,40},{44,36},{24,36},{-12,36},{-36,36},{48,32},{28,32},{-12,32},{-36,32},{48,28},{28,28},{-12,28},{-36,28},{48,24},{28,24},{-16,24},{-20,24},{-36,24},{48,20},{28,20},{-24,20},{-28,20},{-32,20},{48,16},{28,16},{52,12},{32,12},{52,8},{32,8},{48,4},{44,4},{40,4},{36,4}};
-const short C2_Land_1[131][2] = {{-44,120},{-48,120},{-52,120},{-56,120},{-60,120},{-28,116},{-32,116},{-36,116},{-40,116},{-64,116},{-68,116},{-20,112},{-24,112},{-72,112},{-72,108},{-36,104},{-40,104},{-44,104},{-48,104},{-52,104},{-56,104},{-72,104},{-56,100},{-60,100},{-64,100},{-68,100},{8,76},{12,72},{0,72},{12,68},{16,64},{8,64},{16,60},{8,60},{-36,60},{16,56},{4,56},{-24,56},{-36,56},{20,52},{0,52},{-24,52},{-36,52},{-40,52},{20,48},{-4,48},{-8,48},{-12,48},{-16,48},{-20,48},{-24,48},{-28,48},{-32,48},{-40,48},{-44,48},{24,44},{20,44},{0,44},{-16,44},{-44,44},{28,40},{20,40},{0,40},{-12,40},{-44,40},{32,36},{20,36},{0,36},{-4,36},{-8,36},{-24,36},{-44,36},{32,32},{20,32},{0,32},{-24,32},{-44,32},{40,28},{36,28},{16,28},{0,28},{-8,28},{-12,28},{-16,28},{-20,28},{-48,28},{44,24},{16,24},{-4,24},{-20,24},{-24,24},{-48,24},{44,20},{20,20},{12,20},{-4,20},{-24,20},{-28,20},{-52,20},{44,16},{28,16},{24,16},{12,16},{-8,16},{-28,16},{-52,16},{44,12},{32,12},{12,12},{-8,12},{-28,12},{-52,12},{44,8},{32,8},{12,8},{-8,8},{-28,8},{-52,8},{44,4},{40,4},{36,4},{8,4},{4,4},{0,4},{-4,4},{-32,4},{-36,4},{-40,4},{-44,4},{-48,4},{-52,4}};
-const short C2_Land_2[128][2] = {{-20,128},{-24,128},{-28,128},{-32,128},{-36,128},{-40,128},{-12,124},{-16,124},{-44,124},{-8,120},{-44,120},{-28,116},{-44,116},{-24,112},{-32,112},{-36,112},{-40,112},{16,80},{12,80},{20,76},{20,72},{20,68},{-24,68},{24,64},{16,64},{-12,64},{-24,64},{24,60},{12,60},{-12,60},{-24,60},{24,56},{8,56},{4,56},{0,56},{-4,56},{-8,56},{-12,56},{-16,56},{-20,56},{20,52},{-8,52},{-20,52},{-24,52},{-28,52},{-32,52},{-36,52},{-40,52},{20,48},{-8,48},{-16,48},{-40,48},{-44,48},{24,44},{20,44},{-4,44},{-16,44},{-44,44},{28,40},{16,40},{-4,40},{-12,40},{-44,40},{32,36},{16,36},{-4,36},{-8,36},{-24,36},{-44,36},{32,32},{16,32},{-4,32},{-24,32},{-44,32},{40,28},{36,28},{16,28},{-4,28},{-8,28},{-12,28},{-16,28},{-20,28},{-48,28},{44,24},{16,24},{-4,24},{-20,24},{-24,24},{-48,24},{44,20},{20,20},{12,20},{-4,20},{-24,20},{-28,20},{-52,20},{44,16},{28,16},{24,16},{12,16},{-8,16},{-28,16},{-52,16},{44,12},{32,12},{12,12},{-8,12},{-28,12},{-52,12},{44,8},{32,8},{12,8},{-8,8},{-28,8},{-52,8},{44,4},{40,4},{36,4},{8,4},{4,4},{0,4},{-4,4},{-32,4},{-36,4},{-40,4},{-44,4},{-48,4},{-52,4}};
-const short C2_StandGuard_0[139][2] = {{32,116},{28,116},{24,116},{-16,116},{36,112},{-12,112},{-20,112},{40,108},{-8,108},{-24,108},{40,104},{-4,104},{-28,104},{40,100},{16,100},{12,100},{8,100},{-4,100},{-28,100},{40,96},{20,96},{4,96},{-4,96},{-28,96},{40,92},{0,92},{-4,92},{-28,92},{36,88},{0,88},{-4,88},{-28,88},{32,84},{8,84},{4,84},{0,84},{-8,84},{-28,84},{28,80},{24,80},{20,80},{16,80},{12,80},{4,80},{0,80},{-12,80},{-24,80},{28,76},{4,76},{-12,76},{-16,76},{-20,76},{32,72},{4,72},{-12,72},{36,68},{4,68},{-16,68},{40,64},{32,64},{28,64},{24,64},{20,64},{4,64},{-16,64},{44,60},{20,60},{16,60},{12,60},{8,60},{4,60},{0,60},{-4,60},{-8,60},{-12,60},{-16,60},{-20,60},{44,56},{8,56},{-20,56},{44,52},{12,52},{4,52},{-24,52},{44,48},{16,48},{4,48},{-24,48},{44,44},{16,44},{4,44},{-24,44},{44,40},{16,40},{0,40},{-28,40},{44,36},{16,36},{0,36},{-28,36},{40,32},{16,32},{0,32},{-28,32},{40,28},{16,28},{-4,28},{-32,28},{40,24},{20,24},{-4,24},{-32,24},{44,20},{20,20},{-8,20},{-32,20},{44,16},{20,16},{-8,16},{-32,16},{48,12},{24,12},{-12,12},{-36,12},{48,8},{24,8},{-12,8},{-36,8},{44,4},{40,4},{36,4},{32,4},{28,4},{24,4},{-16,4},{-20,4},{-24,4},{-28,4},{-32,4}};
-const short C2_StandGuard_1[138][2] = {{36,116},{32,116},{28,116},{40,112},{-8,112},{-12,112},{44,108},{0,108},{-4,108},{-16,108},{44,104},{4,104},{-20,104},{44,100},{20,100},{16,100},{12,100},{4,100},{-20,100},{44,96},{24,96},{8,96},{4,96},{-20,96},{44,92},{4,92},{-20,92},{40,88},{4,88},{-20,88},{36,84},{12,84},{8,84},{4,84},{0,84},{-20,84},{32,80},{28,80},{24,80},{20,80},{16,80},{4,80},{-4,80},{-16,80},{32,76},{8,76},{4,76},{-8,76},{-12,76},{32,72},{8,72},{-12,72},{36,68},{8,68},{-16,68},{40,64},{8,64},{-16,64},{44,60},{40,60},{36,60},{32,60},{28,60},{8,60},{-20,60},{44,56},{28,56},{24,56},{20,56},{16,56},{12,56},{8,56},{4,56},{0,56},{-4,56},{-8,56},{-12,56},{-16,56},{-20,56},{44,52},{12,52},{4,52},{-24,52},{44,48},{16,48},{4,48},{-24,48},{44,44},{16,44},{4,44},{-24,44},{44,40},{16,40},{0,40},{-28,40},{44,36},{16,36},{0,36},{-28,36},{40,32},{16,32},{0,32},{-28,32},{40,28},{16,28},{-4,28},{-32,28},{40,24},{20,24},{-4,24},{-32,24},{44,20},{20,20},{-8,20},{-32,20},{44,16},{20,16},{-8,16},{-32,16},{48,12},{24,12},{-12,12},{-36,12},{48,8},{24,8},{-12,8},{-36,8},{44,4},{40,4},{36,4},{32,4},{28,4},{24,4},{-16,4},{-20,4},{-24,4},{-28,4},{-32,4}};
-const short E_Attack_0_0[72][2] = {{4,124},{0,124},{-4,124},{-8,124},{-12,124},{12,120},{8,120},{4,120},{0,120},{-4,120},{-8,120},{-12,120},{-16,120},{12,116},{8,116},{4,116},{0,116},{-4,116},{-8,116},{-12,116},{-16,116},{-20,116},{16,112},{12,112},{8,112},{4,112},{0,112},{-4,112},{-8,112},{-12,112},{-16,112},{-20,112},{16,108},{12,108},{8,108},{4,108},{0,108},{-4,108},{-20,108},{16,104},{12,104},{8,104},{4,104},{0,104},{-20,104},{16,100},{12,100},{4,100},{-20,100},{16,96},{12,96},{4,96},{-20,96},{12,92},{8,92},{8,88},{0,88},{-20,88},{8,84},{0,84},{-8,84},{-16,84},{-20,84},{4,80},{0,80},{-8,80},{-16,80},{-20,80},{-4,76},{-8,76},{-12,76},{-16,76}};
-const short E_Attack_0_1[72][2] = {{8,120},{4,120},{0,120},{-4,120},{-8,120},{16,116},{12,116},{8,116},{4,116},{0,116},{-4,116},{-8,116},{-12,116},{16,112},{12,112},{8,112},{4,112},{0,112},{-4,112},{-8,112},{-12,112},{-16,112},{20,108},{16,108},{12,108},{8,108},{4,108},{0,108},{-4,108},{-8,108},{-12,108},{-16,108},{20,104},{16,104},{12,104},{8,104},{4,104},{0,104},{-16,104},{20,100},{16,100},{12,100},{8,100},{4,100},{-16,100},{20,96},{16,96},{8,96},{-16,96},{20,92},{16,92},{8,92},{-16,92},{16,88},{12,88},{12,84},{4,84},{-16,84},{12,80},{4,80},{-4,80},{-12,80},{-16,80},{8,76},{4,76},{-4,76},{-12,76},{-16,76},{0,72},{-4,72},{-8,72},{-12,72}};
-const short E_Attack_0_2[72][2] = {{28,104},{24,104},{20,104},{16,104},{12,104},{36,100},{32,100},{28,100},{24,100},{20,100},{16,100},{12,100},{8,100},{36,96},{32,96},{28,96},{24,96},{20,96},{16,96},{12,96},{8,96},{4,96},{40,92},{36,92},{32,92},{28,92},{24,92},{20,92},{16,92},{12,92},{8,92},{4,92},{40,88},{36,88},{32,88},{28,88},{24,88},{20,88},{4,88},{40,84},{36,84},{32,84},{28,84},{24,84},{4,84},{40,80},{36,80},{28,80},{4,80},{40,76},{36,76},{28,76},{4,76},{36,72},{32,72},{32,68},{24,68},{4,68},{32,64},{24,64},{16,64},{8,64},{4,64},{28,60},{24,60},{16,60},{8,60},{4,60},{20,56},{16,56},{12,56},{8,56}};
-const short E_Attack_0_3[72][2] = {{24,108},{20,108},{16,108},{12,108},{8,108},{32,104},{28,104},{24,104},{20,104},{16,104},{12,104},{8,104},{4,104},{32,100},{28,100},{24,100},{20,100},{16,100},{12,100},{8,100},{4,100},{0,100},{36,96},{32,96},{28,96},{24,96},{20,96},{16,96},{12,96},{8,96},{4,96},{0,96},{36,92},{32,92},{28,92},{24,92},{20,92},{16,92},{0,92},{36,88},{32,88},{28,88},{24,88},{20,88},{0,88},{36,84},{32,84},{24,84},{0,84},{36,80},{32,80},{24,80},{0,80},{32,76},{28,76},{28,72},{20,72},{0,72},{28,68},{20,68},{12,68},{4,68},{0,68},{24,64},{20,64},{12,64},{4,64},{0,64},{16,60},{12,60},{8,60},{4,60}};
-const short E_Attack_0_4[72][2] = {{8,120},{4,120},{0,120},{-4,120},{-8,120},{16,116},{12,116},{8,116},{4,116},{0,116},{-4,116},{-8,116},{-12,116},{16,112},{12,112},{8,112},{4,112},{0,112},{-4,112},{-8,112},{-12,112},{-16,112},{20,108},{16,108},{12,108},{8,108},{4,108},{0,108},{-4,108},{-8,108},{-12,108},{-16,108},{20,104},{16,104},{12,104},{8,104},{4,104},{0,104},{-16,104},{20,100},{16,100},{12,100},{8,100},{4,100},{-16,100},{20,96},{16,96},{8,96},{-16,96},{20,92},{16,92},{8,92},{-16,92},{16,88},{12,88},{12,84},{4,84},{-16,84},{12,80},{4,80},{-4,80},{-12,80},{-16,80},{8,76},{4,76},{-4,76},{-12,76},{-16,76},{0,72},{-4,72},{-8,72},{-12,72}};
-const short E_Attack_1_0[72][2] = {{4,160},{0,160},{-4,160},{-8,160},{-12,160},{12,156},{8,156},{4,156},{0,156},{-4,156},{-8,156},{-12,156},{-16,156},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{-12,152},{-16,152},{-20,152},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{-16,148},{-20,148},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-20,144},{16,140},{12,140},{8,140},{4,140},{0,140},{-20,140},{16,136},{12,136},{4,136},{-20,136},{16,132},{12,132},{4,132},{-20,132},{12,128},{8,128},{8,124},{0,124},{-20,124},{8,120},{0,120},{-8,120},{-16,120},{-20,120},{4,116},{0,116},{-8,116},{-16,116},{-20,116},{-4,112},{-8,112},{-12,112},{-16,112}};
-const short E_Attack_1_1[72][2] = {{4,156},{0,156},{-4,156},{-8,156},{-12,156},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{-12,152},{-16,152},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{-16,148},{-20,148},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{-12,144},{-16,144},{-20,144},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{-20,140},{16,136},{12,136},{8,136},{4,136},{0,136},{-20,136},{16,132},{12,132},{4,132},{-20,132},{16,128},{12,128},{4,128},{-20,128},{12,124},{8,124},{8,120},{0,120},{-20,120},{8,116},{0,116},{-8,116},{-16,116},{-20,116},{4,112},{0,112},{-8,112},{-16,112},{-20,112},{-4,108},{-8,108},{-12,108},{-16,108}};
-const short E_Attack_1_2[72][2] = {{8,152},{4,152},{0,152},{-4,152},{-8,152},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{-12,144},{-16,144},{20,140},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{-8,140},{-12,140},{-16,140},{20,136},{16,136},{12,136},{8,136},{4,136},{0,136},{-16,136},{20,132},{16,132},{12,132},{8,132},{4,132},{-16,132},{20,128},{16,128},{8,128},{-16,128},{20,124},{16,124},{8,124},{-16,124},{16,120},{12,120},{12,116},{4,116},{-16,116},{12,112},{4,112},{-4,112},{-12,112},{-16,112},{8,108},{4,108},{-4,108},{-12,108},{-16,108},{0,104},{-4,104},{-8,104},{-12,104}};
-const short E_Attack_1_3[72][2] = {{16,152},{12,152},{8,152},{4,152},{0,152},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{28,140},{24,140},{20,140},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{-8,140},{28,136},{24,136},{20,136},{16,136},{12,136},{8,136},{-8,136},{28,132},{24,132},{20,132},{16,132},{12,132},{-8,132},{28,128},{24,128},{16,128},{-8,128},{28,124},{24,124},{16,124},{-8,124},{24,120},{20,120},{20,116},{12,116},{-8,116},{20,112},{12,112},{4,112},{-4,112},{-8,112},{16,108},{12,108},{4,108},{-4,108},{-8,108},{8,104},{4,104},{0,104},{-4,104}};
-const short E_Attack_1_4[72][2] = {{40,148},{36,148},{32,148},{28,148},{24,148},{48,144},{44,144},{40,144},{36,144},{32,144},{28,144},{24,144},{20,144},{48,140},{44,140},{40,140},{36,140},{32,140},{28,140},{24,140},{20,140},{16,140},{52,136},{48,136},{44,136},{40,136},{36,136},{32,136},{28,136},{24,136},{20,136},{16,136},{52,132},{48,132},{44,132},{40,132},{36,132},{32,132},{16,132},{52,128},{48,128},{44,128},{40,128},{36,128},{16,128},{52,124},{48,124},{40,124},{16,124},{52,120},{48,120},{40,120},{16,120},{48,116},{44,116},{44,112},{36,112},{16,112},{44,108},{36,108},{28,108},{20,108},{16,108},{40,104},{36,104},{28,104},{20,104},{16,104},{32,100},{28,100},{24,100},{20,100}};
-const short E_Attack_1_5[72][2] = {{68,140},{64,140},{60,140},{56,140},{52,140},{72,136},{68,136},{64,136},{60,136},{56,136},{52,136},{48,136},{44,136},{76,132},{72,132},{68,132},{64,132},{60,132},{56,132},{52,132},{48,132},{44,132},{76,128},{72,128},{68,128},{64,128},{60,128},{56,128},{52,128},{48,128},{44,128},{40,128},{76,124},{60,124},{56,124},{52,124},{48,124},{44,124},{40,124},{76,120},{56,120},{52,120},{48,120},{44,120},{40,120},{76,116},{52,116},{44,116},{40,116},{76,112},{52,112},{44,112},{40,112},{48,108},{44,108},{76,104},{56,104},{48,104},{76,100},{72,100},{64,100},{56,100},{48,100},{76,96},{72,96},{64,96},{56,96},{52,96},{72,92},{68,92},{64,92},{60,92}};
-const short E_Attack_1_6[72][2] = {{52,156},{48,156},{44,156},{40,156},{36,156},{60,152},{56,152},{52,152},{48,152},{44,152},{40,152},{36,152},{32,152},{60,148},{56,148},{52,148},{48,148},{44,148},{40,148},{36,148},{32,148},{28,148},{64,144},{60,144},{56,144},{52,144},{48,144},{44,144},{40,144},{36,144},{32,144},{28,144},{64,140},{60,140},{56,140},{52,140},{48,140},{44,140},{28,140},{64,136},{60,136},{56,136},{52,136},{48,136},{28,136},{64,132},{60,132},{52,132},{28,132},{64,128},{60,128},{52,128},{28,128},{60,124},{56,124},{56,120},{48,120},{28,120},{56,116},{48,116},{40,116},{32,116},{28,116},{52,112},{48,112},{40,112},{32,112},{28,112},{44,108},{40,108},{36,108},{32,108}};
-const short E_Attack_1_7[72][2] = {{24,160},{20,160},{16,160},{12,160},{8,160},{32,156},{28,156},{24,156},{20,156},{16,156},{12,156},{8,156},{4,156},{32,152},{28,152},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{36,148},{32,148},{28,148},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{36,144},{32,144},{28,144},{24,144},{20,144},{16,144},{0,144},{36,140},{32,140},{28,140},{24,140},{20,140},{0,140},{36,136},{32,136},{24,136},{0,136},{36,132},{32,132},{24,132},{0,132},{32,128},{28,128},{28,124},{20,124},{0,124},{28,120},{20,120},{12,120},{4,120},{0,120},{24,116},{20,116},{12,116},{4,116},{0,116},{16,112},{12,112},{8,112},{4,112}};
-const short E_Attack_3_0[72][2] = {{-16,136},{-20,136},{-24,136},{-28,136},{-32,136},{-8,132},{-12,132},{-16,132},{-20,132},{-24,132},{-28,132},{-32,132},{-36,132},{-8,128},{-12,128},{-16,128},{-20,128},{-24,128},{-28,128},{-32,128},{-36,128},{-40,128},{-4,124},{-8,124},{-12,124},{-16,124},{-20,124},{-24,124},{-28,124},{-32,124},{-36,124},{-40,124},{-4,120},{-8,120},{-12,120},{-16,120},{-20,120},{-24,120},{-40,120},{-4,116},{-8,116},{-12,116},{-16,116},{-20,116},{-40,116},{-4,112},{-8,112},{-16,112},{-40,112},{-4,108},{-8,108},{-16,108},{-40,108},{-8,104},{-12,104},{-12,100},{-20,100},{-40,100},{-12,96},{-20,96},{-28,96},{-36,96},{-40,96},{-16,92},{-20,92},{-28,92},{-36,92},{-40,92},{-24,88},{-28,88},{-32,88},{-36,88}};
-const short E_Attack_3_1[85][2] = {{-20,132},{-24,132},{-28,132},{-32,132},{-36,132},{-12,128},{-16,128},{-20,128},{-24,128},{-28,128},{-32,128},{-36,128},{-40,128},{-12,124},{-16,124},{-20,124},{-24,124},{-28,124},{-32,124},{-36,124},{-40,124},{-44,124},{-8,120},{-12,120},{-16,120},{-20,120},{-24,120},{-28,120},{-32,120},{-36,120},{-40,120},{-44,120},{-8,116},{-12,116},{-16,116},{-20,116},{-24,116},{-28,116},{-32,116},{-36,116},{-44,116},{-8,112},{-12,112},{-16,112},{-20,112},{-24,112},{-28,112},{-32,112},{-44,112},{-8,108},{-12,108},{-16,108},{-20,108},{-24,108},{-32,108},{-44,108},{-8,104},{-12,104},{-16,104},{-20,104},{-24,104},{-32,104},{-44,104},{-12,100},{-16,100},{-20,100},{-24,100},{-28,100},{-16,96},{-20,96},{-24,96},{-28,96},{-44,96},{-20,92},{-24,92},{-28,92},{-36,92},{-44,92},{-24,88},{-28,88},{-32,88},{-36,88},{-44,88},{-36,84},{-40,84}};
-const short E_Attack_3_2[82][2] = {{-20,152},{-24,152},{-28,152},{-32,152},{-36,152},{-12,148},{-16,148},{-20,148},{-24,148},{-28,148},{-32,148},{-36,148},{-40,148},{-12,144},{-16,144},{-20,144},{-24,144},{-28,144},{-32,144},{-36,144},{-40,144},{-44,144},{-8,140},{-12,140},{-16,140},{-20,140},{-24,140},{-28,140},{-32,140},{-36,140},{-40,140},{-44,140},{-8,136},{-12,136},{-16,136},{-20,136},{-24,136},{-28,136},{-32,136},{-36,136},{-40,136},{-44,136},{-8,132},{-12,132},{-16,132},{-20,132},{-24,132},{-28,132},{-32,132},{-36,132},{-44,132},{-8,128},{-12,128},{-16,128},{-20,128},{-24,128},{-28,128},{-36,128},{-44,128},{-8,124},{-12,124},{-16,124},{-20,124},{-24,124},{-28,124},{-36,124},{-44,124},{-16,120},{-20,120},{-24,120},{-28,120},{-32,120},{-44,120},{-24,116},{-28,116},{-32,116},{-44,116},{-32,112},{-36,112},{-44,112},{-36,108},{-40,108}};
-const short E_Attack_3_3[53][2] = {{16,168},{12,168},{8,168},{4,168},{0,168},{20,164},{16,164},{12,164},{8,164},{4,164},{0,164},{-4,164},{20,160},{16,160},{12,160},{8,160},{4,160},{0,160},{-4,160},{24,156},{20,156},{16,156},{12,156},{8,156},{4,156},{0,156},{-4,156},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{20,140},{16,140},{12,140},{8,140},{20,136}};
-const short E_Attack_3_4[67][2] = {{20,172},{16,172},{12,172},{8,172},{4,172},{24,168},{20,168},{16,168},{12,168},{8,168},{4,168},{0,168},{28,164},{24,164},{20,164},{16,164},{12,164},{8,164},{4,164},{0,164},{-4,164},{28,160},{24,160},{20,160},{16,160},{12,160},{8,160},{4,160},{0,160},{-4,160},{28,156},{24,156},{20,156},{16,156},{12,156},{8,156},{4,156},{0,156},{-4,156},{-8,156},{28,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{28,148},{20,148},{12,148},{8,148},{4,148},{0,148},{28,144},{20,144},{12,144},{8,144},{4,144},{28,140},{16,140},{12,140},{28,136},{16,136},{28,132},{20,132},{24,128}};
-const short E_Attack_3_5[72][2] = {{16,180},{12,180},{8,180},{4,180},{0,180},{20,176},{16,176},{12,176},{8,176},{4,176},{0,176},{-4,176},{-8,176},{24,172},{20,172},{16,172},{12,172},{8,172},{4,172},{0,172},{-4,172},{-8,172},{24,168},{20,168},{16,168},{12,168},{8,168},{4,168},{0,168},{-4,168},{-8,168},{-12,168},{24,164},{8,164},{4,164},{0,164},{-4,164},{-8,164},{-12,164},{24,160},{4,160},{0,160},{-4,160},{-8,160},{-12,160},{24,156},{0,156},{-8,156},{-12,156},{24,152},{0,152},{-8,152},{-12,152},{-4,148},{-8,148},{24,144},{4,144},{-4,144},{24,140},{20,140},{12,140},{4,140},{-4,140},{24,136},{20,136},{12,136},{4,136},{0,136},{20,132},{16,132},{12,132},{8,132}};
-const short E_Attack_3_6[72][2] = {{16,164},{12,164},{8,164},{4,164},{0,164},{24,160},{20,160},{16,160},{12,160},{8,160},{4,160},{0,160},{-4,160},{24,156},{20,156},{16,156},{12,156},{8,156},{4,156},{0,156},{-4,156},{-8,156},{28,152},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{28,148},{24,148},{20,148},{16,148},{12,148},{8,148},{-8,148},{28,144},{24,144},{20,144},{16,144},{12,144},{-8,144},{28,140},{24,140},{16,140},{-8,140},{28,136},{24,136},{16,136},{-8,136},{24,132},{20,132},{20,128},{12,128},{-8,128},{20,124},{12,124},{4,124},{-4,124},{-8,124},{16,120},{12,120},{4,120},{-4,120},{-8,120},{8,116},{4,116},{0,116},{-4,116}};
-const short E_Backward_0[72][2] = {{20,156},{16,156},{12,156},{8,156},{4,156},{28,152},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{28,148},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{32,144},{28,144},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{32,140},{28,140},{24,140},{20,140},{16,140},{12,140},{-4,140},{32,136},{28,136},{24,136},{20,136},{16,136},{-4,136},{32,132},{28,132},{20,132},{-4,132},{32,128},{28,128},{20,128},{-4,128},{28,124},{24,124},{24,120},{16,120},{-4,120},{24,116},{16,116},{8,116},{0,116},{-4,116},{20,112},{16,112},{8,112},{0,112},{-4,112},{12,108},{8,108},{4,108},{0,108}};
-const short E_Backward_1[72][2] = {{24,156},{20,156},{16,156},{12,156},{8,156},{32,152},{28,152},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{32,148},{28,148},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{36,144},{32,144},{28,144},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{36,140},{32,140},{28,140},{24,140},{20,140},{16,140},{0,140},{36,136},{32,136},{28,136},{24,136},{20,136},{0,136},{36,132},{32,132},{24,132},{0,132},{36,128},{32,128},{24,128},{0,128},{32,124},{28,124},{28,120},{20,120},{0,120},{28,116},{20,116},{12,116},{4,116},{0,116},{24,112},{20,112},{12,112},{4,112},{0,112},{16,108},{12,108},{8,108},{4,108}};
-const short E_Backward_2[72][2] = {{28,160},{24,160},{20,160},{16,160},{12,160},{36,156},{32,156},{28,156},{24,156},{20,156},{16,156},{12,156},{8,156},{36,152},{32,152},{28,152},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{40,148},{36,148},{32,148},{28,148},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{40,144},{36,144},{32,144},{28,144},{24,144},{20,144},{4,144},{40,140},{36,140},{32,140},{28,140},{24,140},{4,140},{40,136},{36,136},{28,136},{4,136},{40,132},{36,132},{28,132},{4,132},{36,128},{32,128},{32,124},{24,124},{4,124},{32,120},{24,120},{16,120},{8,120},{4,120},{28,116},{24,116},{16,116},{8,116},{4,116},{20,112},{16,112},{12,112},{8,112}};
-const short E_Backward_3[72][2] = {{28,160},{24,160},{20,160},{16,160},{12,160},{36,156},{32,156},{28,156},{24,156},{20,156},{16,156},{12,156},{8,156},{36,152},{32,152},{28,152},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{40,148},{36,148},{32,148},{28,148},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{40,144},{36,144},{32,144},{28,144},{24,144},{20,144},{4,144},{40,140},{36,140},{32,140},{28,140},{24,140},{4,140},{40,136},{36,136},{28,136},{4,136},{40,132},{36,132},{28,132},{4,132},{36,128},{32,128},{32,124},{24,124},{4,124},{32,120},{24,120},{16,120},{8,120},{4,120},{28,116},{24,116},{16,116},{8,116},{4,116},{20,112},{16,112},{12,112},{8,112}};
-const short E_Backward_4[72][2] = {{24,156},{20,156},{16,156},{12,156},{8,156},{32,152},{28,152},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{32,148},{28,148},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{36,144},{32,144},{28,144},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{36,140},{32,140},{28,140},{24,140},{20,140},{16,140},{0,140},{36,136},{32,136},{28,136},{24,136},{20,136},{0,136},{36,132},{32,132},{24,132},{0,132},{36,128},{32,128},{24,128},{0,128},{32,124},{28,124},{28,120},{20,120},{0,120},{28,116},{20,116},{12,116},{4,116},{0,116},{24,112},{20,112},{12,112},{4,112},{0,112},{16,108},{12,108},{8,108},{4,108}};
-const short E_Backward_5[72][2] = {{20,156},{16,156},{12,156},{8,156},{4,156},{28,152},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{28,148},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{32,144},{28,144},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{32,140},{28,140},{24,140},{20,140},{16,140},{12,140},{-4,140},{32,136},{28,136},{24,136},{20,136},{16,136},{-4,136},{32,132},{28,132},{20,132},{-4,132},{32,128},{28,128},{20,128},{-4,128},{28,124},{24,124},{24,120},{16,120},{-4,120},{24,116},{16,116},{8,116},{0,116},{-4,116},{20,112},{16,112},{8,112},{0,112},{-4,112},{12,108},{8,108},{4,108},{0,108}};
-const short E_CrouchGuard_0[72][2] = {{16,120},{12,120},{8,120},{4,120},{0,120},{24,116},{20,116},{16,116},{12,116},{8,116},{4,116},{0,116},{-4,116},{24,112},{20,112},{16,112},{12,112},{8,112},{4,112},{0,112},{-4,112},{-8,112},{28,108},{24,108},{20,108},{16,108},{12,108},{8,108},{4,108},{0,108},{-4,108},{-8,108},{28,104},{24,104},{20,104},{16,104},{12,104},{8,104},{-8,104},{28,100},{24,100},{20,100},{16,100},{12,100},{-8,100},{28,96},{24,96},{16,96},{-8,96},{28,92},{24,92},{16,92},{-8,92},{24,88},{20,88},{-8,88},{24,84},{20,84},{12,84},{-8,84},{20,80},{16,80},{12,80},{4,80},{-4,80},{-8,80},{16,76},{12,76},{8,76},{4,76},{0,76},{-4,76}};
-const short E_CrouchGuard_1[74][2] = {{20,120},{16,120},{12,120},{8,120},{4,120},{28,116},{24,116},{20,116},{16,116},{12,116},{8,116},{4,116},{0,116},{28,112},{24,112},{20,112},{16,112},{12,112},{8,112},{4,112},{0,112},{-4,112},{32,108},{28,108},{24,108},{20,108},{16,108},{12,108},{8,108},{4,108},{0,108},{-4,108},{32,104},{28,104},{24,104},{20,104},{16,104},{12,104},{0,104},{-4,104},{32,100},{28,100},{24,100},{20,100},{16,100},{0,100},{-4,100},{32,96},{28,96},{20,96},{-4,96},{32,92},{28,92},{20,92},{-4,92},{28,88},{24,88},{-4,88},{28,84},{24,84},{16,84},{-4,84},{24,80},{20,80},{16,80},{8,80},{0,80},{-4,80},{20,76},{16,76},{12,76},{8,76},{4,76},{0,76}};
-const short E_Damage_0[72][2] = {{12,152},{8,152},{4,152},{0,152},{-4,152},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{-12,144},{24,140},{20,140},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{-8,140},{-12,140},{24,136},{20,136},{16,136},{12,136},{8,136},{4,136},{-12,136},{24,132},{20,132},{16,132},{12,132},{8,132},{-12,132},{24,128},{20,128},{12,128},{-12,128},{24,124},{20,124},{12,124},{-12,124},{20,120},{16,120},{16,116},{8,116},{-12,116},{16,112},{8,112},{0,112},{-8,112},{-12,112},{12,108},{8,108},{0,108},{-8,108},{-12,108},{4,104},{0,104},{-4,104},{-8,104}};
-const short E_Damage_1[72][2] = {{16,144},{12,144},{8,144},{4,144},{0,144},{24,140},{20,140},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{24,136},{20,136},{16,136},{12,136},{8,136},{4,136},{0,136},{-4,136},{-8,136},{28,132},{24,132},{20,132},{16,132},{12,132},{8,132},{4,132},{0,132},{-4,132},{-8,132},{28,128},{24,128},{20,128},{16,128},{12,128},{8,128},{-8,128},{28,124},{24,124},{20,124},{16,124},{12,124},{-8,124},{28,120},{24,120},{16,120},{-8,120},{28,116},{24,116},{16,116},{-8,116},{24,112},{20,112},{20,108},{12,108},{-8,108},{20,104},{12,104},{4,104},{-4,104},{-8,104},{16,100},{12,100},{4,100},{-4,100},{-8,100},{8,96},{4,96},{0,96},{-4,96}};
-const short E_Damage_2[72][2] = {{16,152},{12,152},{8,152},{4,152},{0,152},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{28,140},{24,140},{20,140},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{-8,140},{28,136},{24,136},{20,136},{16,136},{12,136},{8,136},{-8,136},{28,132},{24,132},{20,132},{16,132},{12,132},{-8,132},{28,128},{24,128},{16,128},{-8,128},{28,124},{24,124},{16,124},{-8,124},{24,120},{20,120},{20,116},{12,116},{-8,116},{20,112},{12,112},{4,112},{-4,112},{-8,112},{16,108},{12,108},{4,108},{-4,108},{-8,108},{8,104},{4,104},{0,104},{-4,104}};
-const short E_Damage_3[72][2] = {{24,152},{20,152},{16,152},{12,152},{8,152},{32,148},{28,148},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{32,144},{28,144},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{36,140},{32,140},{28,140},{24,140},{20,140},{16,140},{12,140},{8,140},{4,140},{0,140},{36,136},{32,136},{28,136},{24,136},{20,136},{16,136},{0,136},{36,132},{32,132},{28,132},{24,132},{20,132},{0,132},{36,128},{32,128},{24,128},{0,128},{36,124},{32,124},{24,124},{0,124},{32,120},{28,120},{28,116},{20,116},{0,116},{28,112},{20,112},{12,112},{4,112},{0,112},{24,108},{20,108},{12,108},{4,108},{0,108},{16,104},{12,104},{8,104},{4,104}};
-const short E_Dead_0[72][2] = {{84,136},{80,136},{76,136},{72,136},{68,136},{64,136},{56,136},{52,136},{48,136},{88,132},{84,132},{80,132},{52,132},{48,132},{44,132},{92,128},{88,128},{84,128},{80,128},{44,128},{92,124},{88,124},{84,124},{80,124},{52,124},{48,124},{44,124},{92,120},{88,120},{84,120},{80,120},{76,120},{44,120},{92,116},{88,116},{84,116},{80,116},{76,116},{72,116},{56,116},{52,116},{48,116},{92,112},{88,112},{84,112},{80,112},{76,112},{72,112},{68,112},{64,112},{48,112},{88,108},{84,108},{80,108},{76,108},{72,108},{60,108},{56,108},{52,108},{88,104},{84,104},{80,104},{76,104},{72,104},{68,104},{64,104},{60,104},{80,100},{76,100},{72,100},{68,100},{64,100}};
-const short E_Dead_1[72][2] = {{92,132},{88,132},{84,132},{80,132},{76,132},{72,132},{64,132},{60,132},{56,132},{96,128},{92,128},{88,128},{60,128},{56,128},{52,128},{100,124},{96,124},{92,124},{88,124},{52,124},{100,120},{96,120},{92,120},{88,120},{60,120},{56,120},{52,120},{100,116},{96,116},{92,116},{88,116},{84,116},{52,116},{100,112},{96,112},{92,112},{88,112},{84,112},{80,112},{64,112},{60,112},{56,112},{100,108},{96,108},{92,108},{88,108},{84,108},{80,108},{76,108},{72,108},{56,108},{96,104},{92,104},{88,104},{84,104},{80,104},{68,104},{64,104},{60,104},{96,100},{92,100},{88,100},{84,100},{80,100},{76,100},{72,100},{68,100},{88,96},{84,96},{80,96},{76,96},{72,96}};
-const short E_Dead_2[72][2] = {{100,108},{96,108},{92,108},{88,108},{84,108},{80,108},{72,108},{68,108},{64,108},{104,104},{100,104},{96,104},{68,104},{64,104},{60,104},{108,100},{104,100},{100,100},{96,100},{60,100},{108,96},{104,96},{100,96},{96,96},{68,96},{64,96},{60,96},{108,92},{104,92},{100,92},{96,92},{92,92},{60,92},{108,88},{104,88},{100,88},{96,88},{92,88},{88,88},{72,88},{68,88},{64,88},{108,84},{104,84},{100,84},{96,84},{92,84},{88,84},{84,84},{80,84},{64,84},{104,80},{100,80},{96,80},{92,80},{88,80},{76,80},{72,80},{68,80},{104,76},{100,76},{96,76},{92,76},{88,76},{84,76},{80,76},{76,76},{96,72},{92,72},{88,72},{84,72},{80,72}};
-const short E_Dead_3[65][2] = {{84,36},{80,36},{76,36},{72,36},{68,36},{64,36},{88,32},{84,32},{80,32},{76,32},{72,32},{92,28},{88,28},{84,28},{80,28},{92,24},{88,24},{84,24},{80,24},{56,24},{52,24},{92,20},{88,20},{84,20},{80,20},{76,20},{72,20},{68,20},{52,20},{92,16},{88,16},{84,16},{80,16},{76,16},{72,16},{68,16},{56,16},{52,16},{92,12},{88,12},{84,12},{80,12},{76,12},{72,12},{68,12},{64,12},{52,12},{88,8},{84,8},{80,8},{76,8},{72,8},{68,8},{60,8},{56,8},{52,8},{88,4},{84,4},{80,4},{76,4},{72,4},{68,4},{64,4},{60,4},{56,4}};
-const short E_Dead_4[6][2] = {{60,36},{56,36},{60,32},{56,32},{52,32},{52,28}};
-const short E_Dead_5[14][2] = {{68,32},{64,32},{60,32},{56,32},{72,28},{68,28},{64,28},{60,28},{48,28},{44,28},{76,24},{72,24},{68,24},{64,24}};
-const short E_Dead_6[25][2] = {{80,200},{76,200},{72,200},{68,200},{64,200},{72,52},{68,52},{64,52},{60,52},{56,52},{52,52},{76,48},{72,48},{68,48},{64,48},{60,48},{56,48},{48,48},{44,48},{76,44},{72,44},{68,44},{64,44},{48,44},{44,44}};
-const short E_Dead_7[17][2] = {{72,32},{68,32},{64,32},{60,32},{56,32},{52,32},{76,28},{72,28},{68,28},{64,28},{60,28},{48,28},{72,24},{68,24},{64,24},{52,24},{48,24}};
-const short E_Fall_0[72][2] = {{12,164},{8,164},{4,164},{0,164},{-4,164},{20,160},{16,160},{12,160},{8,160},{4,160},{0,160},{-4,160},{-8,160},{20,156},{16,156},{12,156},{8,156},{4,156},{0,156},{-4,156},{-8,156},{-12,156},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{-12,152},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{-12,148},{24,144},{20,144},{16,144},{12,144},{8,144},{-12,144},{24,140},{20,140},{12,140},{-12,140},{24,136},{20,136},{12,136},{-12,136},{20,132},{16,132},{16,128},{8,128},{-12,128},{16,124},{8,124},{0,124},{-8,124},{-12,124},{12,120},{8,120},{0,120},{-8,120},{-12,120},{4,116},{0,116},{-4,116},{-8,116}};
-const short E_Forward_0[72][2] = {{4,156},{0,156},{-4,156},{-8,156},{-12,156},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{-12,152},{-16,152},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{-16,148},{-20,148},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{-12,144},{-16,144},{-20,144},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{-20,140},{16,136},{12,136},{8,136},{4,136},{0,136},{-20,136},{16,132},{12,132},{4,132},{-20,132},{16,128},{12,128},{4,128},{-20,128},{12,124},{8,124},{8,120},{0,120},{-20,120},{8,116},{0,116},{-8,116},{-16,116},{-20,116},{4,112},{0,112},{-8,112},{-16,112},{-20,112},{-4,108},{-8,108},{-12,108},{-16,108}};
-const short E_Forward_1[72][2] = {{4,156},{0,156},{-4,156},{-8,156},{-12,156},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{-12,152},{-16,152},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{-16,148},{-20,148},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{-12,144},{-16,144},{-20,144},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{-20,140},{16,136},{12,136},{8,136},{4,136},{0,136},{-20,136},{16,132},{12,132},{4,132},{-20,132},{16,128},{12,128},{4,128},{-20,128},{12,124},{8,124},{8,120},{0,120},{-20,120},{8,116},{0,116},{-8,116},{-16,116},{-20,116},{4,112},{0,112},{-8,112},{-16,112},{-20,112},{-4,108},{-8,108},{-12,108},{-16,108}};
-const short E_Forward_2[72][2] = {{4,156},{0,156},{-4,156},{-8,156},{-12,156},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{-12,152},{-16,152},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{-16,148},{-20,148},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{-12,144},{-16,144},{-20,144},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{-20,140},{16,136},{12,136},{8,136},{4,136},{0,136},{-20,136},{16,132},{12,132},{4,132},{-20,132},{16,128},{12,128},{4,128},{-20,128},{12,124},{8,124},{8,120},{0,120},{-20,120},{8,116},{0,116},{-8,116},{-16,116},{-20,116},{4,112},{0,112},{-8,112},{-16,112},{-20,112},{-4,108},{-8,108},{-12,108},{-16,108}};
-const short E_Forward_3[72][2] = {{8,156},{4,156},{0,156},{-4,156},{-8,156},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{-12,152},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{-16,148},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{-12,144},{-16,144},{20,140},{16,140},{12,140},{8,140},{4,140},{0,140},{-16,140},{20,136},{16,136},{12,136},{8,136},{4,136},{-16,136},{20,132},{16,132},{8,132},{-16,132},{20,128},{16,128},{8,128},{-16,128},{16,124},{12,124},{12,120},{4,120},{-16,120},{12,116},{4,116},{-4,116},{-12,116},{-16,116},{8,112},{4,112},{-4,112},{-12,112},{-16,112},{0,108},{-4,108},{-8,108},{-12,108}};
-const short E_Forward_4[72][2] = {{8,156},{4,156},{0,156},{-4,156},{-8,156},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{-12,152},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{-16,148},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{-12,144},{-16,144},{20,140},{16,140},{12,140},{8,140},{4,140},{0,140},{-16,140},{20,136},{16,136},{12,136},{8,136},{4,136},{-16,136},{20,132},{16,132},{8,132},{-16,132},{20,128},{16,128},{8,128},{-16,128},{16,124},{12,124},{12,120},{4,120},{-16,120},{12,116},{4,116},{-4,116},{-12,116},{-16,116},{8,112},{4,112},{-4,112},{-12,112},{-16,112},{0,108},{-4,108},{-8,108},{-12,108}};
-const short E_Forward_5[72][2] = {{4,152},{0,152},{-4,152},{-8,152},{-12,152},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{-16,148},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{-12,144},{-16,144},{-20,144},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{-8,140},{-12,140},{-16,140},{-20,140},{16,136},{12,136},{8,136},{4,136},{0,136},{-4,136},{-20,136},{16,132},{12,132},{8,132},{4,132},{0,132},{-20,132},{16,128},{12,128},{4,128},{-20,128},{16,124},{12,124},{4,124},{-20,124},{12,120},{8,120},{8,116},{0,116},{-20,116},{8,112},{0,112},{-8,112},{-16,112},{-20,112},{4,108},{0,108},{-8,108},{-16,108},{-20,108},{-4,104},{-8,104},{-12,104},{-16,104}};
-const short E_Idle_0[72][2] = {{4,156},{0,156},{-4,156},{-8,156},{-12,156},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{-12,152},{-16,152},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{-16,148},{-20,148},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{-12,144},{-16,144},{-20,144},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{-20,140},{16,136},{12,136},{8,136},{4,136},{0,136},{-20,136},{16,132},{12,132},{4,132},{-20,132},{16,128},{12,128},{4,128},{-20,128},{12,124},{8,124},{8,120},{0,120},{-20,120},{8,116},{0,116},{-8,116},{-16,116},{-20,116},{4,112},{0,112},{-8,112},{-16,112},{-20,112},{-4,108},{-8,108},{-12,108},{-16,108}};
-const short E_Idle_1[72][2] = {{4,156},{0,156},{-4,156},{-8,156},{-12,156},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{-12,152},{-16,152},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{-16,148},{-20,148},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{-12,144},{-16,144},{-20,144},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{-20,140},{16,136},{12,136},{8,136},{4,136},{0,136},{-20,136},{16,132},{12,132},{4,132},{-20,132},{16,128},{12,128},{4,128},{-20,128},{12,124},{8,124},{8,120},{0,120},{-20,120},{8,116},{0,116},{-8,116},{-16,116},{-20,116},{4,112},{0,112},{-8,112},{-16,112},{-20,112},{-4,108},{-8,108},{-12,108},{-16,108}};
-const short E_Idle_2[72][2] = {{4,160},{0,160},{-4,160},{-8,160},{-12,160},{12,156},{8,156},{4,156},{0,156},{-4,156},{-8,156},{-12,156},{-16,156},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{-12,152},{-16,152},{-20,152},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{-16,148},{-20,148},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-20,144},{16,140},{12,140},{8,140},{4,140},{0,140},{-20,140},{16,136},{12,136},{4,136},{-20,136},{16,132},{12,132},{4,132},{-20,132},{12,128},{8,128},{8,124},{0,124},{-20,124},{8,120},{0,120},{-8,120},{-16,120},{-20,120},{4,116},{0,116},{-8,116},{-16,116},{-20,116},{-4,112},{-8,112},{-12,112},{-16,112}};
-const short E_Idle_3[72][2] = {{4,160},{0,160},{-4,160},{-8,160},{-12,160},{12,156},{8,156},{4,156},{0,156},{-4,156},{-8,156},{-12,156},{-16,156},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{-12,152},{-16,152},{-20,152},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{-16,148},{-20,148},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-20,144},{16,140},{12,140},{8,140},{4,140},{0,140},{-20,140},{16,136},{12,136},{4,136},{-20,136},{16,132},{12,132},{4,132},{-20,132},{12,128},{8,128},{8,124},{0,124},{-20,124},{8,120},{0,120},{-8,120},{-16,120},{-20,120},{4,116},{0,116},{-8,116},{-16,116},{-20,116},{-4,112},{-8,112},{-12,112},{-16,112}};
-const short E_Idle_4[72][2] = {{4,156},{0,156},{-4,156},{-8,156},{-12,156},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{-12,152},{-16,152},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{-16,148},{-20,148},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{-12,144},{-16,144},{-20,144},{16,140},{12,140},{8,140},{4,140},{0,140},{-4,140},{-20,140},{16,136},{12,136},{8,136},{4,136},{0,136},{-20,136},{16,132},{12,132},{4,132},{-20,132},{16,128},{12,128},{4,128},{-20,128},{12,124},{8,124},{8,120},{0,120},{-20,120},{8,116},{0,116},{-8,116},{-16,116},{-20,116},{4,112},{0,112},{-8,112},{-16,112},{-20,112},{-4,108},{-8,108},{-12,108},{-16,108}};
-const short E_Jump_0[72][2] = {{-16,136},{-20,136},{-24,136},{-28,136},{-32,136},{-8,132},{-12,132},{-16,132},{-20,132},{-24,132},{-28,132},{-32,132},{-36,132},{-8,128},{-12,128},{-16,128},{-20,128},{-24,128},{-28,128},{-32,128},{-36,128},{-40,128},{-4,124},{-8,124},{-12,124},{-16,124},{-20,124},{-24,124},{-28,124},{-32,124},{-36,124},{-40,124},{-4,120},{-8,120},{-12,120},{-16,120},{-20,120},{-24,120},{-40,120},{-4,116},{-8,116},{-12,116},{-16,116},{-20,116},{-40,116},{-4,112},{-8,112},{-16,112},{-40,112},{-4,108},{-8,108},{-16,108},{-40,108},{-8,104},{-12,104},{-12,100},{-20,100},{-40,100},{-12,96},{-20,96},{-28,96},{-36,96},{-40,96},{-16,92},{-20,92},{-28,92},{-36,92},{-40,92},{-24,88},{-28,88},{-32,88},{-36,88}};
-const short E_Jump_1[72][2] = {{-16,152},{-20,152},{-24,152},{-28,152},{-32,152},{-8,148},{-12,148},{-16,148},{-20,148},{-24,148},{-28,148},{-32,148},{-36,148},{-8,144},{-12,144},{-16,144},{-20,144},{-24,144},{-28,144},{-32,144},{-36,144},{-40,144},{-4,140},{-8,140},{-12,140},{-16,140},{-20,140},{-24,140},{-28,140},{-32,140},{-36,140},{-40,140},{-4,136},{-8,136},{-12,136},{-16,136},{-20,136},{-24,136},{-40,136},{-4,132},{-8,132},{-12,132},{-16,132},{-20,132},{-40,132},{-4,128},{-8,128},{-16,128},{-40,128},{-4,124},{-8,124},{-16,124},{-40,124},{-8,120},{-12,120},{-12,116},{-20,116},{-40,116},{-12,112},{-20,112},{-28,112},{-36,112},{-40,112},{-16,108},{-20,108},{-28,108},{-36,108},{-40,108},{-24,104},{-28,104},{-32,104},{-36,104}};
-const short E_Jump_2[72][2] = {{8,172},{4,172},{0,172},{-4,172},{-8,172},{16,168},{12,168},{8,168},{4,168},{0,168},{-4,168},{-8,168},{-12,168},{16,164},{12,164},{8,164},{4,164},{0,164},{-4,164},{-8,164},{-12,164},{-16,164},{20,160},{16,160},{12,160},{8,160},{4,160},{0,160},{-4,160},{-8,160},{-12,160},{-16,160},{20,156},{16,156},{12,156},{8,156},{4,156},{0,156},{-16,156},{20,152},{16,152},{12,152},{8,152},{4,152},{-16,152},{20,148},{16,148},{8,148},{-16,148},{20,144},{16,144},{8,144},{-16,144},{16,140},{12,140},{12,136},{4,136},{-16,136},{12,132},{4,132},{-4,132},{-12,132},{-16,132},{8,128},{4,128},{-4,128},{-12,128},{-16,128},{0,124},{-4,124},{-8,124},{-12,124}};
-const short E_Land_0[72][2] = {{8,164},{4,164},{0,164},{-4,164},{-8,164},{16,160},{12,160},{8,160},{4,160},{0,160},{-4,160},{-8,160},{-12,160},{16,156},{12,156},{8,156},{4,156},{0,156},{-4,156},{-8,156},{-12,156},{-16,156},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{-12,152},{-16,152},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-16,148},{20,144},{16,144},{12,144},{8,144},{4,144},{-16,144},{20,140},{16,140},{8,140},{-16,140},{20,136},{16,136},{8,136},{-16,136},{16,132},{12,132},{12,128},{4,128},{-16,128},{12,124},{4,124},{-4,124},{-12,124},{-16,124},{8,120},{4,120},{-4,120},{-12,120},{-16,120},{0,116},{-4,116},{-8,116},{-12,116}};
-const short E_Land_1[72][2] = {{-8,108},{-12,108},{-16,108},{-20,108},{-24,108},{0,104},{-4,104},{-8,104},{-12,104},{-16,104},{-20,104},{-24,104},{-28,104},{0,100},{-4,100},{-8,100},{-12,100},{-16,100},{-20,100},{-24,100},{-28,100},{-32,100},{4,96},{0,96},{-4,96},{-8,96},{-12,96},{-16,96},{-20,96},{-24,96},{-28,96},{-32,96},{4,92},{0,92},{-4,92},{-8,92},{-12,92},{-16,92},{-32,92},{4,88},{0,88},{-4,88},{-8,88},{-12,88},{-32,88},{4,84},{0,84},{-8,84},{-32,84},{4,80},{0,80},{-8,80},{-32,80},{0,76},{-4,76},{-4,72},{-12,72},{-32,72},{-4,68},{-12,68},{-20,68},{-28,68},{-32,68},{-8,64},{-12,64},{-20,64},{-28,64},{-32,64},{-16,60},{-20,60},{-24,60},{-28,60}};
-const short E_Land_2[72][2] = {{4,116},{0,116},{-4,116},{-8,116},{-12,116},{12,112},{8,112},{4,112},{0,112},{-4,112},{-8,112},{-12,112},{-16,112},{12,108},{8,108},{4,108},{0,108},{-4,108},{-8,108},{-12,108},{-16,108},{-20,108},{16,104},{12,104},{8,104},{4,104},{0,104},{-4,104},{-8,104},{-12,104},{-16,104},{-20,104},{16,100},{12,100},{8,100},{4,100},{0,100},{-4,100},{-20,100},{16,96},{12,96},{8,96},{4,96},{0,96},{-20,96},{16,92},{12,92},{4,92},{-20,92},{16,88},{12,88},{4,88},{-20,88},{12,84},{8,84},{8,80},{0,80},{-20,80},{8,76},{0,76},{-8,76},{-16,76},{-20,76},{4,72},{0,72},{-8,72},{-16,72},{-20,72},{-4,68},{-8,68},{-12,68},{-16,68}};
-const short E_StandGuard_0[72][2] = {{12,156},{8,156},{4,156},{0,156},{-4,156},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{-8,152},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{-12,148},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{-12,144},{24,140},{20,140},{16,140},{12,140},{8,140},{4,140},{-12,140},{24,136},{20,136},{16,136},{12,136},{8,136},{-12,136},{24,132},{20,132},{12,132},{-12,132},{24,128},{20,128},{12,128},{-12,128},{20,124},{16,124},{20,120},{16,120},{8,120},{-12,120},{16,116},{8,116},{0,116},{-8,116},{-12,116},{12,112},{8,112},{0,112},{-4,112},{-8,112},{4,108},{0,108},{-4,108}};
-const short E_StandGuard_1[70][2] = {{16,156},{12,156},{8,156},{4,156},{0,156},{24,152},{20,152},{16,152},{12,152},{8,152},{4,152},{0,152},{-4,152},{24,148},{20,148},{16,148},{12,148},{8,148},{4,148},{0,148},{-4,148},{-8,148},{28,144},{24,144},{20,144},{16,144},{12,144},{8,144},{4,144},{0,144},{-4,144},{-8,144},{28,140},{24,140},{20,140},{16,140},{12,140},{8,140},{-8,140},{28,136},{24,136},{20,136},{16,136},{12,136},{-8,136},{28,132},{24,132},{16,132},{-8,132},{28,128},{24,128},{16,128},{-8,128},{24,124},{20,124},{24,120},{20,120},{12,120},{-8,120},{20,116},{12,116},{4,116},{-4,116},{-8,116},{16,112},{12,112},{4,112},{-4,112},{8,108},{4,108}};
-
-
-
-Frame A_Attack_0[5] = {{A_Attack_0_0,119},{A_Attack_0_1,119},{A_Attack_0_2,119},{A_Attack_0_3,119},{A_Attack_0_4,119}};
-Frame A_Attack_1[8] = {{A_Attack_1_0,119},{A_Attack_1_1,119},{A_Attack_1_2,119},{A_Attack_1_3,119},{A_Attack_1_4,119},{A_Attack_1_5,119},{A_Attack_1_6,119},{A_Attack_1_7,119}};
-Frame A_Attack_3[7] = {{A_Attack_3_0,119},{A_Attack_3_1,118},{A_Attack_3_2,127},{A_Attack_3_3,77},{A_Attack_3_4,135},{A_Attack_3_5,120},{A_Attack_3_6,119}};
-Frame A_Backward[6] = {{A_Backward_0,119},{A_Backward_1,119},{A_Backward_2,119},{A_Backward_3,119},{A_Backward_4,119},{A_Backward_5,119}};
-Frame A_CrouchGuard[2] = {{A_CrouchGuard_0,123},{A_CrouchGuard_1,120}};
-Frame A_Damage[4] = {{A_Damage_0,119},{A_Damage_1,119},{A_Damage_2,119},{A_Damage_3,119}};
-Frame A_Dead[8] = {{A_Dead_0,123},{A_Dead_1,118},{A_Dead_2,125},{A_Dead_3,100},{A_Dead_4,5},{A_Dead_5,17},{A_Dead_6,20},{A_Dead_7,19}};
-Frame A_Fall[1] = {{A_Fall_0,119}};
-Frame A_Forward[6] = {{A_Forward_0,119},{A_Forward_1,119},{A_Forward_2,119},{A_Forward_3,119},{A_Forward_4,119},{A_Forward_5,119}};
-Frame A_Idle[5] = {{A_Idle_0,119},{A_Idle_1,119},{A_Idle_2,119},{A_Idle_3,119},{A_Idle_4,119}};
-Frame A_StandGuard[2] = {{A_StandGuard_0,118},{A_StandGuard_1,120}};
-Frame C1_Attack_0[5] = {{C1_Attack_0_0,132},{C1_Attack_0_1,109},{C1_Attack_0_2,133},{C1_Attack_0_3,126},{C1_Attack_0_4,109}};
-Frame C1_Attack_1[8] = {{C1_Attack_1_0,128},{C1_Attack_1_1,134},{C1_Attack_1_2,135},{C1_Attack_1_3,128},{C1_Attack_1_4,115},{C1_Attack_1_5,172},{C1_Attack_1_6,152},{C1_Attack_1_7,134}};
-Frame C1_Attack_3[7] = {{C1_Attack_3_0,130},{C1_Attack_3_1,137},{C1_Attack_3_2,146},{C1_Attack_3_3,148},{C1_Attack_3_4,125},{C1_Attack_3_5,165},{C1_Attack_3_6,146}};
-Frame C1_Backward[6] = {{C1_Backward_0,141},{C1_Backward_1,137},{C1_Backward_2,141},{C1_Backward_3,146},{C1_Backward_4,138},{C1_Backward_5,140}};
-Frame C1_CrouchGuard[2] = {{C1_CrouchGuard_0,132},{C1_CrouchGuard_1,120}};
-Frame C1_Damage[4] = {{C1_Damage_0,141},{C1_Damage_1,134},{C1_Damage_2,135},{C1_Damage_3,132}};
-Frame C1_Dead[8] = {{C1_Dead_0,149},{C1_Dead_1,143},{C1_Dead_2,160},{C1_Dead_3,144},{C1_Dead_4,128},{C1_Dead_5,136},{C1_Dead_6,152},{C1_Dead_7,155}};
-Frame C1_Fall[1] = {{C1_Fall_0,139}};
-Frame C1_Forward[6] = {{C1_Forward_0,138},{C1_Forward_1,138},{C1_Forward_2,137},{C1_Forward_3,133},{C1_Forward_4,130},{C1_Forward_5,138}};
-Frame C1_Idle[5] = {{C1_Idle_0,141},{C1_Idle_1,138},{C1_Idle_2,143},{C1_Idle_3,143},{C1_Idle_4,139}};
-Frame C1_StandGuard[2] = {{C1_StandGuard_0,146},{C1_StandGuard_1,143}};
-Frame C2_Attack_0[5] = {{C2_Attack_0_0,131},{C2_Attack_0_1,119},{C2_Attack_0_2,143},{C2_Attack_0_3,129},{C2_Attack_0_4,117}};
-Frame C2_Attack_1[8] = {{C2_Attack_1_0,140},{C2_Attack_1_1,147},{C2_Attack_1_2,150},{C2_Attack_1_3,136},{C2_Attack_1_4,115},{C2_Attack_1_5,168},{C2_Attack_1_6,157},{C2_Attack_1_7,137}};
-Frame C2_Attack_3[7] = {{C2_Attack_3_0,132},{C2_Attack_3_1,133},{C2_Attack_3_2,143},{C2_Attack_3_3,142},{C2_Attack_3_4,132},{C2_Attack_3_5,173},{C2_Attack_3_6,156}};
-Frame C2_Backward[6] = {{C2_Backward_0,144},{C2_Backward_1,141},{C2_Backward_2,144},{C2_Backward_3,148},{C2_Backward_4,140},{C2_Backward_5,144}};
-Frame C2_CrouchGuard[2] = {{C2_CrouchGuard_0,133},{C2_CrouchGuard_1,123}};
-Frame C2_Damage[4] = {{C2_Damage_0,146},{C2_Damage_1,138},{C2_Damage_2,142},{C2_Damage_3,137}};
-Frame C2_Dead[8] = {{C2_Dead_0,155},{C2_Dead_1,150},{C2_Dead_2,176},{C2_Dead_3,157},{C2_Dead_4,127},{C2_Dead_5,139},{C2_Dead_6,164},{C2_Dead_7,169}};
-Frame C2_Fall[1] = {{C2_Fall_0,148}};
-Frame C2_Forward[6] = {{C2_Forward_0,144},{C2_Forward_1,145},{C2_Forward_2,144},{C2_Forward_3,142},{C2_Forward_4,137},{C2_Forward_5,147}};
-Frame C2_Idle[5] = {{C2_Idle_0,147},{C2_Idle_1,146},{C2_Idle_2,150},{C2_Idle_3,150},{C2_Idle_4,146}};
-Frame C2_StandGuard[2] = {{C2_StandGuard_0,139},{C2_StandGuard_1,138}};
-Frame E_Attack_0[5] = {{E_Attack_0_0,72},{E_Attack_0_1,72},{E_Attack_0_2,72},{E_Attack_0_3,72},{E_Attack_0_4,72}};
-Frame E_Attack_1[8] = {{E_Attack_1_0,72},{E_Attack_1_1,72},{E_Attack_1_2,72},{E_Attack_1_3,72},{E_Attack_1_4,72},{E_Attack_1_5,72},{E_Attack_1_6,72},{E_Attack_1_7,72}};
-Frame E_Attack_3[7] = {{E_Attack_3_0,72},{E_Attack_3_1,85},{E_Attack_3_2,82},{E_Attack_3_3,53},{E_Attack_3_4,67},{E_Attack_3_5,72},{E_Attack_3_6,72}};
-Frame E_Backward[6] = {{E_Backward_0,72},{E_Backward_1,72},{E_Backward_2,72},{E_Backward_3,72},{E_Backward_4,72},{E_Backward_5,72}};
-Frame E_CrouchGuard[2] = {{E_CrouchGuard_0,72},{E_CrouchGuard_1,74}};
-Frame E_Damage[4] = {{E_Damage_0,72},{E_Damage_1,72},{E_Damage_2,72},{E_Damage_3,72}};
-Frame E_Dead[8] = {{E_Dead_0,72},{E_Dead_1,72},{E_Dead_2,72},{E_Dead_3,65},{E_Dead_4,6},{E_Dead_5,14},{E_Dead_6,25},{E_Dead_7,17}};
-Frame E_Fall[1] = {{E_Fall_0,72}};
-Frame E_Forward[6] = {{E_Forward_0,72},{E_Forward_1,72},{E_Forward_2,72},{E_Forward_3,72},{E_Forward_4,72},{E_Forward_5,72}};
-Frame E_Idle[5] = {{E_Idle_0,72},{E_Idle_1,72},{E_Idle_2,72},{E_Idle_3,72},{E_Idle_4,72}};
-Frame E_StandGuard[2] = {{E_StandGuard_0,72},{E_StandGuard_1,70}};
-
-
-//intentionally repeating last frame
-Frame A_Jump[7] = {{A_Jump_0,119},{A_Jump_1,119},{A_Jump_2,119},{A_Jump_2,119},{A_Jump_2,119},{A_Jump_2,119},{A_Jump_2,119}};
-Frame E_Jump[7] = {{E_Jump_0,72},{E_Jump_1,72},{E_Jump_2,72},{E_Jump_2,72},{E_Jump_2,72},{E_Jump_2,72},{E_Jump_2,72}};
-Frame C1_Jump[7] = {{C1_Jump_0,130},{C1_Jump_1,137},{C1_Jump_2,123},{C1_Jump_2,123},{C1_Jump_2,123},{C1_Jump_2,123},{C1_Jump_2,123}};
-Frame C2_Jump[7] = {{C2_Jump_0,140},{C2_Jump_1,140},{C2_Jump_2,130},{C2_Jump_2,130},{C2_Jump_2,130},{C2_Jump_2,130},{C2_Jump_2,130}};
-
-//intentionally appending frames from jump animation
-Frame A_Land[6] = {{A_Land_0,119},{A_Land_1,119},{A_Land_2,119},{A_Jump_0,119},{A_Jump_1,119},{A_Jump_2,119}};
-Frame E_Land[6] = {{E_Land_0,72},{E_Land_1,72},{E_Land_2,72},{E_Jump_0,72},{E_Jump_1,72},{E_Jump_2,72}};
-Frame C1_Land[6] = {{C1_Land_0,151},{C1_Land_1,133},{C1_Land_2,126},{C1_Jump_0,140},{C1_Jump_1,140},{C1_Jump_2,130}};
-Frame C2_Land[6] = {{C2_Land_0,162},{C2_Land_1,131},{C2_Land_2,128},{C2_Jump_0,130},{C2_Jump_1,137},{C2_Jump_2,123}};
-
-
-//intentionally using the first frame of crouch attack for crouching
-Frame A_Crouch[1] = {{A_Attack_0_0,119}};
-Frame E_Crouch[1] = {{E_Attack_0_0,72}};
-Frame C1_Crouch[1] = {{C1_Attack_0_0,132}};
-Frame C2_Crouch[1] = {{C2_Attack_0_0,131}};
-
-
-// Characters (head)
-// state =     0            1                2               3                4              5            6            7           8             9                10               11           12                 13                              
-Anim E[15] = {{E_Idle, 5}, {E_Attack_1, 8}, {E_Forward, 6}, {E_Backward, 6}, {E_Damage, 4}, {E_Jump, 7}, {E_Fall,1}, {E_Land,6}, {E_Crouch,1}, {E_Attack_0, 5}, {E_Attack_3, 7}, {E_Dead, 8}, {E_CrouchGuard,2}, {E_StandGuard,2}};
-Anim A[15] = {{A_Idle, 5}, {A_Attack_1, 8}, {A_Forward, 6}, {A_Backward, 6}, {A_Damage, 4}, {A_Jump, 7}, {A_Fall,1}, {A_Land,6}, {A_Crouch,1}, {A_Attack_0, 5}, {A_Attack_3, 7}, {A_Dead, 8}, {A_CrouchGuard,2}, {A_StandGuard,2}};
-// Characters (clothes)
-Anim C1[15] = {{C1_Idle, 5}, {C1_Attack_1, 8}, {C1_Forward, 6}, {C1_Backward, 6}, {C1_Damage, 4}, {C1_Jump, 7}, {C1_Fall,1}, {C1_Land,6}, {C1_Crouch,1}, {C1_Attack_0, 5}, {C1_Attack_3, 7}, {C1_Dead, 8}, {C1_CrouchGuard,2}, {C1_StandGuard,2}};
-Anim C2[15] = {{C2_Idle, 5}, {C2_Attack_1, 8}, {C2_Forward, 6}, {C2_Backward, 6}, {C2_Damage, 4}, {C2_Jump, 7}, {C2_Fall,1}, {C2_Land,6}, {C2_Crouch,1}, {C2_Attack_0, 5}, {C2_Attack_3, 7}, {C2_Dead, 8}, {C2_CrouchGuard,2}, {C2_StandGuard,2}};
+// A row of n blocks of a frame delta: blocks cx, cx-1 .. cx-n+1 of row cy,
+// block {cx, cy} being drawn at (x - 4cx, y - 4cy), or at (x + 4cx, y - 4cy)
+// when flipped (the anchor-relative block offsets the art was drawn with)
+typedef struct
+{
+    signed char cx, cy;
+    unsigned char n;
+}DeltaRun;
 
+// What changes between a frame and the next: the first clear runs go to
+// the background, the next set runs to the fighter color. runs is NULL if
+// the delta would not be worth it.
+typedef struct
+{
+    const DeltaRun* runs;
+    unsigned short clear, set;
+}FrameDelta;
 
+// Frame deltas, indexed [state][frame], for a head and body pairing. States
+// without deltas (the fighter moves in them) have a NULL table.
+typedef struct
+{
+    const Anim* head;
+    const Anim* body;
+    const FrameDelta* const* states;
+}AnimDelta;
+
+// The screen rectangle r = {x0, y0, x1, y1} (x1, y1 exclusive) frame f
+// covers drawn at (x, y)
+static inline void frameRect(const Frame *f, short x, short y, char flip, short r[4])
+{
+    r[0] = x - (flip ? f->fx : f->ax);
+    r[1] = y - f->ay;
+    r[2] = r[0] + f->w;
+    r[3] = r[1] + f->h;
+}
+
+// Sprite bitmaps and the Frame/Anim tables, generated at build time from
+// assets/sprites.txt by tools/spritegen.py
+#include "sprite_data.h"
@@ -0,0 +1,134 @@
+"""
+Minimal PNG reader and writer for the asset tools (no dependencies)
+
+read_png() decodes any non-interlaced PNG with 8-bit or smaller samples
+(grayscale, RGB, palette, with or without alpha) into rows of (r, g, b, a)
+tuples. write_png() stores a 1-bit grayscale image, which is what the
+sprite art is.
+"""
+
+import struct
+import zlib
+
+_SIG = b'\x89PNG\r\n\x1a\n'
+_CHANNELS = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}
+
+
+def _chunks(data):
+    pos = len(_SIG)
+    while pos < len(data):
+        n, kind = struct.unpack('>I4s', data[pos:pos + 8])
+        yield kind, data[pos + 8:pos + 8 + n]
+        pos += 12 + n
+
+
+def _paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    if pa <= pb and pa <= pc:
+        return a
+    return b if pb <= pc else c
+
+
+def _unfilter(raw, height, rowbytes, bpp):
+    """Undo the per-row filters; bpp is bytes per pixel (at least 1)"""
+    rows = []
+    prev = bytearray(rowbytes)
+    pos = 0
+    for _ in range(height):
+        ftype = raw[pos]
+        cur = bytearray(raw[pos + 1:pos + 1 + rowbytes])
+        pos += 1 + rowbytes
+        for i in range(rowbytes):
+            a = cur[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if ftype == 1:
+                cur[i] = (cur[i] + a) & 0xFF
+            elif ftype == 2:
+                cur[i] = (cur[i] + b) & 0xFF
+            elif ftype == 3:
+                cur[i] = (cur[i] + ((a + b) >> 1)) & 0xFF
+            elif ftype == 4:
+                cur[i] = (cur[i] + _paeth(a, b, c)) & 0xFF
+        rows.append(cur)
+        prev = cur
+    return rows
+
+
+def read_png(path):
+    """(width, height, rows) with rows[y][x] = (r, g, b, a), 0..255"""
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:8] != _SIG:
+        raise ValueError('%s: not a PNG file' % path)
+    idat = b''
+    palette, trns = [], b''
+    for kind, body in _chunks(data):
+        if kind == b'IHDR':
+            w, h, depth, ctype, _, _, interlace = struct.unpack('>IIBBBBB', body)
+        elif kind == b'PLTE':
+            palette = [tuple(body[i:i + 3]) for i in range(0, len(body), 3)]
+        elif kind == b'tRNS':
+            trns = body
+        elif kind == b'IDAT':
+            idat += body
+    if depth > 8 or interlace:
+        raise ValueError('%s: only 8-bit or smaller, non-interlaced PNGs' % path)
+    ch = _CHANNELS[ctype]
+    rowbytes = (w * ch * depth + 7) // 8
+    rows = _unfilter(zlib.decompress(idat), h, rowbytes, max(1, ch * depth // 8))
+
+    top = (1 << depth) - 1
+    out = []
+    for row in rows:
+        if depth < 8:
+            samples = [(row[(i * depth) >> 3] >> (8 - depth - ((i * depth) & 7))) & top
+                       for i in range(w * ch)]
+        else:
+            samples = list(row)
+        px = []
+        for x in range(w):
+            s = samples[x * ch:(x + 1) * ch]
+            if ctype == 3:
+                r, g, b = palette[s[0]]
+                a = trns[s[0]] if s[0] < len(trns) else 255
+            else:
+                v = [c * 255 // top for c in s]
+                if ctype == 0:
+                    r = g = b = v[0]
+                    a = 0 if (len(trns) == 2 and s[0] == struct.unpack('>H', trns)[0]) else 255
+                elif ctype == 4:
+                    r = g = b = v[0]
+                    a = v[1]
+                elif ctype == 2:
+                    r, g, b = v
+                    a = 255
+                else:
+                    r, g, b, a = v
+            px.append((r, g, b, a))
+        out.append(px)
+    return w, h, out
+
+
+def write_png(path, rows):
+    """Write rows of 0/1 values as a 1-bit grayscale PNG (1 is white)"""
+    h, w = len(rows), len(rows[0])
+    raw = bytearray()
+    for row in rows:
+        raw.append(0)
+        for i in range(0, w, 8):
+            b = 0
+            for j, v in enumerate(row[i:i + 8]):
+                b |= (v & 1) << (7 - j)
+            raw.append(b)
+
+    def chunk(kind, body):
+        return (struct.pack('>I', len(body)) + kind + body +
+                struct.pack('>I', zlib.crc32(kind + body) & 0xFFFFFFFF))
+
+    with open(path, 'wb') as f:
+        f.write(_SIG)
+        f.write(chunk(b'IHDR', struct.pack('>IIBBBBB', w, h, 1, 0, 0, 0, 0)))
+        f.write(chunk(b'IDAT', zlib.compress(bytes(raw), 9)))
+        f.write(chunk(b'IEND', b''))
@@ -0,0 +1,604 @@
+#!/usr/bin/env python3
+"""
+Sprite asset compiler
+
+Reads the sprite manifest (assets/sprites.txt) and the PNG art it names, and
+writes one C header with a Bitmap for every sprite (see vga16_graphics.h)
+plus the Frame and Anim tables from sprites.h. Each Frame also gets the
+box its sprite covers and its ink pixel count. The build runs it whenever
+the manifest, the art or this tool changes (see CMakeLists.txt).
+
+Each sprite is trimmed to its ink, so the Bitmap's size and anchor offsets
+are its bounding box. It is stored in the encoding the manifest asks for:
+  bits    one bit per cell
+  spans   runs of ink cells, one byte per short run
+  points  a (column, row) byte pair per ink cell
+  auto    whichever of bits and spans is smaller (points is never smaller
+          and is the slowest to draw, so it is only used when asked for)
+  none    not stored - the sprite is only drawn into packed images
+
+All the data goes into one atlas array with every distinct image in it
+once. The fighters' heads, for one, are the same image in almost every
+frame, only placed differently. A sprite that is another's image (or its
+mirror image) with its own anchor gets a Bitmap pointing at the shared
+bytes; one with the same anchor as well is #defined to the other, and the
+Frame tables use the first name. It prints how much flash that saves.
+
+Images declared with "image" are composed from layers of sprites here, at
+build time, and stored run-length packed (see PackedImage in
+vga16_graphics.h), so a screen of big art is one unpacking pass instead
+of many sprites.
+
+Sprites listed with "code" in the manifest are also compiled to C: for each
+flip and each pixel parity of the left edge, a function that stores the
+sprite's bytes at fixed offsets from the top-left, with no decoding, and
+their Frame entries point at it (see BitmapCode in vga16_graphics.h). That
+trades flash for speed, so it is meant for the frames drawn every tick.
+--no-code leaves all of them as plain bitmaps.
+
+USAGE (from the project directory)
+  python3 tools/spritegen.py [-v] [--no-code] [assets/sprites.txt] [sprite_data.h]
+  -v lists the size of every sprite in every encoding
+  --no-code ignores the manifest's "code" lines
+"""
+
+import os
+import re
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from pngfile import read_png  # noqa: E402
+
+CELL = 4
+ROW_BYTES = 320  # of vga_data_array, two pixels a byte
+FORMATS = {'spans': 'BITMAP_SPANS', 'bits': 'BITMAP_1BPP', 'points': 'BITMAP_POINTS'}
+
+
+def fail(where, msg):
+    sys.exit('%s: %s' % (where, msg))
+
+
+def read_manifest(path):
+    """Directives as (line number, words), continuation lines joined"""
+    out = []
+    with open(path) as f:
+        for n, line in enumerate(f, 1):
+            line = line.split('#', 1)[0].rstrip()
+            if not line.strip():
+                continue
+            if line[0].isspace():
+                if not out:
+                    fail('%s:%d' % (path, n), 'continuation with nothing to continue')
+                out[-1][1].extend(line.split())
+            else:
+                out.append((n, line.split()))
+    return out
+
+
+def expand(words):
+    """Expand PREFIX_a..b ranges"""
+    out = []
+    for w in words:
+        m = re.match(r'^(\w*?)(\d+)\.\.(\d+)$', w)
+        if m:
+            out += ['%s%d' % (m.group(1), i) for i in range(int(m.group(2)), int(m.group(3)) + 1)]
+        else:
+            out.append(w)
+    return out
+
+
+def load_cells(path):
+    """Ink cells of an image as a set of (column, row), trimmed to the ink,
+    and the trimmed-off left and top margins"""
+    w, h, rows = read_png(path)
+    ink = set()
+    for r, row in enumerate(rows):
+        for c, (red, green, blue, alpha) in enumerate(row):
+            if alpha >= 128 and (red * 299 + green * 587 + blue * 114) < 128000:
+                ink.add((c, r))
+    if not ink:
+        fail(path, 'no ink')
+    c0 = min(c for c, r in ink)
+    r0 = min(r for c, r in ink)
+    return set((c - c0, r - r0) for c, r in ink), c0, r0
+
+
+def encode_bits(w, h, ink):
+    stride = (w + 7) // 8
+    data = bytearray(stride * h)
+    for c, r in ink:
+        data[r * stride + c // 8] |= 1 << (c % 8)
+    return bytes(data), stride
+
+
+def encode_spans(w, h, ink):
+    """Per row a count, then that many spans left to right, each as the gap
+    in cells since the end of the previous span (or the left edge) and its
+    length: one byte (gap << 4) | (length - 1) when gap < 15 and
+    length <= 16, otherwise 0xF0 followed by a gap byte and a length byte"""
+    out = bytearray()
+    for r in range(h):
+        runs = []
+        c = 0
+        while c < w:
+            if (c, r) in ink:
+                c0 = c
+                while (c, r) in ink:
+                    c += 1
+                runs.append((c0, c - c0))
+            else:
+                c += 1
+        out.append(len(runs))
+        end = 0
+        for c0, n in runs:
+            gap = c0 - end
+            if gap < 15 and n <= 16:
+                out.append((gap << 4) | (n - 1))
+            else:
+                out += bytes((0xF0, gap, n))
+            end = c0 + n
+    return bytes(out)
+
+
+def encode_points(ink):
+    out = bytearray()
+    for c, r in sorted(ink, key=lambda p: (p[1], p[0])):
+        out += bytes((c, r))
+    return bytes(out)
+
+
+class Sprite:
+    def __init__(self, where, art_dir, name, ax, ay, enc):
+        ink, c0, r0 = load_cells(os.path.join(art_dir, name + '.png'))
+        self.name = name
+        self.w = max(c for c, r in ink) + 1
+        self.h = max(r for c, r in ink) + 1
+        if self.w > 255 or self.h > 255:
+            fail(where, '%s is too big' % name)
+        # Anchor offsets of the trimmed image. Unflipped its top-left is at
+        # x - ax; flipped, cell column c lands where column w-1-c would, so
+        # the top-left moves to x - fx.
+        self.ax = ax - c0 * CELL
+        self.ay = ay - r0 * CELL
+        self.fx = (self.w - 1) * CELL - self.ax
+        self.cells = len(ink)
+        self.ink = frozenset(ink)
+        bits, stride = encode_bits(self.w, self.h, ink)
+        spans = encode_spans(self.w, self.h, ink)
+        self.sizes = {'bits': len(bits), 'spans': len(spans), 'points': 2 * len(ink)}
+        if enc == 'auto':
+            enc = 'spans' if len(spans) < len(bits) else 'bits'
+        self.enc = enc
+        self.stride = stride if enc == 'bits' else 0
+        if enc == 'bits':
+            self.data = bits
+        elif enc == 'spans':
+            self.data = spans
+        elif enc == 'points':
+            self.data = encode_points(ink)
+        else:
+            self.data = b''
+
+    def key(self, mirrored=False):
+        """What has to match for two sprites to share data"""
+        ink = self.ink
+        if mirrored:
+            ink = frozenset((self.w - 1 - c, r) for c, r in ink)
+        return (self.enc, self.w, self.h, ink)
+
+
+def build_atlas(sprites):
+    """Give every sprite a place in the atlas. A sprite whose image (or
+    mirror image) is already there shares it; one that also has the same
+    anchor is the same Bitmap and becomes an alias. Returns the atlas
+    bytes and its (offset, name) entries."""
+    atlas = bytearray()
+    entries = []
+    images = {}
+    bitmaps = {}
+    for s in sprites:
+        s.alias = None
+        s.mirrored = False
+        hit = images.get(s.key())
+        if hit is None:
+            hit = images.get(s.key(True))
+            s.mirrored = hit is not None
+        if hit is None:
+            s.offset = len(atlas)
+            images[s.key()] = s
+            entries.append((len(atlas), s))
+            atlas += s.data
+        else:
+            s.offset = hit.offset
+            s.data = hit.data
+        same = (s.offset, s.mirrored, s.w, s.h, s.ax, s.ay)
+        if same in bitmaps:
+            s.alias = bitmaps[same]
+        else:
+            bitmaps[same] = s
+    return bytes(atlas), entries
+
+
+def emit_atlas(sprites, atlas, entries):
+    out = ['// Every distinct image once. Sprites that are another one with a',
+           '// different anchor, or its mirror image, point into the same bytes.',
+           'const unsigned char sprite_atlas[%d] = {' % len(atlas)]
+    for i, (offset, s) in enumerate(entries):
+        end = entries[i + 1][0] if i + 1 < len(entries) else len(atlas)
+        out.append('    // %s (%s)' % (s.name, s.enc))
+        out.append('    ' + ','.join('0x%02x' % b for b in atlas[offset:end]) + ',')
+    out.append('};')
+    out.append('')
+    for s in sprites:
+        if s.alias:
+            out.append('#define %s %s' % (s.name, s.alias.name))
+            continue
+        fmt = FORMATS[s.enc] + (' | BITMAP_MIRRORED' if s.mirrored else '')
+        out.append('const Bitmap %s = {%d, %d, %d, %d, %d, %s, %d, 0, %d, %d, sprite_atlas + %d};' %
+                   (s.name, s.w, s.h, s.ax, s.ay, s.fx, fmt, CELL, s.stride,
+                    len(s.data), s.offset))
+    return out
+
+
+def canonical(sprites, name):
+    s = sprites[name]
+    return s.alias.name if s.alias else name
+
+
+def blocks(where, s):
+    """A sprite's cells as (cx, cy) offsets from the anchor in cells, the
+    way the point lists had them: drawn at (x - 4cx, y - 4cy), or at
+    (x + 4cx, y - 4cy) when flipped"""
+    if s.ax % CELL or s.ay % CELL:
+        fail(where, '%s: anchor is off the %d pixel grid' % (s.name, CELL))
+    return set(((s.ax // CELL) - c, (s.ay // CELL) - r) for c, r in s.ink)
+
+
+def runs(cells):
+    """Cells as (cx, cy, n) runs, top row first, each run left to right:
+    cells cx, cx-1 .. cx-n+1 of row cy"""
+    out = []
+    for cx, cy in sorted(cells, key=lambda p: (-p[1], -p[0])):
+        if out and out[-1][1] == cy and out[-1][0] - out[-1][2] == cx and out[-1][2] < 255:
+            out[-1][2] += 1
+        else:
+            out.append([cx, cy, 1])
+    return out
+
+
+def emit_deltas(where, sprites, frames, anims, head, body, only):
+    """Per state, per frame, the runs to clear and to set to go from that
+    frame of head-over-body to the next (the last frame goes to the first).
+    A delta that would cost more than half of erasing and redrawing is left
+    out (no runs), and the game redraws instead. If only lists states, the
+    others get no table at all."""
+    name = '%s_%s' % (head, body)
+    if len(anims[head]) != len(anims[body]):
+        fail(where, '%s and %s have different numbers of states' % (head, body))
+    table, states, nbytes = [], [], 0
+    for state, (hf, bf) in enumerate(zip(anims[head], anims[body])):
+        if only and state not in only:
+            states.append(None)
+            continue
+        if len(frames[hf]) != len(frames[bf]):
+            fail(where, '%s and %s have different lengths' % (hf, bf))
+        pics = [blocks(where, sprites[h]) | blocks(where, sprites[b])
+                for h, b in zip(frames[hf], frames[bf])]
+        deltas = []
+        for f in range(len(pics)):
+            a, b = pics[f], pics[(f + 1) % len(pics)]
+            clear, put = runs(a - b), runs(b - a)
+            if 2 * (len(clear) + len(put)) > len(runs(a)) + len(runs(b)):
+                # Not much cheaper than erasing and redrawing - don't keep it
+                deltas.append(None)
+                continue
+            deltas.append((len(table), len(clear), len(put)))
+            table += clear + put
+        states.append('const FrameDelta %s_deltas_%d[%d] = {%s};' %
+                      (name, state, len(deltas),
+                       ', '.join('{%s_runs + %d, %d, %d}' % ((name,) + d) if d else '{0, 0, 0}'
+                                 for d in deltas)))
+        nbytes += 8 * len(deltas)
+    for cx, cy, n in table:
+        if not (-128 <= cx < 128 and -128 <= cy < 128):
+            fail(where, '%s: delta run out of range' % name)
+    out = ['// %s heads on %s bodies: what changes from each frame to the next' % (head, body),
+           'const DeltaRun %s_runs[%d] = {%s};' %
+           (name, max(1, len(table)), ','.join('{%d,%d,%d}' % tuple(r) for r in table) or '{0}')]
+    out += [s for s in states if s]
+    out.append('const FrameDelta *const %s_deltas[%d] = {%s};' %
+               (name, len(states), ', '.join('%s_deltas_%d' % (name, i) if states[i] else '0'
+                                             for i in range(len(states)))))
+    out.append('')
+    return out, name, 3 * len(table) + nbytes + 4 * len(states)
+
+
+def code_rows(ink, h, parity):
+    """Per cell row, the bytes a compiled sprite writes: (offset, nibbles)
+    with nibbles 1 (low), 2 (high) or 3 (both), offsets from the byte of
+    the top-left pixel when that pixel is at an even (parity 0) or odd x"""
+    rows = [{} for _ in range(h)]
+    for c, r in ink:
+        for n in range(parity + CELL * c, parity + CELL * (c + 1)):
+            rows[r][n >> 1] = rows[r].get(n >> 1, 0) | (2 if n & 1 else 1)
+    return [sorted(row.items()) for row in rows]
+
+
+def code_size(rows):
+    """Rough Thumb size of a compiled sprite function: a store per whole
+    byte, a read-modify-write per half byte, a base register per 32 bytes
+    of a row (strb only reaches 31 bytes out) and the loop over the 4
+    screen rows of each cell row"""
+    n = 6
+    for row in rows:
+        if row:
+            n += 4 + row[-1][0] // 32
+            n += sum(1 if nib == 3 else 4 for o, nib in row)
+    return 2 * n
+
+
+def emit_code(sprites, names):
+    """Compiled sprites: a straight-line function per distinct image, flip
+    and pixel parity (so a mirror image shares its partner's functions),
+    and a BitmapCode per sprite. Returns the lines and the rough flash."""
+    out = ['// Compiled sprites (see BitmapCode in vga16_graphics.h): p is the byte of',
+           '// the top-left pixel, c the color in both nibbles',
+           '#define CODE_LO(o) (p[o] = (p[o] & 0xF0) | (c & 0x0F))',
+           '#define CODE_HI(o) (p[o] = (p[o] & 0x0F) | (c & 0xF0))']
+    funcs, nbytes = {}, 0
+    for name in names:
+        s = sprites[name]
+        table = []
+        for flip in (0, 1):
+            ink = s.ink
+            if flip:
+                ink = frozenset((s.w - 1 - c, r) for c, r in ink)
+            for parity in (0, 1):
+                key = (s.w, s.h, ink, parity)
+                if key not in funcs:
+                    func = 'code_%s_%d%d' % (name, flip, parity)
+                    funcs[key] = func
+                    rows = code_rows(ink, s.h, parity)
+                    nbytes += code_size(rows)
+                    out.append('static void %s(unsigned char *p, unsigned char c) {' % func)
+                    skip = 0
+                    for row in rows:
+                        if not row:
+                            skip += CELL
+                            continue
+                        if skip:
+                            out.append('    p += %d ;' % (skip * ROW_BYTES))
+                            skip = 0
+                        out.append('    for (int i = 0; i < %d; i++, p += %d) { %s }' %
+                                   (CELL, ROW_BYTES, ' '.join(
+                                       ('p[%d] = c ;' if nib == 3 else
+                                        'CODE_LO(%d) ;' if nib == 1 else 'CODE_HI(%d) ;') % o
+                                       for o, nib in row)))
+                    out.append('}')
+                table.append(funcs[key])
+        out.append('const BitmapCode %s_code = {{{%s, %s}, {%s, %s}}};' % ((name,) + tuple(table)))
+        nbytes += 16
+    out.append('// Rough flash taken by the code above (for bench/bench_sprite_code.c)')
+    out.append('#define SPRITE_CODE_BYTES %d' % nbytes)
+    out.append('')
+    return out, nbytes
+
+
+COLORS = ['BLACK', 'DARK_GREEN', 'MED_GREEN', 'GREEN', 'DARK_BLUE', 'BLUE', 'LIGHT_BLUE',
+          'CYAN', 'RED', 'DARK_ORANGE', 'ORANGE', 'YELLOW', 'MAGENTA', 'PINK', 'LIGHT_PINK',
+          'WHITE']
+
+
+def color(where, name):
+    if name not in COLORS:
+        fail(where, 'unknown color %s' % name)
+    return COLORS.index(name)
+
+
+def compose(image, sprites):
+    """Pixels of an image: its background with its layers drawn over it in
+    order, each exactly as drawBitmap would, cut to the image"""
+    name, w, h, bg, layers = image
+    px = [bytearray([bg]) * w for _ in range(h)]
+    for sname, x, y, c, flip in layers:
+        s = sprites[sname]
+        left = x - (s.fx if flip else s.ax)
+        top = y - s.ay
+        for cx, cy in s.ink:
+            if flip:
+                cx = s.w - 1 - cx
+            x0, y0 = left + CELL * cx, top + CELL * cy
+            for yy in range(max(0, y0), min(h, y0 + CELL)):
+                for xx in range(max(0, x0), min(w, x0 + CELL)):
+                    px[yy][xx] = c
+    return px
+
+
+def encode_packed(px):
+    """PackedImage data: groups of equal rows, each a row count and then
+    the row's runs left to right - (color << 4) | (length - 1) for up to
+    15 pixels, else (color << 4) | 15 and a byte of length - 16"""
+    out = bytearray()
+    r = 0
+    while r < len(px):
+        n = 1
+        while r + n < len(px) and n < 255 and px[r + n] == px[r]:
+            n += 1
+        out.append(n)
+        row = px[r]
+        x = 0
+        while x < len(row):
+            x0 = x
+            while x < len(row) and row[x] == row[x0] and x - x0 < 271:
+                x += 1
+            n_px = x - x0
+            if n_px <= 15:
+                out.append((row[x0] << 4) | (n_px - 1))
+            else:
+                out += bytes(((row[x0] << 4) | 15, n_px - 16))
+        r += n
+    return bytes(out)
+
+
+def emit_images(images, sprites):
+    out = ['// Packed images (see PackedImage in vga16_graphics.h)']
+    nbytes = 0
+    for image in images:
+        data = encode_packed(compose(image, sprites))
+        name, w, h = image[:3]
+        if len(data) > 0xFFFF:
+            fail(name, 'packed image too big')
+        out.append('const unsigned char %s_data[%d] = {%s};' %
+                   (name, len(data), ','.join('0x%02x' % b for b in data)))
+        out.append('const PackedImage %s = {%d, %d, %d, %s_data};' % (name, w, h, len(data), name))
+        nbytes += len(data) + 12
+    out.append('')
+    return out, nbytes
+
+
+def build(manifest, code=True):
+    art_dir = os.path.join(os.path.dirname(manifest), 'art')
+    sprites, frames, anims, tables, compiled, images = {}, {}, {}, [], [], []
+    for n, words in read_manifest(manifest):
+        where = '%s:%d' % (manifest, n)
+        kind, args = words[0], words[1:]
+        if kind == 'sprite':
+            if len(args) not in (3, 4):
+                fail(where, 'sprite NAME AX AY [ENCODING]')
+            enc = args[3] if len(args) == 4 else 'auto'
+            if enc not in ('auto', 'none') and enc not in FORMATS:
+                fail(where, 'unknown encoding %s' % enc)
+            s = Sprite(where, art_dir, args[0], int(args[1]), int(args[2]), enc)
+            sprites[s.name] = s
+        elif kind == 'frames':
+            items = expand(args[1:])
+            for i in items:
+                if i not in sprites or sprites[i].enc == 'none':
+                    fail(where, 'no stored sprite %s' % i)
+            frames[args[0]] = items
+            tables.append((kind, args[0], items))
+        elif kind == 'anim':
+            for i in args[1:]:
+                if i not in frames:
+                    fail(where, 'no frames %s' % i)
+            anims[args[0]] = args[1:]
+            tables.append((kind, args[0], args[1:]))
+        elif kind == 'image':
+            if len(args) != 4:
+                fail(where, 'image NAME W H COLOR')
+            images.append((args[0], int(args[1]), int(args[2]), color(where, args[3]), []))
+        elif kind == 'layer':
+            if len(args) not in (4, 5) or (len(args) == 5 and args[4] != 'flip'):
+                fail(where, 'layer SPRITE X Y COLOR [flip]')
+            if not images:
+                fail(where, 'layer without an image')
+            if args[0] not in sprites:
+                fail(where, 'no sprite %s' % args[0])
+            images[-1][4].append((args[0], int(args[1]), int(args[2]), color(where, args[3]),
+                                  len(args) == 5))
+        elif kind == 'code':
+            for i in expand(args):
+                if i not in sprites or sprites[i].enc == 'none':
+                    fail(where, 'no stored sprite %s' % i)
+                compiled.append(i)
+        elif kind == 'deltas':
+            if len(args) < 2 or args[0] not in anims or args[1] not in anims:
+                fail(where, 'deltas HEAD_ANIM BODY_ANIM [STATE...]')
+            tables.append((kind, where, args))
+        else:
+            fail(where, 'unknown directive %s' % kind)
+
+    stored = [s for s in sprites.values() if s.enc != 'none']
+    atlas, entries = build_atlas(stored)
+    out = ['// Generated by tools/spritegen.py from %s - do not edit.' % os.path.basename(manifest),
+           '// Bitmaps are in vga16_graphics.h, Frame and Anim in sprites.h.', '']
+    out += emit_atlas(stored, atlas, entries)
+    out.append('')
+    names = []
+    if code:
+        for i in compiled:
+            if canonical(sprites, i) not in names:
+                names.append(canonical(sprites, i))
+    code_bytes = 0
+    if names:
+        lines, code_bytes = emit_code(sprites, names)
+        out += lines
+
+    image_bytes = 0
+    if images:
+        lines, image_bytes = emit_images(images, sprites)
+        out += lines
+
+    def frame(i):
+        i = canonical(sprites, i)
+        t = sprites[i]
+        if t.cells * CELL * CELL > 0xFFFF:
+            fail(manifest, '%s is too big for a frame' % i)
+        return '{&%s, %s, %d, %d, %d, %d, %d, %d}' % (
+            i, ('&%s_code' % i) if i in names else '0', t.ax, t.fx, t.ay,
+            t.w * CELL, t.h * CELL, t.cells * CELL * CELL)
+
+    pairs, delta_bytes = [], 0
+    for kind, name, items in tables:
+        if kind == 'frames':
+            out.append('const Frame %s[%d] = {%s};' %
+                       (name, len(items), ', '.join(frame(i) for i in items)))
+        elif kind == 'anim':
+            out.append('Anim %s[%d] = {%s};' %
+                       (name, len(items),
+                        ', '.join('{%s, %d}' % (i, len(frames[i])) for i in items)))
+        else:
+            lines, pair, nbytes = emit_deltas(name, sprites, frames, anims, items[0], items[1],
+                                              set(int(i) for i in items[2:]))
+            if not pairs:
+                out.append('')
+            out += lines
+            pairs.append((items[0], items[1], pair))
+            delta_bytes += nbytes
+    if pairs:
+        out.append('const AnimDelta anim_deltas[%d] = {%s};' %
+                   (len(pairs), ', '.join('{%s, %s, %s_deltas}' % p for p in pairs)))
+    out.append('')
+    return ('\n'.join(out), sprites, atlas, entries, delta_bytes, (len(names), code_bytes),
+            (len(images), image_bytes))
+
+
+def main():
+    args = sys.argv[1:]
+    verbose = '-v' in args
+    code = '--no-code' not in args
+    args = [a for a in args if a not in ('-v', '--no-code')]
+    src = args[0] if len(args) > 0 else 'assets/sprites.txt'
+    dst = args[1] if len(args) > 1 else 'sprite_data.h'
+    text, sprites, atlas, entries, delta_bytes, (ncode, code_bytes), (nimages, image_bytes) = \
+        build(src, code)
+    with open(dst, 'w') as f:
+        f.write(text)
+
+    if verbose:
+        print('%-18s %6s %6s %6s %6s  %s' % ('sprite', 'cells', 'bits', 'spans', 'points', 'used'))
+        for s in sprites.values():
+            print('%-18s %6d %6d %6d %6d  %s' % (s.name, s.cells, s.sizes['bits'],
+                                                s.sizes['spans'], s.sizes['points'], s.enc))
+    # Flash the sprites would take without any sharing: their own data and
+    # a Bitmap each (20 bytes on the RP2040)
+    stored = [s for s in sprites.values() if s.enc != 'none']
+    before = sum(s.sizes[s.enc] for s in stored) + 20 * len(stored)
+    nbitmaps = sum(1 for s in stored if not s.alias)
+    after = len(atlas) + 20 * nbitmaps
+    used = ', '.join('%d %s' % (sum(1 for s in sprites.values() if s.enc == e), e)
+                     for e in FORMATS if any(s.enc == e for s in sprites.values()))
+    print('%d sprites (%s)' % (len(sprites), used))
+    print('  %d distinct images, %d more are mirror images of one, %d Bitmaps' %
+          (len(entries), sum(1 for s in stored if s.mirrored and not s.alias), nbitmaps))
+    print('  %d bytes -> %d bytes of flash, %d saved' % (before, after, before - after))
+    if delta_bytes:
+        print('  %d bytes of frame deltas' % delta_bytes)
+    if nimages:
+        print('  %d packed images, %d bytes' % (nimages, image_bytes))
+    if ncode:
+        print('  %d compiled sprites, about %d bytes of code' % (ncode, code_bytes))
+
+
+if __name__ == '__main__':
+    main()
@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "pico/stdlib.h"
 #include "hardware/pio.h"
 #include "hardware/dma.h"
@@ -10,6 +11,8 @@
 #include "rgb.pio.h"
 // Header file
 #include "vga16_graphics.h"
+// Word-wide pixel kernels
+#include "vga16_swar.h"
 // Font file
 #include "glcdfont.c"
 #include "font_rom_brl4.h"
@@ -26,13 +29,18 @@
 // Pixel color array that is DMA's to the PIO machines and
 // a pointer to the ADDRESS of this color array.
 // Note that this array is automatically initialized to all 0's (black)
-unsigned char vga_data_array[TXCOUNT];
+// Word aligned so the fill routines can store 8 pixels at a time (each row is
+// 320 bytes, so every row starts on a word boundary too).
+unsigned char vga_data_array[TXCOUNT] __attribute__((aligned(4)));
 char * address_pointer = &vga_data_array[0] ;
 
 // Bit masks for drawPixel routine
 #define TOPMASK 0b00001111
 #define BOTTOMMASK 0b11110000
 
+// Bytes per row of the pixel array (2 pixels per byte)
+#define ROWBYTES 320
+
 // For drawLine
 #define swap(a, b) { short t = a; a = b; b = t; }
 
@@ -50,6 +58,37 @@ char textcolor, textbgcolor, wrap;
 #define _width 640
 #define _height 480
 
+// Clip rectangle - every primitive draws only inside [clip_x0, clip_x1) x
+// [clip_y0, clip_y1). Defaults to the whole screen, see setClipRect().
+short clip_x0 = 0, clip_y0 = 0, clip_x1 = _width, clip_y1 = _height ;
+
+// Raster op (see setRasterOp) as masks. Drawing color c turns a pixel's
+// old value into (old & keep) ^ flip, with keep = (c & rop_keep_and) ^
+// rop_keep_xor and flip = c & rop_flip_and. Every nibble of the words is the
+// same, so they work on one pixel or on 8 at once. Starts as ROP_COPY.
+static char rop = ROP_COPY ;
+static uint32_t rop_keep_and = 0, rop_keep_xor = 0, rop_flip_and = 0xFFFFFFFFu ;
+
+// Where the beam is, for beamLine(): the DMA channel sending the pixels
+// (-1 before initVGA()) and the vsync state machine. The frame is 524
+// lines, 32 us each: 480 visible, then the vertical blank of 10 front
+// porch, 2 sync and 32 back porch lines.
+#define VGA_LINES 524
+#define VGA_FRONT_PORCH 10
+#define VGA_SYNC 2
+#define VGA_LINE_US 32
+// Where the front porch, sync pulse and back porch start in vsync.pio -
+// before them is the visible part
+#define VSYNC_FRONT_PC 5
+#define VSYNC_SYNC_PC 8
+#define VSYNC_BACK_PC 11
+static int vga_chan = -1 ;
+static PIO vga_pio ;
+static uint vga_vsync_sm, vga_vsync_offset ;
+
+// Per-pixel plot routine picked once per primitive (see clipPlotter)
+typedef void (*plotter)(short x, short y, char color) ;
+
 void initVGA() {
         // Choose which PIO instance to use (there are two instances, each with 4 state machines)
     PIO pio = pio0;
@@ -89,6 +128,10 @@ void initVGA() {
     // DMA channels - 0 sends color data, 1 reconfigures and restarts 0
     int rgb_chan_0 = dma_claim_unused_channel(true);
     int rgb_chan_1 = dma_claim_unused_channel(true);
+    vga_chan = rgb_chan_0 ;
+    vga_pio = pio ;
+    vga_vsync_sm = vsync_sm ;
+    vga_vsync_offset = vsync_offset ;
 
     // Channel Zero (sends color data to PIO VGA machine)
     dma_channel_config c0 = dma_channel_get_default_config(rgb_chan_0);  // default configs
@@ -148,42 +191,582 @@ void initVGA() {
 }
 
 
-// A function for drawing a pixel with a specified color.
-// Note that because information is passed to the PIO state machines through
-// a DMA channel, we only need to modify the contents of the array and the
-// pixels will be automatically updated on the screen.
-void drawPixel(short x, short y, char color) {
-    // Range checks (640x480 display)
-    if (x > 639) x = 639 ;
-    if (x < 0) x = 0 ;
-    if (y < 0) y = 0 ;
-    if (y > 479) y = 479 ;
-    //if((x > 639) | (x < 0) | (y > 479) | (y < 0) ) return;
+// Restrict all drawing to the rectangle with top-left (x,y), width w and
+// height h (intersected with the screen). Anything outside is discarded.
+void setClipRect(short x, short y, short w, short h) {
+    int x0 = x, y0 = y, x1 = x + w, y1 = y + h ;
+    if (x0 < 0) x0 = 0 ;
+    if (y0 < 0) y0 = 0 ;
+    if (x1 > _width) x1 = _width ;
+    if (y1 > _height) y1 = _height ;
+    // An empty clip rectangle rejects everything
+    if (x1 < x0) x1 = x0 ;
+    if (y1 < y0) y1 = y0 ;
+    clip_x0 = x0 ;
+    clip_y0 = y0 ;
+    clip_x1 = x1 ;
+    clip_y1 = y1 ;
+}
+
+// Drawing goes back to covering the whole screen
+void resetClip() {
+    clip_x0 = 0 ;
+    clip_y0 = 0 ;
+    clip_x1 = _width ;
+    clip_y1 = _height ;
+}
+
+// How drawn pixels combine with what is already on the screen:
+//  ROP_COPY    new = color (the default)
+//  ROP_XOR     new = old ^ color - drawing the same thing twice puts back
+//              whatever was there, on any background
+//  ROP_OR      new = old | color
+//  ROP_AND     new = old & color
+//  ROP_ANDNOT  new = old & ~color
+// Applies to every primitive and text. copyRect and the buffer copies
+// always copy.
+void setRasterOp(char op) {
+    // new = (old & keep) ^ flip, see rop_keep_and
+    switch (op) {
+    case ROP_XOR:    rop_keep_and = 0 ;           rop_keep_xor = 0xFFFFFFFFu ; rop_flip_and = 0xFFFFFFFFu ; break ;
+    case ROP_OR:     rop_keep_and = 0xFFFFFFFFu ; rop_keep_xor = 0xFFFFFFFFu ; rop_flip_and = 0xFFFFFFFFu ; break ;
+    case ROP_AND:    rop_keep_and = 0xFFFFFFFFu ; rop_keep_xor = 0 ;           rop_flip_and = 0 ;           break ;
+    case ROP_ANDNOT: rop_keep_and = 0xFFFFFFFFu ; rop_keep_xor = 0xFFFFFFFFu ; rop_flip_and = 0 ;           break ;
+    default:
+      op = ROP_COPY ;
+      rop_keep_and = 0 ;
+      rop_keep_xor = 0 ;
+      rop_flip_and = 0xFFFFFFFFu ;
+      break ;
+    }
+    rop = op ;
+}
+
+char getRasterOp() {
+    return rop ;
+}
+
+// ==== dirty rectangles ====
+
+// Parts of the screen to be redrawn, as {x0, y0, x1, y1} (x1, y1
+// exclusive), none overlapping. A new rectangle swallows every one it
+// overlaps; at DIRTY_RECTS, the pair whose union adds the least area is
+// merged. See markDirty() and takeDirtyRects().
+static short dirty[DIRTY_RECTS][4] ;
+static int dirty_count = 0 ;
+static char dirty_tracking = DIRTY_OFF ;
+
+// Rectangles and pixels handed out by the last takeDirtyRects()
+unsigned int dirty_rects = 0, dirty_pixels = 0 ;
+
+static inline int rectArea(const short r[4]) {
+    return (r[2] - r[0]) * (r[3] - r[1]) ;
+}
+
+static inline void rectUnion(short r[4], const short s[4]) {
+    if (s[0] < r[0]) r[0] = s[0] ;
+    if (s[1] < r[1]) r[1] = s[1] ;
+    if (s[2] > r[2]) r[2] = s[2] ;
+    if (s[3] > r[3]) r[3] = s[3] ;
+}
+
+static inline int rectsOverlap(const short a[4], const short b[4]) {
+    return (a[0] < b[2]) && (b[0] < a[2]) && (a[1] < b[3]) && (b[1] < a[3]) ;
+}
+
+static void dirtyAdd(short r[4]) {
+    while (1) {
+        // Take in everything it overlaps - the union may reach more
+        for (int i=0; i<dirty_count; ) {
+            if (rectsOverlap(dirty[i], r)) {
+                rectUnion(r, dirty[i]) ;
+                for (int k=0; k<4; k++) dirty[i][k] = dirty[dirty_count - 1][k] ;
+                dirty_count-- ;
+                i = 0 ;
+            }
+            else i++ ;
+        }
+        if (dirty_count < DIRTY_RECTS) break ;
+        // Full: merge with the rectangle that grows least
+        int best = 0, growth = 0x7FFFFFFF ;
+        for (int i=0; i<dirty_count; i++) {
+            short u[4] = {r[0], r[1], r[2], r[3]} ;
+            rectUnion(u, dirty[i]) ;
+            int g = rectArea(u) - rectArea(dirty[i]) - rectArea(r) ;
+            if (g < growth) {
+                growth = g ;
+                best = i ;
+            }
+        }
+        rectUnion(r, dirty[best]) ;
+        for (int k=0; k<4; k++) dirty[best][k] = dirty[dirty_count - 1][k] ;
+        dirty_count-- ;
+    }
+    for (int k=0; k<4; k++) dirty[dirty_count][k] = r[k] ;
+    dirty_count++ ;
+}
+
+// Mark the rectangle with top-left (x,y), width w and height h (cut to
+// the screen) as needing a redraw
+void markDirty(short x, short y, short w, short h) {
+    short r[4] = {x, y, x + w, y + h} ;
+    if (r[0] < 0) r[0] = 0 ;
+    if (r[1] < 0) r[1] = 0 ;
+    if (r[2] > _width) r[2] = _width ;
+    if (r[3] > _height) r[3] = _height ;
+    if ((r[0] >= r[2]) || (r[1] >= r[3])) return ;
+    dirtyAdd(r) ;
+}
+
+// Does the rectangle overlap anything marked dirty?
+char isDirty(short x, short y, short w, short h) {
+    short r[4] = {x, y, x + w, y + h} ;
+    for (int i=0; i<dirty_count; i++) {
+        if (rectsOverlap(dirty[i], r)) return 1 ;
+    }
+    return 0 ;
+}
+
+// Copy out the dirty rectangles ({x0, y0, x1, y1}, at most DIRTY_RECTS),
+// and start over with none. Sets dirty_rects and dirty_pixels.
+short takeDirtyRects(short rects[][4]) {
+    int n = dirty_count ;
+    dirty_pixels = 0 ;
+    for (int i=0; i<n; i++) {
+        for (int k=0; k<4; k++) rects[i][k] = dirty[i][k] ;
+        dirty_pixels += rectArea(dirty[i]) ;
+    }
+    dirty_rects = n ;
+    dirty_count = 0 ;
+    return n ;
+}
+
+// What fillRect and the bitmap and image calls do about dirty rectangles:
+//  DIRTY_OFF    nothing (the default)
+//  DIRTY_DRAW   draw, and mark what they cover (cut to the clip rectangle)
+//  DIRTY_ONLY   mark what they would cover, without drawing
+void trackDirty(char mode) {
+    dirty_tracking = mode ;
+}
+
+// ==== display list ====
+
+// Drawing recorded while a list is open (see deferDraws): fillRect,
+// fillRectDither, the bitmap calls and drawPackedImage. Each is kept as
+// its arguments and its box cut to the clip rectangle, which is all it
+// can touch, so it is replayed with the box as the clip rectangle.
+#define LIST_CMDS 128           // commands kept before a flush is forced
+#define LIST_BAND_ROWS 32       // rows the screen is replayed in at a time
+#define LIST_BANDS ((_height + LIST_BAND_ROWS - 1) / LIST_BAND_ROWS)
+enum list_ops {LIST_NONE, LIST_FILL, LIST_DITHER, LIST_BITMAP, LIST_REMAP, LIST_CODE,
+               LIST_SCALED, LIST_PACKED} ;
+typedef struct {
+    unsigned char op ;          // one of list_ops
+    char rop, flip, color ;
+    char color1, level ;        // LIST_DITHER
+    short x, y ;                // the anchor or top-left (fills use the box)
+    short box[4] ;              // {x0, y0, x1, y1} it draws in
+    const void *src ;           // the Bitmap or PackedImage
+    const void *aux ;           // the BitmapCode or remap table
+    int32_t scale ;             // LIST_SCALED
+} listCmd ;
+static listCmd list_cmds[LIST_CMDS] ;
+static int list_count = 0 ;
+// Scratch for flushDisplayList's sort by band
+static short list_start[LIST_BANDS + 1], list_next[LIST_BANDS], list_order[LIST_CMDS] ;
+static short list_active[LIST_CMDS], list_band[LIST_CMDS] ;
+static char list_mode = LIST_OFF ;
+
+// The call being made, set by its entry point while a list is open - op
+// is LIST_NONE otherwise. drawHook records it.
+static listCmd list_call ;
+
+// Commands recorded, fills merged into the one before, and flushes
+unsigned int list_commands = 0, list_merged = 0, list_flushes = 0 ;
+
+// Time taken over the pixels drawn by flushes, for LIST_CHASE to judge how
+// long a band will take. It starts from a guess of 32 pixels a us.
+static uint32_t list_us_seen = 1, list_pixels_seen = 32 ;
+
+// Start recording a call. A full list is flushed here, before the
+// primitive has anything on the stack, as the flush draws with the same
+// primitives.
+static inline void listCall(char op, const void *src, const void *aux, short x, short y,
+                            char flip, char color) {
+    if (list_mode == LIST_OFF) return ;
+    if (list_count == LIST_CMDS) flushDisplayList() ;
+    list_call.op = op ;
+    list_call.src = src ;
+    list_call.aux = aux ;
+    list_call.x = x ;
+    list_call.y = y ;
+    list_call.flip = flip ;
+    list_call.color = color ;
+}
+
+// Can fill c take in the next one, r, as one rectangle? They must be the
+// same fill and share a whole edge.
+static int listMerges(const listCmd *c, const listCmd *r) {
+    if ((c->op != r->op) || ((c->op != LIST_FILL) && (c->op != LIST_DITHER))) return 0 ;
+    if ((c->rop != r->rop) || (c->color != r->color)) return 0 ;
+    if ((c->op == LIST_DITHER) && ((c->color1 != r->color1) || (c->level != r->level))) return 0 ;
+    if ((c->box[1] == r->box[1]) && (c->box[3] == r->box[3])) {
+        return (c->box[2] == r->box[0]) || (r->box[2] == c->box[0]) ;
+    }
+    if ((c->box[0] == r->box[0]) && (c->box[2] == r->box[2])) {
+        return (c->box[3] == r->box[1]) || (r->box[3] == c->box[1]) ;
+    }
+    return 0 ;
+}
+
+// Record list_call with its box. Dirty rectangles are marked now - the
+// replay doesn't track.
+static int listHook(int x0, int y0, int x1, int y1) {
+    if ((x0 >= x1) || (y0 >= y1)) return 0 ;
+    if (dirty_tracking != DIRTY_OFF) {
+        short r[4] = {x0, y0, x1, y1} ;
+        dirtyAdd(r) ;
+        if (dirty_tracking == DIRTY_ONLY) return 0 ;
+    }
+    listCmd c = list_call ;
+    c.rop = rop ;
+    c.box[0] = x0 ;
+    c.box[1] = y0 ;
+    c.box[2] = x1 ;
+    c.box[3] = y1 ;
+    if ((list_count > 0) && listMerges(&list_cmds[list_count - 1], &c)) {
+        rectUnion(list_cmds[list_count - 1].box, c.box) ;
+        list_merged++ ;
+        return 0 ;
+    }
+    list_cmds[list_count++] = c ;
+    list_commands++ ;
+    return 0 ;
+}
+
+// Scanline the beam is on, the vertical blank being lines 480 to 523.
+// A visible line is the one the pixel DMA is sending. In the blank the
+// DMA waits at the top of the array, so the vsync program says which
+// part it is, and the last line of that part is returned - anything
+// waiting on it waits a little long. -1 before initVGA().
+short beamLine() {
+    if (vga_chan < 0) return -1 ;
+    uint pc = pio_sm_get_pc(vga_pio, vga_vsync_sm) - vga_vsync_offset ;
+    if (pc >= VSYNC_BACK_PC) return VGA_LINES - 1 ;
+    if (pc >= VSYNC_SYNC_PC) return _height + VGA_FRONT_PORCH + VGA_SYNC - 1 ;
+    if (pc >= VSYNC_FRONT_PC) return _height + VGA_FRONT_PORCH - 1 ;
+    uint32_t offset = dma_hw->ch[vga_chan].read_addr - (uint32_t)(uintptr_t)vga_data_array ;
+    if (offset >= TXCOUNT) return _height - 1 ;
+    return offset / ROWBYTES ;
+}
+
+// Wait until rows y0..y1-1 can be drawn, taking about us, without the beam
+// reaching them: it is past them or far enough above them
+static void listChase(int y0, int y1, uint32_t us) {
+    // Lines it takes, at most all but the band's own and the front porch
+    // (beamLine gives the front porch as its last line) - the beam must be
+    // out of the band all the same
+    uint32_t need = (us / VGA_LINE_US) + 1 ;
+    if (need > VGA_LINES - (y1 - y0) - VGA_FRONT_PORCH) need = VGA_LINES - (y1 - y0) - VGA_FRONT_PORCH ;
+    while (1) {
+        int line = beamLine() ;
+        if (line < 0) return ;
+        if (((line < y0) || (line >= y1)) && ((uint32_t)((y0 - line + VGA_LINES) % VGA_LINES) > need)) return ;
+    }
+}
+
+// Carry out a recorded command, as far as the clip rectangle
+static void listRun(const listCmd *c) {
+    switch (c->op) {
+    case LIST_FILL:
+      fillRect(c->box[0], c->box[1], c->box[2] - c->box[0], c->box[3] - c->box[1], c->color) ;
+      break ;
+    case LIST_DITHER:
+      fillRectDither(c->box[0], c->box[1], c->box[2] - c->box[0], c->box[3] - c->box[1],
+                     c->color, c->color1, c->level) ;
+      break ;
+    case LIST_BITMAP:
+      drawBitmap(c->src, c->x, c->y, c->flip, c->color) ;
+      break ;
+    case LIST_REMAP:
+      drawBitmapRemap(c->src, c->x, c->y, c->flip, c->color, c->aux) ;
+      break ;
+    case LIST_CODE:
+      drawBitmapCode(c->src, c->aux, c->x, c->y, c->flip, c->color) ;
+      break ;
+    case LIST_SCALED:
+      drawBitmapScaled(c->src, c->x, c->y, c->flip, c->color, c->scale) ;
+      break ;
+    case LIST_PACKED:
+      drawPackedImage(c->src, c->x, c->y) ;
+      break ;
+    }
+}
+
+void flushDisplayList() {
+/* Carry out the recorded drawing and empty the list. The commands are
+ * bucketed by the band of LIST_BAND_ROWS rows they start in, and the
+ * screen is drawn a band at a time from the top: every command reaching
+ * the band, in the order recorded, clipped to it. So each part of the
+ * screen is finished in one pass and overlapping drawing still stacks the
+ * way it was called. With LIST_CHASE, a band is only started when the
+ * beam is past it, or far enough above it to stay out of it for as long as
+ * the band should take - judged from its pixels and the time pixels have
+ * taken so far - so the beam shows a band all old or all new.
+ * A compiled bitmap (drawBitmapCode) cut by a band edge is drawn by
+ * drawBitmap, as the code can't clip.
+ */
+    if (list_count == 0) return ;
+    short cx0 = clip_x0, cy0 = clip_y0, cx1 = clip_x1, cy1 = clip_y1 ;
+    char saved_rop = rop, saved_mode = list_mode, saved_tracking = dirty_tracking ;
+    list_mode = LIST_OFF ;
+    dirty_tracking = DIRTY_OFF ;
+
+    // Commands by starting band, each band's in the order recorded
+    short *start = list_start, *next = list_next, *order = list_order ;
+    for (int b=0; b<=LIST_BANDS; b++) start[b] = 0 ;
+    for (int i=0; i<list_count; i++) start[(list_cmds[i].box[1] / LIST_BAND_ROWS) + 1]++ ;
+    for (int b=0; b<LIST_BANDS; b++) {
+        start[b + 1] += start[b] ;
+        next[b] = start[b] ;
+    }
+    for (int i=0; i<list_count; i++) order[next[list_cmds[i].box[1] / LIST_BAND_ROWS]++] = i ;
+
+    // The ones still reaching down from bands above, merged with the ones
+    // starting here, again in the order recorded
+    short *active = list_active, *band = list_band ;
+    int nactive = 0 ;
+    for (int b=0; b<LIST_BANDS; b++) {
+        int n = 0, i = 0, j = start[b] ;
+        while ((i < nactive) || (j < start[b + 1])) {
+            if ((j == start[b + 1]) || ((i < nactive) && (active[i] < order[j]))) band[n++] = active[i++] ;
+            else band[n++] = order[j++] ;
+        }
+        nactive = 0 ;
+        if (n == 0) continue ;
+        int y0 = b * LIST_BAND_ROWS, y1 = y0 + LIST_BAND_ROWS ;
+        uint32_t pixels = 0 ;
+        for (int k=0; k<n; k++) {
+            const short *box = list_cmds[band[k]].box ;
+            pixels += (box[2] - box[0]) * (((box[3] < y1) ? box[3] : y1) - ((box[1] > y0) ? box[1] : y0)) ;
+        }
+        if (saved_mode == LIST_CHASE) {
+            listChase(y0, y1, (uint32_t)(((uint64_t)pixels * list_us_seen) / list_pixels_seen)) ;
+        }
+        uint32_t t = time_us_32() ;
+        for (int k=0; k<n; k++) {
+            const listCmd *c = &list_cmds[band[k]] ;
+            clip_x0 = c->box[0] ;
+            clip_x1 = c->box[2] ;
+            clip_y0 = (c->box[1] > y0) ? c->box[1] : y0 ;
+            clip_y1 = (c->box[3] < y1) ? c->box[3] : y1 ;
+            if (c->rop != rop) setRasterOp(c->rop) ;
+            listRun(c) ;
+            if (c->box[3] > y1) active[nactive++] = band[k] ;
+        }
+        list_us_seen += time_us_32() - t ;
+        list_pixels_seen += pixels ;
+        // Weigh recent bands most
+        if (list_pixels_seen > (1u << 20)) {
+            list_us_seen = (list_us_seen >> 1) + 1 ;
+            list_pixels_seen >>= 1 ;
+        }
+    }
 
+    list_count = 0 ;
+    list_flushes++ ;
+    clip_x0 = cx0 ;
+    clip_y0 = cy0 ;
+    clip_x1 = cx1 ;
+    clip_y1 = cy1 ;
+    setRasterOp(saved_rop) ;
+    list_mode = saved_mode ;
+    dirty_tracking = saved_tracking ;
+}
+
+// How fillRect, fillRectDither, the bitmap calls and drawPackedImage are
+// carried out:
+//  LIST_OFF     drawn at once (the default); an open list is flushed
+//  LIST_DEFER   recorded, and drawn by flushDisplayList() in scanline
+//               order. The copies (copyRect, the buffer copies and so the
+//               save-under calls, and packRect) flush first; any other
+//               drawing is done at once, out of turn, so flush before it.
+//               The clip rectangle and raster op are taken at the call,
+//               but what it points at (bitmap, remap table, image) is read
+//               at the flush. Fills sharing an edge with the one before
+//               become one.
+//  LIST_CHASE   LIST_DEFER, and the flush waits for the beam where it
+//               would run into it (see flushDisplayList)
+void deferDraws(char mode) {
+    if (mode == LIST_OFF) flushDisplayList() ;
+    list_mode = mode ;
+}
+
+// Called by the tracked primitives with their clipped box; says whether
+// to go on and draw. A call being recorded to the display list isn't.
+static inline int drawHook(int x0, int y0, int x1, int y1) {
+    if (list_call.op != LIST_NONE) return listHook(x0, y0, x1, y1) ;
+    if (dirty_tracking == DIRTY_OFF) return 1 ;
+    if ((x0 < x1) && (y0 < y1)) {
+        short r[4] = {x0, y0, x1, y1} ;
+        dirtyAdd(r) ;
+    }
+    return dirty_tracking == DIRTY_DRAW ;
+}
+
+// Nibble masks for one pixel of color c under the current raster op
+static inline unsigned char ropKeep(char color) {
+    return ((color & rop_keep_and) ^ rop_keep_xor) & 15 ;
+}
+
+static inline unsigned char ropFlip(char color) {
+    return color & rop_flip_and & 15 ;
+}
+
+// Write a pixel that is already known to be inside the clip rectangle.
+// Inner loops use this once their primitive has been clipped.
+static inline void setPixel(short x, short y, char color) {
     // Which pixel is it?
     int pixel = ((640 * y) + x) ;
 
     // Is this pixel stored in the first 4 bits
     // of the vga data array index, or the second
-    // 4 bits? Check, then mask.
+    // 4 bits? Check, then mask (and apply the raster op - for ROP_COPY
+    // keep is 0 and flip is the color).
+    unsigned char keep = ropKeep(color), flip = ropFlip(color) ;
     if (pixel & 1) {
-        vga_data_array[pixel>>1] = (vga_data_array[pixel>>1] & TOPMASK) | (color << 4) ;
+        vga_data_array[pixel>>1] = (vga_data_array[pixel>>1] & (TOPMASK | (keep << 4))) ^ (flip << 4) ;
+    }
+    else {
+        vga_data_array[pixel>>1] = (vga_data_array[pixel>>1] & (BOTTOMMASK | keep)) ^ flip ;
+    }
+}
+
+// A function for drawing a pixel with a specified color.
+// Note that because information is passed to the PIO state machines through
+// a DMA channel, we only need to modify the contents of the array and the
+// pixels will be automatically updated on the screen.
+void drawPixel(short x, short y, char color) {
+    // Pixels outside the clip rectangle are dropped (one unsigned compare
+    // per axis covers both edges)
+    if (((unsigned)(x - clip_x0) >= (unsigned)(clip_x1 - clip_x0)) ||
+        ((unsigned)(y - clip_y0) >= (unsigned)(clip_y1 - clip_y0))) return ;
+    setPixel(x, y, color) ;
+}
+
+// Pick how a primitive covering (x0,y0)-(x1,y1) inclusive plots its pixels:
+// NULL if it is entirely outside the clip rectangle, the unchecked setPixel
+// if it is entirely inside, and the checking drawPixel only when it
+// straddles an edge.
+static plotter clipPlotter(int x0, int y0, int x1, int y1) {
+    if ((x1 < clip_x0) || (x0 >= clip_x1) || (y1 < clip_y0) || (y0 >= clip_y1)) return NULL ;
+    if ((x0 >= clip_x0) && (x1 < clip_x1) && (y0 >= clip_y0) && (y1 < clip_y1)) return setPixel ;
+    return drawPixel ;
+}
+
+// What the filled shapes paint with on rows with y&3 of 0..3: the 8-pixel
+// color word run through the raster op, as the keep and flip masks of
+// (old & keep) ^ flip. A solid color is the same on every row. The dithered
+// fills mix two colors with the 4x4 Bayer matrix, which repeats every 4
+// pixels - that divides the 8 pixels of a word, so one word per row is
+// right at any x and a dithered span costs exactly what a solid one does.
+typedef struct {
+    uint32_t keep[4] ;
+    uint32_t flip[4] ;
+} fillPattern ;
+
+static inline void patternRow(fillPattern *pat, int r, uint32_t cw) {
+    pat->keep[r] = (cw & rop_keep_and) ^ rop_keep_xor ;
+    pat->flip[r] = cw & rop_flip_and ;
+}
+
+static inline void solidPattern(fillPattern *pat, char color) {
+    uint32_t cw = swar_color(color) ;
+    for (int r=0; r<4; r++) patternRow(pat, r, cw) ;
+}
+
+// 4x4 Bayer matrix - a pixel takes the second color when its entry is
+// below the level, so level n (0..16) shows it on n of every 16 pixels
+static const unsigned char bayer4[4][4] = {
+    { 0,  8,  2, 10},
+    {12,  4, 14,  6},
+    { 3, 11,  1,  9},
+    {15,  7, 13,  5},
+} ;
+
+static void ditherPattern(fillPattern *pat, char color0, char color1, char level) {
+    for (int r=0; r<4; r++) {
+        uint32_t w = 0 ;
+        for (int i=7; i>=0; i--) {
+            w = (w << 4) | ((bayer4[r][i & 3] < level) ? (color1 & 15) : (color0 & 15)) ;
+        }
+        patternRow(pat, r, w) ;
+    }
+}
+
+// Fill pixels x0 through x1-1 of row y. No range checks - callers clip first.
+// The word-wide kernels mask the partly covered words at each end and
+// handle 8 pixels at a time in between. ROP_COPY (keep = 0) only stores.
+static inline void fillSpan(short x0, short x1, short y, const fillPattern *pat) {
+    uint32_t *row = (uint32_t *)vga_data_array + (SWAR_ROWWORDS * y) ;
+    int r = y & 3 ;
+    if (pat->keep[r] == 0) {
+        swar_fill(row, x0, x1, pat->flip[r]) ;
     }
     else {
-        vga_data_array[pixel>>1] = (vga_data_array[pixel>>1] & BOTTOMMASK) | (color) ;
+        swar_fill_rop(row, x0, x1, pat->keep[r], pat->flip[r]) ;
     }
 }
 
 void drawVLine(short x, short y, short h, char color) {
-    for (short i=y; i<(y+h); i++) {
-        drawPixel(x, i, color) ;
+    int y0 = y, y1 = y + h ;
+    if ((x < clip_x0) || (x >= clip_x1)) return ;
+    if (y0 < clip_y0) y0 = clip_y0 ;
+    if (y1 > clip_y1) y1 = clip_y1 ;
+    if (y0 >= y1) return ;
+
+    // Same nibble of every row, so the masks are fixed and we just step a row
+    unsigned char *p = &vga_data_array[(ROWBYTES * y0) + (x >> 1)] ;
+    unsigned char keep = ropKeep(color), flip = ropFlip(color) ;
+    if (x & 1) {
+        keep = TOPMASK | (keep << 4) ;
+        flip <<= 4 ;
+    }
+    else {
+        keep |= BOTTOMMASK ;
+    }
+    for (int j=y0; j<y1; j++, p+=ROWBYTES) {
+        *p = (*p & keep) ^ flip ;
     }
 }
 
+// Fill pixels x0 through x1-1 of row y, clipped to the clip rectangle
+static void clipSpan(int x0, int x1, int y, const fillPattern *pat) {
+    if ((y < clip_y0) || (y >= clip_y1)) return ;
+    if (x0 < clip_x0) x0 = clip_x0 ;
+    if (x1 > clip_x1) x1 = clip_x1 ;
+    if (x0 >= x1) return ;
+    fillSpan(x0, x1, y, pat) ;
+}
+
 void drawHLine(short x, short y, short w, char color) {
-    for (short i=x; i<(x+w); i++) {
-        drawPixel(i, y, color) ;
-    }
+    fillPattern pat ;
+    solidPattern(&pat, color) ;
+    clipSpan(x, x + w, y, &pat) ;
+}
+
+// Cohen-Sutherland region code of a point against the clip rectangle
+#define OUT_LEFT   1
+#define OUT_RIGHT  2
+#define OUT_TOP    4
+#define OUT_BOTTOM 8
+static inline int outCode(int x, int y) {
+    int code = 0 ;
+    if (x < clip_x0) code |= OUT_LEFT ;
+    else if (x >= clip_x1) code |= OUT_RIGHT ;
+    if (y < clip_y0) code |= OUT_TOP ;
+    else if (y >= clip_y1) code |= OUT_BOTTOM ;
+    return code ;
 }
 
 // Bresenham's algorithm - thx wikipedia and thx Bruce!
@@ -200,6 +783,10 @@ void drawLine(short x0, short y0, short x1, short y1, char color) {
  *          the top-left of the screen is 0. It increases to the bottom.
  *      color: 3-bit color value for line
  */
+      // Both ends past the same edge - nothing to draw
+      int code0 = outCode(x0, y0), code1 = outCode(x1, y1) ;
+      if (code0 & code1) return ;
+
       short steep = abs(y1 - y0) > abs(x1 - x0);
       if (steep) {
         swap(x0, y0);
@@ -211,29 +798,106 @@ void drawLine(short x0, short y0, short x1, short y1, char color) {
         swap(y0, y1);
       }
 
-      short dx, dy;
-      dx = x1 - x0;
-      dy = abs(y1 - y0);
-
-      short err = dx / 2;
-      short ystep;
-
-      if (y0 < y1) {
-        ystep = 1;
-      } else {
-        ystep = -1;
+      // From here x is the major axis and y the minor one (swapped back to
+      // screen coordinates for steep lines when we pick the loop below)
+      int dx = x1 - x0 ;
+      int dy = abs(y1 - y0) ;
+      int err = dx / 2 ;
+      int ystep = (y0 < y1) ? 1 : -1 ;
+      int y = y0 ;
+
+      // Draw steps first..last of the Bresenham walk (step i is at x0+i)
+      int first = 0, last = dx ;
+
+      if (code0 | code1) {
+        // An end point is outside, so clip the walk itself rather than each
+        // pixel. After i steps y has moved k(i) = max(0, ceil((i*dy - dx/2)/dx))
+        // times, so the steps that stay inside are a single range we can
+        // solve for exactly - the pixels drawn are the same as unclipped.
+        int u0 = steep ? clip_y0 : clip_x0, u1 = steep ? clip_y1 : clip_x1 ;
+        int v0 = steep ? clip_x0 : clip_y0, v1 = steep ? clip_x1 : clip_y1 ;
+        if (first < u0 - x0) first = u0 - x0 ;
+        if (last > u1 - 1 - x0) last = u1 - 1 - x0 ;
+
+        // Allowed number of minor steps
+        int klo = (ystep > 0) ? (v0 - y0) : (y0 - (v1 - 1)) ;
+        int khi = (ystep > 0) ? (v1 - 1 - y0) : (y0 - v0) ;
+        if (khi < 0) return ;
+        if (dy == 0) {
+          if (klo > 0) return ;
+        }
+        else {
+          // First step with k(i) >= klo, last step with k(i) <= khi
+          if (klo > 0) {
+            long long i = (((long long)(klo - 1) * dx) + err) / dy + 1 ;
+            if (i > first) first = (i > last) ? last + 1 : i ;
+          }
+          long long i = (((long long)khi * dx) + err) / dy ;
+          if (i < last) last = i ;
+        }
+        if (first > last) return ;
+
+        // Bresenham state at step first
+        if (first > 0) {
+          long long num = ((long long)first * dy) - err ;
+          int k = (num > 0) ? (int)((num + dx - 1) / dx) : 0 ;
+          err = (int)(err - ((long long)first * dy) + ((long long)k * dx)) ;
+          y = y0 + (ystep * k) ;
+        }
       }
 
-      for (; x0<=x1; x0++) {
-        if (steep) {
-          drawPixel(y0, x0, color);
-        } else {
-          drawPixel(x0, y0, color);
+      int x = x0 + first ;
+      int n = last - first + 1 ;
+      // Masks for an even (low nibble) and odd (high nibble) pixel
+      unsigned char keep = ropKeep(color), flip = ropFlip(color) ;
+      unsigned char keepLo = BOTTOMMASK | keep, flipLo = flip ;
+      unsigned char keepHi = TOPMASK | (keep << 4), flipHi = flip << 4 ;
+
+      // Walk a byte pointer and the nibble (odd) within it instead of
+      // recomputing the address of every pixel
+      if (!steep) {
+        // x-major: one pixel right per step, a row up or down on carry
+        unsigned char *p = &vga_data_array[(ROWBYTES * y) + (x >> 1)] ;
+        int odd = x & 1 ;
+        int row = ystep * ROWBYTES ;
+        while (n--) {
+          if (odd) {
+            *p = (*p & keepHi) ^ flipHi ;
+            p++ ;
+          }
+          else {
+            *p = (*p & keepLo) ^ flipLo ;
+          }
+          odd ^= 1 ;
+          err -= dy ;
+          if (err < 0) {
+            p += row ;
+            err += dx ;
+          }
         }
-        err -= dy;
-        if (err < 0) {
-          y0 += ystep;
-          err += dx;
+      }
+      else {
+        // y-major: x is the screen row and y the screen column here. One
+        // row down per step, a pixel left or right on carry
+        unsigned char *p = &vga_data_array[(ROWBYTES * x) + (y >> 1)] ;
+        int odd = y & 1 ;
+        int back = (ystep < 0) ;
+        while (n--) {
+          if (odd) {
+            *p = (*p & keepHi) ^ flipHi ;
+          }
+          else {
+            *p = (*p & keepLo) ^ flipLo ;
+          }
+          p += ROWBYTES ;
+          err -= dy ;
+          if (err < 0) {
+            // Moving right leaves the byte from an odd pixel, moving left
+            // leaves it from an even one
+            p += odd - back ;
+            odd ^= 1 ;
+            err += dx ;
+          }
         }
       }
 }
@@ -252,10 +916,15 @@ void drawRect(short x, short y, short w, short h, char color) {
  *      color:  16-bit color of the rectangle outline
  * Returns: Nothing
  */
+  // Each pixel once (the sides stop short of the corners), so the
+  // outline also comes out right with ROP_XOR
+  if ((w <= 0) || (h <= 0)) return ;
   drawHLine(x, y, w, color);
-  drawHLine(x, y+h-1, w, color);
-  drawVLine(x, y, h, color);
-  drawVLine(x+w-1, y, h, color);
+  if (h > 1) drawHLine(x, y+h-1, w, color);
+  if (h > 2) {
+    drawVLine(x, y+1, h-2, color);
+    if (w > 1) drawVLine(x+w-1, y+1, h-2, color);
+  }
 }
 
 void drawCircle(short x0, short y0, short r, char color) {
@@ -276,10 +945,17 @@ void drawCircle(short x0, short y0, short r, char color) {
   short x = 0;
   short y = r;
 
-  drawPixel(x0  , y0+r, color);
-  drawPixel(x0  , y0-r, color);
-  drawPixel(x0+r, y0  , color);
-  drawPixel(x0-r, y0  , color);
+  plotter plot = clipPlotter(x0 - r, y0 - r, x0 + r, y0 + r) ;
+  if (plot == NULL) return ;
+
+  if (r <= 0) {
+    plot(x0, y0, color);
+    return ;
+  }
+  plot(x0  , y0+r, color);
+  plot(x0  , y0-r, color);
+  plot(x0+r, y0  , color);
+  plot(x0-r, y0  , color);
 
   while (x<y) {
     if (f >= 0) {
@@ -290,15 +966,20 @@ void drawCircle(short x0, short y0, short r, char color) {
     x++;
     ddF_x += 2;
     f += ddF_x;
-
-    drawPixel(x0 + x, y0 + y, color);
-    drawPixel(x0 - x, y0 + y, color);
-    drawPixel(x0 + x, y0 - y, color);
-    drawPixel(x0 - x, y0 - y, color);
-    drawPixel(x0 + y, y0 + x, color);
-    drawPixel(x0 - y, y0 + x, color);
-    drawPixel(x0 + y, y0 - x, color);
-    drawPixel(x0 - y, y0 - x, color);
+    // Stepping past the diagonal gives the last step's pixels again
+    if (x > y) break ;
+
+    plot(x0 + x, y0 + y, color);
+    plot(x0 - x, y0 + y, color);
+    plot(x0 + x, y0 - y, color);
+    plot(x0 - x, y0 - y, color);
+    // On the diagonal both octants land on the same pixel - plot it once
+    // so ROP_XOR doesn't cancel it (same for stepping past it, above)
+    if (x == y) continue ;
+    plot(x0 + y, y0 + x, color);
+    plot(x0 - y, y0 + x, color);
+    plot(x0 + y, y0 - x, color);
+    plot(x0 - y, y0 - x, color);
   }
 }
 
@@ -310,6 +991,9 @@ void drawCircleHelper( short x0, short y0, short r, unsigned char cornername, ch
   short x     = 0;
   short y     = r;
 
+  plotter plot = clipPlotter(x0 - r, y0 - r, x0 + r, y0 + r) ;
+  if (plot == NULL) return ;
+
   while (x<y) {
     if (f >= 0) {
       y--;
@@ -319,50 +1003,64 @@ void drawCircleHelper( short x0, short y0, short r, unsigned char cornername, ch
     x++;
     ddF_x += 2;
     f     += ddF_x;
+    // Past the diagonal, and x == y, as in drawCircle (except r = 1, whose
+    // first step is already past it and has no axis pixels before it)
+    if ((x > y) && (x > 1)) break ;
     if (cornername & 0x4) {
-      drawPixel(x0 + x, y0 + y, color);
-      drawPixel(x0 + y, y0 + x, color);
+      plot(x0 + x, y0 + y, color);
+      if (x != y) plot(x0 + y, y0 + x, color);
     }
     if (cornername & 0x2) {
-      drawPixel(x0 + x, y0 - y, color);
-      drawPixel(x0 + y, y0 - x, color);
+      plot(x0 + x, y0 - y, color);
+      if (x != y) plot(x0 + y, y0 - x, color);
     }
     if (cornername & 0x8) {
-      drawPixel(x0 - y, y0 + x, color);
-      drawPixel(x0 - x, y0 + y, color);
+      if (x != y) plot(x0 - y, y0 + x, color);
+      plot(x0 - x, y0 + y, color);
     }
     if (cornername & 0x1) {
-      drawPixel(x0 - y, y0 - x, color);
-      drawPixel(x0 - x, y0 - y, color);
+      if (x != y) plot(x0 - y, y0 - x, color);
+      plot(x0 - x, y0 - y, color);
     }
   }
 }
 
-void fillCircle(short x0, short y0, short r, char color) {
-/* Draw a filled circle with center (x0,y0) and radius r, with given color
- * Parameters:
- *      x0: x-coordinate of center of circle. The top-left of the screen
- *          has x-coordinate 0 and increases to the right
- *      y0: y-coordinate of center of circle. The top-left of the screen
- *          has y-coordinate 0 and increases to the bottom
- *      r:  radius of circle
- *      color: 16-bit color value for the circle
- * Returns: Nothing
- */
-  drawVLine(x0, y0-r, 2*r+1, color);
-  fillCircleHelper(x0, y0, r, 3, 0, color);
-}
-
-void fillCircleHelper(short x0, short y0, short r, unsigned char cornername, short delta, char color) {
-// Helper function for drawing filled circles
+// Horizontal-span fill shared by the filled circles and rounded rectangles.
+// Think of a circle of radius r cut through its centre both ways, with the
+// right half moved to column xr (the left half stays at xl) and the bottom
+// half moved to row yb (the top half stays at yt). Rows yt..yb run the full
+// width, and row d above yt / below yb runs from xl-hw to xr+hw, where hw is
+// the circle's half width d rows from its centre. Spans are cut to columns
+// lo..hi, which is how the half-circle helper keeps one side.
+// The midpoint walk produces each row exactly once: rows d = x of the
+// current step get half width y, and row d = y gets its final (widest) x
+// just before y moves in.
+static void fillCircleSpans(short xl, short xr, short yt, short yb, short r,
+                            int lo, int hi, const fillPattern *pat) {
   short f     = 1 - r;
   short ddF_x = 1;
   short ddF_y = -2 * r;
   short x     = 0;
   short y     = r;
 
+  int a = (xl - r < lo) ? lo : xl - r ;
+  int b = (xr + r > hi) ? hi : xr + r ;
+  if (a <= b) {
+    for (int j=yt; j<=yb; j++) {
+      clipSpan(a, b + 1, j, pat) ;
+    }
+  }
+
   while (x<y) {
     if (f >= 0) {
+      if (y > x) {
+        a = (xl - x < lo) ? lo : xl - x ;
+        b = (xr + x > hi) ? hi : xr + x ;
+        if (a <= b) {
+          clipSpan(a, b + 1, yt - y, pat) ;
+          clipSpan(a, b + 1, yb + y, pat) ;
+        }
+      }
       y--;
       ddF_y += 2;
       f     += ddF_y;
@@ -371,17 +1069,58 @@ void fillCircleHelper(short x0, short y0, short r, unsigned char cornername, sho
     ddF_x += 2;
     f     += ddF_x;
 
-    if (cornername & 0x1) {
-      drawVLine(x0+x, y0-y, 2*y+1+delta, color);
-      drawVLine(x0+y, y0-x, 2*x+1+delta, color);
-    }
-    if (cornername & 0x2) {
-      drawVLine(x0-x, y0-y, 2*y+1+delta, color);
-      drawVLine(x0-y, y0-x, 2*x+1+delta, color);
+    if (x <= y) {
+      a = (xl - y < lo) ? lo : xl - y ;
+      b = (xr + y > hi) ? hi : xr + y ;
+      if (a <= b) {
+        clipSpan(a, b + 1, yt - x, pat) ;
+        clipSpan(a, b + 1, yb + x, pat) ;
+      }
     }
   }
 }
 
+void fillCircle(short x0, short y0, short r, char color) {
+/* Draw a filled circle with center (x0,y0) and radius r, with given color
+ * Parameters:
+ *      x0: x-coordinate of center of circle. The top-left of the screen
+ *          has x-coordinate 0 and increases to the right
+ *      y0: y-coordinate of center of circle. The top-left of the screen
+ *          has y-coordinate 0 and increases to the bottom
+ *      r:  radius of circle
+ *      color: 16-bit color value for the circle
+ * Returns: Nothing
+ */
+  // One span per scanline
+  fillPattern pat ;
+  solidPattern(&pat, color) ;
+  fillCircleSpans(x0, x0, y0, y0, r, clip_x0, clip_x1 - 1, &pat);
+}
+
+void fillCircleDither(short x0, short y0, short r, char color0, char color1, char level) {
+/* fillCircle mixing color0 and color1 with an ordered dither; level 0..16
+ * is how many of every 16 pixels get color1 (0 = all color0, 16 = all
+ * color1). The pattern is tied to the screen, not the circle.
+ */
+  fillPattern pat ;
+  ditherPattern(&pat, color0, color1, level) ;
+  fillCircleSpans(x0, x0, y0, y0, r, clip_x0, clip_x1 - 1, &pat);
+}
+
+void fillCircleHelper(short x0, short y0, short r, unsigned char cornername, short delta, char color) {
+// Helper function for drawing filled circles
+// Fills the right (cornername bit 0) and/or left (bit 1) half of a circle,
+// not including the centre column, stretched down by delta rows.
+  fillPattern pat ;
+  solidPattern(&pat, color) ;
+  if (cornername & 0x1) {
+    fillCircleSpans(x0, x0, y0, y0+delta, r, x0+1, clip_x1 - 1, &pat);
+  }
+  if (cornername & 0x2) {
+    fillCircleSpans(x0, x0, y0, y0+delta, r, clip_x0, x0-1, &pat);
+  }
+}
+
 // Draw a rounded rectangle
 void drawRoundRect(short x, short y, short w, short h, short r, char color) {
 /* Draw a rounded rectangle outline with top left vertex (x,y), width w,
@@ -396,29 +1135,52 @@ void drawRoundRect(short x, short y, short w, short h, short r, char color) {
  *      color:  16-bit color of the rectangle outline
  * Returns: Nothing
  */
+  // Square corners are a plain rectangle (which keeps its corner pixels
+  // from being drawn twice)
+  if (r <= 0) {
+    drawRect(x, y, w, h, color);
+    return ;
+  }
   // smarter version
   drawHLine(x+r  , y    , w-2*r, color); // Top
   drawHLine(x+r  , y+h-1, w-2*r, color); // Bottom
   drawVLine(x    , y+r  , h-2*r, color); // Left
   drawVLine(x+w-1, y+r  , h-2*r, color); // Right
-  // draw four corners
-  drawCircleHelper(x+r    , y+r    , r, 1, color);
-  drawCircleHelper(x+w-r-1, y+r    , r, 2, color);
-  drawCircleHelper(x+w-r-1, y+h-r-1, r, 4, color);
-  drawCircleHelper(x+r    , y+h-r-1, r, 8, color);
+  // draw four corners (with r = 1 they would only redraw the line ends)
+  if (r > 1) {
+    drawCircleHelper(x+r    , y+r    , r, 1, color);
+    drawCircleHelper(x+w-r-1, y+r    , r, 2, color);
+    drawCircleHelper(x+w-r-1, y+h-r-1, r, 4, color);
+    drawCircleHelper(x+r    , y+h-r-1, r, 8, color);
+  }
 }
 
 // Fill a rounded rectangle
 void fillRoundRect(short x, short y, short w, short h, short r, char color) {
-  // smarter version
-  fillRect(x+r, y, w-2*r, h, color);
-
-  // draw four corners
-  fillCircleHelper(x+w-r-1, y+r, r, 1, h-2*r-1, color);
-  fillCircleHelper(x+r    , y+r, r, 2, h-2*r-1, color);
+  // Full-width middle rows plus the two rounded ends, one span per scanline
+  fillPattern pat ;
+  solidPattern(&pat, color) ;
+  fillCircleSpans(x+r, x+w-r-1, y+r, y+h-r-1, r, clip_x0, clip_x1 - 1, &pat);
 }
 
 
+// Rectangle fill shared by fillRect and fillRectDither
+static void fillRectPattern(short x, short y, short w, short h, const fillPattern *pat) {
+  // Clip once for the whole rectangle (anything outside the clip rectangle
+  // is dropped), then fill row by row with the span writer
+  int x0 = x, y0 = y, x1 = x + w, y1 = y + h ;
+  if (x0 < clip_x0) x0 = clip_x0 ;
+  if (y0 < clip_y0) y0 = clip_y0 ;
+  if (x1 > clip_x1) x1 = clip_x1 ;
+  if (y1 > clip_y1) y1 = clip_y1 ;
+  if ((x0 >= x1) || (y0 >= y1)) return ;
+  if (!drawHook(x0, y0, x1, y1)) return ;
+
+  for (int j=y0; j<y1; j++) {
+    fillSpan(x0, x1, j, pat) ;
+  }
+}
+
 // fill a rectangle
 void fillRect(short x, short y, short w, short h, char color) {
 /* Draw a filled rectangle with starting top-left vertex (x,y),
@@ -433,28 +1195,973 @@ void fillRect(short x, short y, short w, short h, char color) {
  *      color:  3-bit color value
  * Returns:     Nothing
  */
+  fillPattern pat ;
+  solidPattern(&pat, color) ;
+  listCall(LIST_FILL, NULL, NULL, x, y, 0, color) ;
+  fillRectPattern(x, y, w, h, &pat) ;
+  list_call.op = LIST_NONE ;
+}
 
-  // rudimentary clipping (drawChar w/big text requires this)
-  // if((x >= _width) || (y >= _height)) return;
-  // if((x + w - 1) >= _width)  w = _width  - x;
-  // if((y + h - 1) >= _height) h = _height - y;
+// fill a rectangle with a two-color ordered dither
+void fillRectDither(short x, short y, short w, short h, char color0, char color1, char level) {
+/* Same as fillRect, but the pixels mix color0 and color1 in a 4x4 Bayer
+ * pattern: level 0..16 is how many of every 16 pixels get color1, so
+ * stepping level across a few bands gives a pseudo-gradient. The pattern
+ * is tied to screen coordinates, so neighbouring fills line up.
+ */
+  fillPattern pat ;
+  ditherPattern(&pat, color0, color1, level) ;
+  listCall(LIST_DITHER, NULL, NULL, x, y, 0, color0) ;
+  list_call.color1 = color1 ;
+  list_call.level = level ;
+  fillRectPattern(x, y, w, h, &pat) ;
+  list_call.op = LIST_NONE ;
+}
 
-  // tft_setAddrWindow(x, y, x+w-1, y+h-1);
+// ==== filled polygons ====
+// Vertices sit on pixel corners: row y is sampled along the line y, and a
+// pixel x is inside when x lies at or right of the left edge and strictly
+// left of the right edge. Each row covers rows ytop .. ybottom-1. So a
+// rectangle given as 4 corners fills the same pixels as fillRect, and two
+// polygons that share an edge never draw the same pixel twice (or leave a
+// gap between them).
+
+// One polygon edge walked down the screen, one row per step. x is 16.16
+// fixed point. The part of the slope below 1/65536 is carried in err/rem
+// (like Bresenham's error term), so x is exactly floor(true x * 65536) on
+// every row and the fill rule above holds without rounding slop.
+typedef struct {
+    int x, step ;     // 16.16
+    int err, rem, dy ;
+} edgeWalk ;
+
+// Floor division for a positive divisor
+static inline long long floorDiv(long long a, int b) {
+    long long q = a / b ;
+    return ((a % b) < 0) ? q - 1 : q ;
+}
 
-  for(int i=x; i<(x+w); i++) {
-    for(int j=y; j<(y+h); j++) {
-        drawPixel(i, j, color);
+// Start walking the edge (xa,ya)-(xb,yb), ya < yb, at row y
+static void edgeStart(edgeWalk *e, int xa, int ya, int xb, int yb, int y) {
+    long long num = (long long)(xb - xa) << 16 ;
+    long long t = (long long)(y - ya) * num ;
+    long long q = floorDiv(t, yb - ya) ;
+    e->dy = yb - ya ;
+    e->x = (xa * 65536) + (int)q ;
+    e->err = (int)(t - (q * e->dy)) ;
+    if (e->dy > 1) {
+        q = floorDiv(num, e->dy) ;
+        e->step = (int)q ;
+        e->rem = (int)(num - (q * e->dy)) ;
+    }
+    else {
+        // Only one row, never stepped
+        e->step = 0 ;
+        e->rem = 0 ;
+    }
+}
+
+static inline void edgeStep(edgeWalk *e) {
+    e->x += e->step ;
+    e->err += e->rem ;
+    if (e->err >= e->dy) {
+        e->x++ ;
+        e->err -= e->dy ;
+    }
+}
+
+// First pixel at or right of the edge
+static inline int edgeCeil(const edgeWalk *e) {
+    return (e->x + 0xFFFF) >> 16 ;
+}
+
+// Polygon fill shared by the solid and dithered versions
+static void fillPolyPattern(const short pts[][2], short n, const fillPattern *pat) {
+  if (n < 3) return ;
+
+  // Top vertex, and the rows covered
+  int top = 0, ymin = pts[0][1], ymax = pts[0][1] ;
+  for (int i=1; i<n; i++) {
+    if (pts[i][1] < ymin) {
+      ymin = pts[i][1] ;
+      top = i ;
+    }
+    if (pts[i][1] > ymax) ymax = pts[i][1] ;
+  }
+  int y0 = (ymin > clip_y0) ? ymin : clip_y0 ;
+  int y1 = (ymax < clip_y1) ? ymax : clip_y1 ;
+  if (y0 >= y1) return ;
+
+  // Walk down both sides from the top vertex - side a backwards through the
+  // vertex list, side b forwards. a0/b0 is the current edge's top vertex and
+  // a1/b1 its bottom one.
+  int a0 = top, a1 = top, b0 = top, b1 = top ;
+  edgeWalk ea, eb ;
+  for (int y=y0; y<y1; y++) {
+    if (pts[a1][1] <= y) {
+      while (pts[a1][1] <= y) {
+        a0 = a1 ;
+        a1 = (a1 == 0) ? n - 1 : a1 - 1 ;
+      }
+      edgeStart(&ea, pts[a0][0], pts[a0][1], pts[a1][0], pts[a1][1], y) ;
+    }
+    if (pts[b1][1] <= y) {
+      while (pts[b1][1] <= y) {
+        b0 = b1 ;
+        b1 = (b1 == n - 1) ? 0 : b1 + 1 ;
+      }
+      edgeStart(&eb, pts[b0][0], pts[b0][1], pts[b1][0], pts[b1][1], y) ;
+    }
+
+    int xl = edgeCeil(&ea), xr = edgeCeil(&eb) ;
+    if (xl > xr) {
+      int t = xl ;
+      xl = xr ;
+      xr = t ;
+    }
+    if (xl < clip_x0) xl = clip_x0 ;
+    if (xr > clip_x1) xr = clip_x1 ;
+    if (xl < xr) fillSpan(xl, xr, y, pat) ;
+
+    edgeStep(&ea) ;
+    edgeStep(&eb) ;
+  }
+}
+
+void fillConvexPoly(const short pts[][2], short n, char color) {
+/* Draw a filled convex polygon with given color
+ * Parameters:
+ *      pts: the n vertices as {x, y} pairs, in order around the polygon
+ *           (either direction)
+ *      n: number of vertices (at least 3)
+ *      color: 4-bit color value
+ * Returns:     Nothing
+ * Non-convex outlines are not supported (they are filled, but not right)
+ */
+  fillPattern pat ;
+  solidPattern(&pat, color) ;
+  fillPolyPattern(pts, n, &pat) ;
+}
+
+void fillTriangle(short x0, short y0, short x1, short y1, short x2, short y2, char color) {
+/* Draw a filled triangle with vertices (x0,y0), (x1,y1) and (x2,y2) with
+ * given color (same fill rule as fillConvexPoly)
+ */
+  const short pts[3][2] = {{x0, y0}, {x1, y1}, {x2, y2}} ;
+  fillConvexPoly(pts, 3, color) ;
+}
+
+// Dithered versions - color0 and color1 mixed at level 0..16, as in
+// fillRectDither
+void fillConvexPolyDither(const short pts[][2], short n, char color0, char color1, char level) {
+  fillPattern pat ;
+  ditherPattern(&pat, color0, color1, level) ;
+  fillPolyPattern(pts, n, &pat) ;
+}
+
+void fillTriangleDither(short x0, short y0, short x1, short y1, short x2, short y2,
+                        char color0, char color1, char level) {
+  const short pts[3][2] = {{x0, y0}, {x1, y1}, {x2, y2}} ;
+  fillConvexPolyDither(pts, 3, color0, color1, level) ;
+}
+
+// ==== block copies ====
+
+// Cut a w x h copy from (sx,sy) to (dx,dy) down to the part whose source
+// lies in [0,sw) x [0,sh) and whose destination lies in [dx0,dx1) x
+// [dy0,dy1). Returns 0 if nothing is left.
+static int clipCopy(int *sx, int *sy, int *dx, int *dy, int *w, int *h,
+                    int sw, int sh, int dx0, int dy0, int dx1, int dy1) {
+  int t ;
+  t = (-*sx > dx0 - *dx) ? -*sx : dx0 - *dx ;
+  if (t > 0) {
+    *sx += t ;
+    *dx += t ;
+    *w -= t ;
+  }
+  t = (-*sy > dy0 - *dy) ? -*sy : dy0 - *dy ;
+  if (t > 0) {
+    *sy += t ;
+    *dy += t ;
+    *h -= t ;
+  }
+  if (*sx + *w > sw) *w = sw - *sx ;
+  if (*dx + *w > dx1) *w = dx1 - *dx ;
+  if (*sy + *h > sh) *h = sh - *sy ;
+  if (*dy + *h > dy1) *h = dy1 - *dy ;
+  return (*w > 0) && (*h > 0) ;
+}
+
+void copyRect(short src_x, short src_y, short w, short h, short dst_x, short dst_y) {
+/* Copy the w x h pixels at (src_x,src_y) to (dst_x,dst_y) on the screen.
+ * The two rectangles may overlap (like memmove). Source pixels off the
+ * screen are not copied, and the destination is clipped to the clip
+ * rectangle.
+ */
+  flushDisplayList() ;
+  int sx = src_x, sy = src_y, dx = dst_x, dy = dst_y, cw = w, ch = h ;
+  if (!clipCopy(&sx, &sy, &dx, &dy, &cw, &ch, _width, _height,
+                clip_x0, clip_y0, clip_x1, clip_y1)) return ;
+
+  // Moving down, go bottom up so no source row is written before it's read
+  int j = 0, jstep = 1 ;
+  if (dy > sy) {
+    j = ch - 1 ;
+    jstep = -1 ;
+  }
+  uint32_t *fb = (uint32_t *)vga_data_array ;
+  for (; (j >= 0) && (j < ch); j += jstep) {
+    uint32_t *src = fb + (SWAR_ROWWORDS * (sy + j)) ;
+    uint32_t *dst = fb + (SWAR_ROWWORDS * (dy + j)) ;
+    if (dy == sy) {
+      // Same row - take the source words out first
+      uint32_t line[SWAR_ROWWORDS] ;
+      int k0 = sx >> 3, nw = ((sx + cw - 1) >> 3) - k0 + 1 ;
+      for (int k=0; k<nw; k++) line[k] = src[k0 + k] ;
+      swar_copy(dst, dx, cw, line, sx & 7, nw) ;
+    }
+    else {
+      swar_copy(dst, dx, cw, src, sx, SWAR_ROWWORDS) ;
+    }
+  }
+}
+
+void copyRectToBuffer(short x, short y, short w, short h, uint32_t *buf) {
+/* Save the w x h pixels at (x,y) into buf, packed like the screen: 4 bits
+ * per pixel, low nibble first, each row padded to a whole word (see
+ * VGA_BUFFER_WORDS). Parts of the rectangle off the screen are left as
+ * they were in buf.
+ */
+  flushDisplayList() ;
+  int sx = x, sy = y, bx = 0, by = 0, cw = w, ch = h ;
+  int stride = (w + 7) >> 3 ;
+  if (!clipCopy(&sx, &sy, &bx, &by, &cw, &ch, _width, _height, 0, 0, w, h)) return ;
+  uint32_t *src = (uint32_t *)vga_data_array + (SWAR_ROWWORDS * sy) ;
+  uint32_t *dst = buf + (stride * by) ;
+  for (int j=0; j<ch; j++, src+=SWAR_ROWWORDS, dst+=stride) {
+    swar_copy(dst, bx, cw, src, sx, SWAR_ROWWORDS) ;
+  }
+}
+
+void copyRectFromBuffer(const uint32_t *buf, short w, short h, short x, short y) {
+/* Put a w x h buffer filled by copyRectToBuffer back on the screen with its
+ * top-left at (x,y), clipped to the clip rectangle.
+ */
+  flushDisplayList() ;
+  int bx = 0, by = 0, dx = x, dy = y, cw = w, ch = h ;
+  int stride = (w + 7) >> 3 ;
+  if (!clipCopy(&bx, &by, &dx, &dy, &cw, &ch, w, h,
+                clip_x0, clip_y0, clip_x1, clip_y1)) return ;
+  const uint32_t *src = buf + (stride * by) ;
+  uint32_t *dst = (uint32_t *)vga_data_array + (SWAR_ROWWORDS * dy) ;
+  for (int j=0; j<ch; j++, src+=stride, dst+=SWAR_ROWWORDS) {
+    swar_copy(dst, dx, cw, src, bx, stride) ;
+  }
+}
+
+// ==== save-under ====
+
+// Copies of the screen under sprites (see saveUnder), in a fixed pool of
+// words: each slot holds a copyRectToBuffer buffer at offset, slots are in
+// no order and a new one goes in the first gap big enough.
+#define SAVE_UNDER_WORDS 8192
+#define SAVE_UNDER_SLOTS 8
+static uint32_t under_pool[SAVE_UNDER_WORDS] ;
+typedef struct {
+  short x, y, w, h ;          // the saved rectangle
+  unsigned short offset ;     // where its buffer is in under_pool
+  unsigned short words ;      // 0 when the slot is free
+} underSlot ;
+static underSlot under_slot[SAVE_UNDER_SLOTS] ;
+
+// Save the w x h pixels with top-left (x,y) to put back later with
+// restoreUnder(), so erasing a sprite drawn over them is exact on any
+// background. Returns the slot, or -1 if the pool has no room.
+short saveUnder(short x, short y, short w, short h) {
+  if ((w <= 0) || (h <= 0)) return -1 ;
+  int words = VGA_BUFFER_WORDS(w, h) ;
+  int slot = -1 ;
+  for (int i=0; i<SAVE_UNDER_SLOTS; i++) {
+    if (under_slot[i].words == 0) slot = i ;
+  }
+  if (slot < 0) return -1 ;
+  // The first gap: at the start of the pool or right after a slot
+  for (int i=-1; i<SAVE_UNDER_SLOTS; i++) {
+    if ((i >= 0) && (under_slot[i].words == 0)) continue ;
+    int offset = (i < 0) ? 0 : under_slot[i].offset + under_slot[i].words ;
+    if (offset + words > SAVE_UNDER_WORDS) continue ;
+    int clear = 1 ;
+    for (int j=0; j<SAVE_UNDER_SLOTS; j++) {
+      if (under_slot[j].words && (offset < under_slot[j].offset + under_slot[j].words) &&
+          (under_slot[j].offset < offset + words)) clear = 0 ;
+    }
+    if (!clear) continue ;
+    underSlot *u = &under_slot[slot] ;
+    u->x = x ;
+    u->y = y ;
+    u->w = w ;
+    u->h = h ;
+    u->offset = offset ;
+    u->words = words ;
+    copyRectToBuffer(x, y, w, h, under_pool + offset) ;
+    return slot ;
+  }
+  return -1 ;
+}
+
+// Put back what saveUnder() saved in slot (clipped to the clip rectangle,
+// a word at a time) and free the slot. Where sprites overlap, restore them
+// in the reverse of the order they were saved.
+void restoreUnder(short slot) {
+  if ((slot < 0) || (slot >= SAVE_UNDER_SLOTS) || (under_slot[slot].words == 0)) return ;
+  underSlot *u = &under_slot[slot] ;
+  copyRectFromBuffer(under_pool + u->offset, u->w, u->h, u->x, u->y) ;
+  u->words = 0 ;
+}
+
+// Free slot without putting anything back
+void dropUnder(short slot) {
+  if ((slot < 0) || (slot >= SAVE_UNDER_SLOTS)) return ;
+  under_slot[slot].words = 0 ;
+}
+
+// ==== bitmap cache ====
+
+// Bitmap data is const, so it sits in flash and is read through the 16 kB
+// XIP cache, which thrashes when big title art and both fighters are drawn
+// in the same frame. drawBitmap reads from copies kept here in SRAM
+// instead: ones pinned with pinBitmap(), and any bitmap of up to
+// BITMAP_CACHE_AUTO bytes it draws, which stays until it is the least
+// recently used one and the room is needed. The data is kept packed (the
+// bytes after an evicted copy slide down), slots are in no order. Slots are
+// found through chains hashed on the data's address, so a lookup - hit or
+// miss - looks at a slot or two, however many are pinned.
+#define BITMAP_CACHE_BYTES 16384
+#define BITMAP_CACHE_SLOTS 192
+#define BITMAP_CACHE_AUTO 512
+#define BITMAP_CACHE_HASH 128       // chains, a power of two
+static unsigned char cache_data[BITMAP_CACHE_BYTES] ;
+typedef struct {
+  const unsigned char *src ;  // the flash data this copies
+  unsigned short offset ;     // where the copy is in cache_data
+  unsigned short size ;
+  unsigned int used ;         // cache_clock at the last hit
+  char pinned ;
+  unsigned char next ;        // the next slot in its chain, plus 1 (0 ends it)
+} cacheSlot ;
+static cacheSlot cache_slot[BITMAP_CACHE_SLOTS] ;
+static unsigned char cache_chain[BITMAP_CACHE_HASH] ;   // first slot of each, plus 1
+static int cache_slots = 0, cache_bytes = 0 ;
+static unsigned int cache_clock = 0 ;
+
+// Lookups that found / didn't find an SRAM copy - clear them to start over
+unsigned int bitmap_cache_hits = 0, bitmap_cache_misses = 0 ;
+
+static inline unsigned char *cacheChain(const unsigned char *src) {
+  uintptr_t a = (uintptr_t)src ;
+  return &cache_chain[(a ^ (a >> 7) ^ (a >> 14)) & (BITMAP_CACHE_HASH - 1)] ;
+}
+
+static int cacheFind(const unsigned char *src) {
+  for (int i=*cacheChain(src); i; i=cache_slot[i - 1].next) {
+    if (cache_slot[i - 1].src == src) return i - 1 ;
+  }
+  return -1 ;
+}
+
+static void cacheLink(int i) {
+  unsigned char *chain = cacheChain(cache_slot[i].src) ;
+  cache_slot[i].next = *chain ;
+  *chain = i + 1 ;
+}
+
+static void cacheUnlink(int i) {
+  unsigned char *p = cacheChain(cache_slot[i].src) ;
+  while (*p != i + 1) p = &cache_slot[*p - 1].next ;
+  *p = cache_slot[i].next ;
+}
+
+// Drop slot i: slide the data after its copy down over it, and move the
+// last slot into its place
+static void cacheEvict(int i) {
+  int offset = cache_slot[i].offset, size = cache_slot[i].size ;
+  memmove(cache_data + offset, cache_data + offset + size, cache_bytes - offset - size) ;
+  cache_bytes -= size ;
+  cacheUnlink(i) ;
+  if (i != --cache_slots) {
+    cacheUnlink(cache_slots) ;
+    cache_slot[i] = cache_slot[cache_slots] ;
+    cacheLink(i) ;
+  }
+  for (int j=0; j<cache_slots; j++) {
+    if (cache_slot[j].offset > offset) cache_slot[j].offset -= size ;
+  }
+}
+
+// Copy bm's data into the cache, evicting least recently used copies that
+// aren't pinned to make room. Returns the slot, or -1 if it doesn't fit.
+static int cacheAdd(const Bitmap *bm) {
+  while ((cache_bytes + bm->size > BITMAP_CACHE_BYTES) || (cache_slots == BITMAP_CACHE_SLOTS)) {
+    int lru = -1 ;
+    for (int i=0; i<cache_slots; i++) {
+      if (!cache_slot[i].pinned && ((lru < 0) || (cache_slot[i].used < cache_slot[lru].used))) lru = i ;
+    }
+    if (lru < 0) return -1 ;
+    cacheEvict(lru) ;
+  }
+  int i = cache_slots++ ;
+  cache_slot[i].src = bm->data ;
+  cache_slot[i].offset = cache_bytes ;
+  cache_slot[i].size = bm->size ;
+  cache_slot[i].used = cache_clock ;
+  cache_slot[i].pinned = 0 ;
+  cacheLink(i) ;
+  memcpy(cache_data + cache_bytes, bm->data, bm->size) ;
+  cache_bytes += bm->size ;
+  return i ;
+}
+
+// Where drawBitmap should read bm's data from
+static const unsigned char *cachedData(const Bitmap *bm) {
+  int i = cacheFind(bm->data) ;
+  if (i >= 0) {
+    bitmap_cache_hits++ ;
+    cache_slot[i].used = ++cache_clock ;
+    return cache_data + cache_slot[i].offset ;
+  }
+  bitmap_cache_misses++ ;
+  if (bm->size <= BITMAP_CACHE_AUTO) i = cacheAdd(bm) ;
+  return (i >= 0) ? cache_data + cache_slot[i].offset : bm->data ;
+}
+
+int pinBitmap(const Bitmap *bm) {
+/* Keep a copy of bm's data in the SRAM bitmap cache until unpinBitmaps().
+ * Bitmaps sharing data share the copy. Returns 0 if the cache is full of
+ * pinned data.
+ */
+  int i = cacheFind(bm->data) ;
+  if (i < 0) i = cacheAdd(bm) ;
+  if (i < 0) return 0 ;
+  cache_slot[i].pinned = 1 ;
+  return 1 ;
+}
+
+void unpinBitmaps(void) {
+/* Let every cached copy be evicted again (they stay until they are) */
+  for (int i=0; i<cache_slots; i++) cache_slot[i].pinned = 0 ;
+}
+
+// ==== bitmaps ====
+
+// Row scratch for the bitmap draws: the masks and colors of one screen
+// row. Static rather than on the stack, as drawing is single-threaded
+static uint32_t row_masks[SWAR_ROWWORDS], row_values[SWAR_ROWWORDS] ;
+
+// Write one screen row of a bitmap: the pixels set in the masks m[k0..k1]
+// get the colors in v, through the raster op
+static inline void bitmapRow(uint32_t *row, const uint32_t *m, const uint32_t *v, int k0, int k1) {
+  for (int k=k0; k<=k1; k++) {
+    if (m[k]) {
+      uint32_t keep = (v[k] & rop_keep_and) ^ rop_keep_xor ;
+      row[k] = (row[k] & (keep | ~m[k])) ^ (v[k] & rop_flip_and & m[k]) ;
+    }
+  }
+}
+
+// Add pixels a..b-1 to the row masks m, with color word cw in v
+static inline void bitmapRange(uint32_t *m, uint32_t *v, int a, int b, uint32_t cw) {
+  int k = a >> 3, kb = (b - 1) >> 3 ;
+  uint32_t mk = swar_head_mask(a) ;
+  for (; k<=kb; k++) {
+    if (k == kb) mk &= swar_tail_mask(b - 1) ;
+    m[k] |= mk ;
+    v[k] |= cw & mk ;
+    mk = 0xFFFFFFFFu ;
+  }
+}
+
+// Draw a span-coded bitmap whose top-left is at (left, top), cut to
+// x0..x1-1, y0..y1-1. Each span is one horizontal fill per screen row.
+static void bitmapSpans(const Bitmap *bm, int left, int top, char flip, char color,
+                        int x0, int x1, int y0, int y1) {
+  int cell = bm->cell ;
+  int right = left + (bm->w * cell) ;
+  fillPattern pat ;
+  solidPattern(&pat, color) ;
+  const unsigned char *src = bm->data ;
+  for (int r=0; r<bm->h; r++) {
+    int n = *src++ ;
+    const unsigned char *first = src ;
+    // Step past this row's spans
+    for (int i=0; i<n; i++) src += ((*src & 0xF0) == 0xF0) ? 3 : 1 ;
+
+    int ya = top + (r * cell), yb = ya + cell ;
+    if (ya >= y1) break ;
+    if ((yb <= y0) || (n == 0)) continue ;
+    if (ya < y0) ya = y0 ;
+    if (yb > y1) yb = y1 ;
+
+    for (int j=ya; j<yb; j++) {
+      const unsigned char *p = first ;
+      int end = 0 ;
+      for (int i=0; i<n; i++) {
+        int gap, len ;
+        if ((*p & 0xF0) == 0xF0) {
+          gap = p[1] ;
+          len = p[2] ;
+          p += 3 ;
+        }
+        else {
+          gap = *p >> 4 ;
+          len = (*p & 15) + 1 ;
+          p++ ;
+        }
+        // Cells end+gap .. +len on screen (mirrored when flipped)
+        int a = end + gap ;
+        end = a + len ;
+        int b ;
+        if (flip) {
+          b = right - (a * cell) ;
+          a = right - (end * cell) ;
+        }
+        else {
+          a = left + (a * cell) ;
+          b = left + (end * cell) ;
+        }
+        if (a < x0) a = x0 ;
+        if (b > x1) b = x1 ;
+        if (a < b) fillSpan(a, b, j, &pat) ;
+      }
+    }
+  }
+}
+
+// Draw a point-list bitmap the same way, one cell-sized fill per point
+static void bitmapPoints(const Bitmap *bm, int left, int top, char flip, char color,
+                         int x0, int x1, int y0, int y1) {
+  int cell = bm->cell ;
+  fillPattern pat ;
+  solidPattern(&pat, color) ;
+  const unsigned char *p = bm->data, *end = bm->data + bm->size ;
+  for (; p<end; p+=2) {
+    int c = flip ? (bm->w - 1 - p[0]) : p[0] ;
+    int a = left + (c * cell), b = a + cell ;
+    int ya = top + (p[1] * cell), yb = ya + cell ;
+    if (a < x0) a = x0 ;
+    if (b > x1) b = x1 ;
+    if (ya < y0) ya = y0 ;
+    if (yb > y1) yb = y1 ;
+    if (a >= b) continue ;
+    for (int j=ya; j<yb; j++) fillSpan(a, b, j, &pat) ;
+  }
+}
+
+// drawBitmap and drawBitmapRemap. remap, if not NULL, gives the color each
+// color of a 4-bit bitmap is drawn in; solid says every entry is the same.
+static void bitmapBlit(const Bitmap *bm, short x, short y, char flip, char color,
+                       const unsigned char *remap, int solid) {
+  int cell = bm->cell ;
+  int left = flip ? (x - bm->fx) : (x - bm->ax) ;
+  int top = y - bm->ay ;
+  int x0 = (left > clip_x0) ? left : clip_x0 ;
+  int x1 = (left + (bm->w * cell) < clip_x1) ? left + (bm->w * cell) : clip_x1 ;
+  int y0 = (top > clip_y0) ? top : clip_y0 ;
+  int y1 = (top + (bm->h * cell) < clip_y1) ? top + (bm->h * cell) : clip_y1 ;
+  if ((x0 >= x1) || (y0 >= y1)) return ;
+  if (!drawHook(x0, y0, x1, y1)) return ;
+
+  // Read the data from its SRAM copy, if there is one
+  Bitmap cached = *bm ;
+  cached.data = cachedData(bm) ;
+  bm = &cached ;
+
+  // From here flip only says which way to read the data
+  int format = bm->format & ~BITMAP_MIRRORED ;
+  if (bm->format & BITMAP_MIRRORED) flip = !flip ;
+  if (format == BITMAP_SPANS) {
+    bitmapSpans(bm, left, top, flip, color, x0, x1, y0, y1) ;
+    return ;
+  }
+  if (format == BITMAP_POINTS) {
+    bitmapPoints(bm, left, top, flip, color, x0, x1, y0, y1) ;
+    return ;
+  }
+
+  int k0 = x0 >> 3, k1 = (x1 - 1) >> 3 ;
+  uint32_t *m = row_masks, *v = row_values ;
+  uint32_t cw = swar_color(color) ;
+  // Remapped 4-bit colors, looked up once a run; a single-color remap
+  // draws every cell that isn't the key in one run
+  uint32_t inks[16] ;
+  if ((format == BITMAP_4BPP) && (remap != NULL) && !solid) {
+    for (int i=0; i<16; i++) inks[i] = swar_color(remap[i]) ;
+  }
+
+  for (int r=(y0 - top) / cell; ; r++) {
+    int ya = top + (r * cell), yb = ya + cell ;
+    if (ya >= y1) break ;
+    if (ya < y0) ya = y0 ;
+    if (yb > y1) yb = y1 ;
+
+    // Masks (and colors) of this bitmap row, cut to x0..x1-1
+    const unsigned char *src = bm->data + (r * bm->stride) ;
+    int any = 0 ;
+    for (int k=k0; k<=k1; k++) m[k] = v[k] = 0 ;
+    int c = 0 ;
+    while (c < bm->w) {
+      // Take a whole run of cells at once: set bits, or one color
+      int c0 = c ;
+      uint32_t ink = cw ;
+      if (format == BITMAP_1BPP) {
+        if ((src[c >> 3] >> (c & 7)) == 0) {
+          // Rest of this byte is clear
+          c = (c | 7) + 1 ;
+          continue ;
+        }
+        while ((c < bm->w) && ((src[c >> 3] >> (c & 7)) & 1)) c++ ;
+        if (c == c0) {
+          c++ ;
+          continue ;
+        }
+      }
+      else if (solid) {
+        if (((src[c >> 1] >> ((c & 1) << 2)) & 15) == bm->key) {
+          c++ ;
+          continue ;
+        }
+        while ((c < bm->w) && (((src[c >> 1] >> ((c & 1) << 2)) & 15) != bm->key)) c++ ;
+      }
+      else {
+        int n = (src[c >> 1] >> ((c & 1) << 2)) & 15 ;
+        c++ ;
+        if (n == bm->key) continue ;
+        while ((c < bm->w) && (((src[c >> 1] >> ((c & 1) << 2)) & 15) == n)) c++ ;
+        ink = remap ? inks[n] : swar_color(n) ;
+      }
+      // Cells c0..c-1 on screen (in reverse order when flipped)
+      int a = flip ? left + ((bm->w - c) * cell) : left + (c0 * cell) ;
+      int b = a + ((c - c0) * cell) ;
+      if (a < x0) a = x0 ;
+      if (b > x1) b = x1 ;
+      if (a >= b) continue ;
+      bitmapRange(m, v, a, b, ink) ;
+      any = 1 ;
+    }
+    if (!any) continue ;
+
+    uint32_t *row = (uint32_t *)vga_data_array + (SWAR_ROWWORDS * ya) ;
+    for (int j=ya; j<yb; j++, row+=SWAR_ROWWORDS) {
+      bitmapRow(row, m, v, k0, k1) ;
+    }
+  }
+}
+
+void drawBitmap(const Bitmap *bm, short x, short y, char flip, char color) {
+/* Draw a bitmap (see Bitmap in vga16_graphics.h) with its anchor at (x,y),
+ * mirrored left-right if flip is set. 1-bit, span and point bitmaps are
+ * drawn in color; a 4-bit one in its own colors (color is ignored). Clipped to the clip
+ * rectangle, and honors the raster op.
+ * Each bitmap row is turned into a row of 8-pixel masks once, then every
+ * screen row it covers is written a word at a time.
+ * Flipping costs nothing: whole runs of cells (spans, points) are placed
+ * at their mirrored position, nothing is reversed bit by bit, so a sprite
+ * draws as fast facing either way and needs no mirrored copy of its data.
+ */
+  listCall(LIST_BITMAP, bm, NULL, x, y, flip, color) ;
+  bitmapBlit(bm, x, y, flip, color, NULL, 0) ;
+  list_call.op = LIST_NONE ;
+}
+
+void drawBitmapRemap(const Bitmap *bm, short x, short y, char flip, char color,
+                     const unsigned char remap[16]) {
+/* drawBitmap with every color passed through remap: a 1-bit, span or point
+ * bitmap is drawn in remap[color], a 4-bit one with each cell's color c
+ * (other than the key) drawn as remap[c]. One table gives a sprite another
+ * costume or flashes it a single color, with no second copy of its data.
+ * The lookup is done once a run of cells, not once a pixel; an identity
+ * remap is plain drawBitmap and a single-color one is drawn like a 1-bit
+ * bitmap.
+ */
+  int identity = 1, solid = 1 ;
+  for (int i=0; i<16; i++) {
+    identity &= remap[i] == i ;
+    solid &= remap[i] == remap[0] ;
+  }
+  listCall(LIST_REMAP, bm, remap, x, y, flip, color) ;
+  bitmapBlit(bm, x, y, flip, remap[color & 15], identity ? NULL : remap, solid) ;
+  list_call.op = LIST_NONE ;
+}
+
+void drawBitmapCode(const Bitmap *bm, const BitmapCode *code, short x, short y, char flip, char color) {
+/* drawBitmap, but through the bitmap's compiled code (see BitmapCode) if
+ * it has some, the raster op is ROP_COPY and it lies wholly inside the
+ * clip rectangle - the code does no checks. The pixels come out the same.
+ */
+  int left = flip ? (x - bm->fx) : (x - bm->ax) ;
+  int top = y - bm->ay ;
+  if ((code == NULL) || (rop != ROP_COPY) ||
+      (left < clip_x0) || (left + (bm->w * bm->cell) > clip_x1) ||
+      (top < clip_y0) || (top + (bm->h * bm->cell) > clip_y1)) {
+    drawBitmap(bm, x, y, flip, color) ;
+    return ;
+  }
+  listCall(LIST_CODE, bm, code, x, y, flip, color) ;
+  int draw = drawHook(left, top, left + (bm->w * bm->cell), top + (bm->h * bm->cell)) ;
+  list_call.op = LIST_NONE ;
+  if (!draw) return ;
+  code->draw[flip ? 1 : 0][left & 1](vga_data_array + (ROWBYTES * top) + (left >> 1), (color & 15) * 0x11) ;
+}
+
+// Screen x (or y) where an edge at offset off from the anchor at origin
+// lands when scaled by scale (a fix15): the first pixel whose center is
+// at or past it
+static inline int scaledEdge(int origin, int off, int32_t scale) {
+  return ((origin << 15) + (off * scale) + 16383) >> 15 ;
+}
+
+void drawBitmapScaled(const Bitmap *bm, short x, short y, char flip, char color, int32_t scale) {
+/* drawBitmap at scale times the size, scale being a fix15 (32768 is 1:1),
+ * grown or shrunk about the anchor. Every screen pixel takes the bitmap
+ * pixel under its center (nearest neighbor), so 1:1 is exactly drawBitmap.
+ * Clipped, and honors the raster op.
+ * A bitmap row's runs of cells are mapped to screen spans with one
+ * multiply per edge and turned into row masks once, then written to every
+ * screen row that row covers - no per-pixel stepping.
+ */
+  if (scale <= 0) return ;
+  int cell = bm->cell ;
+  int left = flip ? -bm->fx : -bm->ax ;   // offsets from the anchor, unscaled
+  int top = -bm->ay ;
+  int x0 = scaledEdge(x, left, scale), x1 = scaledEdge(x, left + (bm->w * cell), scale) ;
+  int y0 = scaledEdge(y, top, scale), y1 = scaledEdge(y, top + (bm->h * cell), scale) ;
+  if (x0 < clip_x0) x0 = clip_x0 ;
+  if (x1 > clip_x1) x1 = clip_x1 ;
+  if (y0 < clip_y0) y0 = clip_y0 ;
+  if (y1 > clip_y1) y1 = clip_y1 ;
+  if ((x0 >= x1) || (y0 >= y1)) return ;
+  listCall(LIST_SCALED, bm, NULL, x, y, flip, color) ;
+  list_call.scale = scale ;
+  int draw = drawHook(x0, y0, x1, y1) ;
+  list_call.op = LIST_NONE ;
+  if (!draw) return ;
+
+  Bitmap cached = *bm ;
+  cached.data = cachedData(bm) ;
+  bm = &cached ;
+  int format = bm->format & ~BITMAP_MIRRORED ;
+  if (bm->format & BITMAP_MIRRORED) flip = !flip ;
+
+  if (format == BITMAP_POINTS) {
+    // One scaled cell per point
+    fillPattern pat ;
+    solidPattern(&pat, color) ;
+    const unsigned char *p = bm->data, *end = bm->data + bm->size ;
+    for (; p<end; p+=2) {
+      int c = flip ? (bm->w - 1 - p[0]) : p[0] ;
+      int a = scaledEdge(x, left + (c * cell), scale), b = scaledEdge(x, left + ((c + 1) * cell), scale) ;
+      int ya = scaledEdge(y, top + (p[1] * cell), scale), yb = scaledEdge(y, top + ((p[1] + 1) * cell), scale) ;
+      if (a < x0) a = x0 ;
+      if (b > x1) b = x1 ;
+      if (ya < y0) ya = y0 ;
+      if (yb > y1) yb = y1 ;
+      if (a >= b) continue ;
+      for (int j=ya; j<yb; j++) fillSpan(a, b, j, &pat) ;
+    }
+    return ;
+  }
+
+  int k0 = x0 >> 3, k1 = (x1 - 1) >> 3 ;
+  uint32_t *m = row_masks, *v = row_values ;
+  uint32_t cw = swar_color(color) ;
+  const unsigned char *src = bm->data ;
+  for (int r=0; r<bm->h; r++) {
+    // Screen rows of bitmap row r, and where its data is
+    int ya = scaledEdge(y, top + (r * cell), scale), yb = scaledEdge(y, top + ((r + 1) * cell), scale) ;
+    if (ya >= y1) break ;
+    const unsigned char *row = src ;
+    int n = 0 ;
+    if (format == BITMAP_SPANS) {
+      n = *row++ ;
+      src = row ;
+      for (int i=0; i<n; i++) src += ((*src & 0xF0) == 0xF0) ? 3 : 1 ;
+    }
+    else {
+      row = bm->data + (r * bm->stride) ;
+    }
+    if (ya < y0) ya = y0 ;
+    if (yb > y1) yb = y1 ;
+    if (ya >= yb) continue ;
+
+    // Masks of this row: each run of cells c0..c-1 as one screen span
+    for (int k=k0; k<=k1; k++) m[k] = v[k] = 0 ;
+    int any = 0, c = 0, end = 0 ;
+    while (1) {
+      int c0 ;
+      uint32_t ink = cw ;
+      if (format == BITMAP_SPANS) {
+        if (n-- == 0) break ;
+        int gap, len ;
+        if ((*row & 0xF0) == 0xF0) {
+          gap = row[1] ;
+          len = row[2] ;
+          row += 3 ;
+        }
+        else {
+          gap = *row >> 4 ;
+          len = (*row & 15) + 1 ;
+          row++ ;
+        }
+        c0 = end + gap ;
+        c = end = c0 + len ;
+      }
+      else if (format == BITMAP_1BPP) {
+        while ((c < bm->w) && !((row[c >> 3] >> (c & 7)) & 1)) c++ ;
+        if (c >= bm->w) break ;
+        c0 = c ;
+        while ((c < bm->w) && ((row[c >> 3] >> (c & 7)) & 1)) c++ ;
+      }
+      else {
+        if (c >= bm->w) break ;
+        c0 = c ;
+        int px = (row[c >> 1] >> ((c & 1) << 2)) & 15 ;
+        c++ ;
+        if (px == bm->key) continue ;
+        while ((c < bm->w) && (((row[c >> 1] >> ((c & 1) << 2)) & 15) == px)) c++ ;
+        ink = swar_color(px) ;
+      }
+      int ca = flip ? (bm->w - c) : c0, cb = flip ? (bm->w - c0) : c ;
+      int a = scaledEdge(x, left + (ca * cell), scale), b = scaledEdge(x, left + (cb * cell), scale) ;
+      if (a < x0) a = x0 ;
+      if (b > x1) b = x1 ;
+      if (a >= b) continue ;
+      bitmapRange(m, v, a, b, ink) ;
+      any = 1 ;
+    }
+    if (!any) continue ;
+
+    uint32_t *screen = (uint32_t *)vga_data_array + (SWAR_ROWWORDS * ya) ;
+    for (int j=ya; j<yb; j++, screen+=SWAR_ROWWORDS) {
+      bitmapRow(screen, m, v, k0, k1) ;
+    }
+  }
+}
+
+// Rows of a packed image group with up to this many runs on screen are
+// each filled run by run; ones with more are filled once and copied, as
+// a copy costs more than a fill a word
+#define PACKED_FILL_RUNS 4
+
+// Fill screen rows ya..yb-1 from x0 to x1 with the runs of a packed image
+// row at p starting at x; returns the runs' end, and their count in x0..x1
+static const unsigned char *packedRuns(const unsigned char *p, int x, int w, int x0, int x1,
+                                       int ya, int yb, int *runs) {
+  *runs = 0 ;
+  for (int c=x; c<x+w; ) {
+    int len = (*p & 15) + 1 ;
+    uint32_t cw = swar_color(*p++ >> 4) ;
+    if (len == 16) len += *p++ ;
+    int a = (c > x0) ? c : x0, b = (c + len < x1) ? c + len : x1 ;
+    if (a < b) {
+      uint32_t *row = (uint32_t *)vga_data_array + (SWAR_ROWWORDS * ya) ;
+      for (int j=ya; j<yb; j++, row+=SWAR_ROWWORDS) swar_fill(row, a, b, cw) ;
+      (*runs)++ ;
+    }
+    c += len ;
+  }
+  return p ;
+}
+
+void drawPackedImage(const PackedImage *im, short x, short y) {
+/* Unpack a packed image (see PackedImage) with its top-left at (x,y), cut
+ * to the clip rectangle, straight into the screen: each run is one
+ * word-wide fill of the first screen row of its group, and the rest of the
+ * group are word copies of that row - or, when the row is only a few runs
+ * (big flat areas), more fills. Always copies - the raster op is ignored.
+ */
+  int x0 = (x > clip_x0) ? x : clip_x0 ;
+  int x1 = (x + im->w < clip_x1) ? x + im->w : clip_x1 ;
+  int y0 = (y > clip_y0) ? y : clip_y0 ;
+  int y1 = (y + im->h < clip_y1) ? y + im->h : clip_y1 ;
+  listCall(LIST_PACKED, im, NULL, x, y, 0, 0) ;
+  int draw = drawHook(x0, y0, x1, y1) ;
+  list_call.op = LIST_NONE ;
+  if (!draw) return ;
+  const unsigned char *p = im->data ;
+  for (int r=0; r<im->h; ) {
+    int n = *p++ ;
+    int ya = y + r, yb = ya + n, runs ;
+    if (ya < clip_y0) ya = clip_y0 ;
+    if (yb > clip_y1) yb = clip_y1 ;
+    if ((x0 >= x1) || (ya >= yb)) yb = ya ;
+    const unsigned char *first = p ;
+    p = packedRuns(p, x, im->w, x0, x1, ya, (ya < yb) ? ya + 1 : ya, &runs) ;
+    if (runs <= PACKED_FILL_RUNS) {
+      if (ya + 1 < yb) packedRuns(first, x, im->w, x0, x1, ya + 1, yb, &runs) ;
+    }
+    else {
+      uint32_t *row = (uint32_t *)vga_data_array + (SWAR_ROWWORDS * ya) ;
+      for (int j=ya+1; j<yb; j++) {
+        swar_copy(row + (SWAR_ROWWORDS * (j - ya)), x0, x1 - x0, row, x0, SWAR_ROWWORDS) ;
+      }
+    }
+    r += n ;
+  }
+}
+
+// Color of the screen pixel at (x,y)
+static inline int screenPixel(int x, int y) {
+  unsigned char b = vga_data_array[(ROWBYTES * y) + (x >> 1)] ;
+  return (x & 1) ? (b >> 4) : (b & 15) ;
+}
+
+int packRect(PackedImage *im, short x, short y, short w, short h, unsigned char *buf, int size) {
+/* Pack the w x h screen pixels with top-left (x,y) (which must be on the
+ * screen) into buf, as a PackedImage for drawPackedImage - the same
+ * packing tools/spritegen.py does. im gets the image. Returns the bytes
+ * used, or -1 if it doesn't fit in size bytes or 64 kB.
+ */
+  if ((x < 0) || (y < 0) || (x + w > _width) || (y + h > _height) || (w <= 0) || (h <= 0)) return -1 ;
+  flushDisplayList() ;
+  if (size > 0xFFFF) size = 0xFFFF ;
+  int n = 0 ;
+  for (int r=0; r<h; ) {
+    // Rows equal to this one
+    int rows = 1 ;
+    while ((r + rows < h) && (rows < 255)) {
+      int c = 0 ;
+      while ((c < w) && (screenPixel(x + c, y + r + rows) == screenPixel(x + c, y + r))) c++ ;
+      if (c < w) break ;
+      rows++ ;
+    }
+    if (n >= size) return -1 ;
+    buf[n++] = rows ;
+    for (int c=0; c<w; ) {
+      int color = screenPixel(x + c, y + r), len = 1 ;
+      while ((c + len < w) && (len < 271) && (screenPixel(x + c + len, y + r) == color)) len++ ;
+      if (n + ((len > 15) ? 2 : 1) > size) return -1 ;
+      if (len <= 15) buf[n++] = (color << 4) | (len - 1) ;
+      else {
+        buf[n++] = (color << 4) | 15 ;
+        buf[n++] = len - 16 ;
+      }
+      c += len ;
     }
+    r += rows ;
   }
+  im->w = w ;
+  im->h = h ;
+  im->size = n ;
+  im->data = buf ;
+  return n ;
 }
 
 // Draw a character
 void drawChar(short x, short y, unsigned char c, char color, char bg, unsigned char size) {
     char i, j;
-  if((x >= _width)            || // Clip right
-     (y >= _height)           || // Clip bottom
-     ((x + 6 * size - 1) < 0) || // Clip left
-     ((y + 8 * size - 1) < 0))   // Clip top
+  // Clip the whole character cell once; size 1 then plots unchecked if the
+  // cell is fully visible (bigger sizes go through the clipped fillRect)
+  plotter plot = clipPlotter(x, y, x + 6 * size - 1, y + 8 * size - 1) ;
+  if (plot == NULL)
     return;
 
   for (i=0; i<6; i++ ) {
@@ -466,13 +2173,13 @@ void drawChar(short x, short y, unsigned char c, char color, char bg, unsigned c
     for ( j = 0; j<8; j++) {
       if (line & 0x1) {
         if (size == 1) // default size
-          drawPixel(x+i, y+j, color);
+          plot(x+i, y+j, color);
         else {  // big size
           fillRect(x+(i*size), y+(j*size), size, size, color);
         }
       } else if (bg != color) {
         if (size == 1) // default size
-          drawPixel(x+i, y+j, bg);
+          plot(x+i, y+j, bg);
         else {  // big size
           fillRect(x+i*size, y+j*size, size, size, bg);
         }
@@ -573,13 +2280,15 @@ inline void setTextColorBig(char color, char background) {
 void drawCharBig(short x, short y, unsigned char c, char color, char bg) {
   char i, j ;
   unsigned char line; 
+  plotter plot = clipPlotter(x, y, x + 7, y + 14) ;
+  if (plot == NULL) return ;
   for (i=0; i<15; i++ ) {   
     line = pgm_read_byte(bigFont+((int)c*16)+i);
     for ( j = 0; j<8; j++) {
       if (line & 0x80) {
-        drawPixel(x+j, y+i, color);
+        plot(x+j, y+i, color);
       } else if (bg!=color){
-        drawPixel(x+j, y+i, bg);
+        plot(x+j, y+i, bg);
       }
       line <<= 1;
     }
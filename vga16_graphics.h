@@ -24,6 +24,8 @@
  */
 
 
+#include <stdint.h>
+
 // Give the I/O pins that we're using some names that make sense - usable in main()
  enum vga_pins {HSYNC=16, VSYNC, LO_GRN, HI_GRN, BLUE_PIN, RED_PIN} ;
 
@@ -33,9 +35,84 @@ enum colors {BLACK, DARK_GREEN, MED_GREEN, GREEN,
             RED, DARK_ORANGE, ORANGE, YELLOW, 
             MAGENTA, PINK, LIGHT_PINK, WHITE} ;
 
+// How drawing combines with the pixels already there - see setRasterOp()
+enum raster_ops {ROP_COPY, ROP_XOR, ROP_OR, ROP_AND, ROP_ANDNOT} ;
+
+// Bitmap formats. BITMAP_MIRRORED can be or'ed in: the data is stored
+// mirrored left-right, so one image serves a sprite and its mirror image.
+enum bitmap_formats {BITMAP_SPANS, BITMAP_1BPP, BITMAP_POINTS, BITMAP_4BPP=4,
+                     BITMAP_MIRRORED=0x80} ;
+
+// What the drawing calls do about dirty rectangles - see trackDirty()
+enum dirty_modes {DIRTY_OFF, DIRTY_DRAW, DIRTY_ONLY} ;
+// Most dirty rectangles kept at once
+#define DIRTY_RECTS 16
+
+// Whether drawing is done at once or recorded - see deferDraws()
+enum list_modes {LIST_OFF, LIST_DEFER, LIST_CHASE} ;
+
+// Packed bitmap for drawBitmap. Rows are stride bytes, top row first.
+//  BITMAP_1BPP: bit i of a byte (LSB first) is cell 8*byte+i, drawn in the
+//         color passed to drawBitmap where set
+//  BITMAP_4BPP: a nibble per cell, low nibble first (like the screen),
+//         drawn in its own color unless it is the key color
+//  BITMAP_SPANS: runs of set cells, drawn in the color passed to
+//         drawBitmap. Per row a count n, then n spans left to right: one
+//         byte (gap << 4) | (length - 1), or 0xF0, gap, length when
+//         gap >= 15 or length > 16. The gap counts cells since the previous
+//         span's end (the left edge for the first). stride is unused.
+//  BITMAP_POINTS: a (column, row) byte pair per set cell, drawn in the
+//         color passed to drawBitmap. stride is unused.
+// Each cell covers cell x cell screen pixels - the game sprites are made of
+// 4x4 blocks, so they are stored one bit per block.
+typedef struct {
+    short w, h ;            // size in cells
+    short ax, ay ;          // the top-left is drawn at (x - ax, y - ay)
+    short fx ;              // flipped (mirrored), the top-left is at (x - fx, y - ay)
+    unsigned char format ;  // one of bitmap_formats, maybe | BITMAP_MIRRORED
+    unsigned char cell ;    // screen pixels per cell, each way
+    unsigned char key ;     // transparent color for BITMAP_4BPP
+    unsigned char stride ;  // bytes per row
+    unsigned short size ;   // bytes of data
+    const unsigned char *data ;
+} Bitmap ;
+
+// Opaque 4-bit image, run-length packed by tools/spritegen.py, for big
+// static art. Rows come in groups of equal rows: a row count, then the row
+// as runs left to right, each a byte (color << 4) | (length - 1) for up to
+// 15 pixels, or (color << 4) | 15 and then a byte of length - 16.
+typedef struct {
+    short w, h ;            // size in pixels
+    unsigned short size ;   // bytes of data
+    const unsigned char *data ;
+} PackedImage ;
+
+// A bitmap compiled to code by tools/spritegen.py. draw[flip][left & 1]
+// writes its set cells for that flip, left being the x of its top-left;
+// p is the byte of that pixel in vga_data_array and c the color in both
+// nibbles. No clipping and no raster op - see drawBitmapCode().
+typedef struct {
+    void (*draw[2][2])(unsigned char *p, unsigned char c) ;
+} BitmapCode ;
+
 // VGA primitives - usable in main
 void initVGA(void) ;
 void drawPixel(short x, short y, char color) ;
+void setClipRect(short x, short y, short w, short h) ;
+void resetClip(void) ;
+void setRasterOp(char op) ;
+char getRasterOp(void) ;
+// Dirty rectangles: parts of the screen to redraw
+void markDirty(short x, short y, short w, short h) ;
+char isDirty(short x, short y, short w, short h) ;
+short takeDirtyRects(short rects[][4]) ;
+void trackDirty(char mode) ;
+extern unsigned int dirty_rects, dirty_pixels ;
+// Display list: drawing recorded, then done in scanline order
+void deferDraws(char mode) ;
+void flushDisplayList(void) ;
+short beamLine(void) ;
+extern unsigned int list_commands, list_merged, list_flushes ;
 void drawVLine(short x, short y, short h, char color) ;
 void drawHLine(short x, short y, short w, char color) ;
 void drawLine(short x0, short y0, short x1, short y1, char color) ;
@@ -44,9 +121,36 @@ void drawCircle(short x0, short y0, short r, char color) ;
 void drawCircleHelper( short x0, short y0, short r, unsigned char cornername, char color) ;
 void fillCircle(short x0, short y0, short r, char color) ;
 void fillCircleHelper(short x0, short y0, short r, unsigned char cornername, short delta, char color) ;
+void fillCircleDither(short x0, short y0, short r, char color0, char color1, char level) ;
 void drawRoundRect(short x, short y, short w, short h, short r, char color) ;
 void fillRoundRect(short x, short y, short w, short h, short r, char color) ;
 void fillRect(short x, short y, short w, short h, char color) ;
+void fillRectDither(short x, short y, short w, short h, char color0, char color1, char level) ;
+void fillTriangle(short x0, short y0, short x1, short y1, short x2, short y2, char color) ;
+void fillConvexPoly(const short pts[][2], short n, char color) ;
+void fillTriangleDither(short x0, short y0, short x1, short y1, short x2, short y2,
+                        char color0, char color1, char level) ;
+void fillConvexPolyDither(const short pts[][2], short n, char color0, char color1, char level) ;
+void copyRect(short src_x, short src_y, short w, short h, short dst_x, short dst_y) ;
+// Words needed for a w x h copyRectToBuffer buffer (rows padded to 8 pixels)
+#define VGA_BUFFER_WORDS(w, h) ((((w) + 7) >> 3) * (h))
+void copyRectToBuffer(short x, short y, short w, short h, uint32_t *buf) ;
+void copyRectFromBuffer(const uint32_t *buf, short w, short h, short x, short y) ;
+// Copies of the screen under sprites, from a fixed pool
+short saveUnder(short x, short y, short w, short h) ;
+void restoreUnder(short slot) ;
+void dropUnder(short slot) ;
+void drawBitmap(const Bitmap *bm, short x, short y, char flip, char color) ;
+void drawBitmapRemap(const Bitmap *bm, short x, short y, char flip, char color,
+                     const unsigned char remap[16]) ;
+void drawBitmapScaled(const Bitmap *bm, short x, short y, char flip, char color, int32_t scale) ;
+void drawBitmapCode(const Bitmap *bm, const BitmapCode *code, short x, short y, char flip, char color) ;
+void drawPackedImage(const PackedImage *im, short x, short y) ;
+int packRect(PackedImage *im, short x, short y, short w, short h, unsigned char *buf, int size) ;
+// SRAM copies of bitmap data that drawBitmap reads instead of flash
+int pinBitmap(const Bitmap *bm) ;
+void unpinBitmaps(void) ;
+extern unsigned int bitmap_cache_hits, bitmap_cache_misses ;
 void drawChar(short x, short y, unsigned char c, char color, char bg, unsigned char size) ;
 void setCursor(short x, short y);
 void setTextColor(char c);
@@ -0,0 +1,220 @@
+/**
+ * Word-wide kernels for the 4-bit pixel array
+ *
+ * vga_data_array packs two pixels per byte, so one 32-bit word holds 8
+ * pixels. Pixel 8k+i of a row lives in bits 4i..4i+3 of word k of that
+ * row (the low nibble is the left pixel, same as drawPixel). Each row is
+ * 320 bytes = 80 words and the array is word aligned, so any row can be
+ * treated as a uint32_t array.
+ *
+ * Every kernel works on the pixel range x0 .. x1-1 of one row and handles
+ * the partly covered first and last words with a nibble mask, so callers
+ * never deal with alignment. No range checks - clip before calling.
+ *
+ * These are SIMD-within-a-register tricks: a color is repeated into all 8
+ * nibbles of a word, and per-pixel tests (is this nibble equal to X?) are
+ * done for all 8 pixels at once with shifts and masks.
+ */
+
+#ifndef VGA16_SWAR_H
+#define VGA16_SWAR_H
+
+#include <stdint.h>
+
+// Words per row of the pixel array
+#define SWAR_ROWWORDS 80
+
+// Low bit of every nibble
+#define SWAR_ONES 0x11111111u
+
+// A color repeated into all 8 pixels of a word
+static inline uint32_t swar_color(unsigned char c) {
+    return (c & 15) * SWAR_ONES ;
+}
+
+// Mask of the pixels from x to the end of its word
+static inline uint32_t swar_head_mask(int x) {
+    return 0xFFFFFFFFu << ((x & 7) << 2) ;
+}
+
+// Mask of the pixels from the start of the word up to and including x
+static inline uint32_t swar_tail_mask(int x) {
+    return 0xFFFFFFFFu >> ((7 - (x & 7)) << 2) ;
+}
+
+// Replace the masked pixels of *w with the matching pixels of v
+static inline void swar_merge(uint32_t *w, uint32_t v, uint32_t m) {
+    *w = (*w & ~m) | (v & m) ;
+}
+
+// 0xF in every nibble of v that is non-zero, 0 elsewhere
+static inline uint32_t swar_nonzero(uint32_t v) {
+    v |= v >> 1 ;
+    v |= v >> 2 ;
+    return (v & SWAR_ONES) * 15 ;
+}
+
+// Spread 8 mask bits into 8 nibbles (bit i -> 0xF in nibble i)
+static inline uint32_t swar_spread(unsigned int b) {
+    uint32_t v = b & 0xFF ;
+    v = (v | (v << 12)) & 0x000F000Fu ;
+    v = (v | (v << 6)) & 0x03030303u ;
+    v = (v | (v << 3)) & SWAR_ONES ;
+    return v * 15 ;
+}
+
+// 8 bits of a 1-bit-per-pixel mask starting at bit s (bit 0 of byte 0 is
+// the first pixel). Bits before the start (s < 0) or past nbytes read as 0.
+static inline unsigned int swar_bits8(const unsigned char *bits, int s, int nbytes) {
+    if (s < 0) {
+        return (bits[0] << -s) & 0xFF ;
+    }
+    int i = s >> 3 ;
+    unsigned int v = bits[i] ;
+    if ((s & 7) && (i + 1 < nbytes)) {
+        v |= bits[i + 1] << 8 ;
+    }
+    return (v >> (s & 7)) & 0xFF ;
+}
+
+// 8 pixels of a packed 4-bit image starting at pixel s (same nibble order
+// as the screen). Pixels before the start (s < 0) or past nwords read as 0.
+static inline uint32_t swar_pixels8(const uint32_t *src, int s, int nwords) {
+    if (s < 0) {
+        return src[0] << (-s << 2) ;
+    }
+    int i = s >> 3 ;
+    int sh = (s & 7) << 2 ;
+    uint32_t v = src[i] >> sh ;
+    if (sh && (i + 1 < nwords)) {
+        v |= src[i + 1] << (32 - sh) ;
+    }
+    return v ;
+}
+
+// ==== kernels ====
+
+// Solid fill: pixels x0..x1-1 all become the color word cw
+static inline void swar_fill(uint32_t *row, int x0, int x1, uint32_t cw) {
+    uint32_t *w = row + (x0 >> 3) ;
+    uint32_t *last = row + ((x1 - 1) >> 3) ;
+    uint32_t m = swar_head_mask(x0) ;
+    if (w == last) {
+        swar_merge(w, cw, m & swar_tail_mask(x1 - 1)) ;
+        return ;
+    }
+    swar_merge(w++, cw, m) ;
+    while (w < last) {
+        *w++ = cw ;
+    }
+    swar_merge(w, cw, swar_tail_mask(x1 - 1)) ;
+}
+
+// Raster-op fill: every pixel of x0..x1-1 becomes (old & keep) ^ flip,
+// where keep and flip give each pixel's masks in its nibble. keep = 0 is a
+// plain fill with flip (use swar_fill for that, it skips the reads).
+static inline void swar_fill_rop(uint32_t *row, int x0, int x1, uint32_t keep, uint32_t flip) {
+    uint32_t *w = row + (x0 >> 3) ;
+    uint32_t *last = row + ((x1 - 1) >> 3) ;
+    uint32_t m = swar_head_mask(x0) ;
+    if (w == last) {
+        m &= swar_tail_mask(x1 - 1) ;
+        *w = (*w & (keep | ~m)) ^ (flip & m) ;
+        return ;
+    }
+    *w = (*w & (keep | ~m)) ^ (flip & m) ;
+    w++ ;
+    while (w < last) {
+        *w = (*w & keep) ^ flip ;
+        w++ ;
+    }
+    m = swar_tail_mask(x1 - 1) ;
+    *w = (*w & (keep | ~m)) ^ (flip & m) ;
+}
+
+// Masked fill: pixel x0+i becomes cw where bit b0+i of the 1-bit mask is
+// set, for i in 0..n-1. nbytes bounds the reads of bits.
+static inline void swar_fill_masked(uint32_t *row, int x0, int n, const unsigned char *bits,
+                                    int b0, int nbytes, uint32_t cw) {
+    int x1 = x0 + n ;
+    int k = x0 >> 3, k1 = (x1 - 1) >> 3 ;
+    int s = b0 + (k << 3) - x0 ;   // mask bit for the first pixel of word k
+    uint32_t *w = row + k ;
+    uint32_t edge = swar_head_mask(x0) ;
+    for (; k <= k1; k++, s += 8, w++) {
+        if (k == k1) edge &= swar_tail_mask(x1 - 1) ;
+        uint32_t m = swar_spread(swar_bits8(bits, s, nbytes)) & edge ;
+        if (m) swar_merge(w, cw, m) ;
+        edge = 0xFFFFFFFFu ;
+    }
+}
+
+// Color replace: pixels of x0..x1-1 equal to from become to
+static inline void swar_replace(uint32_t *row, int x0, int x1, unsigned char from, unsigned char to) {
+    uint32_t fw = swar_color(from), tw = swar_color(to) ;
+    int k = x0 >> 3, k1 = (x1 - 1) >> 3 ;
+    uint32_t *w = row + k ;
+    uint32_t edge = swar_head_mask(x0) ;
+    for (; k <= k1; k++, w++) {
+        if (k == k1) edge &= swar_tail_mask(x1 - 1) ;
+        uint32_t m = ~swar_nonzero(*w ^ fw) & edge ;
+        if (m) swar_merge(w, tw, m) ;
+        edge = 0xFFFFFFFFu ;
+    }
+}
+
+// Transparent-key compositing: pixel x0+i gets pixel s0+i of the packed
+// 4-bit image src unless that pixel is the key color, for i in 0..n-1.
+// nwords bounds the reads of src.
+static inline void swar_blit_key(uint32_t *row, int x0, int n, const uint32_t *src,
+                                 int s0, int nwords, unsigned char key) {
+    uint32_t kw = swar_color(key) ;
+    int x1 = x0 + n ;
+    int k = x0 >> 3, k1 = (x1 - 1) >> 3 ;
+    int s = s0 + (k << 3) - x0 ;
+    uint32_t *w = row + k ;
+    uint32_t edge = swar_head_mask(x0) ;
+    for (; k <= k1; k++, s += 8, w++) {
+        if (k == k1) edge &= swar_tail_mask(x1 - 1) ;
+        uint32_t v = swar_pixels8(src, s, nwords) ;
+        uint32_t m = swar_nonzero(v ^ kw) & edge ;
+        if (m) swar_merge(w, v, m) ;
+        edge = 0xFFFFFFFFu ;
+    }
+}
+
+// Copy: pixel x0+i gets pixel s0+i of the packed 4-bit image src, for
+// i in 0..n-1 (s0 - (x0&7) must be >= -7, which holds for any s0 >= 0).
+// When s0 and x0 sit at the same place in their words the whole words in
+// between are plain word copies; otherwise each is put together from two
+// source words. nwords bounds the reads of src. src and row must not
+// overlap - copy through a line buffer if they do.
+static inline void swar_copy(uint32_t *row, int x0, int n, const uint32_t *src,
+                             int s0, int nwords) {
+    int x1 = x0 + n ;
+    int k = x0 >> 3, k1 = (x1 - 1) >> 3 ;
+    int s = s0 + (k << 3) - x0 ;
+    uint32_t *w = row + k ;
+    uint32_t *last = row + k1 ;
+    uint32_t edge = swar_head_mask(x0) ;
+    if ((s & 7) == 0) {
+        const uint32_t *p = src + (s >> 3) ;
+        if (w == last) {
+            swar_merge(w, *p, edge & swar_tail_mask(x1 - 1)) ;
+            return ;
+        }
+        swar_merge(w++, *p++, edge) ;
+        while (w < last) {
+            *w++ = *p++ ;
+        }
+        swar_merge(w, *p, swar_tail_mask(x1 - 1)) ;
+        return ;
+    }
+    for (; k <= k1; k++, s += 8, w++) {
+        if (k == k1) edge &= swar_tail_mask(x1 - 1) ;
+        swar_merge(w, swar_pixels8(src, s, nwords), edge) ;
+        edge = 0xFFFFFFFFu ;
+    }
+}
+
+#endif